@@ -21,43 +21,240 @@ const dl_uint8_t *dl_errorString[] = {
 void dl_memcopy(void *destination, const void *source, dl_size_t size) {
 	(void) memmove(destination, source, size);
 }
+
+void dl_memcopy_noOverlap(void *destination, const void *source, const dl_size_t size) {
+	if (size) {
+		(void) memcpy(destination, source, size);
+	}
+}
+
+void dl_memclear(void *destination, dl_size_t size) {
+	(void) memset(destination, 0, size);
+}
 #else /* USE_STDLIB */
-void dl_memcopy(void *destination, const void *source, dl_size_t size) {
-	const dl_uint8_t *s;
-	if (destination > source) {
-		s = (dl_uint8_t*)source + size - 1;
-		for (dl_uint8_t *d = (dl_uint8_t*)destination + size - 1; s >= (dl_uint8_t *) source; --d, --s) {
-			*d = *s;
+
+#if defined(__GNUC__) || defined(__clang__)
+/* Without libc, blocks are moved a word or a vector at a time. These types may be loaded from any address and may alias
+   any other type. Targets without vector registers split blocks into words. */
+#define DL_WORD_WIDE
+typedef dl_size_t dl_word_t __attribute__((may_alias, aligned(1)));
+typedef dl_uint8_t dl_block_t __attribute__((vector_size(16), may_alias, aligned(1)));
+#endif
+
+#if defined(DL_WORD_WIDE) && (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+/* 32 byte blocks are only used if the CPU and the OS both support AVX2. */
+#define DL_AVX2
+typedef dl_uint8_t dl_block32_t __attribute__((vector_size(32), may_alias, aligned(1)));
+/* Copies of this size and larger are worth checking for AVX2. */
+#define DL_AVX2_THRESHOLD 128
+
+static dl_bool_t dl_hasAvx2(void) {
+	/* Every thread that races to fill this in computes the same answer. */
+	static int hasAvx2 = -1;
+	if (hasAvx2 < 0) {
+		unsigned int eax, ebx, ecx, edx;
+		int result = 0;
+		if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_OSXSAVE) && (ecx & bit_AVX)) {
+			unsigned int xcr0Low, xcr0High;
+			__asm__ ("xgetbv" : "=a" (xcr0Low), "=d" (xcr0High) : "c" (0));
+			(void) xcr0High;
+			/* The OS saves the SSE and AVX registers. */
+			if (((xcr0Low & 6) == 6)
+			    && __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)
+			    && (ebx & bit_AVX2)) {
+				result = 1;
+			}
 		}
+		hasAvx2 = result;
+	}
+	return hasAvx2;
+}
+
+__attribute__((target("avx2")))
+static dl_size_t dl_copyForward_avx2(dl_uint8_t *destination, const dl_uint8_t *source, dl_size_t size) {
+	dl_size_t i = 0;
+	for (; i + sizeof(dl_block32_t) <= size; i += sizeof(dl_block32_t)) {
+		*(dl_block32_t *) (destination + i) = *(const dl_block32_t *) (source + i);
+	}
+	return i;
+}
+
+__attribute__((target("avx2")))
+static dl_size_t dl_copyBackward_avx2(dl_uint8_t *destination, const dl_uint8_t *source, dl_size_t size) {
+	for (; size >= sizeof(dl_block32_t); size -= sizeof(dl_block32_t)) {
+		*(dl_block32_t *) (destination + size - sizeof(dl_block32_t))
+			= *(const dl_block32_t *) (source + size - sizeof(dl_block32_t));
+	}
+	return size;
+}
+
+__attribute__((target("avx2")))
+static dl_size_t dl_clear_avx2(dl_uint8_t *destination, dl_size_t size) {
+	const dl_block32_t zero = {0};
+	dl_size_t i = 0;
+	for (; i + sizeof(dl_block32_t) <= size; i += sizeof(dl_block32_t)) {
+		*(dl_block32_t *) (destination + i) = zero;
+	}
+	return i;
+}
+#endif /* DL_AVX2 */
+
+/* Copy from the lowest address up. Safe if `destination` is below `source`, since each block is read before the
+   block it overlaps is written. */
+static void dl_copyForward(dl_uint8_t *destination, const dl_uint8_t *source, dl_size_t size) {
+	dl_size_t i = 0;
+#ifdef DL_AVX2
+	if ((size >= DL_AVX2_THRESHOLD) && dl_hasAvx2()) {
+		i = dl_copyForward_avx2(destination, source, size);
+	}
+#endif /* DL_AVX2 */
+#ifdef DL_WORD_WIDE
+	for (; i + sizeof(dl_block_t) <= size; i += sizeof(dl_block_t)) {
+		*(dl_block_t *) (destination + i) = *(const dl_block_t *) (source + i);
+	}
+	for (; i + sizeof(dl_word_t) <= size; i += sizeof(dl_word_t)) {
+		*(dl_word_t *) (destination + i) = *(const dl_word_t *) (source + i);
+	}
+#endif /* DL_WORD_WIDE */
+	for (; i < size; i++) {
+		destination[i] = source[i];
+	}
+}
+
+/* Copy from the highest address down. Safe if `destination` is above `source`. */
+static void dl_copyBackward(dl_uint8_t *destination, const dl_uint8_t *source, dl_size_t size) {
+#ifdef DL_AVX2
+	if ((size >= DL_AVX2_THRESHOLD) && dl_hasAvx2()) {
+		size = dl_copyBackward_avx2(destination, source, size);
+	}
+#endif /* DL_AVX2 */
+#ifdef DL_WORD_WIDE
+	for (; size >= sizeof(dl_block_t); size -= sizeof(dl_block_t)) {
+		*(dl_block_t *) (destination + size - sizeof(dl_block_t))
+			= *(const dl_block_t *) (source + size - sizeof(dl_block_t));
+	}
+	for (; size >= sizeof(dl_word_t); size -= sizeof(dl_word_t)) {
+		*(dl_word_t *) (destination + size - sizeof(dl_word_t))
+			= *(const dl_word_t *) (source + size - sizeof(dl_word_t));
+	}
+#endif /* DL_WORD_WIDE */
+	while (size > 0) {
+		--size;
+		destination[size] = source[size];
 	}
-	else if (destination < source) {
-		s = source;
-		for (dl_uint8_t *d = destination; s < (dl_uint8_t *) source + size; d++, s++) {
-			*d = *s;
+}
+
+void dl_memcopy(void *destination, const void *source, dl_size_t size) {
+	if (destination < source) {
+		dl_copyForward(destination, source, size);
+	}
+	else if (destination > source) {
+		dl_copyBackward(destination, source, size);
+	}
+}
+
+void dl_memcopy_noOverlap(void *destination, const void *source, const dl_size_t size) {
+	dl_copyForward(destination, source, size);
+}
+
+void dl_memclear(void *destination, dl_size_t size) {
+	dl_uint8_t *d = destination;
+	dl_size_t i = 0;
+#ifdef DL_AVX2
+	if ((size >= DL_AVX2_THRESHOLD) && dl_hasAvx2()) {
+		i = dl_clear_avx2(d, size);
+	}
+#endif /* DL_AVX2 */
+#ifdef DL_WORD_WIDE
+	{
+		const dl_block_t zero = {0};
+		for (; i + sizeof(dl_block_t) <= size; i += sizeof(dl_block_t)) {
+			*(dl_block_t *) (d + i) = zero;
 		}
 	}
+	for (; i + sizeof(dl_word_t) <= size; i += sizeof(dl_word_t)) {
+		*(dl_word_t *) (d + i) = 0;
+	}
+#endif /* DL_WORD_WIDE */
+	for (; i < size; i++) {
+		d[i] = 0;
+	}
 }
 #endif /* USE_STDLIB */
 
-void dl_memcopy_noOverlap(void *destination, const void *source, const dl_size_t size) {
-	if (size) {
-		const dl_uint8_t *s;
-		s = source;
-		for (dl_uint8_t *d = destination; s < (dl_uint8_t *) source + size; d++, s++) {
-			*d = *s;
+#ifdef USE_STDLIB
+dl_bool_t dl_memequal(const void *left, const void *right, dl_size_t size) {
+	/* `memcmp` may not be passed null pointers, even with a size of 0. */
+	return (size == 0) || (memcmp(left, right, size) == 0);
+}
+#else /* USE_STDLIB */
+dl_bool_t dl_memequal(const void *left, const void *right, dl_size_t size) {
+	const dl_uint8_t *l = left;
+	const dl_uint8_t *r = right;
+	dl_size_t i = 0;
+	/* No branches inside a block, so the compiler is free to compare a whole block at once. */
+	for (; i + 16 <= size; i += 16) {
+		dl_uint8_t difference = 0;
+		for (dl_size_t j = 0; j < 16; j++) {
+			difference |= l[i + j] ^ r[i + j];
 		}
+		if (difference) return dl_false;
+	}
+	for (; i < size; i++) {
+		if (l[i] != r[i]) return dl_false;
 	}
+	return dl_true;
 }
+#endif /* USE_STDLIB */
 
 #ifdef USE_STDLIB
-void dl_memclear(void *destination, dl_size_t size) {
-	(void) memset(destination, 0, size);
+int dl_memorder(const void *left, const void *right, dl_size_t size) {
+	return (size == 0) ? 0 : memcmp(left, right, size);
+}
+
+dl_ptrdiff_t dl_memfind(const void *memory, dl_size_t size, dl_uint8_t byte) {
+	const dl_uint8_t *found = (size == 0) ? dl_null : memchr(memory, byte, size);
+	return (found == dl_null) ? -1 : found - (const dl_uint8_t *) memory;
 }
 #else /* USE_STDLIB */
-void dl_memclear(void *destination, dl_size_t size) {
-	for (dl_ptrdiff_t i = 0; (dl_size_t) i < size; i++) {
-		((dl_uint8_t *) destination)[i] = 0;
+int dl_memorder(const void *left, const void *right, dl_size_t size) {
+	const dl_uint8_t *l = left;
+	const dl_uint8_t *r = right;
+	dl_size_t i = 0;
+	/* Skip equal blocks the same way `dl_memequal` compares them, then find the byte that differs. */
+	for (; i + 16 <= size; i += 16) {
+		dl_uint8_t difference = 0;
+		for (dl_size_t j = 0; j < 16; j++) {
+			difference |= l[i + j] ^ r[i + j];
+		}
+		if (difference) break;
+	}
+	for (; i < size; i++) {
+		if (l[i] != r[i]) return (l[i] < r[i]) ? -1 : 1;
+	}
+	return 0;
+}
+
+dl_ptrdiff_t dl_memfind(const void *memory, dl_size_t size, dl_uint8_t byte) {
+	const dl_uint8_t *m = memory;
+	dl_size_t i = 0;
+#ifdef DL_WORD_WIDE
+	{
+		/* A word contains `byte` if XORing it with `byte` in every lane leaves a zero byte. */
+		const dl_size_t ones = ((dl_size_t) -1) / 0xFFU;
+		const dl_size_t highs = ones << 7;
+		const dl_size_t pattern = ones * byte;
+		for (; i + sizeof(dl_word_t) <= size; i += sizeof(dl_word_t)) {
+			dl_size_t word = *(const dl_word_t *) (m + i) ^ pattern;
+			if ((word - ones) & ~word & highs) break;
+		}
+	}
+#endif /* DL_WORD_WIDE */
+	for (; i < size; i++) {
+		if (m[i] == byte) return i;
 	}
+	return -1;
 }
 #endif /* USE_STDLIB */
 
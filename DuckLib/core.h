@@ -78,6 +78,12 @@ void DECLSPEC dl_memcopy(void *destination, const void *source, dl_size_t size);
 void DECLSPEC dl_memcopy_noOverlap(void *destination, const void *source, const dl_size_t size);
 
 void DECLSPEC dl_memclear(void *destination, dl_size_t size);
+/* Check if two blocks of memory hold the same bytes. */
+dl_bool_t DECLSPEC dl_memequal(const void *left, const void *right, dl_size_t size);
+/* Order two blocks of memory by their first differing byte. Returns a negative, zero, or positive number like `memcmp`. */
+int DECLSPEC dl_memorder(const void *left, const void *right, dl_size_t size);
+/* Return the index of the first `byte` in the block, or -1 if it isn't there. */
+dl_ptrdiff_t DECLSPEC dl_memfind(const void *memory, dl_size_t size, dl_uint8_t byte);
 
 void DECLSPEC dl_strlen(dl_size_t *length, const dl_uint8_t *string);
 #define DL_STR(DL_STR_string) ((dl_uint8_t *) DL_STR_string), (sizeof(DL_STR_string) - 1)
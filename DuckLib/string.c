@@ -427,24 +427,97 @@ void dl_string_compare(dl_bool_t *result,
                        const dl_size_t str1_length,
                        const dl_uint8_t *str2,
                        const dl_size_t str2_length) {
-	*result = dl_true;
-	if (str1_length != str2_length) {
-		*result = dl_false;
+	*result = (str1_length == str2_length) && dl_memequal(str1, str2, str1_length);
+}
+
+void dl_string_compare_partial(dl_bool_t *result, const dl_uint8_t *str1, const dl_uint8_t *str2, const dl_size_t length) {
+	*result = dl_memequal(str1, str2, length);
+}
+
+dl_ptrdiff_t dl_string_find(const dl_uint8_t *string,
+                            const dl_size_t string_length,
+                            const dl_uint8_t *pattern,
+                            const dl_size_t pattern_length) {
+	dl_size_t i = 0;
+	if (pattern_length == 0) return 0;
+	if (pattern_length > string_length) return -1;
+	/* Jump from one occurrence of the first byte to the next, then check the rest of the pattern. */
+	while (i + pattern_length <= string_length) {
+		dl_ptrdiff_t found = dl_memfind(&string[i], string_length - pattern_length + 1 - i, pattern[0]);
+		if (found < 0) return -1;
+		i += found;
+		if (dl_memequal(&string[i + 1], &pattern[1], pattern_length - 1)) return i;
+		i++;
 	}
-	else for (dl_ptrdiff_t i = 0; (dl_size_t) i < str1_length; i++) {
-		if (str1[i] != str2[i]) {
-			*result = dl_false;
-			break;
+	return -1;
+}
+
+dl_bool_t dl_string_isValidUtf8(const dl_uint8_t *string, const dl_size_t string_length) {
+	dl_size_t i = 0;
+	while (i < string_length) {
+		dl_uint8_t byte = string[i];
+		dl_uint8_t lower = 0x80;
+		dl_uint8_t upper = 0xBF;
+		dl_size_t continuation = 0;
+		if (i + 16 <= string_length) {
+			/* Skip a block of ASCII at once. */
+			dl_uint8_t high = 0;
+			for (dl_size_t j = 0; j < 16; j++) {
+				high |= string[i + j];
+			}
+			if (!(high & 0x80)) {
+				i += 16;
+				continue;
+			}
+		}
+		if (byte < 0x80) {
+			i++;
+			continue;
+		}
+		/* The second byte's range excludes overlong forms, surrogates, and codepoints above U+10FFFF. */
+		if ((byte >= 0xC2) && (byte <= 0xDF)) {
+			continuation = 1;
+		}
+		else if ((byte >= 0xE0) && (byte <= 0xEF)) {
+			continuation = 2;
+			if (byte == 0xE0) lower = 0xA0;
+			else if (byte == 0xED) upper = 0x9F;
 		}
+		else if ((byte >= 0xF0) && (byte <= 0xF4)) {
+			continuation = 3;
+			if (byte == 0xF0) lower = 0x90;
+			else if (byte == 0xF4) upper = 0x8F;
+		}
+		else {
+			return dl_false;
+		}
+		if (string_length - i <= continuation) return dl_false;
+		if ((string[i + 1] < lower) || (string[i + 1] > upper)) return dl_false;
+		for (dl_size_t k = 2; k <= continuation; k++) {
+			if ((string[i + k] & 0xC0) != 0x80) return dl_false;
+		}
+		i += continuation + 1;
 	}
+	return dl_true;
 }
 
-void dl_string_compare_partial(dl_bool_t *result, const dl_uint8_t *str1, const dl_uint8_t *str2, const dl_size_t length) {
-	*result = dl_true;
-	for (dl_ptrdiff_t i = 0; (dl_size_t) i < length; i++) {
-		if (str1[i] != str2[i]) {
-			*result = dl_false;
-			break;
-		}
+dl_size_t dl_string_utf8Length(const dl_uint8_t *string, const dl_size_t string_length) {
+	dl_size_t length = 0;
+	/* No branches, so the compiler is free to vectorize this. */
+	for (dl_size_t i = 0; i < string_length; i++) {
+		length += ((string[i] & 0xC0) != 0x80);
+	}
+	return length;
+}
+
+void dl_string_toLowerCase(dl_uint8_t *string, const dl_size_t string_length) {
+	for (dl_size_t i = 0; i < string_length; i++) {
+		string[i] += ((dl_uint8_t) (string[i] - 'A') < 26) << 5;
+	}
+}
+
+void dl_string_toUpperCase(dl_uint8_t *string, const dl_size_t string_length) {
+	for (dl_size_t i = 0; i < string_length; i++) {
+		string[i] -= ((dl_uint8_t) (string[i] - 'a') < 26) << 5;
 	}
 }
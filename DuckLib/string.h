@@ -28,6 +28,18 @@ void DECLSPEC dl_string_compare_partial(dl_bool_t *result,
                                         const dl_uint8_t *str2,
                                         const dl_size_t length);
 
+/* Return the index of the first occurrence of `pattern` in `string`, or -1 if there is none. */
+dl_ptrdiff_t DECLSPEC dl_string_find(const dl_uint8_t *string,
+                                     const dl_size_t string_length,
+                                     const dl_uint8_t *pattern,
+                                     const dl_size_t pattern_length);
+/* Check that `string` is well-formed UTF-8 as defined by RFC 3629. Overlong forms and surrogates are rejected. */
+dl_bool_t DECLSPEC dl_string_isValidUtf8(const dl_uint8_t *string, const dl_size_t string_length);
+/* Count the codepoints in UTF-8 `string`. Each byte that isn't a continuation byte starts one. */
+dl_size_t DECLSPEC dl_string_utf8Length(const dl_uint8_t *string, const dl_size_t string_length);
+/* Change the case of the ASCII letters in `string` in place. Other bytes are left alone. */
+void DECLSPEC dl_string_toLowerCase(dl_uint8_t *string, const dl_size_t string_length);
+void DECLSPEC dl_string_toUpperCase(dl_uint8_t *string, const dl_size_t string_length);
 #define dl_string_toLower(c) (((c >= 'A') && (c <= 'Z')) ? (c - 'A' + 'a') : c)
 #define dl_string_toUpper(c) (((c >= 'a') && (c <= 'z')) ? (c - 'a' + 'A') : c)
 
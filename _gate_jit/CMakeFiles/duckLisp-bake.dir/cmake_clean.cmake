@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/duckLisp-bake.dir/duckLisp-bake.c.o"
+  "CMakeFiles/duckLisp-bake.dir/duckLisp-bake.c.o.d"
+  "duckLisp-bake"
+  "duckLisp-bake.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/duckLisp-bake.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
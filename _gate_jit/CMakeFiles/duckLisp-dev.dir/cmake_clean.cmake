@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/duckLisp-dev.dir/duckLisp-dev.c.o"
+  "CMakeFiles/duckLisp-dev.dir/duckLisp-dev.c.o.d"
+  "duckLisp-dev"
+  "duckLisp-dev.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/duckLisp-dev.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
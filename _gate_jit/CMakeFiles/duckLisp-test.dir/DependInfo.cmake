@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/scratchwork/duckLisp-test.c" "CMakeFiles/duckLisp-test.dir/duckLisp-test.c.o" "gcc" "CMakeFiles/duckLisp-test.dir/duckLisp-test.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_jit/build-lisp/CMakeFiles/DuckLisp.dir/DependInfo.cmake"
+  "/root/repo/_gate_jit/build-lisp/CMakeFiles/DuckJit.dir/DependInfo.cmake"
+  "/root/repo/_gate_jit/build-lisp/CMakeFiles/DuckLib.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
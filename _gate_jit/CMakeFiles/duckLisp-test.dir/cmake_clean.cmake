@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/duckLisp-test.dir/duckLisp-test.c.o"
+  "CMakeFiles/duckLisp-test.dir/duckLisp-test.c.o.d"
+  "duckLisp-test"
+  "duckLisp-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/duckLisp-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/memory-dev.dir/memory-dev.c.o"
+  "CMakeFiles/memory-dev.dir/memory-dev.c.o.d"
+  "memory-dev"
+  "memory-dev.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/memory-dev.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
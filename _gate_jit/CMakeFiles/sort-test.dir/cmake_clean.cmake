@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sort-test.dir/sort-test.c.o"
+  "CMakeFiles/sort-test.dir/sort-test.c.o.d"
+  "sort-test"
+  "sort-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sort-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trie-dev.dir/trie-dev.c.o"
+  "CMakeFiles/trie-dev.dir/trie-dev.c.o.d"
+  "trie-dev"
+  "trie-dev.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/trie-dev.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/DuckJit.dir/jit.c.o"
+  "CMakeFiles/DuckJit.dir/jit.c.o.d"
+  "libDuckJit.a"
+  "libDuckJit.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/DuckJit.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
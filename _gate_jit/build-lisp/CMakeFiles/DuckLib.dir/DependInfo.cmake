@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/DuckLib/array.c" "build-lisp/CMakeFiles/DuckLib.dir/DuckLib/array.c.o" "gcc" "build-lisp/CMakeFiles/DuckLib.dir/DuckLib/array.c.o.d"
+  "/root/repo/DuckLib/core.c" "build-lisp/CMakeFiles/DuckLib.dir/DuckLib/core.c.o" "gcc" "build-lisp/CMakeFiles/DuckLib.dir/DuckLib/core.c.o.d"
+  "/root/repo/DuckLib/memory.c" "build-lisp/CMakeFiles/DuckLib.dir/DuckLib/memory.c.o" "gcc" "build-lisp/CMakeFiles/DuckLib.dir/DuckLib/memory.c.o.d"
+  "/root/repo/DuckLib/sort.c" "build-lisp/CMakeFiles/DuckLib.dir/DuckLib/sort.c.o" "gcc" "build-lisp/CMakeFiles/DuckLib.dir/DuckLib/sort.c.o.d"
+  "/root/repo/DuckLib/string.c" "build-lisp/CMakeFiles/DuckLib.dir/DuckLib/string.c.o" "gcc" "build-lisp/CMakeFiles/DuckLib.dir/DuckLib/string.c.o.d"
+  "/root/repo/DuckLib/trie.c" "build-lisp/CMakeFiles/DuckLib.dir/DuckLib/trie.c.o" "gcc" "build-lisp/CMakeFiles/DuckLib.dir/DuckLib/trie.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
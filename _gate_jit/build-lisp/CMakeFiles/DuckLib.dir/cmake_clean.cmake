@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/DuckLib.dir/DuckLib/array.c.o"
+  "CMakeFiles/DuckLib.dir/DuckLib/array.c.o.d"
+  "CMakeFiles/DuckLib.dir/DuckLib/core.c.o"
+  "CMakeFiles/DuckLib.dir/DuckLib/core.c.o.d"
+  "CMakeFiles/DuckLib.dir/DuckLib/memory.c.o"
+  "CMakeFiles/DuckLib.dir/DuckLib/memory.c.o.d"
+  "CMakeFiles/DuckLib.dir/DuckLib/sort.c.o"
+  "CMakeFiles/DuckLib.dir/DuckLib/sort.c.o.d"
+  "CMakeFiles/DuckLib.dir/DuckLib/string.c.o"
+  "CMakeFiles/DuckLib.dir/DuckLib/string.c.o.d"
+  "CMakeFiles/DuckLib.dir/DuckLib/trie.c.o"
+  "CMakeFiles/DuckLib.dir/DuckLib/trie.c.o.d"
+  "libDuckLib.a"
+  "libDuckLib.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/DuckLib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/assembler.c" "build-lisp/CMakeFiles/DuckLisp.dir/assembler.c.o" "gcc" "build-lisp/CMakeFiles/DuckLisp.dir/assembler.c.o.d"
+  "/root/repo/duckLisp.c" "build-lisp/CMakeFiles/DuckLisp.dir/duckLisp.c.o" "gcc" "build-lisp/CMakeFiles/DuckLisp.dir/duckLisp.c.o.d"
+  "/root/repo/duckVM.c" "build-lisp/CMakeFiles/DuckLisp.dir/duckVM.c.o" "gcc" "build-lisp/CMakeFiles/DuckLisp.dir/duckVM.c.o.d"
+  "/root/repo/emitters.c" "build-lisp/CMakeFiles/DuckLisp.dir/emitters.c.o" "gcc" "build-lisp/CMakeFiles/DuckLisp.dir/emitters.c.o.d"
+  "/root/repo/generators.c" "build-lisp/CMakeFiles/DuckLisp.dir/generators.c.o" "gcc" "build-lisp/CMakeFiles/DuckLisp.dir/generators.c.o.d"
+  "/root/repo/parenthesis-inferrer.c" "build-lisp/CMakeFiles/DuckLisp.dir/parenthesis-inferrer.c.o" "gcc" "build-lisp/CMakeFiles/DuckLisp.dir/parenthesis-inferrer.c.o.d"
+  "/root/repo/parser.c" "build-lisp/CMakeFiles/DuckLisp.dir/parser.c.o" "gcc" "build-lisp/CMakeFiles/DuckLisp.dir/parser.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_jit/build-lisp/CMakeFiles/DuckLib.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/DuckLisp.dir/assembler.c.o"
+  "CMakeFiles/DuckLisp.dir/assembler.c.o.d"
+  "CMakeFiles/DuckLisp.dir/duckLisp.c.o"
+  "CMakeFiles/DuckLisp.dir/duckLisp.c.o.d"
+  "CMakeFiles/DuckLisp.dir/duckVM.c.o"
+  "CMakeFiles/DuckLisp.dir/duckVM.c.o.d"
+  "CMakeFiles/DuckLisp.dir/emitters.c.o"
+  "CMakeFiles/DuckLisp.dir/emitters.c.o.d"
+  "CMakeFiles/DuckLisp.dir/generators.c.o"
+  "CMakeFiles/DuckLisp.dir/generators.c.o.d"
+  "CMakeFiles/DuckLisp.dir/parenthesis-inferrer.c.o"
+  "CMakeFiles/DuckLisp.dir/parenthesis-inferrer.c.o.d"
+  "CMakeFiles/DuckLisp.dir/parser.c.o"
+  "CMakeFiles/DuckLisp.dir/parser.c.o.d"
+  "libDuckLisp.a"
+  "libDuckLisp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/DuckLisp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -464,6 +464,8 @@ dl_error_t duckLisp_assemble(duckLisp_t *duckLisp,
 			args = &DL_ARRAY_GETADDRESS(instruction.args, duckLisp_instructionArgClass_t, 0);
 		}
 		dl_size_t byte_length;
+		/* Set instead of `currentInstruction.byte` by extended instructions. */
+		dl_size_t extendedOpcode = duckLisp_instruction_nop;
 
 		e = dl_array_clear(&currentArgs);
 		if (e) goto cleanup;
@@ -1257,6 +1259,125 @@ dl_error_t duckLisp_assemble(duckLisp_t *duckLisp,
 			}
 			break;
 		}
+		case duckLisp_instructionClass_mulInteger:
+		case duckLisp_instructionClass_mulFloat:
+		case duckLisp_instructionClass_divInteger:
+		case duckLisp_instructionClass_divFloat:
+		case duckLisp_instructionClass_addInteger:
+		case duckLisp_instructionClass_addFloat:
+		case duckLisp_instructionClass_subInteger:
+		case duckLisp_instructionClass_subFloat:
+		case duckLisp_instructionClass_equalInteger:
+		case duckLisp_instructionClass_equalFloat:
+		case duckLisp_instructionClass_greaterInteger:
+		case duckLisp_instructionClass_greaterFloat:
+		case duckLisp_instructionClass_lessInteger:
+		case duckLisp_instructionClass_lessFloat: {
+			dl_uint8_t specialized;
+			dl_uint8_t generic;
+			switch (instruction.instructionClass) {
+			case duckLisp_instructionClass_mulInteger:
+				specialized = duckLisp_instruction_mulInteger8;
+				generic = duckLisp_instruction_mul16;
+				break;
+			case duckLisp_instructionClass_mulFloat:
+				specialized = duckLisp_instruction_mulFloat8;
+				generic = duckLisp_instruction_mul16;
+				break;
+			case duckLisp_instructionClass_divInteger:
+				specialized = duckLisp_instruction_divInteger8;
+				generic = duckLisp_instruction_div16;
+				break;
+			case duckLisp_instructionClass_divFloat:
+				specialized = duckLisp_instruction_divFloat8;
+				generic = duckLisp_instruction_div16;
+				break;
+			case duckLisp_instructionClass_addInteger:
+				specialized = duckLisp_instruction_addInteger8;
+				generic = duckLisp_instruction_add16;
+				break;
+			case duckLisp_instructionClass_addFloat:
+				specialized = duckLisp_instruction_addFloat8;
+				generic = duckLisp_instruction_add16;
+				break;
+			case duckLisp_instructionClass_subInteger:
+				specialized = duckLisp_instruction_subInteger8;
+				generic = duckLisp_instruction_sub16;
+				break;
+			case duckLisp_instructionClass_subFloat:
+				specialized = duckLisp_instruction_subFloat8;
+				generic = duckLisp_instruction_sub16;
+				break;
+			case duckLisp_instructionClass_equalInteger:
+				specialized = duckLisp_instruction_equalInteger8;
+				generic = duckLisp_instruction_equal16;
+				break;
+			case duckLisp_instructionClass_equalFloat:
+				specialized = duckLisp_instruction_equalFloat8;
+				generic = duckLisp_instruction_equal16;
+				break;
+			case duckLisp_instructionClass_greaterInteger:
+				specialized = duckLisp_instruction_greaterInteger8;
+				generic = duckLisp_instruction_greater16;
+				break;
+			case duckLisp_instructionClass_greaterFloat:
+				specialized = duckLisp_instruction_greaterFloat8;
+				generic = duckLisp_instruction_greater16;
+				break;
+			case duckLisp_instructionClass_lessInteger:
+				specialized = duckLisp_instruction_lessInteger8;
+				generic = duckLisp_instruction_less16;
+				break;
+			case duckLisp_instructionClass_lessFloat:
+				specialized = duckLisp_instruction_lessFloat8;
+				generic = duckLisp_instruction_less16;
+				break;
+			default:
+				e = dl_error_shouldntHappen;
+				goto cleanup;
+			}
+			if ((args[0].type == duckLisp_instructionArgClass_type_index)
+			    && (args[1].type == duckLisp_instructionArgClass_type_index)) {
+				/* Only the 8 bit forms are specialized. Larger indices get the generic instructions, which must be
+				   ordered 16→32. */
+				if (((unsigned long) args[0].value.index < 0x100UL)
+				    && ((unsigned long) args[1].value.index < 0x100UL)) {
+					currentInstruction.byte = specialized;
+					byte_length = 1;
+				}
+				else if (((unsigned int) args[0].value.index < 0x10000UL)
+				         && ((unsigned int) args[1].value.index < 0x10000UL)) {
+					currentInstruction.byte = generic;
+					byte_length = 2;
+				}
+				else {
+					currentInstruction.byte = generic + 1;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, 2 * byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, byte_length + n) = ((args[1].value.index
+					                                                                  >> 8*(byte_length - n - 1))
+					                                                                 & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
 		case duckLisp_instructionClass_cons: {
 			if ((args[0].type == duckLisp_instructionArgClass_type_index)
 			    && (args[1].type == duckLisp_instructionArgClass_type_index)) {
@@ -1510,18 +1631,1649 @@ dl_error_t duckLisp_assemble(duckLisp_t *duckLisp,
 			}
 			break;
 		}
-		case duckLisp_instructionClass_cdr: {
+		case duckLisp_instructionClass_cdr: {
+			if (args[0].type == duckLisp_instructionArgClass_type_index) {
+				if ((unsigned long) args[0].value.index < 0x100UL) {
+					currentInstruction.byte = duckLisp_instruction_cdr8;
+					byte_length = 1;
+				}
+				else if ((unsigned int) args[0].value.index < 0x10000UL) {
+					currentInstruction.byte = duckLisp_instruction_cdr16;
+					byte_length = 2;
+				}
+				else {
+					currentInstruction.byte = duckLisp_instruction_cdr32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_setCar: {
+			if ((args[0].type == duckLisp_instructionArgClass_type_index)
+			    && (args[1].type == duckLisp_instructionArgClass_type_index)) {
+				if (((unsigned long) args[0].value.index < 0x100UL)
+				    && ((unsigned long) args[1].value.index < 0x100UL)) {
+					currentInstruction.byte = duckLisp_instruction_setCar8;
+					byte_length = 1;
+				}
+				else if (((unsigned int) args[0].value.index < 0x10000UL)
+				         && ((unsigned int) args[1].value.index < 0x10000UL)) {
+					currentInstruction.byte = duckLisp_instruction_setCar16;
+					byte_length = 2;
+				}
+				else {
+					currentInstruction.byte = duckLisp_instruction_setCar32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, 2 * byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, byte_length + n) = ((args[1].value.index
+					                                                                  >> 8*(byte_length - n - 1))
+					                                                                 & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_setCdr: {
+			if ((args[0].type == duckLisp_instructionArgClass_type_index)
+			    && (args[1].type == duckLisp_instructionArgClass_type_index)) {
+				if (((unsigned long) args[0].value.index < 0x100UL)
+				    && ((unsigned long) args[1].value.index < 0x100UL)) {
+					currentInstruction.byte = duckLisp_instruction_setCdr8;
+					byte_length = 1;
+				}
+				else if (((unsigned int) args[0].value.index < 0x10000UL)
+				         && ((unsigned int) args[1].value.index < 0x10000UL)) {
+					currentInstruction.byte = duckLisp_instruction_setCdr16;
+					byte_length = 2;
+				}
+				else {
+					currentInstruction.byte = duckLisp_instruction_setCdr32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, 2 * byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, byte_length + n) = ((args[1].value.index
+					                                                                  >> 8*(byte_length - n - 1))
+					                                                                 & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_nullp: {
+			if (args[0].type == duckLisp_instructionArgClass_type_index) {
+				if ((unsigned long) args[0].value.index < 0x100UL) {
+					currentInstruction.byte = duckLisp_instruction_nullp8;
+					byte_length = 1;
+				}
+				else if ((unsigned int) args[0].value.index < 0x10000UL) {
+					currentInstruction.byte = duckLisp_instruction_nullp16;
+					byte_length = 2;
+				}
+				else {
+					currentInstruction.byte = duckLisp_instruction_nullp32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_typeof: {
+			if (args[0].type == duckLisp_instructionArgClass_type_index) {
+				if ((unsigned long) args[0].value.index < 0x100UL) {
+					currentInstruction.byte = duckLisp_instruction_typeof8;
+					byte_length = 1;
+				}
+				else if ((unsigned int) args[0].value.index < 0x10000UL) {
+					currentInstruction.byte = duckLisp_instruction_typeof16;
+					byte_length = 2;
+				}
+				else {
+					currentInstruction.byte = duckLisp_instruction_typeof32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_makeType: {
+			currentInstruction.byte = duckLisp_instruction_makeType;
+			break;
+		}
+		case duckLisp_instructionClass_makeInstance: {
+			if (args[0].type == duckLisp_instructionArgClass_type_index) {
+				dl_ptrdiff_t index = 0;
+				if (((unsigned long) args[0].value.index < 0x100UL)
+				    && ((unsigned long) args[1].value.index < 0x100UL)
+				    && ((unsigned long) args[2].value.index < 0x100UL)) {
+					currentInstruction.byte = duckLisp_instruction_makeInstance8;
+					byte_length = 1;
+				}
+				else if (((unsigned int) args[0].value.index < 0x10000UL)
+				         && ((unsigned int) args[1].value.index < 0x10000UL)
+				         && ((unsigned int) args[2].value.index < 0x10000UL)) {
+					currentInstruction.byte = duckLisp_instruction_makeInstance16;
+					byte_length = 2;
+				}
+				else {
+					currentInstruction.byte = duckLisp_instruction_makeInstance32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, byte_length * instruction.args.elements_length);
+				if (e) goto cleanup;
+				DL_DOTIMES(n, byte_length) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, index + n) = ((args[0].value.index
+					                                                            >> 8*(byte_length - n - 1))
+					                                                           & 0xFFU);
+				}
+				index += byte_length;
+
+				DL_DOTIMES(n, byte_length) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, index + n) = ((args[1].value.index
+					                                                            >> 8*(byte_length - n - 1))
+					                                                           & 0xFFU);
+				}
+				index += byte_length;
+
+				DL_DOTIMES(n, byte_length) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, index + n) = ((args[2].value.index
+					                                                            >> 8*(byte_length - n - 1))
+					                                                           & 0xFFU);
+				}
+				index += byte_length;
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_compositeValue: {
+			if (args[0].type == duckLisp_instructionArgClass_type_index) {
+				dl_ptrdiff_t index = 0;
+				if ((unsigned long) args[0].value.index < 0x100UL) {
+					currentInstruction.byte = duckLisp_instruction_compositeValue8;
+					byte_length = 1;
+				}
+				else if ((unsigned int) args[0].value.index < 0x10000UL) {
+					currentInstruction.byte = duckLisp_instruction_compositeValue16;
+					byte_length = 2;
+				}
+				else {
+					currentInstruction.byte = duckLisp_instruction_compositeValue32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, byte_length * instruction.args.elements_length);
+				if (e) goto cleanup;
+				DL_DOTIMES(n, byte_length) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, index + n) = ((args[0].value.index
+					                                                            >> 8*(byte_length - n - 1))
+					                                                           & 0xFFU);
+				}
+				index += byte_length;
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_compositeFunction: {
+			if (args[0].type == duckLisp_instructionArgClass_type_index) {
+				dl_ptrdiff_t index = 0;
+				if ((unsigned long) args[0].value.index < 0x100UL) {
+					currentInstruction.byte = duckLisp_instruction_compositeFunction8;
+					byte_length = 1;
+				}
+				else if ((unsigned int) args[0].value.index < 0x10000UL) {
+					currentInstruction.byte = duckLisp_instruction_compositeFunction16;
+					byte_length = 2;
+				}
+				else {
+					currentInstruction.byte = duckLisp_instruction_compositeFunction32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, byte_length * instruction.args.elements_length);
+				if (e) goto cleanup;
+				DL_DOTIMES(n, byte_length) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, index + n) = ((args[0].value.index
+					                                                            >> 8*(byte_length - n - 1))
+					                                                           & 0xFFU);
+				}
+				index += byte_length;
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_setCompositeValue: {
+			if ((args[0].type == duckLisp_instructionArgClass_type_index)
+			    && (args[1].type == duckLisp_instructionArgClass_type_index)) {
+				if (((unsigned long) args[0].value.index < 0x100UL)
+				    && ((unsigned long) args[1].value.index < 0x100UL)) {
+					currentInstruction.byte = duckLisp_instruction_setCompositeValue8;
+					byte_length = 1;
+				}
+				else if (((unsigned int) args[0].value.index < 0x10000UL)
+				         && ((unsigned int) args[1].value.index < 0x10000UL)) {
+					currentInstruction.byte = duckLisp_instruction_setCompositeValue16;
+					byte_length = 2;
+				}
+				else {
+					currentInstruction.byte = duckLisp_instruction_setCompositeValue32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, 2 * byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, byte_length + n) = ((args[1].value.index
+					                                                                  >> 8*(byte_length - n - 1))
+					                                                                 & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_setCompositeFunction: {
+			if ((args[0].type == duckLisp_instructionArgClass_type_index)
+			    && (args[1].type == duckLisp_instructionArgClass_type_index)) {
+				if (((unsigned long) args[0].value.index < 0x100UL)
+				    && ((unsigned long) args[1].value.index < 0x100UL)) {
+					currentInstruction.byte = duckLisp_instruction_setCompositeFunction8;
+					byte_length = 1;
+				}
+				else if (((unsigned int) args[0].value.index < 0x10000UL)
+				         && ((unsigned int) args[1].value.index < 0x10000UL)) {
+					currentInstruction.byte = duckLisp_instruction_setCompositeFunction16;
+					byte_length = 2;
+				}
+				else {
+					currentInstruction.byte = duckLisp_instruction_setCompositeFunction32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, 2 * byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, byte_length + n) = ((args[1].value.index
+					                                                                  >> 8*(byte_length - n - 1))
+					                                                                 & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_length: {
+			if (args[0].type == duckLisp_instructionArgClass_type_index) {
+				if ((unsigned long) args[0].value.index < 0x100UL) {
+					currentInstruction.byte = duckLisp_instruction_length8;
+					byte_length = 1;
+				}
+				else if ((unsigned int) args[0].value.index < 0x10000UL) {
+					currentInstruction.byte = duckLisp_instruction_length16;
+					byte_length = 2;
+				}
+				else {
+					currentInstruction.byte = duckLisp_instruction_length32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_symbolString: {
+			if (args[0].type == duckLisp_instructionArgClass_type_index) {
+				if ((unsigned long) args[0].value.index < 0x100UL) {
+					currentInstruction.byte = duckLisp_instruction_symbolString8;
+					byte_length = 1;
+				}
+				else if ((unsigned int) args[0].value.index < 0x10000UL) {
+					currentInstruction.byte = duckLisp_instruction_symbolString16;
+					byte_length = 2;
+				}
+				else {
+					currentInstruction.byte = duckLisp_instruction_symbolString32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_symbolId: {
+			if (args[0].type == duckLisp_instructionArgClass_type_index) {
+				if ((unsigned long) args[0].value.index < 0x100UL) {
+					currentInstruction.byte = duckLisp_instruction_symbolId8;
+					byte_length = 1;
+				}
+				else if ((unsigned int) args[0].value.index < 0x10000UL) {
+					currentInstruction.byte = duckLisp_instruction_symbolId16;
+					byte_length = 2;
+				}
+				else {
+					currentInstruction.byte = duckLisp_instruction_symbolId32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_makeCoroutine: {
+			if (args[0].type == duckLisp_instructionArgClass_type_index) {
+				if ((unsigned long) args[0].value.index < 0x100UL) {
+					currentInstruction.byte = duckLisp_instruction_makeCoroutine8;
+					byte_length = 1;
+				}
+				else if ((unsigned int) args[0].value.index < 0x10000UL) {
+					currentInstruction.byte = duckLisp_instruction_makeCoroutine16;
+					byte_length = 2;
+				}
+				else {
+					currentInstruction.byte = duckLisp_instruction_makeCoroutine32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_resume: {
+			if ((args[0].type == duckLisp_instructionArgClass_type_index)
+			    && (args[1].type == duckLisp_instructionArgClass_type_index)) {
+				if (((unsigned long) args[0].value.index < 0x100UL)
+				    && ((unsigned long) args[1].value.index < 0x100UL)) {
+					currentInstruction.byte = duckLisp_instruction_resume8;
+					byte_length = 1;
+				}
+				else if (((unsigned int) args[0].value.index < 0x10000UL)
+				         && ((unsigned int) args[1].value.index < 0x10000UL)) {
+					currentInstruction.byte = duckLisp_instruction_resume16;
+					byte_length = 2;
+				}
+				else {
+					currentInstruction.byte = duckLisp_instruction_resume32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, 2 * byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, byte_length + n) = ((args[1].value.index
+					                                                                  >> 8*(byte_length - n - 1))
+					                                                                 & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_yield: {
+			if (args[0].type == duckLisp_instructionArgClass_type_index) {
+				if ((unsigned long) args[0].value.index < 0x100UL) {
+					currentInstruction.byte = duckLisp_instruction_yield8;
+					byte_length = 1;
+				}
+				else if ((unsigned int) args[0].value.index < 0x10000UL) {
+					currentInstruction.byte = duckLisp_instruction_yield16;
+					byte_length = 2;
+				}
+				else {
+					currentInstruction.byte = duckLisp_instruction_yield32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_coroutineDonep: {
+			if (args[0].type == duckLisp_instructionArgClass_type_index) {
+				if ((unsigned long) args[0].value.index < 0x100UL) {
+					currentInstruction.byte = duckLisp_instruction_coroutineDonep8;
+					byte_length = 1;
+				}
+				else if ((unsigned int) args[0].value.index < 0x10000UL) {
+					currentInstruction.byte = duckLisp_instruction_coroutineDonep16;
+					byte_length = 2;
+				}
+				else {
+					currentInstruction.byte = duckLisp_instruction_coroutineDonep32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_send: {
+			if ((args[0].type == duckLisp_instructionArgClass_type_index)
+			    && (args[1].type == duckLisp_instructionArgClass_type_index)) {
+				if (((unsigned long) args[0].value.index < 0x100UL)
+				    && ((unsigned long) args[1].value.index < 0x100UL)) {
+					currentInstruction.byte = duckLisp_instruction_send8;
+					byte_length = 1;
+				}
+				else if (((unsigned int) args[0].value.index < 0x10000UL)
+				         && ((unsigned int) args[1].value.index < 0x10000UL)) {
+					currentInstruction.byte = duckLisp_instruction_send16;
+					byte_length = 2;
+				}
+				else {
+					currentInstruction.byte = duckLisp_instruction_send32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, 2 * byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, byte_length + n) = ((args[1].value.index
+					                                                                  >> 8*(byte_length - n - 1))
+					                                                                 & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_receive: {
+			if (args[0].type == duckLisp_instructionArgClass_type_index) {
+				if ((unsigned long) args[0].value.index < 0x100UL) {
+					currentInstruction.byte = duckLisp_instruction_receive8;
+					byte_length = 1;
+				}
+				else if ((unsigned int) args[0].value.index < 0x10000UL) {
+					currentInstruction.byte = duckLisp_instruction_receive16;
+					byte_length = 2;
+				}
+				else {
+					currentInstruction.byte = duckLisp_instruction_receive32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_tryReceive: {
+			if ((args[0].type == duckLisp_instructionArgClass_type_index)
+			    && (args[1].type == duckLisp_instructionArgClass_type_index)) {
+				if (((unsigned long) args[0].value.index < 0x100UL)
+				    && ((unsigned long) args[1].value.index < 0x100UL)) {
+					currentInstruction.byte = duckLisp_instruction_tryReceive8;
+					byte_length = 1;
+				}
+				else if (((unsigned int) args[0].value.index < 0x10000UL)
+				         && ((unsigned int) args[1].value.index < 0x10000UL)) {
+					currentInstruction.byte = duckLisp_instruction_tryReceive16;
+					byte_length = 2;
+				}
+				else {
+					currentInstruction.byte = duckLisp_instruction_tryReceive32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, 2 * byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, byte_length + n) = ((args[1].value.index
+					                                                                  >> 8*(byte_length - n - 1))
+					                                                                 & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_freeze: {
+			if (args[0].type == duckLisp_instructionArgClass_type_index) {
+				if ((unsigned long) args[0].value.index < 0x100UL) {
+					currentInstruction.byte = duckLisp_instruction_freeze8;
+					byte_length = 1;
+				}
+				else if ((unsigned int) args[0].value.index < 0x10000UL) {
+					currentInstruction.byte = duckLisp_instruction_freeze16;
+					byte_length = 2;
+				}
+				else {
+					currentInstruction.byte = duckLisp_instruction_freeze32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_parallelMap: {
+			if ((args[0].type == duckLisp_instructionArgClass_type_index)
+			    && (args[1].type == duckLisp_instructionArgClass_type_index)) {
+				if (((unsigned long) args[0].value.index < 0x100UL)
+				    && ((unsigned long) args[1].value.index < 0x100UL)) {
+					currentInstruction.byte = duckLisp_instruction_parallelMap8;
+					byte_length = 1;
+				}
+				else if (((unsigned int) args[0].value.index < 0x10000UL)
+				         && ((unsigned int) args[1].value.index < 0x10000UL)) {
+					currentInstruction.byte = duckLisp_instruction_parallelMap16;
+					byte_length = 2;
+				}
+				else {
+					currentInstruction.byte = duckLisp_instruction_parallelMap32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, 2 * byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, byte_length + n) = ((args[1].value.index
+					                                                                  >> 8*(byte_length - n - 1))
+					                                                                 & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_makeHashTable: {
+			currentInstruction.byte = duckLisp_instruction_makeHashTable;
+			break;
+		}
+		case duckLisp_instructionClass_hashTableGet: {
+			if ((args[0].type == duckLisp_instructionArgClass_type_index)
+			    && (args[1].type == duckLisp_instructionArgClass_type_index)
+			    && (args[2].type == duckLisp_instructionArgClass_type_index)) {
+				dl_ptrdiff_t index = 0;
+				if (((unsigned long) args[0].value.index < 0x100UL)
+				    && ((unsigned long) args[1].value.index < 0x100UL)
+				    && ((unsigned long) args[2].value.index < 0x100UL)) {
+					currentInstruction.byte = duckLisp_instruction_hashTableGet8;
+					byte_length = 1;
+				}
+				else if (((unsigned int) args[0].value.index < 0x10000UL)
+				         && ((unsigned int) args[1].value.index < 0x10000UL)
+				         && ((unsigned int) args[2].value.index < 0x10000UL)) {
+					currentInstruction.byte = duckLisp_instruction_hashTableGet16;
+					byte_length = 2;
+				}
+				else {
+					currentInstruction.byte = duckLisp_instruction_hashTableGet32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, byte_length * instruction.args.elements_length);
+				if (e) goto cleanup;
+				DL_DOTIMES(n, byte_length) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, index + n) = ((args[0].value.index
+					                                                            >> 8*(byte_length - n - 1))
+					                                                           & 0xFFU);
+				}
+				index += byte_length;
+
+				DL_DOTIMES(n, byte_length) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, index + n) = ((args[1].value.index
+					                                                            >> 8*(byte_length - n - 1))
+					                                                           & 0xFFU);
+				}
+				index += byte_length;
+
+				DL_DOTIMES(n, byte_length) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, index + n) = ((args[2].value.index
+					                                                            >> 8*(byte_length - n - 1))
+					                                                           & 0xFFU);
+				}
+				index += byte_length;
+				break;
+			}
+			else {
+				e = dl_error_invalidValue;
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) e = eError;
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_hashTableSet: {
+			if ((args[0].type == duckLisp_instructionArgClass_type_index)
+			    && (args[1].type == duckLisp_instructionArgClass_type_index)
+			    && (args[2].type == duckLisp_instructionArgClass_type_index)) {
+				dl_ptrdiff_t index = 0;
+				if (((unsigned long) args[0].value.index < 0x100UL)
+				    && ((unsigned long) args[1].value.index < 0x100UL)
+				    && ((unsigned long) args[2].value.index < 0x100UL)) {
+					currentInstruction.byte = duckLisp_instruction_hashTableSet8;
+					byte_length = 1;
+				}
+				else if (((unsigned int) args[0].value.index < 0x10000UL)
+				         && ((unsigned int) args[1].value.index < 0x10000UL)
+				         && ((unsigned int) args[2].value.index < 0x10000UL)) {
+					currentInstruction.byte = duckLisp_instruction_hashTableSet16;
+					byte_length = 2;
+				}
+				else {
+					currentInstruction.byte = duckLisp_instruction_hashTableSet32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, byte_length * instruction.args.elements_length);
+				if (e) goto cleanup;
+				DL_DOTIMES(n, byte_length) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, index + n) = ((args[0].value.index
+					                                                            >> 8*(byte_length - n - 1))
+					                                                           & 0xFFU);
+				}
+				index += byte_length;
+
+				DL_DOTIMES(n, byte_length) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, index + n) = ((args[1].value.index
+					                                                            >> 8*(byte_length - n - 1))
+					                                                           & 0xFFU);
+				}
+				index += byte_length;
+
+				DL_DOTIMES(n, byte_length) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, index + n) = ((args[2].value.index
+					                                                            >> 8*(byte_length - n - 1))
+					                                                           & 0xFFU);
+				}
+				index += byte_length;
+				break;
+			}
+			else {
+				e = dl_error_invalidValue;
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) e = eError;
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_hashTableDelete: {
+			if ((args[0].type == duckLisp_instructionArgClass_type_index)
+			    && (args[1].type == duckLisp_instructionArgClass_type_index)) {
+				if (((unsigned long) args[0].value.index < 0x100UL)
+				    && ((unsigned long) args[1].value.index < 0x100UL)) {
+					currentInstruction.byte = duckLisp_instruction_hashTableDelete8;
+					byte_length = 1;
+				}
+				else if (((unsigned int) args[0].value.index < 0x10000UL)
+				         && ((unsigned int) args[1].value.index < 0x10000UL)) {
+					currentInstruction.byte = duckLisp_instruction_hashTableDelete16;
+					byte_length = 2;
+				}
+				else {
+					currentInstruction.byte = duckLisp_instruction_hashTableDelete32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, 2 * byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, byte_length + n) = ((args[1].value.index
+					                                                                  >> 8*(byte_length - n - 1))
+					                                                                 & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_hashTableNext: {
+			if ((args[0].type == duckLisp_instructionArgClass_type_index)
+			    && (args[1].type == duckLisp_instructionArgClass_type_index)) {
+				if (((unsigned long) args[0].value.index < 0x100UL)
+				    && ((unsigned long) args[1].value.index < 0x100UL)) {
+					currentInstruction.byte = duckLisp_instruction_hashTableNext8;
+					byte_length = 1;
+				}
+				else if (((unsigned int) args[0].value.index < 0x10000UL)
+				         && ((unsigned int) args[1].value.index < 0x10000UL)) {
+					currentInstruction.byte = duckLisp_instruction_hashTableNext16;
+					byte_length = 2;
+				}
+				else {
+					currentInstruction.byte = duckLisp_instruction_hashTableNext32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, 2 * byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, byte_length + n) = ((args[1].value.index
+					                                                                  >> 8*(byte_length - n - 1))
+					                                                                 & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_vectorPush: {
+			if ((args[0].type == duckLisp_instructionArgClass_type_index)
+			    && (args[1].type == duckLisp_instructionArgClass_type_index)) {
+				if (((unsigned long) args[0].value.index < 0x100UL)
+				    && ((unsigned long) args[1].value.index < 0x100UL)) {
+					currentInstruction.byte = duckLisp_instruction_vectorPush8;
+					byte_length = 1;
+				}
+				else if (((unsigned int) args[0].value.index < 0x10000UL)
+				         && ((unsigned int) args[1].value.index < 0x10000UL)) {
+					currentInstruction.byte = duckLisp_instruction_vectorPush16;
+					byte_length = 2;
+				}
+				else {
+					currentInstruction.byte = duckLisp_instruction_vectorPush32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, 2 * byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, byte_length + n) = ((args[1].value.index
+					                                                                  >> 8*(byte_length - n - 1))
+					                                                                 & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_vectorPop: {
+			if (args[0].type == duckLisp_instructionArgClass_type_index) {
+				if ((unsigned long) args[0].value.index < 0x100UL) {
+					currentInstruction.byte = duckLisp_instruction_vectorPop8;
+					byte_length = 1;
+				}
+				else if ((unsigned int) args[0].value.index < 0x10000UL) {
+					currentInstruction.byte = duckLisp_instruction_vectorPop16;
+					byte_length = 2;
+				}
+				else {
+					currentInstruction.byte = duckLisp_instruction_vectorPop32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_vectorTruncate: {
+			if ((args[0].type == duckLisp_instructionArgClass_type_index)
+			    && (args[1].type == duckLisp_instructionArgClass_type_index)) {
+				if (((unsigned long) args[0].value.index < 0x100UL)
+				    && ((unsigned long) args[1].value.index < 0x100UL)) {
+					currentInstruction.byte = duckLisp_instruction_vectorTruncate8;
+					byte_length = 1;
+				}
+				else if (((unsigned int) args[0].value.index < 0x10000UL)
+				         && ((unsigned int) args[1].value.index < 0x10000UL)) {
+					currentInstruction.byte = duckLisp_instruction_vectorTruncate16;
+					byte_length = 2;
+				}
+				else {
+					currentInstruction.byte = duckLisp_instruction_vectorTruncate32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, 2 * byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, byte_length + n) = ((args[1].value.index
+					                                                                  >> 8*(byte_length - n - 1))
+					                                                                 & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_makeStringBuilder: {
+			currentInstruction.byte = duckLisp_instruction_makeStringBuilder;
+			break;
+		}
+		case duckLisp_instructionClass_stringBuilderAppend: {
+			if ((args[0].type == duckLisp_instructionArgClass_type_index)
+			    && (args[1].type == duckLisp_instructionArgClass_type_index)) {
+				if (((unsigned long) args[0].value.index < 0x100UL)
+				    && ((unsigned long) args[1].value.index < 0x100UL)) {
+					currentInstruction.byte = duckLisp_instruction_stringBuilderAppend8;
+					byte_length = 1;
+				}
+				else if (((unsigned int) args[0].value.index < 0x10000UL)
+				         && ((unsigned int) args[1].value.index < 0x10000UL)) {
+					currentInstruction.byte = duckLisp_instruction_stringBuilderAppend16;
+					byte_length = 2;
+				}
+				else {
+					currentInstruction.byte = duckLisp_instruction_stringBuilderAppend32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, 2 * byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, byte_length + n) = ((args[1].value.index
+					                                                                  >> 8*(byte_length - n - 1))
+					                                                                 & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_stringSearch: {
+			if ((args[0].type == duckLisp_instructionArgClass_type_index)
+			    && (args[1].type == duckLisp_instructionArgClass_type_index)
+			    && (args[2].type == duckLisp_instructionArgClass_type_index)) {
+				dl_ptrdiff_t index = 0;
+				if (((unsigned long) args[0].value.index < 0x100UL)
+				    && ((unsigned long) args[1].value.index < 0x100UL)
+				    && ((unsigned long) args[2].value.index < 0x100UL)) {
+					extendedOpcode = duckLisp_instruction_stringSearch8;
+					byte_length = 1;
+				}
+				else if (((unsigned int) args[0].value.index < 0x10000UL)
+				         && ((unsigned int) args[1].value.index < 0x10000UL)
+				         && ((unsigned int) args[2].value.index < 0x10000UL)) {
+					extendedOpcode = duckLisp_instruction_stringSearch16;
+					byte_length = 2;
+				}
+				else {
+					extendedOpcode = duckLisp_instruction_stringSearch32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, byte_length * instruction.args.elements_length);
+				if (e) goto cleanup;
+				DL_DOTIMES(n, byte_length) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, index + n) = ((args[0].value.index
+					                                                            >> 8*(byte_length - n - 1))
+					                                                           & 0xFFU);
+				}
+				index += byte_length;
+
+				DL_DOTIMES(n, byte_length) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, index + n) = ((args[1].value.index
+					                                                            >> 8*(byte_length - n - 1))
+					                                                           & 0xFFU);
+				}
+				index += byte_length;
+
+				DL_DOTIMES(n, byte_length) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, index + n) = ((args[2].value.index
+					                                                            >> 8*(byte_length - n - 1))
+					                                                           & 0xFFU);
+				}
+				index += byte_length;
+				break;
+			}
+			else {
+				e = dl_error_invalidValue;
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) e = eError;
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_stringCompare: {
+			if ((args[0].type == duckLisp_instructionArgClass_type_index)
+			    && (args[1].type == duckLisp_instructionArgClass_type_index)) {
+				if (((unsigned long) args[0].value.index < 0x100UL)
+				    && ((unsigned long) args[1].value.index < 0x100UL)) {
+					extendedOpcode = duckLisp_instruction_stringCompare8;
+					byte_length = 1;
+				}
+				else if (((unsigned int) args[0].value.index < 0x10000UL)
+				         && ((unsigned int) args[1].value.index < 0x10000UL)) {
+					extendedOpcode = duckLisp_instruction_stringCompare16;
+					byte_length = 2;
+				}
+				else {
+					extendedOpcode = duckLisp_instruction_stringCompare32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, 2 * byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, byte_length + n) = ((args[1].value.index
+					                                                                  >> 8*(byte_length - n - 1))
+					                                                                 & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_utf8Validp: {
+			if (args[0].type == duckLisp_instructionArgClass_type_index) {
+				if ((unsigned long) args[0].value.index < 0x100UL) {
+					extendedOpcode = duckLisp_instruction_utf8Validp8;
+					byte_length = 1;
+				}
+				else if ((unsigned int) args[0].value.index < 0x10000UL) {
+					extendedOpcode = duckLisp_instruction_utf8Validp16;
+					byte_length = 2;
+				}
+				else {
+					extendedOpcode = duckLisp_instruction_utf8Validp32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_utf8Length: {
+			if (args[0].type == duckLisp_instructionArgClass_type_index) {
+				if ((unsigned long) args[0].value.index < 0x100UL) {
+					extendedOpcode = duckLisp_instruction_utf8Length8;
+					byte_length = 1;
+				}
+				else if ((unsigned int) args[0].value.index < 0x10000UL) {
+					extendedOpcode = duckLisp_instruction_utf8Length16;
+					byte_length = 2;
+				}
+				else {
+					extendedOpcode = duckLisp_instruction_utf8Length32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_stringUpcase: {
+			if (args[0].type == duckLisp_instructionArgClass_type_index) {
+				if ((unsigned long) args[0].value.index < 0x100UL) {
+					extendedOpcode = duckLisp_instruction_stringUpcase8;
+					byte_length = 1;
+				}
+				else if ((unsigned int) args[0].value.index < 0x10000UL) {
+					extendedOpcode = duckLisp_instruction_stringUpcase16;
+					byte_length = 2;
+				}
+				else {
+					extendedOpcode = duckLisp_instruction_stringUpcase32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_stringDowncase: {
+			if (args[0].type == duckLisp_instructionArgClass_type_index) {
+				if ((unsigned long) args[0].value.index < 0x100UL) {
+					extendedOpcode = duckLisp_instruction_stringDowncase8;
+					byte_length = 1;
+				}
+				else if ((unsigned int) args[0].value.index < 0x10000UL) {
+					extendedOpcode = duckLisp_instruction_stringDowncase16;
+					byte_length = 2;
+				}
+				else {
+					extendedOpcode = duckLisp_instruction_stringDowncase32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_makeTypedArray: {
+			if ((args[0].type == duckLisp_instructionArgClass_type_index)
+			    && (args[1].type == duckLisp_instructionArgClass_type_index)) {
+				if (((unsigned long) args[0].value.index < 0x100UL)
+				    && ((unsigned long) args[1].value.index < 0x100UL)) {
+					extendedOpcode = duckLisp_instruction_makeTypedArray8;
+					byte_length = 1;
+				}
+				else if (((unsigned int) args[0].value.index < 0x10000UL)
+				         && ((unsigned int) args[1].value.index < 0x10000UL)) {
+					extendedOpcode = duckLisp_instruction_makeTypedArray16;
+					byte_length = 2;
+				}
+				else {
+					extendedOpcode = duckLisp_instruction_makeTypedArray32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, 2 * byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, byte_length + n) = ((args[1].value.index
+					                                                                  >> 8*(byte_length - n - 1))
+					                                                                 & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_typedArraySum: {
+			if (args[0].type == duckLisp_instructionArgClass_type_index) {
+				if ((unsigned long) args[0].value.index < 0x100UL) {
+					extendedOpcode = duckLisp_instruction_typedArraySum8;
+					byte_length = 1;
+				}
+				else if ((unsigned int) args[0].value.index < 0x10000UL) {
+					extendedOpcode = duckLisp_instruction_typedArraySum16;
+					byte_length = 2;
+				}
+				else {
+					extendedOpcode = duckLisp_instruction_typedArraySum32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_typedArrayDot: {
+			if ((args[0].type == duckLisp_instructionArgClass_type_index)
+			    && (args[1].type == duckLisp_instructionArgClass_type_index)) {
+				if (((unsigned long) args[0].value.index < 0x100UL)
+				    && ((unsigned long) args[1].value.index < 0x100UL)) {
+					extendedOpcode = duckLisp_instruction_typedArrayDot8;
+					byte_length = 1;
+				}
+				else if (((unsigned int) args[0].value.index < 0x10000UL)
+				         && ((unsigned int) args[1].value.index < 0x10000UL)) {
+					extendedOpcode = duckLisp_instruction_typedArrayDot16;
+					byte_length = 2;
+				}
+				else {
+					extendedOpcode = duckLisp_instruction_typedArrayDot32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, 2 * byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, byte_length + n) = ((args[1].value.index
+					                                                                  >> 8*(byte_length - n - 1))
+					                                                                 & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_typedArrayScale: {
+			if ((args[0].type == duckLisp_instructionArgClass_type_index)
+			    && (args[1].type == duckLisp_instructionArgClass_type_index)) {
+				if (((unsigned long) args[0].value.index < 0x100UL)
+				    && ((unsigned long) args[1].value.index < 0x100UL)) {
+					extendedOpcode = duckLisp_instruction_typedArrayScale8;
+					byte_length = 1;
+				}
+				else if (((unsigned int) args[0].value.index < 0x10000UL)
+				         && ((unsigned int) args[1].value.index < 0x10000UL)) {
+					extendedOpcode = duckLisp_instruction_typedArrayScale16;
+					byte_length = 2;
+				}
+				else {
+					extendedOpcode = duckLisp_instruction_typedArrayScale32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, 2 * byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, byte_length + n) = ((args[1].value.index
+					                                                                  >> 8*(byte_length - n - 1))
+					                                                                 & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_typedArrayAdd: {
+			if ((args[0].type == duckLisp_instructionArgClass_type_index)
+			    && (args[1].type == duckLisp_instructionArgClass_type_index)) {
+				if (((unsigned long) args[0].value.index < 0x100UL)
+				    && ((unsigned long) args[1].value.index < 0x100UL)) {
+					extendedOpcode = duckLisp_instruction_typedArrayAdd8;
+					byte_length = 1;
+				}
+				else if (((unsigned int) args[0].value.index < 0x10000UL)
+				         && ((unsigned int) args[1].value.index < 0x10000UL)) {
+					extendedOpcode = duckLisp_instruction_typedArrayAdd16;
+					byte_length = 2;
+				}
+				else {
+					extendedOpcode = duckLisp_instruction_typedArrayAdd32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, 2 * byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, byte_length + n) = ((args[1].value.index
+					                                                                  >> 8*(byte_length - n - 1))
+					                                                                 & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_typedArrayMul: {
+			if ((args[0].type == duckLisp_instructionArgClass_type_index)
+			    && (args[1].type == duckLisp_instructionArgClass_type_index)) {
+				if (((unsigned long) args[0].value.index < 0x100UL)
+				    && ((unsigned long) args[1].value.index < 0x100UL)) {
+					extendedOpcode = duckLisp_instruction_typedArrayMul8;
+					byte_length = 1;
+				}
+				else if (((unsigned int) args[0].value.index < 0x10000UL)
+				         && ((unsigned int) args[1].value.index < 0x10000UL)) {
+					extendedOpcode = duckLisp_instruction_typedArrayMul16;
+					byte_length = 2;
+				}
+				else {
+					extendedOpcode = duckLisp_instruction_typedArrayMul32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, 2 * byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, byte_length + n) = ((args[1].value.index
+					                                                                  >> 8*(byte_length - n - 1))
+					                                                                 & 0xFFU);
+				}
+				break;
+			}
+			else {
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) {
+					e = eError;
+				}
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_typedArrayMin: {
 			if (args[0].type == duckLisp_instructionArgClass_type_index) {
 				if ((unsigned long) args[0].value.index < 0x100UL) {
-					currentInstruction.byte = duckLisp_instruction_cdr8;
+					extendedOpcode = duckLisp_instruction_typedArrayMin8;
 					byte_length = 1;
 				}
 				else if ((unsigned int) args[0].value.index < 0x10000UL) {
-					currentInstruction.byte = duckLisp_instruction_cdr16;
+					extendedOpcode = duckLisp_instruction_typedArrayMin16;
 					byte_length = 2;
 				}
 				else {
-					currentInstruction.byte = duckLisp_instruction_cdr32;
+					extendedOpcode = duckLisp_instruction_typedArrayMin32;
 					byte_length = 4;
 				}
 				e = dl_array_pushElements(&currentArgs, dl_null, byte_length);
@@ -1543,24 +3295,21 @@ dl_error_t duckLisp_assemble(duckLisp_t *duckLisp,
 			}
 			break;
 		}
-		case duckLisp_instructionClass_setCar: {
-			if ((args[0].type == duckLisp_instructionArgClass_type_index)
-			    && (args[1].type == duckLisp_instructionArgClass_type_index)) {
-				if (((unsigned long) args[0].value.index < 0x100UL)
-				    && ((unsigned long) args[1].value.index < 0x100UL)) {
-					currentInstruction.byte = duckLisp_instruction_setCar8;
+		case duckLisp_instructionClass_typedArrayMax: {
+			if (args[0].type == duckLisp_instructionArgClass_type_index) {
+				if ((unsigned long) args[0].value.index < 0x100UL) {
+					extendedOpcode = duckLisp_instruction_typedArrayMax8;
 					byte_length = 1;
 				}
-				else if (((unsigned int) args[0].value.index < 0x10000UL)
-				         && ((unsigned int) args[1].value.index < 0x10000UL)) {
-					currentInstruction.byte = duckLisp_instruction_setCar16;
+				else if ((unsigned int) args[0].value.index < 0x10000UL) {
+					extendedOpcode = duckLisp_instruction_typedArrayMax16;
 					byte_length = 2;
 				}
 				else {
-					currentInstruction.byte = duckLisp_instruction_setCar32;
+					extendedOpcode = duckLisp_instruction_typedArrayMax32;
 					byte_length = 4;
 				}
-				e = dl_array_pushElements(&currentArgs, dl_null, 2 * byte_length);
+				e = dl_array_pushElements(&currentArgs, dl_null, byte_length);
 				if (e) {
 					goto cleanup;
 				}
@@ -1568,11 +3317,6 @@ dl_error_t duckLisp_assemble(duckLisp_t *duckLisp,
 					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
 					                                                   & 0xFFU);
 				}
-				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
-					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, byte_length + n) = ((args[1].value.index
-					                                                                  >> 8*(byte_length - n - 1))
-					                                                                 & 0xFFU);
-				}
 				break;
 			}
 			else {
@@ -1584,21 +3328,21 @@ dl_error_t duckLisp_assemble(duckLisp_t *duckLisp,
 			}
 			break;
 		}
-		case duckLisp_instructionClass_setCdr: {
+		case duckLisp_instructionClass_makeRecord: {
 			if ((args[0].type == duckLisp_instructionArgClass_type_index)
 			    && (args[1].type == duckLisp_instructionArgClass_type_index)) {
 				if (((unsigned long) args[0].value.index < 0x100UL)
 				    && ((unsigned long) args[1].value.index < 0x100UL)) {
-					currentInstruction.byte = duckLisp_instruction_setCdr8;
+					extendedOpcode = duckLisp_instruction_makeRecord8;
 					byte_length = 1;
 				}
 				else if (((unsigned int) args[0].value.index < 0x10000UL)
 				         && ((unsigned int) args[1].value.index < 0x10000UL)) {
-					currentInstruction.byte = duckLisp_instruction_setCdr16;
+					extendedOpcode = duckLisp_instruction_makeRecord16;
 					byte_length = 2;
 				}
 				else {
-					currentInstruction.byte = duckLisp_instruction_setCdr32;
+					extendedOpcode = duckLisp_instruction_makeRecord32;
 					byte_length = 4;
 				}
 				e = dl_array_pushElements(&currentArgs, dl_null, 2 * byte_length);
@@ -1625,21 +3369,24 @@ dl_error_t duckLisp_assemble(duckLisp_t *duckLisp,
 			}
 			break;
 		}
-		case duckLisp_instructionClass_nullp: {
-			if (args[0].type == duckLisp_instructionArgClass_type_index) {
-				if ((unsigned long) args[0].value.index < 0x100UL) {
-					currentInstruction.byte = duckLisp_instruction_nullp8;
+		case duckLisp_instructionClass_recordSlot: {
+			if ((args[0].type == duckLisp_instructionArgClass_type_index)
+			    && (args[1].type == duckLisp_instructionArgClass_type_integer)) {
+				if (((unsigned long) args[0].value.index < 0x100UL)
+				    && ((unsigned long) args[1].value.integer < 0x100UL)) {
+					extendedOpcode = duckLisp_instruction_recordSlot8;
 					byte_length = 1;
 				}
-				else if ((unsigned int) args[0].value.index < 0x10000UL) {
-					currentInstruction.byte = duckLisp_instruction_nullp16;
+				else if (((unsigned int) args[0].value.index < 0x10000UL)
+				         && ((unsigned int) args[1].value.integer < 0x10000UL)) {
+					extendedOpcode = duckLisp_instruction_recordSlot16;
 					byte_length = 2;
 				}
 				else {
-					currentInstruction.byte = duckLisp_instruction_nullp32;
+					extendedOpcode = duckLisp_instruction_recordSlot32;
 					byte_length = 4;
 				}
-				e = dl_array_pushElements(&currentArgs, dl_null, byte_length);
+				e = dl_array_pushElements(&currentArgs, dl_null, 2 * byte_length);
 				if (e) {
 					goto cleanup;
 				}
@@ -1647,38 +3394,10 @@ dl_error_t duckLisp_assemble(duckLisp_t *duckLisp,
 					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
 					                                                   & 0xFFU);
 				}
-				break;
-			}
-			else {
-				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
-				if (eError) {
-					e = eError;
-				}
-				goto cleanup;
-			}
-			break;
-		}
-		case duckLisp_instructionClass_typeof: {
-			if (args[0].type == duckLisp_instructionArgClass_type_index) {
-				if ((unsigned long) args[0].value.index < 0x100UL) {
-					currentInstruction.byte = duckLisp_instruction_typeof8;
-					byte_length = 1;
-				}
-				else if ((unsigned int) args[0].value.index < 0x10000UL) {
-					currentInstruction.byte = duckLisp_instruction_typeof16;
-					byte_length = 2;
-				}
-				else {
-					currentInstruction.byte = duckLisp_instruction_typeof32;
-					byte_length = 4;
-				}
-				e = dl_array_pushElements(&currentArgs, dl_null, byte_length);
-				if (e) {
-					goto cleanup;
-				}
 				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
-					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
-					                                                   & 0xFFU);
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, byte_length + n) = ((args[1].value.integer
+					                                                                  >> 8*(byte_length - n - 1))
+					                                                                 & 0xFFU);
 				}
 				break;
 			}
@@ -1691,27 +3410,25 @@ dl_error_t duckLisp_assemble(duckLisp_t *duckLisp,
 			}
 			break;
 		}
-		case duckLisp_instructionClass_makeType: {
-			currentInstruction.byte = duckLisp_instruction_makeType;
-			break;
-		}
-		case duckLisp_instructionClass_makeInstance: {
-			if (args[0].type == duckLisp_instructionArgClass_type_index) {
+		case duckLisp_instructionClass_setRecordSlot: {
+			if ((args[0].type == duckLisp_instructionArgClass_type_index)
+			    && (args[1].type == duckLisp_instructionArgClass_type_integer)
+			    && (args[2].type == duckLisp_instructionArgClass_type_index)) {
 				dl_ptrdiff_t index = 0;
 				if (((unsigned long) args[0].value.index < 0x100UL)
-				    && ((unsigned long) args[1].value.index < 0x100UL)
+				    && ((unsigned long) args[1].value.integer < 0x100UL)
 				    && ((unsigned long) args[2].value.index < 0x100UL)) {
-					currentInstruction.byte = duckLisp_instruction_makeInstance8;
+					extendedOpcode = duckLisp_instruction_setRecordSlot8;
 					byte_length = 1;
 				}
 				else if (((unsigned int) args[0].value.index < 0x10000UL)
-				         && ((unsigned int) args[1].value.index < 0x10000UL)
+				         && ((unsigned int) args[1].value.integer < 0x10000UL)
 				         && ((unsigned int) args[2].value.index < 0x10000UL)) {
-					currentInstruction.byte = duckLisp_instruction_makeInstance16;
+					extendedOpcode = duckLisp_instruction_setRecordSlot16;
 					byte_length = 2;
 				}
 				else {
-					currentInstruction.byte = duckLisp_instruction_makeInstance32;
+					extendedOpcode = duckLisp_instruction_setRecordSlot32;
 					byte_length = 4;
 				}
 				e = dl_array_pushElements(&currentArgs, dl_null, byte_length * instruction.args.elements_length);
@@ -1724,7 +3441,7 @@ dl_error_t duckLisp_assemble(duckLisp_t *duckLisp,
 				index += byte_length;
 
 				DL_DOTIMES(n, byte_length) {
-					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, index + n) = ((args[1].value.index
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, index + n) = ((args[1].value.integer
 					                                                            >> 8*(byte_length - n - 1))
 					                                                           & 0xFFU);
 				}
@@ -1738,6 +3455,38 @@ dl_error_t duckLisp_assemble(duckLisp_t *duckLisp,
 				index += byte_length;
 				break;
 			}
+			else {
+				e = dl_error_invalidValue;
+				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
+				if (eError) e = eError;
+				goto cleanup;
+			}
+			break;
+		}
+		case duckLisp_instructionClass_pushQuoted: {
+			if (args[0].type == duckLisp_instructionArgClass_type_integer) {
+				if ((unsigned long) args[0].value.integer < 0x100UL) {
+					extendedOpcode = duckLisp_instruction_pushQuoted8;
+					byte_length = 1;
+				}
+				else if ((unsigned int) args[0].value.integer < 0x10000UL) {
+					extendedOpcode = duckLisp_instruction_pushQuoted16;
+					byte_length = 2;
+				}
+				else {
+					extendedOpcode = duckLisp_instruction_pushQuoted32;
+					byte_length = 4;
+				}
+				e = dl_array_pushElements(&currentArgs, dl_null, byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.integer >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				break;
+			}
 			else {
 				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
 				if (eError) {
@@ -1747,29 +3496,36 @@ dl_error_t duckLisp_assemble(duckLisp_t *duckLisp,
 			}
 			break;
 		}
-		case duckLisp_instructionClass_compositeValue: {
-			if (args[0].type == duckLisp_instructionArgClass_type_index) {
-				dl_ptrdiff_t index = 0;
-				if ((unsigned long) args[0].value.index < 0x100UL) {
-					currentInstruction.byte = duckLisp_instruction_compositeValue8;
+		case duckLisp_instructionClass_setQuoted: {
+			if ((args[0].type == duckLisp_instructionArgClass_type_index)
+			    && (args[1].type == duckLisp_instructionArgClass_type_integer)) {
+				if (((unsigned long) args[0].value.index < 0x100UL)
+				    && ((unsigned long) args[1].value.integer < 0x100UL)) {
+					extendedOpcode = duckLisp_instruction_setQuoted8;
 					byte_length = 1;
 				}
-				else if ((unsigned int) args[0].value.index < 0x10000UL) {
-					currentInstruction.byte = duckLisp_instruction_compositeValue16;
+				else if (((unsigned int) args[0].value.index < 0x10000UL)
+				         && ((unsigned int) args[1].value.integer < 0x10000UL)) {
+					extendedOpcode = duckLisp_instruction_setQuoted16;
 					byte_length = 2;
 				}
 				else {
-					currentInstruction.byte = duckLisp_instruction_compositeValue32;
+					extendedOpcode = duckLisp_instruction_setQuoted32;
 					byte_length = 4;
 				}
-				e = dl_array_pushElements(&currentArgs, dl_null, byte_length * instruction.args.elements_length);
-				if (e) goto cleanup;
-				DL_DOTIMES(n, byte_length) {
-					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, index + n) = ((args[0].value.index
-					                                                            >> 8*(byte_length - n - 1))
-					                                                           & 0xFFU);
+				e = dl_array_pushElements(&currentArgs, dl_null, 2 * byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, byte_length + n) = ((args[1].value.integer
+					                                                                  >> 8*(byte_length - n - 1))
+					                                                                 & 0xFFU);
 				}
-				index += byte_length;
 				break;
 			}
 			else {
@@ -1781,29 +3537,36 @@ dl_error_t duckLisp_assemble(duckLisp_t *duckLisp,
 			}
 			break;
 		}
-		case duckLisp_instructionClass_compositeFunction: {
-			if (args[0].type == duckLisp_instructionArgClass_type_index) {
-				dl_ptrdiff_t index = 0;
-				if ((unsigned long) args[0].value.index < 0x100UL) {
-					currentInstruction.byte = duckLisp_instruction_compositeFunction8;
+		case duckLisp_instructionClass_nth: {
+			if ((args[0].type == duckLisp_instructionArgClass_type_index)
+			    && (args[1].type == duckLisp_instructionArgClass_type_index)) {
+				if (((unsigned long) args[0].value.index < 0x100UL)
+				    && ((unsigned long) args[1].value.index < 0x100UL)) {
+					extendedOpcode = duckLisp_instruction_nth8;
 					byte_length = 1;
 				}
-				else if ((unsigned int) args[0].value.index < 0x10000UL) {
-					currentInstruction.byte = duckLisp_instruction_compositeFunction16;
+				else if (((unsigned int) args[0].value.index < 0x10000UL)
+				         && ((unsigned int) args[1].value.index < 0x10000UL)) {
+					extendedOpcode = duckLisp_instruction_nth16;
 					byte_length = 2;
 				}
 				else {
-					currentInstruction.byte = duckLisp_instruction_compositeFunction32;
+					extendedOpcode = duckLisp_instruction_nth32;
 					byte_length = 4;
 				}
-				e = dl_array_pushElements(&currentArgs, dl_null, byte_length * instruction.args.elements_length);
-				if (e) goto cleanup;
-				DL_DOTIMES(n, byte_length) {
-					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, index + n) = ((args[0].value.index
-					                                                            >> 8*(byte_length - n - 1))
-					                                                           & 0xFFU);
+				e = dl_array_pushElements(&currentArgs, dl_null, 2 * byte_length);
+				if (e) {
+					goto cleanup;
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
+					                                                   & 0xFFU);
+				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, byte_length + n) = ((args[1].value.index
+					                                                                  >> 8*(byte_length - n - 1))
+					                                                                 & 0xFFU);
 				}
-				index += byte_length;
 				break;
 			}
 			else {
@@ -1815,21 +3578,21 @@ dl_error_t duckLisp_assemble(duckLisp_t *duckLisp,
 			}
 			break;
 		}
-		case duckLisp_instructionClass_setCompositeValue: {
+		case duckLisp_instructionClass_nthcdr: {
 			if ((args[0].type == duckLisp_instructionArgClass_type_index)
 			    && (args[1].type == duckLisp_instructionArgClass_type_index)) {
 				if (((unsigned long) args[0].value.index < 0x100UL)
 				    && ((unsigned long) args[1].value.index < 0x100UL)) {
-					currentInstruction.byte = duckLisp_instruction_setCompositeValue8;
+					extendedOpcode = duckLisp_instruction_nthcdr8;
 					byte_length = 1;
 				}
 				else if (((unsigned int) args[0].value.index < 0x10000UL)
 				         && ((unsigned int) args[1].value.index < 0x10000UL)) {
-					currentInstruction.byte = duckLisp_instruction_setCompositeValue16;
+					extendedOpcode = duckLisp_instruction_nthcdr16;
 					byte_length = 2;
 				}
 				else {
-					currentInstruction.byte = duckLisp_instruction_setCompositeValue32;
+					extendedOpcode = duckLisp_instruction_nthcdr32;
 					byte_length = 4;
 				}
 				e = dl_array_pushElements(&currentArgs, dl_null, 2 * byte_length);
@@ -1856,21 +3619,21 @@ dl_error_t duckLisp_assemble(duckLisp_t *duckLisp,
 			}
 			break;
 		}
-		case duckLisp_instructionClass_setCompositeFunction: {
+		case duckLisp_instructionClass_append: {
 			if ((args[0].type == duckLisp_instructionArgClass_type_index)
 			    && (args[1].type == duckLisp_instructionArgClass_type_index)) {
 				if (((unsigned long) args[0].value.index < 0x100UL)
 				    && ((unsigned long) args[1].value.index < 0x100UL)) {
-					currentInstruction.byte = duckLisp_instruction_setCompositeFunction8;
+					extendedOpcode = duckLisp_instruction_append8;
 					byte_length = 1;
 				}
 				else if (((unsigned int) args[0].value.index < 0x10000UL)
 				         && ((unsigned int) args[1].value.index < 0x10000UL)) {
-					currentInstruction.byte = duckLisp_instruction_setCompositeFunction16;
+					extendedOpcode = duckLisp_instruction_append16;
 					byte_length = 2;
 				}
 				else {
-					currentInstruction.byte = duckLisp_instruction_setCompositeFunction32;
+					extendedOpcode = duckLisp_instruction_append32;
 					byte_length = 4;
 				}
 				e = dl_array_pushElements(&currentArgs, dl_null, 2 * byte_length);
@@ -1897,18 +3660,18 @@ dl_error_t duckLisp_assemble(duckLisp_t *duckLisp,
 			}
 			break;
 		}
-		case duckLisp_instructionClass_length: {
+		case duckLisp_instructionClass_reverse: {
 			if (args[0].type == duckLisp_instructionArgClass_type_index) {
 				if ((unsigned long) args[0].value.index < 0x100UL) {
-					currentInstruction.byte = duckLisp_instruction_length8;
+					extendedOpcode = duckLisp_instruction_reverse8;
 					byte_length = 1;
 				}
 				else if ((unsigned int) args[0].value.index < 0x10000UL) {
-					currentInstruction.byte = duckLisp_instruction_length16;
+					extendedOpcode = duckLisp_instruction_reverse16;
 					byte_length = 2;
 				}
 				else {
-					currentInstruction.byte = duckLisp_instruction_length32;
+					extendedOpcode = duckLisp_instruction_reverse32;
 					byte_length = 4;
 				}
 				e = dl_array_pushElements(&currentArgs, dl_null, byte_length);
@@ -1930,21 +3693,24 @@ dl_error_t duckLisp_assemble(duckLisp_t *duckLisp,
 			}
 			break;
 		}
-		case duckLisp_instructionClass_symbolString: {
-			if (args[0].type == duckLisp_instructionArgClass_type_index) {
-				if ((unsigned long) args[0].value.index < 0x100UL) {
-					currentInstruction.byte = duckLisp_instruction_symbolString8;
+		case duckLisp_instructionClass_assoc: {
+			if ((args[0].type == duckLisp_instructionArgClass_type_index)
+			    && (args[1].type == duckLisp_instructionArgClass_type_index)) {
+				if (((unsigned long) args[0].value.index < 0x100UL)
+				    && ((unsigned long) args[1].value.index < 0x100UL)) {
+					extendedOpcode = duckLisp_instruction_assoc8;
 					byte_length = 1;
 				}
-				else if ((unsigned int) args[0].value.index < 0x10000UL) {
-					currentInstruction.byte = duckLisp_instruction_symbolString16;
+				else if (((unsigned int) args[0].value.index < 0x10000UL)
+				         && ((unsigned int) args[1].value.index < 0x10000UL)) {
+					extendedOpcode = duckLisp_instruction_assoc16;
 					byte_length = 2;
 				}
 				else {
-					currentInstruction.byte = duckLisp_instruction_symbolString32;
+					extendedOpcode = duckLisp_instruction_assoc32;
 					byte_length = 4;
 				}
-				e = dl_array_pushElements(&currentArgs, dl_null, byte_length);
+				e = dl_array_pushElements(&currentArgs, dl_null, 2 * byte_length);
 				if (e) {
 					goto cleanup;
 				}
@@ -1952,6 +3718,11 @@ dl_error_t duckLisp_assemble(duckLisp_t *duckLisp,
 					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
 					                                                   & 0xFFU);
 				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, byte_length + n) = ((args[1].value.index
+					                                                                  >> 8*(byte_length - n - 1))
+					                                                                 & 0xFFU);
+				}
 				break;
 			}
 			else {
@@ -1963,21 +3734,24 @@ dl_error_t duckLisp_assemble(duckLisp_t *duckLisp,
 			}
 			break;
 		}
-		case duckLisp_instructionClass_symbolId: {
-			if (args[0].type == duckLisp_instructionArgClass_type_index) {
-				if ((unsigned long) args[0].value.index < 0x100UL) {
-					currentInstruction.byte = duckLisp_instruction_symbolId8;
+		case duckLisp_instructionClass_member: {
+			if ((args[0].type == duckLisp_instructionArgClass_type_index)
+			    && (args[1].type == duckLisp_instructionArgClass_type_index)) {
+				if (((unsigned long) args[0].value.index < 0x100UL)
+				    && ((unsigned long) args[1].value.index < 0x100UL)) {
+					extendedOpcode = duckLisp_instruction_member8;
 					byte_length = 1;
 				}
-				else if ((unsigned int) args[0].value.index < 0x10000UL) {
-					currentInstruction.byte = duckLisp_instruction_symbolId16;
+				else if (((unsigned int) args[0].value.index < 0x10000UL)
+				         && ((unsigned int) args[1].value.index < 0x10000UL)) {
+					extendedOpcode = duckLisp_instruction_member16;
 					byte_length = 2;
 				}
 				else {
-					currentInstruction.byte = duckLisp_instruction_symbolId32;
+					extendedOpcode = duckLisp_instruction_member32;
 					byte_length = 4;
 				}
-				e = dl_array_pushElements(&currentArgs, dl_null, byte_length);
+				e = dl_array_pushElements(&currentArgs, dl_null, 2 * byte_length);
 				if (e) {
 					goto cleanup;
 				}
@@ -1985,6 +3759,11 @@ dl_error_t duckLisp_assemble(duckLisp_t *duckLisp,
 					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, n) = ((args[0].value.index >> 8*(byte_length - n - 1))
 					                                                   & 0xFFU);
 				}
+				for (dl_ptrdiff_t n = 0; (dl_size_t) n < byte_length; n++) {
+					DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, byte_length + n) = ((args[1].value.index
+					                                                                  >> 8*(byte_length - n - 1))
+					                                                                 & 0xFFU);
+				}
 				break;
 			}
 			else {
@@ -2193,6 +3972,10 @@ dl_error_t duckLisp_assemble(duckLisp_t *duckLisp,
 					                                                    >> 8*(byte_length - n - 1))
 					                                                   & 0xFFU);
 				}
+				// Arity
+				e = dl_array_pushElement(&currentArgs, dl_null);
+				if (e) goto cleanup;
+				DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, byte_length) = args[1].value.integer & 0xFFU;
 				break;
 			default:
 				eError = duckLisp_error_pushRuntime(duckLisp, DL_STR("Invalid argument class. Aborting."));
@@ -2529,6 +4312,17 @@ dl_error_t duckLisp_assemble(duckLisp_t *duckLisp,
 		}
 		}
 
+		if (extendedOpcode != duckLisp_instruction_nop) {
+			/* The low byte of the extended opcode is written as if it were the first byte of the arguments. */
+			currentInstruction.byte = duckLisp_instruction_extended;
+			e = dl_array_pushElement(&currentArgs, dl_null);
+			if (e) goto cleanup;
+			for (dl_ptrdiff_t k = currentArgs.elements_length - 1; k > 0; --k) {
+				DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, k) = DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, k - 1);
+			}
+			DL_ARRAY_GETADDRESS(currentArgs, dl_uint8_t, 0) = extendedOpcode & 0xFFU;
+		}
+
 		/* Write instruction to linked list of bytecode. */
 		if (bytecodeList.elements_length > 0) {
 			DL_ARRAY_GETTOPADDRESS(bytecodeList, byteLink_t).next = bytecodeList.elements_length;
@@ -2846,6 +4640,328 @@ dl_error_t duckLisp_assemble(duckLisp_t *duckLisp,
 }
 
 
+/* Instruction formats used by the disassembler, keyed by opcode. Extended opcodes are offset by
+   `duckLisp_instruction_extendedFirst`. After the name, `1`, `2`, and `4` are integer operands of that many bytes, `f` is
+   an eight byte float, and `s`, `v`, and `V` followed by an operand number are a string of that many bytes, that many
+   operands the size of that operand, and that many four byte operands. */
+static const struct {
+	const dl_uint16_t opcode;
+	dl_uint8_t *format;
+	const dl_size_t format_length;
+} duckLisp_disassembler_templates[] = {
+	{duckLisp_instruction_nop, DL_STR("nop")},
+	{duckLisp_instruction_pushString8, DL_STR("string.8 1 s0")},
+	{duckLisp_instruction_pushString16, DL_STR("string.16 2 s0")},
+	{duckLisp_instruction_pushString32, DL_STR("string.32 4 s0")},
+	{duckLisp_instruction_pushSymbol8, DL_STR("symbol.8 1 1 s1")},
+	{duckLisp_instruction_pushSymbol16, DL_STR("symbol.16 2 2 s1")},
+	{duckLisp_instruction_pushSymbol32, DL_STR("symbol.32 4 4 s1")},
+	{duckLisp_instruction_pushStrippedSymbol8, DL_STR("stripped-symbol.8 1 1 s1")},
+	{duckLisp_instruction_pushStrippedSymbol16, DL_STR("stripped-symbol.16 2 2 s1")},
+	{duckLisp_instruction_pushStrippedSymbol32, DL_STR("stripped-symbol.32 4 4 s1")},
+	{duckLisp_instruction_pushBooleanFalse, DL_STR("false")},
+	{duckLisp_instruction_pushBooleanTrue, DL_STR("true")},
+	{duckLisp_instruction_pushInteger8, DL_STR("integer.8 1")},
+	{duckLisp_instruction_pushInteger16, DL_STR("integer.16 2")},
+	{duckLisp_instruction_pushInteger32, DL_STR("integer.32 4")},
+	{duckLisp_instruction_pushDoubleFloat, DL_STR("double-float f")},
+	{duckLisp_instruction_pushIndex8, DL_STR("index.8 1")},
+	{duckLisp_instruction_pushIndex16, DL_STR("index.16 2")},
+	{duckLisp_instruction_pushIndex32, DL_STR("index.32 4")},
+	{duckLisp_instruction_pushUpvalue8, DL_STR("upvalue.8 1")},
+	{duckLisp_instruction_pushUpvalue16, DL_STR("upvalue.16 2")},
+	{duckLisp_instruction_pushUpvalue32, DL_STR("upvalue.32 4")},
+	{duckLisp_instruction_pushClosure8, DL_STR("closure.8 1 1 4 V2")},
+	{duckLisp_instruction_pushClosure16, DL_STR("closure.16 2 1 4 V2")},
+	{duckLisp_instruction_pushClosure32, DL_STR("closure.32 4 1 4 V2")},
+	{duckLisp_instruction_pushVaClosure8, DL_STR("variadic-closure.8 1 1 4 V2")},
+	{duckLisp_instruction_pushVaClosure16, DL_STR("variadic-closure.16 2 1 4 V2")},
+	{duckLisp_instruction_pushVaClosure32, DL_STR("variadic-closure.32 4 1 4 V2")},
+	{duckLisp_instruction_pushGlobal8, DL_STR("global.8 1")},
+	{duckLisp_instruction_pushGlobal16, DL_STR("global.8 2")},
+	{duckLisp_instruction_pushGlobal32, DL_STR("global.8 4")},
+	{duckLisp_instruction_setUpvalue8, DL_STR("set-upvalue.8 1 1")},
+	{duckLisp_instruction_setUpvalue16, DL_STR("set-upvalue.16 1 2")},
+	{duckLisp_instruction_setUpvalue32, DL_STR("set-upvalue.32 1 4")},
+	{duckLisp_instruction_setGlobal8, DL_STR("set-global.8 1 1")},
+	{duckLisp_instruction_setGlobal16, DL_STR("set-global.16 2 2")},
+	{duckLisp_instruction_setGlobal32, DL_STR("set-global.32 4 4")},
+	{duckLisp_instruction_funcall8, DL_STR("funcall.8 1 1")},
+	{duckLisp_instruction_funcall16, DL_STR("funcall.16 2 1")},
+	{duckLisp_instruction_funcall32, DL_STR("funcall.32 4 1")},
+	{duckLisp_instruction_releaseUpvalues8, DL_STR("release-upvalues.8 1 v0")},
+	{duckLisp_instruction_releaseUpvalues16, DL_STR("release-upvalues.16 2 v0")},
+	{duckLisp_instruction_releaseUpvalues32, DL_STR("release-upvalues.32 4 v0")},
+	{duckLisp_instruction_call8, DL_STR("obsolete: call.8 1 1")},
+	{duckLisp_instruction_call16, DL_STR("obsolete: call.16 1 2")},
+	{duckLisp_instruction_call32, DL_STR("obsolete: call.32 1 4")},
+	{duckLisp_instruction_acall8, DL_STR("obsolete: acall.8 1 1")},
+	{duckLisp_instruction_acall16, DL_STR("obsolete: acall.16 1 2")},
+	{duckLisp_instruction_acall32, DL_STR("obsolete: acall.32 1 4")},
+	{duckLisp_instruction_apply8, DL_STR("apply.8 1 1")},
+	{duckLisp_instruction_apply16, DL_STR("apply.16 2 1")},
+	{duckLisp_instruction_apply32, DL_STR("apply.32 4 1")},
+	{duckLisp_instruction_ccall8, DL_STR("c-call.8 1 1")},
+	{duckLisp_instruction_ccall16, DL_STR("c-call.16 2 1")},
+	{duckLisp_instruction_ccall32, DL_STR("c-call.32 4 1")},
+	{duckLisp_instruction_jump8, DL_STR("jump.8 1")},
+	{duckLisp_instruction_jump16, DL_STR("jump.16 2")},
+	{duckLisp_instruction_jump32, DL_STR("jump.32 4")},
+	{duckLisp_instruction_brz8, DL_STR("brz.8 1 1")},
+	{duckLisp_instruction_brz16, DL_STR("brz.16 2 1")},
+	{duckLisp_instruction_brz32, DL_STR("brz.32 4 1")},
+	{duckLisp_instruction_brnz8, DL_STR("brnz.8 1 1")},
+	{duckLisp_instruction_brnz16, DL_STR("brnz.16 2 1")},
+	{duckLisp_instruction_brnz32, DL_STR("brnz.32 4 1")},
+	{duckLisp_instruction_move8, DL_STR("move.8 1 1")},
+	{duckLisp_instruction_move16, DL_STR("move.16 2 2")},
+	{duckLisp_instruction_move32, DL_STR("move.32 4 4")},
+	{duckLisp_instruction_not8, DL_STR("not.8 1")},
+	{duckLisp_instruction_not16, DL_STR("not.16 2")},
+	{duckLisp_instruction_not32, DL_STR("not.32 4")},
+	{duckLisp_instruction_mul8, DL_STR("mul.8 1 1")},
+	{duckLisp_instruction_mul16, DL_STR("mul.16 2 2")},
+	{duckLisp_instruction_mul32, DL_STR("mul.32 4 4")},
+	{duckLisp_instruction_div8, DL_STR("div.8 1 1")},
+	{duckLisp_instruction_div16, DL_STR("div.16 2 2")},
+	{duckLisp_instruction_div32, DL_STR("div.32 4 4")},
+	{duckLisp_instruction_add8, DL_STR("add.8 1 1")},
+	{duckLisp_instruction_add16, DL_STR("add.16 2 2")},
+	{duckLisp_instruction_add32, DL_STR("add.32 4 4")},
+	{duckLisp_instruction_sub8, DL_STR("sub.8 1 1")},
+	{duckLisp_instruction_sub16, DL_STR("sub.16 2 2")},
+	{duckLisp_instruction_sub32, DL_STR("sub.32 4 4")},
+	{duckLisp_instruction_equal8, DL_STR("equal.8 1 1")},
+	{duckLisp_instruction_equal16, DL_STR("equal.16 2 2")},
+	{duckLisp_instruction_equal32, DL_STR("equal.32 4 4")},
+	{duckLisp_instruction_greater8, DL_STR("greater.8 1 1")},
+	{duckLisp_instruction_greater16, DL_STR("greater.16 2 2")},
+	{duckLisp_instruction_greater32, DL_STR("greater.32 4 4")},
+	{duckLisp_instruction_less8, DL_STR("less.8 1 1")},
+	{duckLisp_instruction_less16, DL_STR("less.16 2 2")},
+	{duckLisp_instruction_less32, DL_STR("less.32 4 4")},
+	{duckLisp_instruction_mulInteger8, DL_STR("mul-integer.8 1 1")},
+	{duckLisp_instruction_mulFloat8, DL_STR("mul-float.8 1 1")},
+	{duckLisp_instruction_divInteger8, DL_STR("div-integer.8 1 1")},
+	{duckLisp_instruction_divFloat8, DL_STR("div-float.8 1 1")},
+	{duckLisp_instruction_addInteger8, DL_STR("add-integer.8 1 1")},
+	{duckLisp_instruction_addFloat8, DL_STR("add-float.8 1 1")},
+	{duckLisp_instruction_subInteger8, DL_STR("sub-integer.8 1 1")},
+	{duckLisp_instruction_subFloat8, DL_STR("sub-float.8 1 1")},
+	{duckLisp_instruction_equalInteger8, DL_STR("equal-integer.8 1 1")},
+	{duckLisp_instruction_equalFloat8, DL_STR("equal-float.8 1 1")},
+	{duckLisp_instruction_greaterInteger8, DL_STR("greater-integer.8 1 1")},
+	{duckLisp_instruction_greaterFloat8, DL_STR("greater-float.8 1 1")},
+	{duckLisp_instruction_lessInteger8, DL_STR("less-integer.8 1 1")},
+	{duckLisp_instruction_lessFloat8, DL_STR("less-float.8 1 1")},
+	{duckLisp_instruction_cons8, DL_STR("cons.8 1 1")},
+	{duckLisp_instruction_cons16, DL_STR("cons.16 2 2")},
+	{duckLisp_instruction_cons32, DL_STR("cons.32 4 4")},
+	{duckLisp_instruction_vector8, DL_STR("vector.8 1 V0")},
+	{duckLisp_instruction_vector16, DL_STR("vector.16 2 V0")},
+	{duckLisp_instruction_vector32, DL_STR("vector.32 4 V0")},
+	{duckLisp_instruction_makeVector8, DL_STR("makeVector.8 1 1")},
+	{duckLisp_instruction_makeVector16, DL_STR("makeVector.16 2 2")},
+	{duckLisp_instruction_makeVector32, DL_STR("makeVector.32 4 4")},
+	{duckLisp_instruction_getVecElt8, DL_STR("getVecElt.8 1 1")},
+	{duckLisp_instruction_getVecElt16, DL_STR("getVecElt.16 2 2")},
+	{duckLisp_instruction_getVecElt32, DL_STR("getVecElt.32 4 4")},
+	{duckLisp_instruction_setVecElt8, DL_STR("setVecElt.8 1 1 1")},
+	{duckLisp_instruction_setVecElt16, DL_STR("setVecElt.16 2 2 2")},
+	{duckLisp_instruction_setVecElt32, DL_STR("setVecElt.32 4 4 4")},
+	{duckLisp_instruction_car8, DL_STR("car.8 1")},
+	{duckLisp_instruction_car16, DL_STR("car.16 2")},
+	{duckLisp_instruction_car32, DL_STR("car.32 4")},
+	{duckLisp_instruction_cdr8, DL_STR("cdr.8 1")},
+	{duckLisp_instruction_cdr16, DL_STR("cdr.16 2")},
+	{duckLisp_instruction_cdr32, DL_STR("cdr.32 4")},
+	{duckLisp_instruction_setCar8, DL_STR("setCar.8 1 1")},
+	{duckLisp_instruction_setCar16, DL_STR("setCar.16 2 2")},
+	{duckLisp_instruction_setCar32, DL_STR("setCar.32 4 4")},
+	{duckLisp_instruction_setCdr8, DL_STR("setCdr.8 1 1")},
+	{duckLisp_instruction_setCdr16, DL_STR("setCdr.16 2 2")},
+	{duckLisp_instruction_setCdr32, DL_STR("setCdr.32 4 4")},
+	{duckLisp_instruction_nullp8, DL_STR("null?.8 1")},
+	{duckLisp_instruction_nullp16, DL_STR("null?.16 2")},
+	{duckLisp_instruction_nullp32, DL_STR("null?.32 4")},
+	{duckLisp_instruction_typeof8, DL_STR("typeof.8 1")},
+	{duckLisp_instruction_typeof16, DL_STR("typeof.16 2")},
+	{duckLisp_instruction_typeof32, DL_STR("typeof.32 4")},
+	{duckLisp_instruction_makeType, DL_STR("makeType")},
+	{duckLisp_instruction_makeInstance8, DL_STR("makeInstance.8 1 1 1")},
+	{duckLisp_instruction_makeInstance16, DL_STR("makeInstance.16 2 2 2")},
+	{duckLisp_instruction_makeInstance32, DL_STR("makeInstance.32 4 4 4")},
+	{duckLisp_instruction_compositeValue8, DL_STR("compositeValue.8 1")},
+	{duckLisp_instruction_compositeValue16, DL_STR("compositeValue.16 2")},
+	{duckLisp_instruction_compositeValue32, DL_STR("compositeValue.32 4")},
+	{duckLisp_instruction_compositeFunction8, DL_STR("compositeFunction.8 1")},
+	{duckLisp_instruction_compositeFunction16, DL_STR("compositeFunction.16 2")},
+	{duckLisp_instruction_compositeFunction32, DL_STR("compositeFunction.32 4")},
+	{duckLisp_instruction_setCompositeValue8, DL_STR("setCompositeValue.8 1 1")},
+	{duckLisp_instruction_setCompositeValue16, DL_STR("setCompositeValue.16 2 2")},
+	{duckLisp_instruction_setCompositeValue32, DL_STR("setCompositeValue.32 4 4")},
+	{duckLisp_instruction_setCompositeFunction8, DL_STR("setCompositeFunction.8 1 1")},
+	{duckLisp_instruction_setCompositeFunction16, DL_STR("setCompositeFunction.16 2 2")},
+	{duckLisp_instruction_setCompositeFunction32, DL_STR("setCompositeFunction.32 4 4")},
+	{duckLisp_instruction_makeString8, DL_STR("makeString.8 1")},
+	{duckLisp_instruction_makeString16, DL_STR("makeString.16 2")},
+	{duckLisp_instruction_makeString32, DL_STR("makeString.32 4")},
+	{duckLisp_instruction_concatenate8, DL_STR("concatenate.8 1 1")},
+	{duckLisp_instruction_concatenate16, DL_STR("concatenate.16 2 2")},
+	{duckLisp_instruction_concatenate32, DL_STR("concatenate.32 4 4")},
+	{duckLisp_instruction_substring8, DL_STR("substring.8 1 1 1")},
+	{duckLisp_instruction_substring16, DL_STR("substring.16 2 2 2")},
+	{duckLisp_instruction_substring32, DL_STR("substring.32 4 4 4")},
+	{duckLisp_instruction_length8, DL_STR("length.8 1")},
+	{duckLisp_instruction_length16, DL_STR("length.16 2")},
+	{duckLisp_instruction_length32, DL_STR("length.32 4")},
+	{duckLisp_instruction_symbolString8, DL_STR("symbolString.8 1")},
+	{duckLisp_instruction_symbolString16, DL_STR("symbolString.16 2")},
+	{duckLisp_instruction_symbolString32, DL_STR("symbolString.32 4")},
+	{duckLisp_instruction_symbolId8, DL_STR("symbolId.8 1")},
+	{duckLisp_instruction_symbolId16, DL_STR("symbolId.16 2")},
+	{duckLisp_instruction_symbolId32, DL_STR("symbolId.32 4")},
+	{duckLisp_instruction_makeCoroutine8, DL_STR("makeCoroutine.8 1")},
+	{duckLisp_instruction_makeCoroutine16, DL_STR("makeCoroutine.16 2")},
+	{duckLisp_instruction_makeCoroutine32, DL_STR("makeCoroutine.32 4")},
+	{duckLisp_instruction_resume8, DL_STR("resume.8 1 1")},
+	{duckLisp_instruction_resume16, DL_STR("resume.16 2 2")},
+	{duckLisp_instruction_resume32, DL_STR("resume.32 4 4")},
+	{duckLisp_instruction_yield8, DL_STR("yield.8 1")},
+	{duckLisp_instruction_yield16, DL_STR("yield.16 2")},
+	{duckLisp_instruction_yield32, DL_STR("yield.32 4")},
+	{duckLisp_instruction_coroutineDonep8, DL_STR("coroutineDonep.8 1")},
+	{duckLisp_instruction_coroutineDonep16, DL_STR("coroutineDonep.16 2")},
+	{duckLisp_instruction_coroutineDonep32, DL_STR("coroutineDonep.32 4")},
+	{duckLisp_instruction_send8, DL_STR("send.8 1 1")},
+	{duckLisp_instruction_send16, DL_STR("send.16 2 2")},
+	{duckLisp_instruction_send32, DL_STR("send.32 4 4")},
+	{duckLisp_instruction_receive8, DL_STR("receive.8 1")},
+	{duckLisp_instruction_receive16, DL_STR("receive.16 2")},
+	{duckLisp_instruction_receive32, DL_STR("receive.32 4")},
+	{duckLisp_instruction_tryReceive8, DL_STR("tryReceive.8 1 1")},
+	{duckLisp_instruction_tryReceive16, DL_STR("tryReceive.16 2 2")},
+	{duckLisp_instruction_tryReceive32, DL_STR("tryReceive.32 4 4")},
+	{duckLisp_instruction_freeze8, DL_STR("freeze.8 1")},
+	{duckLisp_instruction_freeze16, DL_STR("freeze.16 2")},
+	{duckLisp_instruction_freeze32, DL_STR("freeze.32 4")},
+	{duckLisp_instruction_parallelMap8, DL_STR("parallelMap.8 1 1")},
+	{duckLisp_instruction_parallelMap16, DL_STR("parallelMap.16 2 2")},
+	{duckLisp_instruction_parallelMap32, DL_STR("parallelMap.32 4 4")},
+	{duckLisp_instruction_makeHashTable, DL_STR("makeHashTable")},
+	{duckLisp_instruction_hashTableGet8, DL_STR("hashTableGet.8 1 1 1")},
+	{duckLisp_instruction_hashTableGet16, DL_STR("hashTableGet.16 2 2 2")},
+	{duckLisp_instruction_hashTableGet32, DL_STR("hashTableGet.32 4 4 4")},
+	{duckLisp_instruction_hashTableSet8, DL_STR("hashTableSet.8 1 1 1")},
+	{duckLisp_instruction_hashTableSet16, DL_STR("hashTableSet.16 2 2 2")},
+	{duckLisp_instruction_hashTableSet32, DL_STR("hashTableSet.32 4 4 4")},
+	{duckLisp_instruction_hashTableDelete8, DL_STR("hashTableDelete.8 1 1")},
+	{duckLisp_instruction_hashTableDelete16, DL_STR("hashTableDelete.16 2 2")},
+	{duckLisp_instruction_hashTableDelete32, DL_STR("hashTableDelete.32 4 4")},
+	{duckLisp_instruction_hashTableNext8, DL_STR("hashTableNext.8 1 1")},
+	{duckLisp_instruction_hashTableNext16, DL_STR("hashTableNext.16 2 2")},
+	{duckLisp_instruction_hashTableNext32, DL_STR("hashTableNext.32 4 4")},
+	{duckLisp_instruction_vectorPush8, DL_STR("vectorPush.8 1 1")},
+	{duckLisp_instruction_vectorPush16, DL_STR("vectorPush.16 2 2")},
+	{duckLisp_instruction_vectorPush32, DL_STR("vectorPush.32 4 4")},
+	{duckLisp_instruction_vectorPop8, DL_STR("vectorPop.8 1")},
+	{duckLisp_instruction_vectorPop16, DL_STR("vectorPop.16 2")},
+	{duckLisp_instruction_vectorPop32, DL_STR("vectorPop.32 4")},
+	{duckLisp_instruction_vectorTruncate8, DL_STR("vectorTruncate.8 1 1")},
+	{duckLisp_instruction_vectorTruncate16, DL_STR("vectorTruncate.16 2 2")},
+	{duckLisp_instruction_vectorTruncate32, DL_STR("vectorTruncate.32 4 4")},
+	{duckLisp_instruction_makeStringBuilder, DL_STR("makeStringBuilder")},
+	{duckLisp_instruction_stringBuilderAppend8, DL_STR("stringBuilderAppend.8 1 1")},
+	{duckLisp_instruction_stringBuilderAppend16, DL_STR("stringBuilderAppend.16 2 2")},
+	{duckLisp_instruction_stringBuilderAppend32, DL_STR("stringBuilderAppend.32 4 4")},
+	{duckLisp_instruction_stringSearch8, DL_STR("stringSearch.8 1 1 1")},
+	{duckLisp_instruction_stringSearch16, DL_STR("stringSearch.16 2 2 2")},
+	{duckLisp_instruction_stringSearch32, DL_STR("stringSearch.32 4 4 4")},
+	{duckLisp_instruction_stringCompare8, DL_STR("stringCompare.8 1 1")},
+	{duckLisp_instruction_stringCompare16, DL_STR("stringCompare.16 2 2")},
+	{duckLisp_instruction_stringCompare32, DL_STR("stringCompare.32 4 4")},
+	{duckLisp_instruction_utf8Validp8, DL_STR("utf8Validp.8 1")},
+	{duckLisp_instruction_utf8Validp16, DL_STR("utf8Validp.16 2")},
+	{duckLisp_instruction_utf8Validp32, DL_STR("utf8Validp.32 4")},
+	{duckLisp_instruction_utf8Length8, DL_STR("utf8Length.8 1")},
+	{duckLisp_instruction_utf8Length16, DL_STR("utf8Length.16 2")},
+	{duckLisp_instruction_utf8Length32, DL_STR("utf8Length.32 4")},
+	{duckLisp_instruction_stringUpcase8, DL_STR("stringUpcase.8 1")},
+	{duckLisp_instruction_stringUpcase16, DL_STR("stringUpcase.16 2")},
+	{duckLisp_instruction_stringUpcase32, DL_STR("stringUpcase.32 4")},
+	{duckLisp_instruction_stringDowncase8, DL_STR("stringDowncase.8 1")},
+	{duckLisp_instruction_stringDowncase16, DL_STR("stringDowncase.16 2")},
+	{duckLisp_instruction_stringDowncase32, DL_STR("stringDowncase.32 4")},
+	{duckLisp_instruction_makeTypedArray8, DL_STR("makeTypedArray.8 1 1")},
+	{duckLisp_instruction_makeTypedArray16, DL_STR("makeTypedArray.16 2 2")},
+	{duckLisp_instruction_makeTypedArray32, DL_STR("makeTypedArray.32 4 4")},
+	{duckLisp_instruction_typedArraySum8, DL_STR("typedArraySum.8 1")},
+	{duckLisp_instruction_typedArraySum16, DL_STR("typedArraySum.16 2")},
+	{duckLisp_instruction_typedArraySum32, DL_STR("typedArraySum.32 4")},
+	{duckLisp_instruction_typedArrayDot8, DL_STR("typedArrayDot.8 1 1")},
+	{duckLisp_instruction_typedArrayDot16, DL_STR("typedArrayDot.16 2 2")},
+	{duckLisp_instruction_typedArrayDot32, DL_STR("typedArrayDot.32 4 4")},
+	{duckLisp_instruction_typedArrayScale8, DL_STR("typedArrayScale.8 1 1")},
+	{duckLisp_instruction_typedArrayScale16, DL_STR("typedArrayScale.16 2 2")},
+	{duckLisp_instruction_typedArrayScale32, DL_STR("typedArrayScale.32 4 4")},
+	{duckLisp_instruction_typedArrayAdd8, DL_STR("typedArrayAdd.8 1 1")},
+	{duckLisp_instruction_typedArrayAdd16, DL_STR("typedArrayAdd.16 2 2")},
+	{duckLisp_instruction_typedArrayAdd32, DL_STR("typedArrayAdd.32 4 4")},
+	{duckLisp_instruction_typedArrayMul8, DL_STR("typedArrayMul.8 1 1")},
+	{duckLisp_instruction_typedArrayMul16, DL_STR("typedArrayMul.16 2 2")},
+	{duckLisp_instruction_typedArrayMul32, DL_STR("typedArrayMul.32 4 4")},
+	{duckLisp_instruction_typedArrayMin8, DL_STR("typedArrayMin.8 1")},
+	{duckLisp_instruction_typedArrayMin16, DL_STR("typedArrayMin.16 2")},
+	{duckLisp_instruction_typedArrayMin32, DL_STR("typedArrayMin.32 4")},
+	{duckLisp_instruction_typedArrayMax8, DL_STR("typedArrayMax.8 1")},
+	{duckLisp_instruction_typedArrayMax16, DL_STR("typedArrayMax.16 2")},
+	{duckLisp_instruction_typedArrayMax32, DL_STR("typedArrayMax.32 4")},
+	{duckLisp_instruction_makeRecord8, DL_STR("makeRecord.8 1 1")},
+	{duckLisp_instruction_makeRecord16, DL_STR("makeRecord.16 2 2")},
+	{duckLisp_instruction_makeRecord32, DL_STR("makeRecord.32 4 4")},
+	{duckLisp_instruction_recordSlot8, DL_STR("recordSlot.8 1 1")},
+	{duckLisp_instruction_recordSlot16, DL_STR("recordSlot.16 2 2")},
+	{duckLisp_instruction_recordSlot32, DL_STR("recordSlot.32 4 4")},
+	{duckLisp_instruction_setRecordSlot8, DL_STR("setRecordSlot.8 1 1 1")},
+	{duckLisp_instruction_setRecordSlot16, DL_STR("setRecordSlot.16 2 2 2")},
+	{duckLisp_instruction_setRecordSlot32, DL_STR("setRecordSlot.32 4 4 4")},
+	{duckLisp_instruction_pushQuoted8, DL_STR("pushQuoted.8 1")},
+	{duckLisp_instruction_pushQuoted16, DL_STR("pushQuoted.16 2")},
+	{duckLisp_instruction_pushQuoted32, DL_STR("pushQuoted.32 4")},
+	{duckLisp_instruction_setQuoted8, DL_STR("setQuoted.8 1 1")},
+	{duckLisp_instruction_setQuoted16, DL_STR("setQuoted.16 2 2")},
+	{duckLisp_instruction_setQuoted32, DL_STR("setQuoted.32 4 4")},
+	{duckLisp_instruction_nth8, DL_STR("nth.8 1 1")},
+	{duckLisp_instruction_nth16, DL_STR("nth.16 2 2")},
+	{duckLisp_instruction_nth32, DL_STR("nth.32 4 4")},
+	{duckLisp_instruction_nthcdr8, DL_STR("nthcdr.8 1 1")},
+	{duckLisp_instruction_nthcdr16, DL_STR("nthcdr.16 2 2")},
+	{duckLisp_instruction_nthcdr32, DL_STR("nthcdr.32 4 4")},
+	{duckLisp_instruction_append8, DL_STR("append.8 1 1")},
+	{duckLisp_instruction_append16, DL_STR("append.16 2 2")},
+	{duckLisp_instruction_append32, DL_STR("append.32 4 4")},
+	{duckLisp_instruction_reverse8, DL_STR("reverse.8 1")},
+	{duckLisp_instruction_reverse16, DL_STR("reverse.16 2")},
+	{duckLisp_instruction_reverse32, DL_STR("reverse.32 4")},
+	{duckLisp_instruction_assoc8, DL_STR("assoc.8 1 1")},
+	{duckLisp_instruction_assoc16, DL_STR("assoc.16 2 2")},
+	{duckLisp_instruction_assoc32, DL_STR("assoc.32 4 4")},
+	{duckLisp_instruction_member8, DL_STR("member.8 1 1")},
+	{duckLisp_instruction_member16, DL_STR("member.16 2 2")},
+	{duckLisp_instruction_member32, DL_STR("member.32 4 4")},
+	{duckLisp_instruction_pop8, DL_STR("pop.8 1")},
+	{duckLisp_instruction_pop16, DL_STR("pop.16 2")},
+	{duckLisp_instruction_pop32, DL_STR("pop.32 4")},
+	{duckLisp_instruction_return0, DL_STR("return.0")},
+	{duckLisp_instruction_return8, DL_STR("return.8 1")},
+	{duckLisp_instruction_return16, DL_STR("return.16 2")},
+	{duckLisp_instruction_return32, DL_STR("return.32 4")},
+	{duckLisp_instruction_halt, DL_STR("halt")},
+	{duckLisp_instruction_nil, DL_STR("nil")},
+	{duckLisp_instruction_extended, DL_STR("extended 1")},
+};
+
+
 dl_error_t duckLisp_disassemble(dl_array_t *string,
                                 dl_memoryAllocation_t *memoryAllocation,
                                 const dl_uint8_t *bytecode,
@@ -2853,183 +4969,11 @@ dl_error_t duckLisp_disassemble(dl_array_t *string,
 	dl_error_t e = dl_error_ok;
 	dl_error_t eError = dl_error_ok;
 
-	const dl_size_t maxElements = 256;
+	/* One-byte opcodes, then extended opcodes. */
+	const dl_size_t maxElements = 512;
 	dl_array_t disassembly;
 	/**/ dl_array_init(&disassembly, memoryAllocation, sizeof(char), dl_array_strategy_double);
 
-	const struct {
-		const dl_uint8_t opcode;
-		dl_uint8_t *format;
-		const dl_size_t format_length;
-	} templates[] = {
-		{duckLisp_instruction_nop, DL_STR("nop")},
-		{duckLisp_instruction_pushString8, DL_STR("string.8 1 s0")},
-		{duckLisp_instruction_pushString16, DL_STR("string.16 2 s0")},
-		{duckLisp_instruction_pushString32, DL_STR("string.32 4 s0")},
-		{duckLisp_instruction_pushSymbol8, DL_STR("symbol.8 1 1 s1")},
-		{duckLisp_instruction_pushSymbol16, DL_STR("symbol.16 2 2 s1")},
-		{duckLisp_instruction_pushSymbol32, DL_STR("symbol.32 4 4 s1")},
-		{duckLisp_instruction_pushStrippedSymbol8, DL_STR("stripped-symbol.8 1 1 s1")},
-		{duckLisp_instruction_pushStrippedSymbol16, DL_STR("stripped-symbol.16 2 2 s1")},
-		{duckLisp_instruction_pushStrippedSymbol32, DL_STR("stripped-symbol.32 4 4 s1")},
-		{duckLisp_instruction_pushBooleanFalse, DL_STR("false")},
-		{duckLisp_instruction_pushBooleanTrue, DL_STR("true")},
-		{duckLisp_instruction_pushInteger8, DL_STR("integer.8 1")},
-		{duckLisp_instruction_pushInteger16, DL_STR("integer.16 2")},
-		{duckLisp_instruction_pushInteger32, DL_STR("integer.32 4")},
-		{duckLisp_instruction_pushDoubleFloat, DL_STR("double-float f")},
-		{duckLisp_instruction_pushIndex8, DL_STR("index.8 1")},
-		{duckLisp_instruction_pushIndex16, DL_STR("index.16 2")},
-		{duckLisp_instruction_pushIndex32, DL_STR("index.32 4")},
-		{duckLisp_instruction_pushUpvalue8, DL_STR("upvalue.8 1")},
-		{duckLisp_instruction_pushUpvalue16, DL_STR("upvalue.16 2")},
-		{duckLisp_instruction_pushUpvalue32, DL_STR("upvalue.32 4")},
-		{duckLisp_instruction_pushClosure8, DL_STR("closure.8 1 1 4 V2")},
-		{duckLisp_instruction_pushClosure16, DL_STR("closure.16 2 1 4 V2")},
-		{duckLisp_instruction_pushClosure32, DL_STR("closure.32 4 1 4 V2")},
-		{duckLisp_instruction_pushVaClosure8, DL_STR("variadic-closure.8 1 1 4 V2")},
-		{duckLisp_instruction_pushVaClosure16, DL_STR("variadic-closure.16 2 1 4 V2")},
-		{duckLisp_instruction_pushVaClosure32, DL_STR("variadic-closure.32 4 1 4 V2")},
-		{duckLisp_instruction_pushGlobal8, DL_STR("global.8 1")},
-		{duckLisp_instruction_pushGlobal16, DL_STR("global.8 2")},
-		{duckLisp_instruction_pushGlobal32, DL_STR("global.8 4")},
-		{duckLisp_instruction_setUpvalue8, DL_STR("set-upvalue.8 1 1")},
-		{duckLisp_instruction_setUpvalue16, DL_STR("set-upvalue.16 1 2")},
-		{duckLisp_instruction_setUpvalue32, DL_STR("set-upvalue.32 1 4")},
-		{duckLisp_instruction_setGlobal8, DL_STR("set-global.8 1 1")},
-		{duckLisp_instruction_setGlobal16, DL_STR("set-global.16 2 2")},
-		{duckLisp_instruction_setGlobal32, DL_STR("set-global.32 4 4")},
-		{duckLisp_instruction_funcall8, DL_STR("funcall.8 1 1")},
-		{duckLisp_instruction_funcall16, DL_STR("funcall.16 2 1")},
-		{duckLisp_instruction_funcall32, DL_STR("funcall.32 4 1")},
-		{duckLisp_instruction_releaseUpvalues8, DL_STR("release-upvalues.8 1 v0")},
-		{duckLisp_instruction_releaseUpvalues16, DL_STR("release-upvalues.16 2 v0")},
-		{duckLisp_instruction_releaseUpvalues32, DL_STR("release-upvalues.32 4 v0")},
-		{duckLisp_instruction_call8, DL_STR("obsolete: call.8 1 1")},
-		{duckLisp_instruction_call16, DL_STR("obsolete: call.16 1 2")},
-		{duckLisp_instruction_call32, DL_STR("obsolete: call.32 1 4")},
-		{duckLisp_instruction_acall8, DL_STR("obsolete: acall.8 1 1")},
-		{duckLisp_instruction_acall16, DL_STR("obsolete: acall.16 1 2")},
-		{duckLisp_instruction_acall32, DL_STR("obsolete: acall.32 1 4")},
-		{duckLisp_instruction_apply8, DL_STR("apply.8 1 1")},
-		{duckLisp_instruction_apply16, DL_STR("apply.16 2 1")},
-		{duckLisp_instruction_apply32, DL_STR("apply.32 4 1")},
-		{duckLisp_instruction_ccall8, DL_STR("c-call.8 1")},
-		{duckLisp_instruction_ccall16, DL_STR("c-call.16 2")},
-		{duckLisp_instruction_ccall32, DL_STR("c-call.32 4")},
-		{duckLisp_instruction_jump8, DL_STR("jump.8 1")},
-		{duckLisp_instruction_jump16, DL_STR("jump.16 2")},
-		{duckLisp_instruction_jump32, DL_STR("jump.32 4")},
-		{duckLisp_instruction_brz8, DL_STR("brz.8 1 1")},
-		{duckLisp_instruction_brz16, DL_STR("brz.16 2 1")},
-		{duckLisp_instruction_brz32, DL_STR("brz.32 4 1")},
-		{duckLisp_instruction_brnz8, DL_STR("brnz.8 1 1")},
-		{duckLisp_instruction_brnz16, DL_STR("brnz.16 2 1")},
-		{duckLisp_instruction_brnz32, DL_STR("brnz.32 4 1")},
-		{duckLisp_instruction_move8, DL_STR("move.8 1 1")},
-		{duckLisp_instruction_move16, DL_STR("move.16 2 2")},
-		{duckLisp_instruction_move32, DL_STR("move.32 4 4")},
-		{duckLisp_instruction_not8, DL_STR("not.8 1")},
-		{duckLisp_instruction_not16, DL_STR("not.16 2")},
-		{duckLisp_instruction_not32, DL_STR("not.32 4")},
-		{duckLisp_instruction_mul8, DL_STR("mul.8 1 1")},
-		{duckLisp_instruction_mul16, DL_STR("mul.16 2 2")},
-		{duckLisp_instruction_mul32, DL_STR("mul.32 4 4")},
-		{duckLisp_instruction_div8, DL_STR("div.8 1 1")},
-		{duckLisp_instruction_div16, DL_STR("div.16 2 2")},
-		{duckLisp_instruction_div32, DL_STR("div.32 4 4")},
-		{duckLisp_instruction_add8, DL_STR("add.8 1 1")},
-		{duckLisp_instruction_add16, DL_STR("add.16 2 2")},
-		{duckLisp_instruction_add32, DL_STR("add.32 4 4")},
-		{duckLisp_instruction_sub8, DL_STR("sub.8 1 1")},
-		{duckLisp_instruction_sub16, DL_STR("sub.16 2 2")},
-		{duckLisp_instruction_sub32, DL_STR("sub.32 4 4")},
-		{duckLisp_instruction_equal8, DL_STR("equal.8 1 1")},
-		{duckLisp_instruction_equal16, DL_STR("equal.16 2 2")},
-		{duckLisp_instruction_equal32, DL_STR("equal.32 4 4")},
-		{duckLisp_instruction_greater8, DL_STR("greater.8 1 1")},
-		{duckLisp_instruction_greater16, DL_STR("greater.16 2 2")},
-		{duckLisp_instruction_greater32, DL_STR("greater.32 4 4")},
-		{duckLisp_instruction_less8, DL_STR("less.8 1 1")},
-		{duckLisp_instruction_less16, DL_STR("less.16 2 2")},
-		{duckLisp_instruction_less32, DL_STR("less.32 4 4")},
-		{duckLisp_instruction_cons8, DL_STR("cons.8 1 1")},
-		{duckLisp_instruction_cons16, DL_STR("cons.16 2 2")},
-		{duckLisp_instruction_cons32, DL_STR("cons.32 4 4")},
-		{duckLisp_instruction_vector8, DL_STR("vector.8 1 V0")},
-		{duckLisp_instruction_vector16, DL_STR("vector.16 2 V0")},
-		{duckLisp_instruction_vector32, DL_STR("vector.32 4 V0")},
-		{duckLisp_instruction_makeVector8, DL_STR("makeVector.8 1 1")},
-		{duckLisp_instruction_makeVector16, DL_STR("makeVector.16 2 2")},
-		{duckLisp_instruction_makeVector32, DL_STR("makeVector.32 4 4")},
-		{duckLisp_instruction_getVecElt8, DL_STR("getVecElt.8 1 1")},
-		{duckLisp_instruction_getVecElt16, DL_STR("getVecElt.16 2 2")},
-		{duckLisp_instruction_getVecElt32, DL_STR("getVecElt.32 4 4")},
-		{duckLisp_instruction_setVecElt8, DL_STR("setVecElt.8 1 1 1")},
-		{duckLisp_instruction_setVecElt16, DL_STR("setVecElt.16 2 2 2")},
-		{duckLisp_instruction_setVecElt32, DL_STR("setVecElt.32 4 4 4")},
-		{duckLisp_instruction_car8, DL_STR("car.8 1")},
-		{duckLisp_instruction_car16, DL_STR("car.16 2")},
-		{duckLisp_instruction_car32, DL_STR("car.32 4")},
-		{duckLisp_instruction_cdr8, DL_STR("cdr.8 1")},
-		{duckLisp_instruction_cdr16, DL_STR("cdr.16 2")},
-		{duckLisp_instruction_cdr32, DL_STR("cdr.32 4")},
-		{duckLisp_instruction_setCar8, DL_STR("setCar.8 1 1")},
-		{duckLisp_instruction_setCar16, DL_STR("setCar.16 2 2")},
-		{duckLisp_instruction_setCar32, DL_STR("setCar.32 4 4")},
-		{duckLisp_instruction_setCdr8, DL_STR("setCdr.8 1 1")},
-		{duckLisp_instruction_setCdr16, DL_STR("setCdr.16 2 2")},
-		{duckLisp_instruction_setCdr32, DL_STR("setCdr.32 4 4")},
-		{duckLisp_instruction_nullp8, DL_STR("null?.8 1")},
-		{duckLisp_instruction_nullp16, DL_STR("null?.16 2")},
-		{duckLisp_instruction_nullp32, DL_STR("null?.32 4")},
-		{duckLisp_instruction_typeof8, DL_STR("typeof.8 1")},
-		{duckLisp_instruction_typeof16, DL_STR("typeof.16 2")},
-		{duckLisp_instruction_typeof32, DL_STR("typeof.32 4")},
-		{duckLisp_instruction_makeType, DL_STR("makeType")},
-		{duckLisp_instruction_makeInstance8, DL_STR("makeInstance.8 1 1 1")},
-		{duckLisp_instruction_makeInstance16, DL_STR("makeInstance.16 2 2 2")},
-		{duckLisp_instruction_makeInstance32, DL_STR("makeInstance.32 4 4 4")},
-		{duckLisp_instruction_compositeValue8, DL_STR("compositeValue.8 1")},
-		{duckLisp_instruction_compositeValue16, DL_STR("compositeValue.16 2")},
-		{duckLisp_instruction_compositeValue32, DL_STR("compositeValue.32 4")},
-		{duckLisp_instruction_compositeFunction8, DL_STR("compositeFunction.8 1")},
-		{duckLisp_instruction_compositeFunction16, DL_STR("compositeFunction.16 2")},
-		{duckLisp_instruction_compositeFunction32, DL_STR("compositeFunction.32 4")},
-		{duckLisp_instruction_setCompositeValue8, DL_STR("setCompositeValue.8 1 1")},
-		{duckLisp_instruction_setCompositeValue16, DL_STR("setCompositeValue.16 2 2")},
-		{duckLisp_instruction_setCompositeValue32, DL_STR("setCompositeValue.32 4 4")},
-		{duckLisp_instruction_setCompositeFunction8, DL_STR("setCompositeFunction.8 1 1")},
-		{duckLisp_instruction_setCompositeFunction16, DL_STR("setCompositeFunction.16 2 2")},
-		{duckLisp_instruction_setCompositeFunction32, DL_STR("setCompositeFunction.32 4 4")},
-		{duckLisp_instruction_makeString8, DL_STR("makeString.8 1")},
-		{duckLisp_instruction_makeString16, DL_STR("makeString.16 2")},
-		{duckLisp_instruction_makeString32, DL_STR("makeString.32 4")},
-		{duckLisp_instruction_concatenate8, DL_STR("concatenate.8 1 1")},
-		{duckLisp_instruction_concatenate16, DL_STR("concatenate.16 2 2")},
-		{duckLisp_instruction_concatenate32, DL_STR("concatenate.32 4 4")},
-		{duckLisp_instruction_substring8, DL_STR("substring.8 1 1 1")},
-		{duckLisp_instruction_substring16, DL_STR("substring.16 2 2 2")},
-		{duckLisp_instruction_substring32, DL_STR("substring.32 4 4 4")},
-		{duckLisp_instruction_length8, DL_STR("length.8 1")},
-		{duckLisp_instruction_length16, DL_STR("length.16 2")},
-		{duckLisp_instruction_length32, DL_STR("length.32 4")},
-		{duckLisp_instruction_symbolString8, DL_STR("symbolString.8 1")},
-		{duckLisp_instruction_symbolString16, DL_STR("symbolString.16 2")},
-		{duckLisp_instruction_symbolString32, DL_STR("symbolString.32 4")},
-		{duckLisp_instruction_symbolId8, DL_STR("symbolId.8 1")},
-		{duckLisp_instruction_symbolId16, DL_STR("symbolId.16 2")},
-		{duckLisp_instruction_symbolId32, DL_STR("symbolId.32 4")},
-		{duckLisp_instruction_pop8, DL_STR("pop.8 1")},
-		{duckLisp_instruction_pop16, DL_STR("pop.16 2")},
-		{duckLisp_instruction_pop32, DL_STR("pop.32 4")},
-		{duckLisp_instruction_return0, DL_STR("return.0")},
-		{duckLisp_instruction_return8, DL_STR("return.8 1")},
-		{duckLisp_instruction_return16, DL_STR("return.16 2")},
-		{duckLisp_instruction_return32, DL_STR("return.32 4")},
-		{duckLisp_instruction_halt, DL_STR("halt")},
-		{duckLisp_instruction_nil, DL_STR("nil")},
-	};
 	dl_ptrdiff_t *template_array = dl_null;
 	e = DL_MALLOC(memoryAllocation, &template_array, maxElements, dl_ptrdiff_t);
 	if (e) goto cleanup;
@@ -3038,18 +4982,23 @@ dl_error_t duckLisp_disassemble(dl_array_t *string,
 		template_array[i] = -1;
 	}
 
-	DL_DOTIMES(i, sizeof(templates)/sizeof(*templates)) {
-		template_array[templates[i].opcode] = i;
+	DL_DOTIMES(i, sizeof(duckLisp_disassembler_templates)/sizeof(*duckLisp_disassembler_templates)) {
+		template_array[duckLisp_disassembler_templates[i].opcode] = i;
 	}
 
 	e = dl_array_pushElements(&disassembly, DL_STR("DISASSEMBLY START\n"));
 	if (e) goto cleanup;
 
 	DL_DOTIMES(bytecode_index, length) {
-		dl_ptrdiff_t template_index = template_array[bytecode[bytecode_index]];
+		dl_size_t opcode = bytecode[bytecode_index];
+		if ((opcode == duckLisp_instruction_extended) && ((dl_size_t) bytecode_index + 1 < length)) {
+			bytecode_index++;
+			opcode = duckLisp_instruction_extendedFirst + bytecode[bytecode_index];
+		}
+		dl_ptrdiff_t template_index = template_array[opcode];
 		if (template_index >= 0) {
-			dl_uint8_t *format = templates[template_index].format;
-			dl_size_t format_length = templates[template_index].format_length;
+			dl_uint8_t *format = duckLisp_disassembler_templates[template_index].format;
+			dl_size_t format_length = duckLisp_disassembler_templates[template_index].format_length;
 
 			/* Name */
 			DL_DOTIMES(k, format_length) {
@@ -3263,3 +5212,82 @@ dl_error_t duckLisp_disassemble(dl_array_t *string,
 	if (eError) e = eError;
 	return e;
 }
+
+dl_error_t duckLisp_instructionLength(const dl_uint8_t *bytecode,
+                                      const dl_size_t length,
+                                      const dl_size_t offset,
+                                      dl_size_t *instructionLength) {
+	dl_size_t index = offset;
+	dl_size_t opcode;
+	dl_ptrdiff_t template_index = -1;
+	const dl_uint8_t *format;
+	dl_size_t format_length;
+	dl_size_t args[5];
+	dl_size_t args_size[5];
+	dl_size_t args_length = 0;
+
+	if (index >= length) return dl_error_invalidValue;
+	opcode = bytecode[index++];
+	if (opcode == duckLisp_instruction_extended) {
+		if (index >= length) return dl_error_invalidValue;
+		opcode = duckLisp_instruction_extendedFirst + bytecode[index++];
+	}
+	DL_DOTIMES(i, sizeof(duckLisp_disassembler_templates)/sizeof(*duckLisp_disassembler_templates)) {
+		if (duckLisp_disassembler_templates[i].opcode == opcode) {
+			template_index = i;
+			break;
+		}
+	}
+	if (template_index < 0) return dl_error_invalidValue;
+	format = duckLisp_disassembler_templates[template_index].format;
+	format_length = duckLisp_disassembler_templates[template_index].format_length;
+
+	/* Skip the name. */
+	while ((format_length > 0) && !dl_string_isSpace(*format)) {
+		format++;
+		--format_length;
+	}
+	while (format_length > 0) {
+		const char formatChar = *format;
+		dl_size_t size = 0;
+		format++;
+		--format_length;
+		switch (formatChar) {
+		case '1':
+		case '2':
+		case '4':
+			size = formatChar - '0';
+			if ((args_length >= sizeof(args)/sizeof(*args)) || (index + size > length)) return dl_error_invalidValue;
+			args[args_length] = 0;
+			DL_DOTIMES(k, size) {
+				args[args_length] = (args[args_length] << 8) | bytecode[index + k];
+			}
+			args_size[args_length] = size;
+			args_length++;
+			break;
+		case 'f':
+			size = 8;
+			break;
+		case 's':
+		case 'v':
+		case 'V': {
+			dl_size_t arg;
+			if (format_length == 0) return dl_error_invalidValue;
+			arg = *format - '0';
+			format++;
+			--format_length;
+			if (arg >= args_length) return dl_error_invalidValue;
+			size = args[arg] * ((formatChar == 's') ? 1 : (formatChar == 'v') ? args_size[arg] : 4);
+			break;
+		}
+		case ' ':
+			break;
+		default:
+			return dl_error_invalidValue;
+		}
+		if ((size > length) || (index > length - size)) return dl_error_invalidValue;
+		index += size;
+	}
+	*instructionLength = index - offset;
+	return dl_error_ok;
+}
@@ -1040,7 +1040,8 @@ dl_error_t duckLisp_compile_compoundExpression(duckLisp_t *duckLisp,
 
 		temp_type = duckLisp_ast_type_none;  // Let's use `none` as a wildcard. Variables do not have a set type.
 		break;
-	case duckLisp_ast_type_expression:
+	case duckLisp_ast_type_expression: {
+		dl_size_t assembly_length = assembly->elements_length;
 		temp_index = -1;
 		e = duckLisp_compile_expression(duckLisp,
 		                                compileState,
@@ -1052,7 +1053,30 @@ dl_error_t duckLisp_compile_compoundExpression(duckLisp_t *duckLisp,
 		if (e) goto cleanup;
 		if (temp_index == -1) temp_index = duckLisp_localsLength_get(compileState) - 1;
 		temp_type = duckLisp_ast_type_none;
+		/* If the last instruction this expression emitted was type-specialized arithmetic, then the type of the result
+		   is known. Labels are part of the assembly, so nothing can have jumped past that instruction. */
+		if ((assembly->elements_length > assembly_length)
+		    && ((dl_size_t) temp_index == duckLisp_localsLength_get(compileState) - 1)) {
+			duckLisp_instructionObject_t lastInstruction = DL_ARRAY_GETTOPADDRESS(*assembly,
+			                                                                      duckLisp_instructionObject_t);
+			switch (lastInstruction.instructionClass) {
+			case duckLisp_instructionClass_mulInteger:
+			case duckLisp_instructionClass_divInteger:
+			case duckLisp_instructionClass_addInteger:
+			case duckLisp_instructionClass_subInteger:
+				temp_type = duckLisp_ast_type_int;
+				break;
+			case duckLisp_instructionClass_mulFloat:
+			case duckLisp_instructionClass_divFloat:
+			case duckLisp_instructionClass_addFloat:
+			case duckLisp_instructionClass_subFloat:
+				temp_type = duckLisp_ast_type_float;
+				break;
+			default:;
+			}
+		}
 		break;
+	}
 	default:
 		temp_type = duckLisp_ast_type_none;
 		e = dl_array_pushElements(&eString, functionName, functionName_length);
@@ -1240,6 +1264,7 @@ dl_error_t duckLisp_compileAST(duckLisp_t *duckLisp,
 	/* Stack length is zero. */
 
 	compileState->currentCompileState->label_number = 0;
+	compileState->currentCompileState->quoted_number = 0;
 
 	assembly = &compileState->currentCompileState->assembly;
 
@@ -1902,6 +1927,94 @@ dl_error_t duckLisp_init(duckLisp_t *duckLisp,
 		{DL_STR("symbol-string"), duckLisp_generator_symbolString, DL_STR("(I)"), dl_null, 0},
 		{DL_STR("__symbol-id"), duckLisp_generator_symbolId, DL_STR("(I)"), dl_null, 0},
 		{DL_STR("symbol-id"), duckLisp_generator_symbolId, DL_STR("(I)"), dl_null, 0},
+		{DL_STR("__make-coroutine"), duckLisp_generator_makeCoroutine, DL_STR("(I)"), dl_null, 0},
+		{DL_STR("make-coroutine"), duckLisp_generator_makeCoroutine, DL_STR("(I)"), dl_null, 0},
+		{DL_STR("__resume"), duckLisp_generator_resume, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("resume"), duckLisp_generator_resume, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("__yield"), duckLisp_generator_yield, DL_STR("(I)"), dl_null, 0},
+		{DL_STR("yield"), duckLisp_generator_yield, DL_STR("(I)"), dl_null, 0},
+		{DL_STR("__coroutine-done?"), duckLisp_generator_coroutineDonep, DL_STR("(I)"), dl_null, 0},
+		{DL_STR("coroutine-done?"), duckLisp_generator_coroutineDonep, DL_STR("(I)"), dl_null, 0},
+		{DL_STR("__send"), duckLisp_generator_send, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("send"), duckLisp_generator_send, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("__receive"), duckLisp_generator_receive, DL_STR("(I)"), dl_null, 0},
+		{DL_STR("receive"), duckLisp_generator_receive, DL_STR("(I)"), dl_null, 0},
+		{DL_STR("__try-receive"), duckLisp_generator_tryReceive, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("try-receive"), duckLisp_generator_tryReceive, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("__freeze"), duckLisp_generator_freeze, DL_STR("(I)"), dl_null, 0},
+		{DL_STR("freeze"), duckLisp_generator_freeze, DL_STR("(I)"), dl_null, 0},
+		{DL_STR("__parallel-map"), duckLisp_generator_parallelMap, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("parallel-map"), duckLisp_generator_parallelMap, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("__make-hash-table"), duckLisp_generator_makeHashTable, DL_STR("()"), dl_null, 0},
+		{DL_STR("make-hash-table"), duckLisp_generator_makeHashTable, DL_STR("()"), dl_null, 0},
+		{DL_STR("__hash-table-get"), duckLisp_generator_hashTableGet, DL_STR("(I I I)"), dl_null, 0},
+		{DL_STR("hash-table-get"), duckLisp_generator_hashTableGet, DL_STR("(I I I)"), dl_null, 0},
+		{DL_STR("__hash-table-set"), duckLisp_generator_hashTableSet, DL_STR("(I I I)"), dl_null, 0},
+		{DL_STR("hash-table-set"), duckLisp_generator_hashTableSet, DL_STR("(I I I)"), dl_null, 0},
+		{DL_STR("__hash-table-delete"), duckLisp_generator_hashTableDelete, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("hash-table-delete"), duckLisp_generator_hashTableDelete, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("__hash-table-next"), duckLisp_generator_hashTableNext, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("hash-table-next"), duckLisp_generator_hashTableNext, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("__vector-push"), duckLisp_generator_vectorPush, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("vector-push"), duckLisp_generator_vectorPush, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("__vector-pop"), duckLisp_generator_vectorPop, DL_STR("(I)"), dl_null, 0},
+		{DL_STR("vector-pop"), duckLisp_generator_vectorPop, DL_STR("(I)"), dl_null, 0},
+		{DL_STR("__vector-truncate"), duckLisp_generator_vectorTruncate, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("vector-truncate"), duckLisp_generator_vectorTruncate, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("__make-string-builder"), duckLisp_generator_makeStringBuilder, DL_STR("()"), dl_null, 0},
+		{DL_STR("make-string-builder"), duckLisp_generator_makeStringBuilder, DL_STR("()"), dl_null, 0},
+		{DL_STR("__string-builder-append"), duckLisp_generator_stringBuilderAppend, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("string-builder-append"), duckLisp_generator_stringBuilderAppend, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("__string-search"), duckLisp_generator_stringSearch, DL_STR("(I I I)"), dl_null, 0},
+		{DL_STR("string-search"), duckLisp_generator_stringSearch, DL_STR("(I I I)"), dl_null, 0},
+		{DL_STR("__string-compare"), duckLisp_generator_stringCompare, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("string-compare"), duckLisp_generator_stringCompare, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("__utf-8-valid?"), duckLisp_generator_utf8Validp, DL_STR("(I)"), dl_null, 0},
+		{DL_STR("utf-8-valid?"), duckLisp_generator_utf8Validp, DL_STR("(I)"), dl_null, 0},
+		{DL_STR("__utf-8-length"), duckLisp_generator_utf8Length, DL_STR("(I)"), dl_null, 0},
+		{DL_STR("utf-8-length"), duckLisp_generator_utf8Length, DL_STR("(I)"), dl_null, 0},
+		{DL_STR("__string-upcase"), duckLisp_generator_stringUpcase, DL_STR("(I)"), dl_null, 0},
+		{DL_STR("string-upcase"), duckLisp_generator_stringUpcase, DL_STR("(I)"), dl_null, 0},
+		{DL_STR("__string-downcase"), duckLisp_generator_stringDowncase, DL_STR("(I)"), dl_null, 0},
+		{DL_STR("string-downcase"), duckLisp_generator_stringDowncase, DL_STR("(I)"), dl_null, 0},
+		{DL_STR("__make-typed-array"), duckLisp_generator_makeTypedArray, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("make-typed-array"), duckLisp_generator_makeTypedArray, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("__typed-array-sum"), duckLisp_generator_typedArraySum, DL_STR("(I)"), dl_null, 0},
+		{DL_STR("typed-array-sum"), duckLisp_generator_typedArraySum, DL_STR("(I)"), dl_null, 0},
+		{DL_STR("__typed-array-dot"), duckLisp_generator_typedArrayDot, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("typed-array-dot"), duckLisp_generator_typedArrayDot, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("__typed-array-scale"), duckLisp_generator_typedArrayScale, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("typed-array-scale"), duckLisp_generator_typedArrayScale, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("__typed-array-add"), duckLisp_generator_typedArrayAdd, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("typed-array-add"), duckLisp_generator_typedArrayAdd, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("__typed-array-mul"), duckLisp_generator_typedArrayMul, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("typed-array-mul"), duckLisp_generator_typedArrayMul, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("__typed-array-min"), duckLisp_generator_typedArrayMin, DL_STR("(I)"), dl_null, 0},
+		{DL_STR("typed-array-min"), duckLisp_generator_typedArrayMin, DL_STR("(I)"), dl_null, 0},
+		{DL_STR("__typed-array-max"), duckLisp_generator_typedArrayMax, DL_STR("(I)"), dl_null, 0},
+		{DL_STR("typed-array-max"), duckLisp_generator_typedArrayMax, DL_STR("(I)"), dl_null, 0},
+		{DL_STR("__make-record"), duckLisp_generator_makeRecord, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("make-record"), duckLisp_generator_makeRecord, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("__record-slot"), duckLisp_generator_recordSlot, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("record-slot"), duckLisp_generator_recordSlot, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("__set-record-slot"), duckLisp_generator_setRecordSlot, DL_STR("(I I I)"), dl_null, 0},
+		{DL_STR("set-record-slot"), duckLisp_generator_setRecordSlot, DL_STR("(I I I)"), dl_null, 0},
+		{DL_STR("__nth"), duckLisp_generator_nth, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("nth"), duckLisp_generator_nth, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("__nthcdr"), duckLisp_generator_nthcdr, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("nthcdr"), duckLisp_generator_nthcdr, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("__append"), duckLisp_generator_append, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("append"), duckLisp_generator_append, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("__reverse"), duckLisp_generator_reverse, DL_STR("(I)"), dl_null, 0},
+		{DL_STR("reverse"), duckLisp_generator_reverse, DL_STR("(I)"), dl_null, 0},
+		{DL_STR("__assoc"), duckLisp_generator_assoc, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("assoc"), duckLisp_generator_assoc, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("__member"), duckLisp_generator_member, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("member"), duckLisp_generator_member, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("__map"), duckLisp_generator_map, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("map"), duckLisp_generator_map, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("__filter"), duckLisp_generator_filter, DL_STR("(I I)"), dl_null, 0},
+		{DL_STR("filter"), duckLisp_generator_filter, DL_STR("(I I)"), dl_null, 0},
 		{DL_STR("__error"), duckLisp_generator_error, DL_STR("(I)"), dl_null, 0},
 		{dl_null, 0, dl_null, dl_null, 0, dl_null, 0}
 	};
@@ -2094,6 +2207,7 @@ void duckLisp_quit(duckLisp_t *duckLisp) {
 void duckLisp_subCompileState_init(dl_memoryAllocation_t *memoryAllocation,
                                    duckLisp_subCompileState_t *subCompileState) {
 	subCompileState->label_number = 0;
+	subCompileState->quoted_number = 0;
 	subCompileState->locals_length = 0;
 	/**/ dl_array_init(&subCompileState->scope_stack,
 	                   memoryAllocation,
@@ -2773,6 +2887,14 @@ dl_error_t duckLisp_subCompileState_prettyPrint(dl_array_t *string_array, duckLi
 	e = dl_array_pushElements(string_array, DL_STR(", "));
 	if (e) goto cleanup;
 
+	e = dl_array_pushElements(string_array, DL_STR("quoted_number = "));
+	if (e) goto cleanup;
+	e = dl_string_fromSize(string_array, subCompileState.quoted_number);
+	if (e) goto cleanup;
+
+	e = dl_array_pushElements(string_array, DL_STR(", "));
+	if (e) goto cleanup;
+
 	e = dl_array_pushElements(string_array, DL_STR("assembly["));
 	if (e) goto cleanup;
 	e = dl_string_fromSize(string_array, subCompileState.assembly.elements_length);
@@ -3221,6 +3343,34 @@ dl_error_t duckLisp_instructionClass_prettyPrint(dl_array_t *string_array,
 		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_less"));
 	case duckLisp_instructionClass_greater:
 		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_greater"));
+	case duckLisp_instructionClass_mulInteger:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_mulInteger"));
+	case duckLisp_instructionClass_mulFloat:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_mulFloat"));
+	case duckLisp_instructionClass_divInteger:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_divInteger"));
+	case duckLisp_instructionClass_divFloat:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_divFloat"));
+	case duckLisp_instructionClass_addInteger:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_addInteger"));
+	case duckLisp_instructionClass_addFloat:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_addFloat"));
+	case duckLisp_instructionClass_subInteger:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_subInteger"));
+	case duckLisp_instructionClass_subFloat:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_subFloat"));
+	case duckLisp_instructionClass_equalInteger:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_equalInteger"));
+	case duckLisp_instructionClass_equalFloat:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_equalFloat"));
+	case duckLisp_instructionClass_lessInteger:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_lessInteger"));
+	case duckLisp_instructionClass_lessFloat:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_lessFloat"));
+	case duckLisp_instructionClass_greaterInteger:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_greaterInteger"));
+	case duckLisp_instructionClass_greaterFloat:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_greaterFloat"));
 	case duckLisp_instructionClass_cons:
 		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_cons"));
 	case duckLisp_instructionClass_vector:
@@ -3267,6 +3417,94 @@ dl_error_t duckLisp_instructionClass_prettyPrint(dl_array_t *string_array,
 		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_symbolString"));
 	case duckLisp_instructionClass_symbolId:
 		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_symbolId"));
+	case duckLisp_instructionClass_makeCoroutine:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_makeCoroutine"));
+	case duckLisp_instructionClass_resume:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_resume"));
+	case duckLisp_instructionClass_yield:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_yield"));
+	case duckLisp_instructionClass_coroutineDonep:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_coroutineDonep"));
+	case duckLisp_instructionClass_send:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_send"));
+	case duckLisp_instructionClass_receive:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_receive"));
+	case duckLisp_instructionClass_tryReceive:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_tryReceive"));
+	case duckLisp_instructionClass_freeze:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_freeze"));
+	case duckLisp_instructionClass_parallelMap:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_parallelMap"));
+	case duckLisp_instructionClass_makeHashTable:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_makeHashTable"));
+	case duckLisp_instructionClass_hashTableGet:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_hashTableGet"));
+	case duckLisp_instructionClass_hashTableSet:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_hashTableSet"));
+	case duckLisp_instructionClass_hashTableDelete:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_hashTableDelete"));
+	case duckLisp_instructionClass_hashTableNext:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_hashTableNext"));
+	case duckLisp_instructionClass_vectorPush:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_vectorPush"));
+	case duckLisp_instructionClass_vectorPop:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_vectorPop"));
+	case duckLisp_instructionClass_vectorTruncate:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_vectorTruncate"));
+	case duckLisp_instructionClass_makeStringBuilder:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_makeStringBuilder"));
+	case duckLisp_instructionClass_stringBuilderAppend:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_stringBuilderAppend"));
+	case duckLisp_instructionClass_stringSearch:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_stringSearch"));
+	case duckLisp_instructionClass_stringCompare:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_stringCompare"));
+	case duckLisp_instructionClass_utf8Validp:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_utf8Validp"));
+	case duckLisp_instructionClass_utf8Length:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_utf8Length"));
+	case duckLisp_instructionClass_stringUpcase:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_stringUpcase"));
+	case duckLisp_instructionClass_stringDowncase:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_stringDowncase"));
+	case duckLisp_instructionClass_makeTypedArray:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_makeTypedArray"));
+	case duckLisp_instructionClass_typedArraySum:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_typedArraySum"));
+	case duckLisp_instructionClass_typedArrayDot:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_typedArrayDot"));
+	case duckLisp_instructionClass_typedArrayScale:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_typedArrayScale"));
+	case duckLisp_instructionClass_typedArrayAdd:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_typedArrayAdd"));
+	case duckLisp_instructionClass_typedArrayMul:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_typedArrayMul"));
+	case duckLisp_instructionClass_typedArrayMin:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_typedArrayMin"));
+	case duckLisp_instructionClass_typedArrayMax:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_typedArrayMax"));
+	case duckLisp_instructionClass_makeRecord:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_makeRecord"));
+	case duckLisp_instructionClass_recordSlot:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_recordSlot"));
+	case duckLisp_instructionClass_setRecordSlot:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_setRecordSlot"));
+	case duckLisp_instructionClass_pushQuoted:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_pushQuoted"));
+	case duckLisp_instructionClass_setQuoted:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_setQuoted"));
+	case duckLisp_instructionClass_nth:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_nth"));
+	case duckLisp_instructionClass_nthcdr:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_nthcdr"));
+	case duckLisp_instructionClass_append:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_append"));
+	case duckLisp_instructionClass_reverse:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_reverse"));
+	case duckLisp_instructionClass_assoc:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_assoc"));
+	case duckLisp_instructionClass_member:
+		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_member"));
 	case duckLisp_instructionClass_pop:
 		return dl_array_pushElements(string_array, DL_STR("duckLisp_instructionClass_pop"));
 	case duckLisp_instructionClass_return:
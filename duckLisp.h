@@ -129,6 +129,7 @@ typedef struct {
 	dl_array_t scope_stack;  /* dl_array_t:duckLisp_scope_t:{dl_trie_t} */
 	dl_size_t locals_length;  /* The predicted total runtime stack length for the current instruction. */
 	dl_size_t label_number;  /* The total number of labels that have been used in this sub-compile-state. */
+	dl_size_t quoted_number;  /* The total number of cached quoted constants in this sub-compile-state. */
 	dl_array_t assembly;  /* dl_array_t:duckLisp_instructionObject_t This is always the true assembly array. */
 } duckLisp_subCompileState_t;
 
@@ -241,6 +242,21 @@ typedef enum {
 	duckLisp_instructionClass_equal,
 	duckLisp_instructionClass_less,
 	duckLisp_instructionClass_greater,
+	/* Type-specialized arithmetic. Emitted when both operands are known to be integers or known to be floats. */
+	duckLisp_instructionClass_mulInteger,
+	duckLisp_instructionClass_mulFloat,
+	duckLisp_instructionClass_divInteger,
+	duckLisp_instructionClass_divFloat,
+	duckLisp_instructionClass_addInteger,
+	duckLisp_instructionClass_addFloat,
+	duckLisp_instructionClass_subInteger,
+	duckLisp_instructionClass_subFloat,
+	duckLisp_instructionClass_equalInteger,
+	duckLisp_instructionClass_equalFloat,
+	duckLisp_instructionClass_lessInteger,
+	duckLisp_instructionClass_lessFloat,
+	duckLisp_instructionClass_greaterInteger,
+	duckLisp_instructionClass_greaterFloat,
 	duckLisp_instructionClass_cons,
 	duckLisp_instructionClass_vector,
 	duckLisp_instructionClass_makeVector,
@@ -264,6 +280,50 @@ typedef enum {
 	duckLisp_instructionClass_length,
 	duckLisp_instructionClass_symbolString,
 	duckLisp_instructionClass_symbolId,
+	duckLisp_instructionClass_makeCoroutine,
+	duckLisp_instructionClass_resume,
+	duckLisp_instructionClass_yield,
+	duckLisp_instructionClass_coroutineDonep,
+	duckLisp_instructionClass_send,
+	duckLisp_instructionClass_receive,
+	duckLisp_instructionClass_tryReceive,
+	duckLisp_instructionClass_freeze,
+	duckLisp_instructionClass_parallelMap,
+	duckLisp_instructionClass_makeHashTable,
+	duckLisp_instructionClass_hashTableGet,
+	duckLisp_instructionClass_hashTableSet,
+	duckLisp_instructionClass_hashTableDelete,
+	duckLisp_instructionClass_hashTableNext,
+	duckLisp_instructionClass_vectorPush,
+	duckLisp_instructionClass_vectorPop,
+	duckLisp_instructionClass_vectorTruncate,
+	duckLisp_instructionClass_makeStringBuilder,
+	duckLisp_instructionClass_stringBuilderAppend,
+	duckLisp_instructionClass_stringSearch,
+	duckLisp_instructionClass_stringCompare,
+	duckLisp_instructionClass_utf8Validp,
+	duckLisp_instructionClass_utf8Length,
+	duckLisp_instructionClass_stringUpcase,
+	duckLisp_instructionClass_stringDowncase,
+	duckLisp_instructionClass_makeTypedArray,
+	duckLisp_instructionClass_typedArraySum,
+	duckLisp_instructionClass_typedArrayDot,
+	duckLisp_instructionClass_typedArrayScale,
+	duckLisp_instructionClass_typedArrayAdd,
+	duckLisp_instructionClass_typedArrayMul,
+	duckLisp_instructionClass_typedArrayMin,
+	duckLisp_instructionClass_typedArrayMax,
+	duckLisp_instructionClass_makeRecord,
+	duckLisp_instructionClass_recordSlot,
+	duckLisp_instructionClass_setRecordSlot,
+	duckLisp_instructionClass_pushQuoted,
+	duckLisp_instructionClass_setQuoted,
+	duckLisp_instructionClass_nth,
+	duckLisp_instructionClass_nthcdr,
+	duckLisp_instructionClass_append,
+	duckLisp_instructionClass_reverse,
+	duckLisp_instructionClass_assoc,
+	duckLisp_instructionClass_member,
 	duckLisp_instructionClass_pop,
 	duckLisp_instructionClass_return,
 	duckLisp_instructionClass_halt,
@@ -400,6 +460,23 @@ typedef enum {
 	duckLisp_instruction_less16,
 	duckLisp_instruction_less32,
 
+	/* Type-specialized versions of the above. If an operand turns out to have a different type the VM falls back to the
+	   generic instruction. Only 8 bit forms exist. The assembler emits the generic instructions for larger indices. */
+	duckLisp_instruction_mulInteger8,
+	duckLisp_instruction_mulFloat8,
+	duckLisp_instruction_divInteger8,
+	duckLisp_instruction_divFloat8,
+	duckLisp_instruction_addInteger8,
+	duckLisp_instruction_addFloat8,
+	duckLisp_instruction_subInteger8,
+	duckLisp_instruction_subFloat8,
+	duckLisp_instruction_equalInteger8,
+	duckLisp_instruction_equalFloat8,
+	duckLisp_instruction_greaterInteger8,
+	duckLisp_instruction_greaterFloat8,
+	duckLisp_instruction_lessInteger8,
+	duckLisp_instruction_lessFloat8,
+
 	duckLisp_instruction_cons8,
 	duckLisp_instruction_cons16,
 	duckLisp_instruction_cons32,
@@ -490,6 +567,78 @@ typedef enum {
 	duckLisp_instruction_symbolId16,
 	duckLisp_instruction_symbolId32,
 
+	duckLisp_instruction_makeCoroutine8,
+	duckLisp_instruction_makeCoroutine16,
+	duckLisp_instruction_makeCoroutine32,
+
+	duckLisp_instruction_resume8,
+	duckLisp_instruction_resume16,
+	duckLisp_instruction_resume32,
+
+	duckLisp_instruction_yield8,
+	duckLisp_instruction_yield16,
+	duckLisp_instruction_yield32,
+
+	duckLisp_instruction_coroutineDonep8,
+	duckLisp_instruction_coroutineDonep16,
+	duckLisp_instruction_coroutineDonep32,
+
+	duckLisp_instruction_send8,
+	duckLisp_instruction_send16,
+	duckLisp_instruction_send32,
+
+	duckLisp_instruction_receive8,
+	duckLisp_instruction_receive16,
+	duckLisp_instruction_receive32,
+
+	duckLisp_instruction_tryReceive8,
+	duckLisp_instruction_tryReceive16,
+	duckLisp_instruction_tryReceive32,
+
+	duckLisp_instruction_freeze8,
+	duckLisp_instruction_freeze16,
+	duckLisp_instruction_freeze32,
+
+	duckLisp_instruction_parallelMap8,
+	duckLisp_instruction_parallelMap16,
+	duckLisp_instruction_parallelMap32,
+
+	duckLisp_instruction_makeHashTable,
+
+	duckLisp_instruction_hashTableGet8,
+	duckLisp_instruction_hashTableGet16,
+	duckLisp_instruction_hashTableGet32,
+
+	duckLisp_instruction_hashTableSet8,
+	duckLisp_instruction_hashTableSet16,
+	duckLisp_instruction_hashTableSet32,
+
+	duckLisp_instruction_hashTableDelete8,
+	duckLisp_instruction_hashTableDelete16,
+	duckLisp_instruction_hashTableDelete32,
+
+	duckLisp_instruction_hashTableNext8,
+	duckLisp_instruction_hashTableNext16,
+	duckLisp_instruction_hashTableNext32,
+
+	duckLisp_instruction_vectorPush8,
+	duckLisp_instruction_vectorPush16,
+	duckLisp_instruction_vectorPush32,
+
+	duckLisp_instruction_vectorPop8,
+	duckLisp_instruction_vectorPop16,
+	duckLisp_instruction_vectorPop32,
+
+	duckLisp_instruction_vectorTruncate8,
+	duckLisp_instruction_vectorTruncate16,
+	duckLisp_instruction_vectorTruncate32,
+
+	duckLisp_instruction_makeStringBuilder,
+
+	duckLisp_instruction_stringBuilderAppend8,
+	duckLisp_instruction_stringBuilderAppend16,
+	duckLisp_instruction_stringBuilderAppend32,
+
 	duckLisp_instruction_pop8,
 	duckLisp_instruction_pop16,
 	duckLisp_instruction_pop32,
@@ -502,6 +651,112 @@ typedef enum {
 	duckLisp_instruction_halt,
 
 	duckLisp_instruction_nil,
+
+	/* Followed by a byte that selects one of the extended instructions below. One-byte opcodes have run out. */
+	duckLisp_instruction_extended,
+
+	/* Extended instructions. The second byte of the instruction is the low byte of the value. */
+	duckLisp_instruction_extendedFirst = 0x100,
+
+	duckLisp_instruction_stringSearch8 = duckLisp_instruction_extendedFirst,
+	duckLisp_instruction_stringSearch16,
+	duckLisp_instruction_stringSearch32,
+
+	duckLisp_instruction_stringCompare8,
+	duckLisp_instruction_stringCompare16,
+	duckLisp_instruction_stringCompare32,
+
+	duckLisp_instruction_utf8Validp8,
+	duckLisp_instruction_utf8Validp16,
+	duckLisp_instruction_utf8Validp32,
+
+	duckLisp_instruction_utf8Length8,
+	duckLisp_instruction_utf8Length16,
+	duckLisp_instruction_utf8Length32,
+
+	duckLisp_instruction_stringUpcase8,
+	duckLisp_instruction_stringUpcase16,
+	duckLisp_instruction_stringUpcase32,
+
+	duckLisp_instruction_stringDowncase8,
+	duckLisp_instruction_stringDowncase16,
+	duckLisp_instruction_stringDowncase32,
+
+	duckLisp_instruction_makeTypedArray8,
+	duckLisp_instruction_makeTypedArray16,
+	duckLisp_instruction_makeTypedArray32,
+
+	duckLisp_instruction_typedArraySum8,
+	duckLisp_instruction_typedArraySum16,
+	duckLisp_instruction_typedArraySum32,
+
+	duckLisp_instruction_typedArrayDot8,
+	duckLisp_instruction_typedArrayDot16,
+	duckLisp_instruction_typedArrayDot32,
+
+	duckLisp_instruction_typedArrayScale8,
+	duckLisp_instruction_typedArrayScale16,
+	duckLisp_instruction_typedArrayScale32,
+
+	duckLisp_instruction_typedArrayAdd8,
+	duckLisp_instruction_typedArrayAdd16,
+	duckLisp_instruction_typedArrayAdd32,
+
+	duckLisp_instruction_typedArrayMul8,
+	duckLisp_instruction_typedArrayMul16,
+	duckLisp_instruction_typedArrayMul32,
+
+	duckLisp_instruction_typedArrayMin8,
+	duckLisp_instruction_typedArrayMin16,
+	duckLisp_instruction_typedArrayMin32,
+
+	duckLisp_instruction_typedArrayMax8,
+	duckLisp_instruction_typedArrayMax16,
+	duckLisp_instruction_typedArrayMax32,
+
+	duckLisp_instruction_makeRecord8,
+	duckLisp_instruction_makeRecord16,
+	duckLisp_instruction_makeRecord32,
+
+	duckLisp_instruction_recordSlot8,
+	duckLisp_instruction_recordSlot16,
+	duckLisp_instruction_recordSlot32,
+
+	duckLisp_instruction_setRecordSlot8,
+	duckLisp_instruction_setRecordSlot16,
+	duckLisp_instruction_setRecordSlot32,
+
+	duckLisp_instruction_pushQuoted8,
+	duckLisp_instruction_pushQuoted16,
+	duckLisp_instruction_pushQuoted32,
+
+	duckLisp_instruction_setQuoted8,
+	duckLisp_instruction_setQuoted16,
+	duckLisp_instruction_setQuoted32,
+
+	duckLisp_instruction_nth8,
+	duckLisp_instruction_nth16,
+	duckLisp_instruction_nth32,
+
+	duckLisp_instruction_nthcdr8,
+	duckLisp_instruction_nthcdr16,
+	duckLisp_instruction_nthcdr32,
+
+	duckLisp_instruction_append8,
+	duckLisp_instruction_append16,
+	duckLisp_instruction_append32,
+
+	duckLisp_instruction_reverse8,
+	duckLisp_instruction_reverse16,
+	duckLisp_instruction_reverse32,
+
+	duckLisp_instruction_assoc8,
+	duckLisp_instruction_assoc16,
+	duckLisp_instruction_assoc32,
+
+	duckLisp_instruction_member8,
+	duckLisp_instruction_member16,
+	duckLisp_instruction_member32,
 } duckLisp_instruction_t;
 
 typedef enum {
@@ -750,6 +1005,12 @@ dl_error_t duckLisp_disassemble(dl_array_t *string,
                                 dl_memoryAllocation_t *memoryAllocation,
                                 const dl_uint8_t *bytecode,
                                 const dl_size_t length);
+/* Find the length in bytes of the instruction at `offset`, including its opcode and operands. Fails if the opcode is
+   unknown or the instruction runs past the end of the bytecode. */
+dl_error_t duckLisp_instructionLength(const dl_uint8_t *bytecode,
+                                      const dl_size_t length,
+                                      const dl_size_t offset,
+                                      dl_size_t *instructionLength);
 
 
 /* Pretty printing functions for debugging. */
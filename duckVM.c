@@ -32,6 +32,17 @@ SOFTWARE.
 
 duckVM_object_t duckVM_object_makeUpvalueArray(duckVM_object_t **upvalues, dl_size_t length);
 
+/* Programs and frozen regions may be shared between threads, so their reference counts are changed atomically.
+   duck-lisp is C99, which has no atomics, so this uses compiler builtins. Without them the count is not thread-safe. */
+#if defined(__GNUC__) || defined(__clang__)
+# define DUCKVM_ATOMIC_INCREMENT(pointer) ((void) __atomic_add_fetch((pointer), 1, __ATOMIC_RELAXED))
+# define DUCKVM_ATOMIC_DECREMENT(pointer) __atomic_sub_fetch((pointer), 1, __ATOMIC_ACQ_REL)
+#else
+# define DUCKVM_ATOMIC_INCREMENT(pointer) ((void) ++*(pointer))
+# define DUCKVM_ATOMIC_DECREMENT(pointer) (--*(pointer))
+#endif
+
+
 dl_error_t duckVM_error_pushRuntime(duckVM_t *duckVM, const dl_uint8_t *message, const dl_size_t message_length) {
 	dl_error_t e = dl_error_ok;
 
@@ -53,6 +64,7 @@ dl_error_t duckVM_gclist_init(duckVM_gclist_t *gclist,
 
 	gclist->memoryAllocation = memoryAllocation;
 	gclist->duckVM = duckVM;
+	gclist->frozenReached = dl_null;
 
 
 	e = dl_malloc(gclist->memoryAllocation,
@@ -105,17 +117,52 @@ static dl_error_t duckVM_gclist_quit(duckVM_gclist_t *gclist) {
 	return e;
 }
 
+/* Check if the object was allocated from this heap. Frozen objects live outside of every heap. */
+static dl_bool_t duckVM_gclist_owns(const duckVM_gclist_t *gclist, const duckVM_object_t *object) {
+	return (object >= gclist->objects) && (object < gclist->objects + gclist->objects_length);
+}
+
+/* Return the index in `duckVM->frozen` where a region whose objects start at `object` belongs. The regions are sorted
+   by that address, so this is a binary search. */
+static dl_size_t duckVM_frozen_search(const duckVM_t *duckVM, const duckVM_object_t *object) {
+	dl_size_t low = 0;
+	dl_size_t high = duckVM->frozen.elements_length;
+	while (low < high) {
+		const dl_size_t middle = low + (high - low) / 2;
+		if (DL_ARRAY_GETADDRESS(duckVM->frozen, duckVM_frozen_t *, middle)->objects <= object) low = middle + 1;
+		else high = middle;
+	}
+	return low;
+}
+
+/* Return the index in `duckVM->frozen` of the region that holds a frozen object, or -1 if the VM holds no such
+   region. */
+static dl_ptrdiff_t duckVM_frozen_index(const duckVM_t *duckVM, const duckVM_object_t *object) {
+	const dl_size_t index = duckVM_frozen_search(duckVM, object);
+	duckVM_frozen_t *region;
+	if (index == 0) return -1;
+	region = DL_ARRAY_GETADDRESS(duckVM->frozen, duckVM_frozen_t *, index - 1);
+	if (object >= region->objects + region->objects_length) return -1;
+	return index - 1;
+}
+
 static dl_error_t duckVM_gclist_markObject(duckVM_gclist_t *gclist, duckVM_object_t *object, dl_bool_t stack) {
 	dl_error_t e = dl_error_ok;
+	dl_error_t eError = dl_error_ok;
 
 	/* Array of pointers that need to be traced. */
 	dl_array_t dispatchStack;
+	/* Objects held by value: hash table entries, record slots, the stacks saved by coroutines, and quoted constants.
+	   They aren't heap objects, so they are traced like the VM's stack instead of being marked. */
+	dl_array_t valueStack;
 	(void) dl_array_init(&dispatchStack, gclist->memoryAllocation, sizeof(duckVM_object_t *), dl_array_strategy_double);
+	(void) dl_array_init(&valueStack, gclist->memoryAllocation, sizeof(duckVM_object_t *), dl_array_strategy_double);
 
 	while (dl_true) {
-		// Bug: It is possible for object - gclist->objects to be negative during an OOM condition.
+		/* Frozen objects are never traced. They can only point to other frozen objects. */
 		if (object && (stack
-		               || !gclist->objectInUse[(dl_ptrdiff_t) (object - gclist->objects)])) {
+		               || (duckVM_gclist_owns(gclist, object)
+		                   && !gclist->objectInUse[(dl_ptrdiff_t) (object - gclist->objects)]))) {
 			if (!stack) {
 				gclist->objectInUse[(dl_ptrdiff_t) (object - gclist->objects)] = dl_true;
 			}
@@ -144,6 +191,11 @@ static dl_error_t duckVM_gclist_markObject(duckVM_gclist_t *gclist, duckVM_objec
 					e = dl_array_pushElement(&dispatchStack, &object->value.upvalue.value.heap_upvalue);
 					if (e) goto cleanup;
 				}
+				else if (object->value.upvalue.coroutine != dl_null) {
+					/* Keep the stack the upvalue points into alive. */
+					e = dl_array_pushElement(&dispatchStack, &object->value.upvalue.coroutine);
+					if (e) goto cleanup;
+				}
 			}
 			else if (object->type == duckVM_object_type_upvalueArray) {
 				DL_DOTIMES(k, object->value.upvalue_array.length) {
@@ -185,6 +237,89 @@ static dl_error_t duckVM_gclist_markObject(duckVM_gclist_t *gclist, duckVM_objec
 				e = dl_array_pushElement(&dispatchStack, &object->value.internalComposite.function);
 				if (e) goto cleanup;
 			}
+			else if (object->type == duckVM_object_type_coroutine) {
+				e = dl_array_pushElement(&dispatchStack, &object->value.coroutine);
+				if (e) goto cleanup;
+			}
+			else if (object->type == duckVM_object_type_internalCoroutine) {
+				duckVM_coroutineContext_t *context = object->value.internalCoroutine.context;
+				e = dl_array_pushElement(&dispatchStack, &object->value.internalCoroutine.function);
+				if (e) goto cleanup;
+				e = dl_array_pushElement(&dispatchStack, &object->value.internalCoroutine.resumer);
+				if (e) goto cleanup;
+				DL_DOTIMES(k, context->stack.elements_length) {
+					duckVM_object_t *value = &DL_ARRAY_GETADDRESS(context->stack, duckVM_object_t, k);
+					e = dl_array_pushElement(&valueStack, &value);
+					if (e) goto cleanup;
+				}
+				DL_DOTIMES(k, context->upvalue_stack.elements_length) {
+					e = dl_array_pushElement(&dispatchStack,
+					                         &DL_ARRAY_GETADDRESS(context->upvalue_stack, duckVM_object_t *, k));
+					if (e) goto cleanup;
+				}
+				DL_DOTIMES(k, context->call_stack.elements_length) {
+					e = dl_array_pushElement(&dispatchStack,
+					                         &DL_ARRAY_GETADDRESS(context->call_stack, duckVM_callFrame_t, k).bytecode);
+					if (e) goto cleanup;
+				}
+				e = dl_array_pushElement(&dispatchStack, &context->bytecode);
+				if (e) goto cleanup;
+			}
+			else if (object->type == duckVM_object_type_hashTable) {
+				e = dl_array_pushElement(&dispatchStack, &object->value.hashTable);
+				if (e) goto cleanup;
+			}
+			else if (object->type == duckVM_object_type_stringBuilder) {
+				e = dl_array_pushElement(&dispatchStack, &object->value.stringBuilder);
+				if (e) goto cleanup;
+			}
+			else if (object->type == duckVM_object_type_typedArray) {
+				e = dl_array_pushElement(&dispatchStack, &object->value.typedArray);
+				if (e) goto cleanup;
+			}
+			else if (object->type == duckVM_object_type_record) {
+				e = dl_array_pushElement(&dispatchStack, &object->value.record);
+				if (e) goto cleanup;
+			}
+			else if (object->type == duckVM_object_type_internalRecord) {
+				DL_DOTIMES(k, object->value.internalRecord.slots_length) {
+					duckVM_object_t *value = &object->value.internalRecord.slots[k];
+					e = dl_array_pushElement(&valueStack, &value);
+					if (e) goto cleanup;
+				}
+			}
+			else if (object->type == duckVM_object_type_internalHashTable) {
+				/* Deleted entries keep their keys. */
+				duckVM_hashTableEntry_t *tables[2];
+				dl_size_t capacities[2];
+				tables[0] = object->value.internalHashTable.entries;
+				capacities[0] = object->value.internalHashTable.capacity;
+				tables[1] = object->value.internalHashTable.oldEntries;
+				capacities[1] = object->value.internalHashTable.oldCapacity;
+				DL_DOTIMES(j, 2) {
+					if (tables[j] == dl_null) continue;
+					DL_DOTIMES(k, capacities[j]) {
+						duckVM_hashTableEntry_t *entry = &tables[j][k];
+						if (entry->state == duckVM_hashTableEntry_state_empty) continue;
+						duckVM_object_t *value = &entry->key;
+						e = dl_array_pushElement(&valueStack, &value);
+						if (e) goto cleanup;
+						if (entry->state == duckVM_hashTableEntry_state_full) {
+							value = &entry->value;
+							e = dl_array_pushElement(&valueStack, &value);
+							if (e) goto cleanup;
+						}
+					}
+				}
+			}
+			else if (object->type == duckVM_object_type_bytecode) {
+				/* Quoted constants are frozen. They are only traced to find their regions. */
+				DL_DOTIMES(k, object->value.bytecode.quoted_length) {
+					duckVM_object_t *value = &object->value.bytecode.quoted[k];
+					e = dl_array_pushElement(&valueStack, &value);
+					if (e) goto cleanup;
+				}
+			}
 			else if (object->type == duckVM_object_type_user) {
 				if (object->value.user.marker) {
 					/* User-provided marking function */
@@ -194,24 +329,92 @@ static dl_error_t duckVM_gclist_markObject(duckVM_gclist_t *gclist, duckVM_objec
 			}
 			/* else ignore, since the stack is the root of GC. Would cause a cycle (infinite loop) if we handled it. */
 		}
+		else if ((object != dl_null) && !duckVM_gclist_owns(gclist, object) && (gclist->frozenReached != dl_null)) {
+			/* A frozen object. Keep its region. */
+			const dl_ptrdiff_t index = duckVM_frozen_index(gclist->duckVM, object);
+			if (index >= 0) gclist->frozenReached[index] = dl_true;
+		}
 
-		e = dl_array_popElement(&dispatchStack, &object);
+		e = dl_array_popElement(&valueStack, &object);
 		if (e == dl_error_bufferUnderflow) {
-			e = dl_error_ok;
-			break;
+			e = dl_array_popElement(&dispatchStack, &object);
+			if (e == dl_error_bufferUnderflow) {
+				e = dl_error_ok;
+				break;
+			}
+			if (e) goto cleanup;
+			stack = dl_false;
+		}
+		else if (e) goto cleanup;
+		else stack = dl_true;
+	}
+
+ cleanup:
+	eError = dl_array_quit(&valueStack);
+	if (eError) e = eError;
+	eError = dl_array_quit(&dispatchStack);
+	if (eError) e = eError;
+	return e;
+}
+
+/* Release the VM's reference to each frozen region that the collector didn't reach. Regions that a reached region
+   depends on are kept too, since the VM has to be able to find them when it sends their objects. */
+static dl_error_t duckVM_frozen_releaseUnreached(duckVM_t *duckVM, dl_bool_t *reached) {
+	dl_error_t e = dl_error_ok;
+	dl_error_t eError = dl_error_ok;
+
+	dl_array_t *frozen = &duckVM->frozen;
+	dl_size_t kept = 0;
+	dl_array_t pending;  /* dl_size_t */
+	/**/ dl_array_init(&pending, duckVM->memoryAllocation, sizeof(dl_size_t), dl_array_strategy_double);
+
+	DL_DOTIMES(i, frozen->elements_length) {
+		if (reached[i]) {
+			e = dl_array_pushElement(&pending, &i);
+			if (e) goto cleanup;
 		}
+	}
+	while (pending.elements_length > 0) {
+		dl_size_t i;
+		duckVM_frozen_t *region;
+		e = dl_array_popElement(&pending, &i);
 		if (e) goto cleanup;
+		region = DL_ARRAY_GETADDRESS(*frozen, duckVM_frozen_t *, i);
+		DL_DOTIMES(j, region->dependencies.elements_length) {
+			duckVM_frozen_t *dependency = DL_ARRAY_GETADDRESS(region->dependencies, duckVM_frozen_t *, j);
+			const dl_ptrdiff_t found = duckVM_frozen_index(duckVM, dependency->objects);
+			dl_size_t index;
+			if (found < 0) continue;
+			index = found;
+			if (!reached[index]) {
+				reached[index] = dl_true;
+				e = dl_array_pushElement(&pending, &index);
+				if (e) goto cleanup;
+			}
+		}
+	}
 
-		stack = dl_false;
+	DL_DOTIMES(i, frozen->elements_length) {
+		duckVM_frozen_t *region = DL_ARRAY_GETADDRESS(*frozen, duckVM_frozen_t *, i);
+		if (reached[i]) {
+			DL_ARRAY_GETADDRESS(*frozen, duckVM_frozen_t *, kept++) = region;
+		}
+		else {
+			eError = duckVM_frozen_release(region);
+			if (eError) e = eError;
+		}
 	}
+	frozen->elements_length = kept;
 
  cleanup:
-	e = dl_array_quit(&dispatchStack);
+	eError = dl_array_quit(&pending);
+	if (eError) e = eError;
 	return e;
 }
 
 static dl_error_t duckVM_gclist_garbageCollect(duckVM_t *duckVM) {
 	dl_error_t e = dl_error_ok;
+	dl_error_t eError = dl_error_ok;
 
 	/* Clear the in use flags. */
 	duckVM_gclist_t *gclistPointer = &duckVM->gclist;
@@ -221,6 +424,15 @@ static dl_error_t duckVM_gclist_garbageCollect(duckVM_t *duckVM) {
 		gclistCopy.objectInUse[i] = dl_false;
 	}
 
+	/* If this fails, every frozen region is kept until the next collection. */
+	if ((duckVM->frozen.elements_length > 0)
+	    && !DL_MALLOC(duckVM->memoryAllocation,
+	                  &gclistPointer->frozenReached,
+	                  duckVM->frozen.elements_length,
+	                  dl_bool_t)) {
+		/**/ dl_memclear(gclistPointer->frozenReached, duckVM->frozen.elements_length * sizeof(dl_bool_t));
+	}
+
 	/* Mark the cells in use. */
 
 	/* Stack */
@@ -265,6 +477,12 @@ static dl_error_t duckVM_gclist_garbageCollect(duckVM_t *duckVM) {
 			if (e) goto cleanup;
 	}
 
+	/* Running coroutines. Each one holds the state of the one that resumed it. */
+	if (duckVM->currentCoroutine != dl_null) {
+		e = duckVM_gclist_markObject(gclistPointer, duckVM->currentCoroutine, dl_false);
+		if (e) goto cleanup;
+	}
+
 	/* Free cells if not marked. */
 	gclistPointer->freeObjects_length = 0;  /* This feels horribly inefficient. (That's 'cause it is.) */
 	for (dl_ptrdiff_t i = 0; (dl_size_t) i < gclistCopy.objects_length; i++) {
@@ -286,11 +504,38 @@ static dl_error_t duckVM_gclist_garbageCollect(duckVM_t *duckVM) {
 				e = DL_FREE(duckVM->memoryAllocation, &objectPointer->value.internal_vector.values);
 				if (e) goto cleanup;
 			}
-			else if ((type == duckVM_object_type_bytecode)
-			         /* Prevent multiple frees. */
-			         && (object.value.bytecode.bytecode != dl_null)) {
-				e = DL_FREE(duckVM->memoryAllocation, &objectPointer->value.bytecode.bytecode);
-				if (e) goto cleanup;
+			else if (type == duckVM_object_type_bytecode) {
+				/* Prevent multiple frees. */
+				if (object.value.bytecode.quoted != dl_null) {
+					e = DL_FREE(duckVM->memoryAllocation, &objectPointer->value.bytecode.quoted);
+					if (e) goto cleanup;
+					objectPointer->value.bytecode.quoted_length = 0;
+				}
+				if (object.value.bytecode.polymorphic != dl_null) {
+					e = DL_FREE(duckVM->memoryAllocation, &objectPointer->value.bytecode.polymorphic);
+					if (e) goto cleanup;
+				}
+				while (objectPointer->value.bytecode.native != dl_null) {
+					duckVM_native_t *native = objectPointer->value.bytecode.native;
+					objectPointer->value.bytecode.native = native->next;
+					/**/ duckVM->jit->free(duckVM->jit->data, duckVM, native);
+				}
+				if (object.value.bytecode.nativeEntries != dl_null) {
+					e = DL_FREE(duckVM->memoryAllocation, &objectPointer->value.bytecode.nativeEntries);
+					if (e) goto cleanup;
+				}
+				if (object.value.bytecode.bytecode != dl_null) {
+					if (object.value.bytecode.program == dl_null) {
+						e = DL_FREE(duckVM->memoryAllocation, &objectPointer->value.bytecode.bytecode);
+						if (e) goto cleanup;
+					}
+					else {
+						e = duckVM_program_release(object.value.bytecode.program);
+						objectPointer->value.bytecode.bytecode = dl_null;
+						objectPointer->value.bytecode.program = dl_null;
+						if (e) goto cleanup;
+					}
+				}
 			}
 			else if ((type == duckVM_object_type_internalString)
 			         /* Prevent multiple frees. */
@@ -298,6 +543,46 @@ static dl_error_t duckVM_gclist_garbageCollect(duckVM_t *duckVM) {
 				e = DL_FREE(duckVM->memoryAllocation, &objectPointer->value.internalString.value);
 				if (e) goto cleanup;
 			}
+			else if ((type == duckVM_object_type_internalCoroutine)
+			         /* Prevent multiple frees. */
+			         && (object.value.internalCoroutine.context != dl_null)) {
+				duckVM_coroutineContext_t *context = object.value.internalCoroutine.context;
+				e = dl_array_quit(&context->stack);
+				if (e) goto cleanup;
+				e = dl_array_quit(&context->call_stack);
+				if (e) goto cleanup;
+				e = dl_array_quit(&context->upvalue_stack);
+				if (e) goto cleanup;
+				e = dl_array_quit(&context->upvalue_array_call_stack);
+				if (e) goto cleanup;
+				e = DL_FREE(duckVM->memoryAllocation, &objectPointer->value.internalCoroutine.context);
+				if (e) goto cleanup;
+			}
+			else if (type == duckVM_object_type_internalHashTable) {
+				/* Prevent multiple frees. */
+				if (object.value.internalHashTable.entries != dl_null) {
+					e = DL_FREE(duckVM->memoryAllocation, &objectPointer->value.internalHashTable.entries);
+					if (e) goto cleanup;
+				}
+				if (object.value.internalHashTable.oldEntries != dl_null) {
+					e = DL_FREE(duckVM->memoryAllocation, &objectPointer->value.internalHashTable.oldEntries);
+					if (e) goto cleanup;
+				}
+			}
+			else if (type == duckVM_object_type_internalTypedArray) {
+				/* Prevent multiple frees. */
+				if (object.value.internalTypedArray.elements.u8 != dl_null) {
+					e = DL_FREE(duckVM->memoryAllocation, &objectPointer->value.internalTypedArray.elements.u8);
+					if (e) goto cleanup;
+				}
+			}
+			else if (type == duckVM_object_type_internalRecord) {
+				/* Prevent multiple frees. */
+				if (object.value.internalRecord.slots != dl_null) {
+					e = DL_FREE(duckVM->memoryAllocation, &objectPointer->value.internalRecord.slots);
+					if (e) goto cleanup;
+				}
+			}
 			else if ((type == duckVM_object_type_user)
 			         && (object.value.user.destructor != dl_null)) {
 				e = object.value.user.destructor(gclistPointer, objectPointer);
@@ -307,7 +592,16 @@ static dl_error_t duckVM_gclist_garbageCollect(duckVM_t *duckVM) {
 		}
 	}
 
+	if (gclistPointer->frozenReached != dl_null) {
+		e = duckVM_frozen_releaseUnreached(duckVM, gclistPointer->frozenReached);
+		if (e) goto cleanup;
+	}
+
  cleanup:
+	if (gclistPointer->frozenReached != dl_null) {
+		eError = DL_FREE(duckVM->memoryAllocation, &gclistPointer->frozenReached);
+		if (eError) e = eError;
+	}
 	return e;
 }
 
@@ -359,6 +653,7 @@ static dl_error_t duckVM_gclist_pushObject(duckVM_t *duckVM, duckVM_object_t **o
 		if (e) goto cleanup;
 	}
 	else if (objectIn.type == duckVM_object_type_internalVector) {
+		heapObject->value.internal_vector.capacity = objectIn.value.internal_vector.length;
 		if (objectIn.value.internal_vector.length > 0) {
 			e = DL_MALLOC(duckVM->memoryAllocation,
 			              (void **) &heapObject->value.internal_vector.values,
@@ -382,7 +677,16 @@ static dl_error_t duckVM_gclist_pushObject(duckVM_t *duckVM, duckVM_object_t **o
 		if (e) goto cleanup;
 	}
 	else if (objectIn.type == duckVM_object_type_bytecode) {
-		if (objectIn.value.bytecode.bytecode_length > 0) {
+		heapObject->value.bytecode.quoted = dl_null;
+		heapObject->value.bytecode.quoted_length = 0;
+		heapObject->value.bytecode.polymorphic = dl_null;
+		heapObject->value.bytecode.native = dl_null;
+		heapObject->value.bytecode.nativeEntries = dl_null;
+		if (objectIn.value.bytecode.program != dl_null) {
+			/* Shared programs are referenced, not copied. */
+			duckVM_program_retain(objectIn.value.bytecode.program);
+		}
+		else if (objectIn.value.bytecode.bytecode_length > 0) {
 			e = DL_MALLOC(duckVM->memoryAllocation,
 			              &heapObject->value.bytecode.bytecode,
 			              objectIn.value.bytecode.bytecode_length,
@@ -404,6 +708,8 @@ static dl_error_t duckVM_gclist_pushObject(duckVM_t *duckVM, duckVM_object_t **o
 		if (e) goto cleanup;
 	}
 	else if (objectIn.type == duckVM_object_type_internalString) {
+		heapObject->value.internalString.capacity = objectIn.value.internalString.value_length;
+		heapObject->value.internalString.hashed = dl_false;
 		if (objectIn.value.internalString.value_length > 0) {
 			e = DL_MALLOC(duckVM->memoryAllocation,
 			              &heapObject->value.internalString.value,
@@ -438,6 +744,15 @@ dl_error_t duckVM_init(duckVM_t *duckVM, dl_memoryAllocation_t *memoryAllocation
 
 	duckVM->memoryAllocation = memoryAllocation;
 	duckVM->currentBytecode = dl_null;
+	duckVM->suspendedIp = dl_null;
+	duckVM->currentCoroutine = dl_null;
+	duckVM->callDepth = 0;
+	duckVM->messageMap = dl_null;
+	duckVM->mapPool = dl_null;
+	duckVM->jit = dl_null;
+	DL_DOTIMES(i, DUCKVM_JIT_COUNTS) {
+		duckVM->jitCounts[i] = 0;
+	}
 	duckVM->nextUserType = duckVM_object_type_last;
 	/**/ dl_array_init(&duckVM->errors, duckVM->memoryAllocation, sizeof(dl_uint8_t), dl_array_strategy_double);
 	/**/ dl_array_init(&duckVM->stack, duckVM->memoryAllocation, sizeof(duckVM_object_t), dl_array_strategy_double);
@@ -463,6 +778,17 @@ dl_error_t duckVM_init(duckVM_t *duckVM, dl_memoryAllocation_t *memoryAllocation
 	                   duckVM->memoryAllocation,
 	                   sizeof(dl_ptrdiff_t),
 	                   dl_array_strategy_double);
+	/**/ dl_array_init(&duckVM->channels,
+	                   duckVM->memoryAllocation,
+	                   sizeof(duckVM_mailbox_t *),
+	                   dl_array_strategy_double);
+	/**/ dl_array_init(&duckVM->frozen,
+	                   duckVM->memoryAllocation,
+	                   sizeof(duckVM_frozen_t *),
+	                   dl_array_strategy_double);
+	/**/ dl_array_init(&duckVM->lastBytecode, duckVM->memoryAllocation, sizeof(dl_uint8_t), dl_array_strategy_double);
+	duckVM->lastBytecode_stackLength = 0;
+	duckVM->lastBytecode_verified = dl_false;
 	e = duckVM_gclist_init(&duckVM->gclist, duckVM->memoryAllocation, duckVM, maxObjects);
 	if (e) goto cleanup;
 	duckVM->duckLisp = dl_null;
@@ -479,8 +805,18 @@ void duckVM_quit(duckVM_t *duckVM) {
 	e = dl_array_quit(&duckVM->globals);
 	e = dl_array_quit(&duckVM->globals_map);
 	e = dl_array_quit(&duckVM->call_stack);
+	e = dl_array_quit(&duckVM->channels);
+	if (duckVM->messageMap != dl_null) e = DL_FREE(duckVM->memoryAllocation, &duckVM->messageMap);
 	duckVM->currentBytecode = dl_null;
+	duckVM->suspendedIp = dl_null;
+	duckVM->currentCoroutine = dl_null;
+	duckVM->callDepth = 0;
 	e = duckVM_gclist_garbageCollect(duckVM);
+	DL_DOTIMES(i, duckVM->frozen.elements_length) {
+		e = duckVM_frozen_release(DL_ARRAY_GETADDRESS(duckVM->frozen, duckVM_frozen_t *, i));
+	}
+	e = dl_array_quit(&duckVM->frozen);
+	e = dl_array_quit(&duckVM->lastBytecode);
 	e = dl_array_quit(&duckVM->upvalue_array_call_stack);
 	/**/ duckVM_gclist_quit(&duckVM->gclist);
 	e = dl_array_quit(&duckVM->errors);
@@ -491,6 +827,16 @@ void duckVM_quit(duckVM_t *duckVM) {
 
 static dl_error_t stack_push(duckVM_t *duckVM, duckVM_object_t *object) {
 	dl_error_t e = dl_error_ok;
+	dl_array_t *stack = &duckVM->stack;
+	dl_array_t *upvalue_stack = &duckVM->upvalue_stack;
+	/* Almost every instruction pushes, and the stacks rarely need to grow, so skip the generic array code when there is
+	   room. */
+	if (((stack->elements_length + 1) * sizeof(duckVM_object_t) <= stack->elements_memorySize)
+	    && ((upvalue_stack->elements_length + 1) * sizeof(duckVM_object_t *) <= upvalue_stack->elements_memorySize)) {
+		((duckVM_object_t *) stack->elements)[stack->elements_length++] = *object;
+		((duckVM_object_t **) upvalue_stack->elements)[upvalue_stack->elements_length++] = dl_null;
+		return e;
+	}
 	e = dl_array_pushElement(&duckVM->stack, object);
 	if (e) goto cleanup;
 	e = dl_array_pushElement(&duckVM->upvalue_stack, dl_null);
@@ -547,6 +893,40 @@ static dl_error_t stack_set(duckVM_t *duckVM, duckVM_object_t *element, dl_ptrdi
 	return dl_array_set(&duckVM->stack, element, index);
 }
 
+/* Read the operand `index` objects down from the top of the stack. If the bytecode has been verified, the index is
+   already known to be in range, so the object is read straight through the stack top. That only holds while every
+   instruction has the stack effect the verifier assumed, which is why `duckVM_callCallback` checks C callbacks instead
+   of trusting them. */
+static dl_error_t stack_getOperand(duckVM_t *duckVM,
+                                   const duckVM_object_t *bytecode,
+                                   duckVM_object_t *element,
+                                   const dl_ptrdiff_t index) {
+	if (bytecode->value.bytecode.verified) {
+		const duckVM_object_t *stackTop = ((duckVM_object_t *) duckVM->stack.elements
+		                                   + duckVM->stack.elements_length);
+		*element = stackTop[-index];
+		return dl_error_ok;
+	}
+	if ((index < 1) || ((dl_size_t) index > duckVM->stack.elements_length)) return dl_error_invalidValue;
+	*element = ((duckVM_object_t *) duckVM->stack.elements)[duckVM->stack.elements_length - index];
+	return dl_error_ok;
+}
+
+/* Write the operand `index` objects down from the top of the stack. See `stack_getOperand`. */
+static dl_error_t stack_setOperand(duckVM_t *duckVM,
+                                   const duckVM_object_t *bytecode,
+                                   const duckVM_object_t *element,
+                                   const dl_ptrdiff_t index) {
+	if (bytecode->value.bytecode.verified) {
+		duckVM_object_t *stackTop = (duckVM_object_t *) duckVM->stack.elements + duckVM->stack.elements_length;
+		stackTop[-index] = *element;
+		return dl_error_ok;
+	}
+	if ((index < 1) || ((dl_size_t) index > duckVM->stack.elements_length)) return dl_error_invalidValue;
+	((duckVM_object_t *) duckVM->stack.elements)[duckVM->stack.elements_length - index] = *element;
+	return dl_error_ok;
+}
+
 static dl_error_t call_stack_push(duckVM_t *duckVM,
                                   dl_uint8_t *ip,
                                   duckVM_object_t *bytecode,
@@ -637,6 +1017,59 @@ dl_bool_t duckVM_listIsCyclic(duckVM_object_t *rootCons) {
 	return dl_false;
 }
 
+/* Count the conses in a list. Cycles are detected with Brent's algorithm while counting, so the list is only walked
+   once. Returns false if the list is circular. */
+static dl_bool_t duckVM_list_length(duckVM_object_t *rootCons, dl_size_t *length) {
+	duckVM_object_t *slow = rootCons;
+	duckVM_object_t *fast = rootCons;
+	dl_size_t taken = 0;
+	dl_size_t limit = 2;
+	*length = 0;
+	while ((fast != dl_null) && (fast->type == duckVM_object_type_cons)) {
+		(*length)++;
+		fast = fast->value.cons.cdr;
+		taken++;
+		if (slow == fast) return dl_false;
+		if (taken == limit) {
+			taken = 0;
+			limit *= 2;
+			slow = fast;
+		}
+	}
+	return dl_true;
+}
+
+
+/* Run a C callback. A callback must replace its arguments with exactly one value. Verified bytecode relies on this
+   because it reads operands without bounds checks, so under verified bytecode the stack is checked afterward instead of
+   trusted. */
+static dl_error_t duckVM_callCallback(duckVM_t *duckVM,
+                                      dl_error_t (*callback)(duckVM_t *),
+                                      const dl_uint8_t numberOfArgs,
+                                      const dl_bool_t verified) {
+	dl_error_t e = dl_error_ok;
+	dl_error_t eError = dl_error_ok;
+	dl_size_t stack_length = duckVM->stack.elements_length;
+
+	e = callback(duckVM);
+	if (e) {
+		eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_callCallback: C callback returned error."));
+		if (eError) e = eError;
+		goto cleanup;
+	}
+	if (verified
+	    && ((numberOfArgs > stack_length)
+	        || (duckVM->stack.elements_length != stack_length - numberOfArgs + 1))) {
+		e = dl_error_invalidValue;
+		eError = duckVM_error_pushRuntime(duckVM,
+		                                  DL_STR("duckVM_callCallback: C callback must pop its arguments and push one value."));
+		if (eError) e = eError;
+		goto cleanup;
+	}
+
+ cleanup:
+	return e;
+}
 
 static dl_error_t duckVM_instruction_prepareForFuncall(duckVM_t *duckVM,
                                                        duckVM_object_t *functionObject,
@@ -742,600 +1175,5527 @@ static dl_error_t duckVM_instruction_prepareForFuncall(duckVM_t *duckVM,
 }                
 
 
-int duckVM_executeInstruction(duckVM_t *duckVM,
-                              duckVM_object_t *bytecode,
-                              unsigned char **ipPtr,
-                              duckVM_halt_mode_t *halt) {
+/* Coroutines */
+
+/* Exchange the VM's execution state with the state saved in the coroutine. */
+static void duckVM_coroutine_swapContext(duckVM_t *duckVM,
+                                         duckVM_object_t *coroutine,
+                                         dl_uint8_t **ip,
+                                         duckVM_object_t **bytecode) {
+	duckVM_coroutineContext_t *context = coroutine->value.internalCoroutine.context;
+	dl_array_t array;
+	dl_uint8_t *savedIp = *ip;
+	duckVM_object_t *savedBytecode = *bytecode;
+
+	array = duckVM->stack;
+	duckVM->stack = context->stack;
+	context->stack = array;
+	array = duckVM->call_stack;
+	duckVM->call_stack = context->call_stack;
+	context->call_stack = array;
+	array = duckVM->upvalue_stack;
+	duckVM->upvalue_stack = context->upvalue_stack;
+	context->upvalue_stack = array;
+	array = duckVM->upvalue_array_call_stack;
+	duckVM->upvalue_array_call_stack = context->upvalue_array_call_stack;
+	context->upvalue_array_call_stack = array;
+
+	*ip = context->ip;
+	context->ip = savedIp;
+	*bytecode = context->bytecode;
+	context->bytecode = savedBytecode;
+}
+
+/* Return the stack that an open upvalue points into. Only the running code's stack is in `duckVM->stack`. A coroutine
+   that resumed another has its stack saved in the context of the coroutine it resumed, and a suspended coroutine has
+   its own stack saved in its context. */
+static dl_array_t *duckVM_upvalue_stack(duckVM_t *duckVM, const duckVM_upvalue_t *upvalue) {
+	duckVM_object_t *coroutine = duckVM->currentCoroutine;
+	if (upvalue->coroutine == coroutine) return &duckVM->stack;
+	while (coroutine != dl_null) {
+		if (coroutine->value.internalCoroutine.resumer == upvalue->coroutine) {
+			return &coroutine->value.internalCoroutine.context->stack;
+		}
+		coroutine = coroutine->value.internalCoroutine.resumer;
+	}
+	return &upvalue->coroutine->value.internalCoroutine.context->stack;
+}
+
+/* Switch from the current coroutine back to whoever resumed it. */
+static dl_error_t duckVM_coroutine_leave(duckVM_t *duckVM,
+                                         const duckVM_coroutine_status_t status,
+                                         dl_uint8_t **ip,
+                                         duckVM_object_t **bytecode) {
 	dl_error_t e = dl_error_ok;
-	dl_error_t eError = dl_error_ok;
 
-	dl_uint8_t *ptr1 = dl_null;
-	dl_ptrdiff_t ptrdiff1 = 0;
-	dl_ptrdiff_t ptrdiff2 = 0;
-	dl_ptrdiff_t ptrdiff3 = 0;
-	dl_size_t size1 = 0;
-	dl_size_t size2 = 0;
-	dl_uint8_t uint8 = 0;
-	duckVM_object_t object1 = {0};
-	duckVM_object_t object2 = {0};
-	duckVM_object_t object3 = {0};
-	duckVM_object_t *objectPtr1 = {0};
-	duckVM_object_t *objectPtr2 = {0};
-	duckVM_object_t cons1 = {0};
-	dl_bool_t bool1 = dl_false;
-	dl_bool_t parsedBytecode = dl_false;
-	unsigned char *ip = *ipPtr;
-	unsigned char opcode = *(ip++);
-	switch (opcode) {
-	case duckLisp_instruction_nop:
-		break;
+	duckVM_object_t *coroutine = duckVM->currentCoroutine;
+	duckVM_coroutineContext_t *context = coroutine->value.internalCoroutine.context;
+	duckVM_coroutine_swapContext(duckVM, coroutine, ip, bytecode);
+	duckVM->currentCoroutine = coroutine->value.internalCoroutine.resumer;
+	coroutine->value.internalCoroutine.resumer = dl_null;
+	coroutine->value.internalCoroutine.status = status;
+
+	if (status == duckVM_coroutine_status_done) {
+		/* A finished coroutine can't be resumed, so its stacks can go now instead of at the next collection. */
+		context->ip = dl_null;
+		context->bytecode = dl_null;
+		e = dl_array_popElements(&context->stack, dl_null, context->stack.elements_length);
+		if (e) goto cleanup;
+		e = dl_array_popElements(&context->call_stack, dl_null, context->call_stack.elements_length);
+		if (e) goto cleanup;
+		e = dl_array_popElements(&context->upvalue_stack, dl_null, context->upvalue_stack.elements_length);
+		if (e) goto cleanup;
+		e = dl_array_popElements(&context->upvalue_array_call_stack,
+		                         dl_null,
+		                         context->upvalue_array_call_stack.elements_length);
+		if (e) goto cleanup;
+	}
 
-	case duckLisp_instruction_pushSymbol32:
-		size2 = *(ip++);
-		size2 = *(ip++) + (size2 << 8);
-		size2 = *(ip++) + (size2 << 8);
-		size2 = *(ip++) + (size2 << 8);
-		size1 = *(ip++);
-		size1 = *(ip++) + (size1 << 8);
-		size1 = *(ip++) + (size1 << 8);
-		size1 = *(ip++) + (size1 << 8);
-		parsedBytecode = dl_true;
-		/* Fall through */
-	case duckLisp_instruction_pushSymbol16:
-		if (!parsedBytecode) {
-			size2 = *(ip++);
-			size2 = *(ip++) + (size2 << 8);
-			size1 = *(ip++);
-			size1 = *(ip++) + (size1 << 8);
-			parsedBytecode = dl_true;
-		}
-		/* Fall through */
-	case duckLisp_instruction_pushSymbol8:
-		if (!parsedBytecode) {
-			size2 = *(ip++);
-			size1 = *(ip++);
-		}
-		{
-			dl_uint8_t *lastIp = ip;
-			ip += size1;
-			e = duckVM_object_makeSymbol(duckVM, &object1, size2, lastIp, size1);
-			if (e) break;
-		}
-		e = stack_push(duckVM, &object1);
-		if (e) {
-			eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->push-symbol: stack_push failed."));
-			if (!e) e = eError;
-		}
-		break;
+ cleanup:
+	return e;
+}
 
-	case duckLisp_instruction_pushStrippedSymbol32:
-		size2 = *(ip++);
-		size2 = *(ip++) + (size2 << 8);
-		size2 = *(ip++) + (size2 << 8);
-		size2 = *(ip++) + (size2 << 8);
-		parsedBytecode = dl_true;
-		/* Fall through */
-	case duckLisp_instruction_pushStrippedSymbol16:
-		if (!parsedBytecode) {
-			size2 = *(ip++);
-			size2 = *(ip++) + (size2 << 8);
-			parsedBytecode = dl_true;
-		}
-		/* Fall through */
-	case duckLisp_instruction_pushStrippedSymbol8:
-		if (!parsedBytecode) {
-			size2 = *(ip++);
-		}
-		(void) duckVM_object_makeCompressedSymbol(&object1, size2);
-		e = stack_push(duckVM, &object1);
-		if (e) {
-			eError = duckVM_error_pushRuntime(duckVM,
-			                                  DL_STR("duckVM_execute->push-stripped-symbol: stack_push failed."));
-			if (!e) e = eError;
-		}
-		break;
+/* Abandon every coroutine entered since `barrier` was running. Used when an error unwinds out of the interpreter. */
+static dl_error_t duckVM_coroutine_unwind(duckVM_t *duckVM, duckVM_object_t *barrier) {
+	dl_error_t e = dl_error_ok;
+	dl_uint8_t *ip = dl_null;
+	duckVM_object_t *bytecode = dl_null;
+	while ((duckVM->currentCoroutine != dl_null) && (duckVM->currentCoroutine != barrier)) {
+		e = duckVM_coroutine_leave(duckVM, duckVM_coroutine_status_done, &ip, &bytecode);
+		if (e) break;
+	}
+	return e;
+}
 
-	case duckLisp_instruction_pushString32:
-		size1 = *(ip++);
-		size1 = *(ip++) + (size1 << 8);
-		// Fall through
-	case duckLisp_instruction_pushString16:
-		size1 = *(ip++) + (size1 << 8);
-		// Fall through
-	case duckLisp_instruction_pushString8:
-		size1 = *(ip++) + (size1 << 8);
-		{
-			dl_uint8_t *string = ip;
-			dl_size_t string_length = size1;
-			ip += size1;
+/* Return from the function a coroutine was started with. Its result is passed to the resumer like a yielded value. */
+static dl_error_t duckVM_coroutine_finish(duckVM_t *duckVM, dl_uint8_t **ip, duckVM_object_t **bytecode) {
+	dl_error_t e = dl_error_ok;
+
+	duckVM_object_t result;
+	result.type = duckVM_object_type_list;
+	result.value.list = dl_null;
+	if (duckVM->stack.elements_length > 0) {
+		e = dl_array_getTop(&duckVM->stack, &result);
+		if (e) goto cleanup;
+	}
+	e = duckVM_coroutine_leave(duckVM, duckVM_coroutine_status_done, ip, bytecode);
+	if (e) goto cleanup;
+	e = stack_push(duckVM, &result);
+	if (e) goto cleanup;
+
+ cleanup:
+	return e;
+}
+
+
+/* Frozen objects */
+
+void duckVM_frozen_retain(duckVM_frozen_t *region) {
+	DUCKVM_ATOMIC_INCREMENT(&region->references);
+}
+
+dl_error_t duckVM_frozen_release(duckVM_frozen_t *region) {
+	dl_error_t e = dl_error_ok;
+	dl_error_t eError = dl_error_ok;
+	dl_memoryAllocation_t *memoryAllocation = region->memoryAllocation;
+	if (DUCKVM_ATOMIC_DECREMENT(&region->references) > 0) return e;
+	DL_DOTIMES(i, region->dependencies.elements_length) {
+		eError = duckVM_frozen_release(DL_ARRAY_GETADDRESS(region->dependencies, duckVM_frozen_t *, i));
+		if (eError) e = eError;
+	}
+	eError = dl_array_quit(&region->dependencies);
+	if (eError) e = eError;
+	if (region->objects != dl_null) {
+		eError = DL_FREE(memoryAllocation, &region->objects);
+		if (eError) e = eError;
+	}
+	if (region->elements != dl_null) {
+		eError = DL_FREE(memoryAllocation, &region->elements);
+		if (eError) e = eError;
+	}
+	if (region->bytes != dl_null) {
+		eError = DL_FREE(memoryAllocation, &region->bytes);
+		if (eError) e = eError;
+	}
+	eError = DL_FREE(memoryAllocation, &region);
+	if (eError) e = eError;
+	return e;
+}
+
+/* Find the region a frozen object belongs to among the regions the VM holds. */
+static duckVM_frozen_t *duckVM_frozen_find(duckVM_t *duckVM, const duckVM_object_t *object) {
+	const dl_ptrdiff_t index = duckVM_frozen_index(duckVM, object);
+	if (index < 0) return dl_null;
+	return DL_ARRAY_GETADDRESS(duckVM->frozen, duckVM_frozen_t *, index);
+}
+
+/* Add a region to the ones the VM holds, keeping them sorted. The VM takes over the caller's reference. */
+static dl_error_t duckVM_frozen_insert(duckVM_t *duckVM, duckVM_frozen_t *region) {
+	dl_error_t e = dl_error_ok;
+	const dl_size_t index = duckVM_frozen_search(duckVM, region->objects);
+	e = dl_array_pushElement(&duckVM->frozen, &region);
+	if (e) return e;
+	/**/ dl_memcopy(&DL_ARRAY_GETADDRESS(duckVM->frozen, duckVM_frozen_t *, index + 1),
+	                &DL_ARRAY_GETADDRESS(duckVM->frozen, duckVM_frozen_t *, index),
+	                (duckVM->frozen.elements_length - 1 - index) * sizeof(duckVM_frozen_t *));
+	DL_ARRAY_GETADDRESS(duckVM->frozen, duckVM_frozen_t *, index) = region;
+	return e;
+}
+
+/* Give the VM a reference to the region and everything it depends on, unless it already has one. */
+static dl_error_t duckVM_frozen_adopt(duckVM_t *duckVM, duckVM_frozen_t *region) {
+	dl_error_t e = dl_error_ok;
+	if (duckVM_frozen_find(duckVM, region->objects) == region) return e;
+	e = duckVM_frozen_insert(duckVM, region);
+	if (e) return e;
+	/**/ duckVM_frozen_retain(region);
+	DL_DOTIMES(i, region->dependencies.elements_length) {
+		e = duckVM_frozen_adopt(duckVM, DL_ARRAY_GETADDRESS(region->dependencies, duckVM_frozen_t *, i));
+		if (e) return e;
+	}
+	return e;
+}
+
+/* Check if the contents of a sequence are frozen. */
+static dl_bool_t duckVM_object_isFrozen(duckVM_t *duckVM, const duckVM_object_t *object) {
+	const duckVM_object_t *heapObject = dl_null;
+	switch (object->type) {
+	case duckVM_object_type_list:
+		heapObject = object->value.list;
+		break;
+	case duckVM_object_type_vector:
+		heapObject = object->value.vector.internal_vector;
+		break;
+	case duckVM_object_type_string:
+		heapObject = object->value.string.internalString;
+		break;
+	case duckVM_object_type_symbol:
+		heapObject = object->value.symbol.internalString;
+		break;
+	default:
+		break;
+	}
+	return (heapObject != dl_null) && !duckVM_gclist_owns(&duckVM->gclist, heapObject);
+}
+
+
+/* Messages */
+
+static void duckVM_mailbox_lock(duckVM_mailbox_t *mailbox) {
+	if (mailbox->lock != dl_null) mailbox->lock(mailbox->lockData);
+}
+
+static void duckVM_mailbox_unlock(duckVM_mailbox_t *mailbox) {
+	if (mailbox->unlock != dl_null) mailbox->unlock(mailbox->lockData);
+}
+
+static dl_error_t duckVM_message_quit(dl_memoryAllocation_t *memoryAllocation, duckVM_message_t *message) {
+	dl_error_t e = dl_error_ok;
+	dl_error_t eError = dl_error_ok;
+	DL_DOTIMES(i, message->nodes.elements_length) {
+		duckVM_messageNode_t *node = &DL_ARRAY_GETADDRESS(message->nodes, duckVM_messageNode_t, i);
+		if ((node->type == duckVM_object_type_none) && (node->value.frozen.region != dl_null)) {
+			eError = duckVM_frozen_release(node->value.frozen.region);
+			if (eError) e = eError;
+		}
+		else if ((node->type == duckVM_object_type_bytecode) && (node->value.program != dl_null)) {
+			eError = duckVM_program_release(node->value.program);
+			if (eError) e = eError;
+		}
+	}
+	eError = dl_array_quit(&message->nodes);
+	if (eError) e = eError;
+	eError = dl_array_quit(&message->elements);
+	if (eError) e = eError;
+	eError = dl_array_quit(&message->bytes);
+	if (eError) e = eError;
+	eError = DL_FREE(memoryAllocation, &message);
+	if (eError) e = eError;
+	return e;
+}
+
+void duckVM_mailbox_init(duckVM_mailbox_t *mailbox, dl_memoryAllocation_t *memoryAllocation) {
+	mailbox->memoryAllocation = memoryAllocation;
+	mailbox->head = dl_null;
+	mailbox->tail = dl_null;
+	mailbox->length = 0;
+	mailbox->lock = dl_null;
+	mailbox->unlock = dl_null;
+	mailbox->lockData = dl_null;
+}
+
+dl_error_t duckVM_mailbox_quit(duckVM_mailbox_t *mailbox) {
+	dl_error_t e = dl_error_ok;
+	while (mailbox->head != dl_null) {
+		duckVM_message_t *message = mailbox->head;
+		mailbox->head = message->next;
+		dl_error_t eError = duckVM_message_quit(mailbox->memoryAllocation, message);
+		if (eError) e = eError;
+	}
+	mailbox->tail = dl_null;
+	mailbox->length = 0;
+	return e;
+}
+
+/* Find the node of a heap object, adding an empty node for it if it hasn't been seen yet. `visited` lists the heap
+   object of every node after the first. Frozen objects get a finished node each time they are found. */
+static dl_error_t duckVM_message_node(duckVM_t *duckVM,
+                                      duckVM_message_t *message,
+                                      dl_array_t *visited,
+                                      duckVM_object_t *object,
+                                      dl_ptrdiff_t *index) {
+	dl_error_t e = dl_error_ok;
+	duckVM_messageNode_t node;
+	dl_ptrdiff_t slot;
+
+	if (object == dl_null) {
+		*index = -1;
+		goto cleanup;
+	}
+	if (!duckVM_gclist_owns(&duckVM->gclist, object)) {
+		/* Frozen objects are shared instead of copied. The node holds a reference to the object's region. */
+		/**/ dl_memclear(&node, sizeof(duckVM_messageNode_t));
+		node.type = duckVM_object_type_none;
+		node.value.frozen.object = object;
+		node.value.frozen.region = duckVM_frozen_find(duckVM, object);
+		if (node.value.frozen.region == dl_null) {
+			dl_error_t eError = dl_error_ok;
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_send: Object is not in the VM's heap or in a frozen region it holds."));
+			if (eError) e = eError;
+			goto cleanup;
+		}
+		*index = message->nodes.elements_length;
+		e = dl_array_pushElement(&message->nodes, &node);
+		if (e) goto cleanup;
+		/**/ duckVM_frozen_retain(node.value.frozen.region);
+		/* Keeps node indices in step with `visited`. */
+		e = dl_array_pushElement(visited, &object);
+		goto cleanup;
+	}
+	slot = object - duckVM->gclist.objects;
+	if (duckVM->messageMap[slot] >= 0) {
+		*index = duckVM->messageMap[slot];
+		goto cleanup;
+	}
+	*index = message->nodes.elements_length;
+	/**/ dl_memclear(&node, sizeof(duckVM_messageNode_t));
+	e = dl_array_pushElement(&message->nodes, &node);
+	if (e) goto cleanup;
+	e = dl_array_pushElement(visited, &object);
+	if (e) goto cleanup;
+	duckVM->messageMap[slot] = *index;
+
+ cleanup:
+	return e;
+}
+
+/* Fill in the node of an object. Objects it references are given nodes that are filled in later. */
+static dl_error_t duckVM_message_fillNode(duckVM_t *duckVM,
+                                          duckVM_message_t *message,
+                                          dl_array_t *visited,
+                                          duckVM_object_t *object,
+                                          dl_ptrdiff_t index) {
+	dl_error_t e = dl_error_ok;
+	dl_error_t eError = dl_error_ok;
+	duckVM_messageNode_t node;
+	/**/ dl_memclear(&node, sizeof(duckVM_messageNode_t));
+	node.type = object->type;
+
+	switch (object->type) {
+	case duckVM_object_type_bool:
+		node.value.boolean = object->value.boolean;
+		break;
+	case duckVM_object_type_integer:
+		node.value.integer = object->value.integer;
+		break;
+	case duckVM_object_type_float:
+		node.value.floatingPoint = object->value.floatingPoint;
+		break;
+	case duckVM_object_type_type:
+		node.value.type = object->value.type;
+		break;
+	case duckVM_object_type_list:
+		e = duckVM_message_node(duckVM, message, visited, object->value.list, &node.value.list);
+		break;
+	case duckVM_object_type_cons:
+		e = duckVM_message_node(duckVM, message, visited, object->value.cons.car, &node.value.cons.car);
+		if (e) break;
+		e = duckVM_message_node(duckVM, message, visited, object->value.cons.cdr, &node.value.cons.cdr);
+		break;
+	case duckVM_object_type_string:
+		node.value.string.offset = object->value.string.offset;
+		node.value.string.length = object->value.string.length;
+		e = duckVM_message_node(duckVM,
+		                        message,
+		                        visited,
+		                        object->value.string.internalString,
+		                        &node.value.string.internalString);
+		break;
+	case duckVM_object_type_symbol:
+		node.value.symbol.id = object->value.symbol.id;
+		e = duckVM_message_node(duckVM,
+		                        message,
+		                        visited,
+		                        object->value.symbol.internalString,
+		                        &node.value.symbol.internalString);
+		break;
+	case duckVM_object_type_vector:
+		node.value.vector.offset = object->value.vector.offset;
+		e = duckVM_message_node(duckVM,
+		                        message,
+		                        visited,
+		                        object->value.vector.internal_vector,
+		                        &node.value.vector.internalVector);
+		break;
+	case duckVM_object_type_internalVector:
+		node.value.range.offset = message->elements.elements_length;
+		node.value.range.length = object->value.internal_vector.length;
+		node.value.range.initialized = object->value.internal_vector.initialized;
+		if (!node.value.range.initialized) break;
+		DL_DOTIMES(i, node.value.range.length) {
+			dl_ptrdiff_t element;
+			e = duckVM_message_node(duckVM, message, visited, object->value.internal_vector.values[i], &element);
+			if (e) break;
+			e = dl_array_pushElement(&message->elements, &element);
+			if (e) break;
+		}
+		break;
+	case duckVM_object_type_internalString:
+		node.value.range.offset = message->bytes.elements_length;
+		node.value.range.length = object->value.internalString.value_length;
+		e = dl_array_pushElements(&message->bytes,
+		                          object->value.internalString.value,
+		                          object->value.internalString.value_length);
+		break;
+	case duckVM_object_type_closure:
+		node.value.closure.name = object->value.closure.name;
+		node.value.closure.arity = object->value.closure.arity;
+		node.value.closure.variadic = object->value.closure.variadic;
+		e = duckVM_message_node(duckVM, message, visited, object->value.closure.bytecode, &node.value.closure.bytecode);
+		if (e) break;
+		e = duckVM_message_node(duckVM,
+		                        message,
+		                        visited,
+		                        object->value.closure.upvalue_array,
+		                        &node.value.closure.upvalueArray);
+		break;
+	case duckVM_object_type_bytecode:
+		/* Bytecode that isn't part of a program could be quickened by its VM while the receiver reads it. */
+		if (object->value.bytecode.program == dl_null) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_message_fillNode: Closures can only be sent if they belong to a shared program."));
+			if (eError) e = eError;
+			break;
+		}
+		node.value.program = object->value.bytecode.program;
+		/**/ duckVM_program_retain(node.value.program);
+		break;
+	case duckVM_object_type_upvalueArray:
+		node.value.range.offset = message->elements.elements_length;
+		node.value.range.length = object->value.upvalue_array.length;
+		node.value.range.initialized = dl_true;
+		DL_DOTIMES(i, node.value.range.length) {
+			dl_ptrdiff_t element;
+			e = duckVM_message_node(duckVM, message, visited, object->value.upvalue_array.upvalues[i], &element);
+			if (e) break;
+			e = dl_array_pushElement(&message->elements, &element);
+			if (e) break;
+		}
+		break;
+	case duckVM_object_type_upvalue:
+		node.value.upvalue.type = object->value.upvalue.type;
+		if (object->value.upvalue.type == duckVM_upvalue_type_stack_index) {
+			/* The variable is still on the stack, so send its current value in a node of its own. The stack slot
+			   isn't a heap object, so the node is filled in right away instead of by the caller. */
+			duckVM_messageNode_t valueNode;
+			duckVM_object_t *value = &DL_ARRAY_GETADDRESS(*duckVM_upvalue_stack(duckVM, &object->value.upvalue),
+			                                              duckVM_object_t,
+			                                              object->value.upvalue.value.stack_index);
+			/**/ dl_memclear(&valueNode, sizeof(duckVM_messageNode_t));
+			node.value.upvalue.type = duckVM_upvalue_type_heap_object;
+			node.value.upvalue.value = message->nodes.elements_length;
+			e = dl_array_pushElement(&message->nodes, &valueNode);
+			if (e) break;
+			e = dl_array_pushElement(visited, &value);
+			if (e) break;
+			e = duckVM_message_fillNode(duckVM, message, visited, value, node.value.upvalue.value);
+		}
+		else if (object->value.upvalue.type == duckVM_upvalue_type_heap_object) {
+			e = duckVM_message_node(duckVM,
+			                        message,
+			                        visited,
+			                        object->value.upvalue.value.heap_object,
+			                        &node.value.upvalue.value);
+		}
+		else {
+			e = duckVM_message_node(duckVM,
+			                        message,
+			                        visited,
+			                        object->value.upvalue.value.heap_upvalue,
+			                        &node.value.upvalue.value);
+		}
+		break;
+	default:
+		e = dl_error_invalidValue;
+		eError = duckVM_error_pushRuntime(duckVM,
+		                                  DL_STR("duckVM_message_fillNode: Functions, composites, coroutines, hash tables, string builders, typed arrays, records and user objects can't be sent or frozen."));
+		if (eError) e = eError;
+	}
+	if (e) goto cleanup;
+
+	DL_ARRAY_GETADDRESS(message->nodes, duckVM_messageNode_t, index) = node;
+
+ cleanup:
+	return e;
+}
+
+/* Copy `object` and everything it references into a new message. */
+static dl_error_t duckVM_message_fromObject(duckVM_t *duckVM,
+                                            dl_memoryAllocation_t *memoryAllocation,
+                                            duckVM_object_t *object,
+                                            duckVM_message_t **messageOut) {
+	dl_error_t e = dl_error_ok;
+	dl_error_t eError = dl_error_ok;
+
+	duckVM_message_t *message = dl_null;
+	dl_array_t visited;  /* duckVM_object_t * */
+	duckVM_messageNode_t root;
+	/**/ dl_array_init(&visited, duckVM->memoryAllocation, sizeof(duckVM_object_t *), dl_array_strategy_double);
+
+	if (duckVM->messageMap == dl_null) {
+		e = DL_MALLOC(duckVM->memoryAllocation,
+		              &duckVM->messageMap,
+		              duckVM->gclist.objects_length,
+		              dl_ptrdiff_t);
+		if (e) goto cleanup;
+		DL_DOTIMES(i, duckVM->gclist.objects_length) {
+			duckVM->messageMap[i] = -1;
+		}
+	}
+
+	e = DL_MALLOC(memoryAllocation, &message, 1, duckVM_message_t);
+	if (e) goto cleanup;
+	/**/ dl_array_init(&message->nodes,
+	                   memoryAllocation,
+	                   sizeof(duckVM_messageNode_t),
+	                   dl_array_strategy_double);
+	/**/ dl_array_init(&message->elements, memoryAllocation, sizeof(dl_ptrdiff_t), dl_array_strategy_double);
+	/**/ dl_array_init(&message->bytes, memoryAllocation, sizeof(dl_uint8_t), dl_array_strategy_double);
+	message->next = dl_null;
+
+	/**/ dl_memclear(&root, sizeof(duckVM_messageNode_t));
+	e = dl_array_pushElement(&message->nodes, &root);
+	if (e) goto cleanup;
+	e = duckVM_message_fillNode(duckVM, message, &visited, object, 0);
+	if (e) goto cleanup;
+	/* `visited` grows as new heap objects are found. */
+	for (dl_size_t i = 0; i < visited.elements_length; i++) {
+		duckVM_object_t *visitedObject = DL_ARRAY_GETADDRESS(visited, duckVM_object_t *, i);
+		/* Frozen nodes are finished when they are created. */
+		if (!duckVM_gclist_owns(&duckVM->gclist, visitedObject)) continue;
+		e = duckVM_message_fillNode(duckVM, message, &visited, visitedObject, i + 1);
+		if (e) goto cleanup;
+	}
+
+	*messageOut = message;
+
+ cleanup:
+	/* Only reset the entries that were used so that small messages stay cheap in big heaps. */
+	DL_DOTIMES(i, visited.elements_length) {
+		duckVM_object_t *visitedObject = DL_ARRAY_GETADDRESS(visited, duckVM_object_t *, i);
+		if (duckVM_gclist_owns(&duckVM->gclist, visitedObject)) {
+			duckVM->messageMap[visitedObject - duckVM->gclist.objects] = -1;
+		}
+	}
+	eError = dl_array_quit(&visited);
+	if (eError) e = eError;
+	if (e && (message != dl_null)) {
+		eError = duckVM_message_quit(memoryAllocation, message);
+		if (eError) e = eError;
+	}
+	return e;
+}
+
+static duckVM_object_t *duckVM_message_pointer(duckVM_object_t **pointers, dl_ptrdiff_t index) {
+	if (index < 0) return dl_null;
+	return pointers[index - 1];
+}
+
+/* Build the object that the node describes. References are resolved through `pointers`, which holds the object of
+   every node after the first. */
+static duckVM_object_t duckVM_message_nodeToObject(duckVM_message_t *message,
+                                                   duckVM_object_t **pointers,
+                                                   duckVM_object_t *object,
+                                                   dl_ptrdiff_t index) {
+	duckVM_messageNode_t node = DL_ARRAY_GETADDRESS(message->nodes, duckVM_messageNode_t, index);
+	duckVM_object_t result = *object;
+	result.type = node.type;
+	switch (node.type) {
+	case duckVM_object_type_bool:
+		result.value.boolean = node.value.boolean;
+		break;
+	case duckVM_object_type_integer:
+		result.value.integer = node.value.integer;
+		break;
+	case duckVM_object_type_float:
+		result.value.floatingPoint = node.value.floatingPoint;
+		break;
+	case duckVM_object_type_type:
+		result.value.type = node.value.type;
+		break;
+	case duckVM_object_type_list:
+		result.value.list = duckVM_message_pointer(pointers, node.value.list);
+		break;
+	case duckVM_object_type_cons:
+		result.value.cons.car = duckVM_message_pointer(pointers, node.value.cons.car);
+		result.value.cons.cdr = duckVM_message_pointer(pointers, node.value.cons.cdr);
+		break;
+	case duckVM_object_type_string:
+		result.value.string.internalString = duckVM_message_pointer(pointers, node.value.string.internalString);
+		result.value.string.offset = node.value.string.offset;
+		result.value.string.length = node.value.string.length;
+		break;
+	case duckVM_object_type_symbol:
+		result.value.symbol.id = node.value.symbol.id;
+		result.value.symbol.internalString = duckVM_message_pointer(pointers, node.value.symbol.internalString);
+		break;
+	case duckVM_object_type_vector:
+		result.value.vector.internal_vector = duckVM_message_pointer(pointers, node.value.vector.internalVector);
+		result.value.vector.offset = node.value.vector.offset;
+		break;
+	case duckVM_object_type_internalVector:
+		if (node.value.range.initialized) {
+			DL_DOTIMES(i, node.value.range.length) {
+				dl_ptrdiff_t element = DL_ARRAY_GETADDRESS(message->elements, dl_ptrdiff_t, node.value.range.offset + i);
+				result.value.internal_vector.values[i] = duckVM_message_pointer(pointers, element);
+			}
+			result.value.internal_vector.initialized = dl_true;
+		}
+		break;
+	case duckVM_object_type_closure:
+		result.value.closure.name = node.value.closure.name;
+		result.value.closure.bytecode = duckVM_message_pointer(pointers, node.value.closure.bytecode);
+		result.value.closure.upvalue_array = duckVM_message_pointer(pointers, node.value.closure.upvalueArray);
+		result.value.closure.arity = node.value.closure.arity;
+		result.value.closure.variadic = node.value.closure.variadic;
+		break;
+	case duckVM_object_type_upvalueArray:
+		DL_DOTIMES(i, node.value.range.length) {
+			dl_ptrdiff_t element = DL_ARRAY_GETADDRESS(message->elements, dl_ptrdiff_t, node.value.range.offset + i);
+			result.value.upvalue_array.upvalues[i] = duckVM_message_pointer(pointers, element);
+		}
+		break;
+	case duckVM_object_type_upvalue:
+		result.value.upvalue.type = node.value.upvalue.type;
+		if (node.value.upvalue.type == duckVM_upvalue_type_heap_upvalue) {
+			result.value.upvalue.value.heap_upvalue = duckVM_message_pointer(pointers, node.value.upvalue.value);
+		}
+		else {
+			result.value.upvalue.value.heap_object = duckVM_message_pointer(pointers, node.value.upvalue.value);
+		}
+		break;
+	default:
+		/* Internal strings and bytecode were created with their contents. */
+		break;
+	}
+	return result;
+}
+
+/* Copy a message into the VM's heap and push the object on the stack. */
+static dl_error_t duckVM_message_pushObject(duckVM_t *duckVM, duckVM_message_t *message) {
+	dl_error_t e = dl_error_ok;
+	dl_error_t eError = dl_error_ok;
+
+	duckVM_object_t *keeper = dl_null;
+	duckVM_object_t object;
+	dl_size_t heapObjects_length = message->nodes.elements_length - 1;
+	/**/ dl_memclear(&object, sizeof(duckVM_object_t));
+
+	if (heapObjects_length > 0) {
+		/* Every heap object is allocated before any of them are linked together. Until they are linked, they are kept
+		   alive by a vector on the stack. */
+		duckVM_object_t keeperVector;
+		/**/ dl_memclear(&keeperVector, sizeof(duckVM_object_t));
+		keeperVector.type = duckVM_object_type_internalVector;
+		keeperVector.value.internal_vector.length = heapObjects_length;
+		keeperVector.value.internal_vector.initialized = dl_false;
+		e = duckVM_gclist_pushObject(duckVM, &keeper, keeperVector);
+		if (e) goto cleanup;
+		DL_DOTIMES(i, heapObjects_length) {
+			keeper->value.internal_vector.values[i] = dl_null;
+		}
+		keeper->value.internal_vector.initialized = dl_true;
+		keeperVector.type = duckVM_object_type_vector;
+		keeperVector.value.vector.internal_vector = keeper;
+		keeperVector.value.vector.offset = 0;
+		e = stack_push(duckVM, &keeperVector);
+		if (e) goto cleanup;
+
+		DL_DOTIMES(i, heapObjects_length) {
+			duckVM_messageNode_t node = DL_ARRAY_GETADDRESS(message->nodes, duckVM_messageNode_t, i + 1);
+			duckVM_object_t heapObject;
+			if (node.type == duckVM_object_type_none) {
+				/* Frozen objects arrive as they are. */
+				keeper->value.internal_vector.values[i] = node.value.frozen.object;
+				e = duckVM_frozen_adopt(duckVM, node.value.frozen.region);
+				if (e) goto cleanup;
+				continue;
+			}
+			/**/ dl_memclear(&heapObject, sizeof(duckVM_object_t));
+			if (node.type == duckVM_object_type_internalString) {
+				heapObject.type = duckVM_object_type_internalString;
+				heapObject.value.internalString.value = &DL_ARRAY_GETADDRESS(message->bytes,
+				                                                             dl_uint8_t,
+				                                                             node.value.range.offset);
+				heapObject.value.internalString.value_length = node.value.range.length;
+			}
+			else if (node.type == duckVM_object_type_internalVector) {
+				/* Filled in once every object exists. */
+				heapObject.type = duckVM_object_type_internalVector;
+				heapObject.value.internal_vector.length = node.value.range.length;
+				heapObject.value.internal_vector.initialized = dl_false;
+			}
+			else if (node.type == duckVM_object_type_upvalueArray) {
+				heapObject.type = duckVM_object_type_upvalueArray;
+				heapObject.value.upvalue_array.length = node.value.range.length;
+			}
+			else if (node.type == duckVM_object_type_bytecode) {
+				/* Takes its own reference to the program. */
+				heapObject.type = duckVM_object_type_bytecode;
+				heapObject.value.bytecode.bytecode = node.value.program->bytecode;
+				heapObject.value.bytecode.bytecode_length = node.value.program->bytecode_length;
+				heapObject.value.bytecode.verified = node.value.program->verified;
+				heapObject.value.bytecode.program = node.value.program;
+			}
+			else {
+				/* Placeholder. */
+				heapObject.type = duckVM_object_type_bool;
+			}
+			e = duckVM_gclist_pushObject(duckVM, &keeper->value.internal_vector.values[i], heapObject);
+			if (e) goto cleanup;
+			if (node.type == duckVM_object_type_upvalueArray) {
+				/* The collector traces upvalue arrays, so they can't hold garbage until they are filled in. */
+				DL_DOTIMES(j, node.value.range.length) {
+					keeper->value.internal_vector.values[i]->value.upvalue_array.upvalues[j] = dl_null;
+				}
+			}
+		}
+
+		/* Nothing is allocated from here on, so the garbage collector can't see half-linked objects. */
+		DL_DOTIMES(i, heapObjects_length) {
+			duckVM_object_t *heapObject = keeper->value.internal_vector.values[i];
+			if (DL_ARRAY_GETADDRESS(message->nodes, duckVM_messageNode_t, i + 1).type == duckVM_object_type_none) {
+				continue;
+			}
+			*heapObject = duckVM_message_nodeToObject(message,
+			                                          keeper->value.internal_vector.values,
+			                                          heapObject,
+			                                          i + 1);
+		}
+		object = duckVM_message_nodeToObject(message, keeper->value.internal_vector.values, &object, 0);
+	}
+	else {
+		object = duckVM_message_nodeToObject(message, dl_null, &object, 0);
+	}
+	if (heapObjects_length > 0) {
+		e = stack_pop_multiple(duckVM, 1);
+		if (e) goto cleanup;
+	}
+	e = stack_push(duckVM, &object);
+	if (e) goto cleanup;
+
+ cleanup:
+	if (e) {
+		eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_message_pushObject: Failed."));
+		if (eError) e = eError;
+	}
+	return e;
+}
+
+/* Send a copy of `object`. */
+static dl_error_t duckVM_mailbox_send(duckVM_t *duckVM, duckVM_mailbox_t *mailbox, duckVM_object_t *object) {
+	dl_error_t e = dl_error_ok;
+	duckVM_message_t *message = dl_null;
+
+	/* Copying happens outside of the lock. Only linking the message in is serialized. */
+	e = duckVM_message_fromObject(duckVM, mailbox->memoryAllocation, object, &message);
+	if (e) goto cleanup;
+
+	/**/ duckVM_mailbox_lock(mailbox);
+	if (mailbox->tail == dl_null) mailbox->head = message;
+	else mailbox->tail->next = message;
+	mailbox->tail = message;
+	mailbox->length++;
+	/**/ duckVM_mailbox_unlock(mailbox);
+
+ cleanup:
+	return e;
+}
+
+/* Push the oldest message on the stack if there is one. */
+static dl_error_t duckVM_mailbox_receive(duckVM_t *duckVM, duckVM_mailbox_t *mailbox, dl_bool_t *received) {
+	dl_error_t e = dl_error_ok;
+	duckVM_message_t *message = dl_null;
+
+	*received = dl_false;
+
+	/**/ duckVM_mailbox_lock(mailbox);
+	message = mailbox->head;
+	if (message != dl_null) {
+		mailbox->head = message->next;
+		if (mailbox->head == dl_null) mailbox->tail = dl_null;
+		mailbox->length--;
+	}
+	/**/ duckVM_mailbox_unlock(mailbox);
+	if (message == dl_null) goto cleanup;
+
+	e = duckVM_message_pushObject(duckVM, message);
+	if (e) {
+		/* Put the message back so that it isn't lost. */
+		/**/ duckVM_mailbox_lock(mailbox);
+		message->next = mailbox->head;
+		mailbox->head = message;
+		if (mailbox->tail == dl_null) mailbox->tail = message;
+		mailbox->length++;
+		/**/ duckVM_mailbox_unlock(mailbox);
+		goto cleanup;
+	}
+	*received = dl_true;
+	e = duckVM_message_quit(mailbox->memoryAllocation, message);
+
+ cleanup:
+	return e;
+}
+
+/* Look up the mailbox linked to a channel number. */
+static dl_error_t duckVM_channel_get(duckVM_t *duckVM, duckVM_object_t *channel, duckVM_mailbox_t **mailbox) {
+	dl_error_t e = dl_error_ok;
+	dl_error_t eError = dl_error_ok;
+	if ((channel->type != duckVM_object_type_integer)
+	    || (channel->value.integer < 0)
+	    || ((dl_size_t) channel->value.integer >= duckVM->channels.elements_length)
+	    || (DL_ARRAY_GETADDRESS(duckVM->channels, duckVM_mailbox_t *, channel->value.integer) == dl_null)) {
+		e = dl_error_invalidValue;
+		eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute: Channel is not linked to a mailbox."));
+		if (eError) e = eError;
+		goto cleanup;
+	}
+	*mailbox = DL_ARRAY_GETADDRESS(duckVM->channels, duckVM_mailbox_t *, channel->value.integer);
+ cleanup:
+	return e;
+}
+
+/* Build a frozen region out of a message. The region is returned with one reference. */
+static dl_error_t duckVM_frozen_fromMessage(duckVM_t *duckVM, duckVM_message_t *message, duckVM_frozen_t **regionOut) {
+	dl_error_t e = dl_error_ok;
+	dl_error_t eError = dl_error_ok;
+
+	dl_memoryAllocation_t *memoryAllocation = duckVM->memoryAllocation;
+	duckVM_frozen_t *region = dl_null;
+	duckVM_object_t **pointers = dl_null;
+
+	/* Regions don't hold references to programs. */
+	DL_DOTIMES(i, message->nodes.elements_length) {
+		if (DL_ARRAY_GETADDRESS(message->nodes, duckVM_messageNode_t, i).type == duckVM_object_type_closure) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_freeze: Closures can't be frozen."));
+			if (eError) e = eError;
+			goto cleanup;
+		}
+	}
+
+	e = DL_MALLOC(memoryAllocation, &region, 1, duckVM_frozen_t);
+	if (e) goto cleanup;
+	/**/ dl_memclear(region, sizeof(duckVM_frozen_t));
+	region->memoryAllocation = memoryAllocation;
+	region->references = 1;
+	region->objects_length = message->nodes.elements_length - 1;
+	/**/ dl_array_init(&region->dependencies,
+	                   memoryAllocation,
+	                   sizeof(duckVM_frozen_t *),
+	                   dl_array_strategy_double);
+
+	if (region->objects_length > 0) {
+		e = DL_MALLOC(memoryAllocation, &region->objects, region->objects_length, duckVM_object_t);
+		if (e) goto cleanup;
+		e = DL_MALLOC(memoryAllocation, &pointers, region->objects_length, duckVM_object_t *);
+		if (e) goto cleanup;
+	}
+	if (message->elements.elements_length > 0) {
+		e = DL_MALLOC(memoryAllocation, &region->elements, message->elements.elements_length, duckVM_object_t *);
+		if (e) goto cleanup;
+	}
+	if (message->bytes.elements_length > 0) {
+		e = DL_MALLOC(memoryAllocation, &region->bytes, message->bytes.elements_length, dl_uint8_t);
+		if (e) goto cleanup;
+		/**/ dl_memcopy_noOverlap(region->bytes, message->bytes.elements, message->bytes.elements_length);
+	}
+
+	DL_DOTIMES(i, region->objects_length) {
+		duckVM_messageNode_t node = DL_ARRAY_GETADDRESS(message->nodes, duckVM_messageNode_t, i + 1);
+		pointers[i] = ((node.type == duckVM_object_type_none)
+		               ? node.value.frozen.object
+		               : &region->objects[i]);
+	}
+
+	DL_DOTIMES(i, region->objects_length) {
+		duckVM_messageNode_t node = DL_ARRAY_GETADDRESS(message->nodes, duckVM_messageNode_t, i + 1);
+		duckVM_object_t *object = &region->objects[i];
+		/**/ dl_memclear(object, sizeof(duckVM_object_t));
+		if (node.type == duckVM_object_type_none) {
+			/* Already frozen. The slot is unused, but the region has to keep the other region alive. */
+			dl_bool_t found = dl_false;
+			DL_DOTIMES(j, region->dependencies.elements_length) {
+				if (DL_ARRAY_GETADDRESS(region->dependencies, duckVM_frozen_t *, j) == node.value.frozen.region) {
+					found = dl_true;
+					break;
+				}
+			}
+			if (!found) {
+				e = dl_array_pushElement(&region->dependencies, &node.value.frozen.region);
+				if (e) goto cleanup;
+				/**/ duckVM_frozen_retain(node.value.frozen.region);
+			}
+			continue;
+		}
+		object->type = node.type;
+		if (node.type == duckVM_object_type_internalString) {
+			object->value.internalString.value = (node.value.range.length > 0
+			                                      ? &region->bytes[node.value.range.offset]
+			                                      : dl_null);
+			object->value.internalString.value_length = node.value.range.length;
+		}
+		else if (node.type == duckVM_object_type_internalVector) {
+			if (node.value.range.initialized && (node.value.range.length > 0)) {
+				object->value.internal_vector.values = &region->elements[node.value.range.offset];
+				object->value.internal_vector.length = node.value.range.length;
+			}
+		}
+		*object = duckVM_message_nodeToObject(message, pointers, object, i + 1);
+	}
+
+	/**/ dl_memclear(&region->root, sizeof(duckVM_object_t));
+	region->root = duckVM_message_nodeToObject(message, pointers, &region->root, 0);
+
+	*regionOut = region;
+
+ cleanup:
+	if (pointers != dl_null) {
+		eError = DL_FREE(memoryAllocation, &pointers);
+		if (eError) e = eError;
+	}
+	if (e && (region != dl_null)) {
+		eError = duckVM_frozen_release(region);
+		if (eError) e = eError;
+	}
+	return e;
+}
+
+/* Freeze `object` and store the frozen value in `frozenObject`. The new region is held by the VM and returned in
+   `regionOut`. If there was nothing left to freeze, `frozenObject` is a copy of `object`, and `regionOut` is the region
+   that it is already in, or `dl_null` if it has no heap part. */
+static dl_error_t duckVM_frozen_fromObject(duckVM_t *duckVM,
+                                           duckVM_object_t *object,
+                                           duckVM_object_t *frozenObject,
+                                           duckVM_frozen_t **regionOut) {
+	dl_error_t e = dl_error_ok;
+	dl_error_t eError = dl_error_ok;
+
+	duckVM_message_t *message = dl_null;
+	duckVM_frozen_t *region = dl_null;
+
+	*frozenObject = *object;
+	*regionOut = dl_null;
+
+	/* A frozen region is built the same way as a message, but is never copied back into a heap. */
+	e = duckVM_message_fromObject(duckVM, duckVM->memoryAllocation, object, &message);
+	if (e) goto cleanup;
+
+	if (message->nodes.elements_length == 1) goto cleanup;
+	if ((message->nodes.elements_length == 2)
+	    && (DL_ARRAY_GETADDRESS(message->nodes, duckVM_messageNode_t, 1).type == duckVM_object_type_none)) {
+		*regionOut = DL_ARRAY_GETADDRESS(message->nodes, duckVM_messageNode_t, 1).value.frozen.region;
+		goto cleanup;
+	}
+
+	e = duckVM_frozen_fromMessage(duckVM, message, &region);
+	if (e) goto cleanup;
+	/* The VM takes the region's first reference. */
+	e = duckVM_frozen_insert(duckVM, region);
+	if (e) {
+		eError = duckVM_frozen_release(region);
+		if (eError) e = eError;
+		goto cleanup;
+	}
+	*frozenObject = region->root;
+	*regionOut = region;
+
+ cleanup:
+	if (message != dl_null) {
+		eError = duckVM_message_quit(duckVM->memoryAllocation, message);
+		if (eError) e = eError;
+	}
+	return e;
+}
+
+
+/* Strings */
+
+/* FNV-1a of the string's bytes. The hash of a string that starts at the beginning of its internal string is cached in
+   the internal string, so substrings that share that start, strings taken from a builder, and the same string hashed
+   again only hash the bytes past the cached prefix. Frozen strings may be shared with other threads, so their hashes
+   are never cached. */
+static dl_size_t duckVM_string_hash(duckVM_t *duckVM, const duckVM_object_t *string) {
+	duckVM_object_t *internalString = string->value.string.internalString;
+	dl_size_t length = string->value.string.length - string->value.string.offset;
+	dl_size_t hash = 2166136261UL;
+	dl_size_t start = 0;
+	const dl_uint8_t *bytes = dl_null;
+	dl_bool_t prefix = (string->value.string.offset == 0);
+
+	if ((internalString == dl_null) || (length == 0)) return hash;
+
+	bytes = internalString->value.internalString.value + string->value.string.offset;
+	if (prefix
+	    && internalString->value.internalString.hashed
+	    && (internalString->value.internalString.hash_length <= length)) {
+		hash = internalString->value.internalString.hash;
+		start = internalString->value.internalString.hash_length;
+	}
+	for (dl_size_t i = start; i < length; i++) {
+		hash ^= bytes[i];
+		hash *= 16777619UL;
+	}
+	if (prefix && (start < length) && duckVM_gclist_owns(&duckVM->gclist, internalString)) {
+		internalString->value.internalString.hash = hash;
+		internalString->value.internalString.hash_length = length;
+		internalString->value.internalString.hashed = dl_true;
+	}
+	return hash;
+}
+
+/* Check if the hash of a string is already known without computing it. */
+static dl_bool_t duckVM_string_cachedHash(const duckVM_object_t *string, dl_size_t *hash) {
+	duckVM_object_t *internalString = string->value.string.internalString;
+	if ((internalString == dl_null)
+	    || (string->value.string.offset != 0)
+	    || !internalString->value.internalString.hashed
+	    || (internalString->value.internalString.hash_length != string->value.string.length)) {
+		return dl_false;
+	}
+	*hash = internalString->value.internalString.hash;
+	return dl_true;
+}
+
+/* Compare the bytes of two strings. Views of the same bytes are equal without looking at them, and strings with
+   cached hashes that differ are unequal. */
+static dl_bool_t duckVM_string_equal(const duckVM_object_t *left, const duckVM_object_t *right) {
+	dl_bool_t result = dl_false;
+	dl_size_t length = left->value.string.length - left->value.string.offset;
+	dl_size_t leftHash = 0;
+	dl_size_t rightHash = 0;
+
+	if (right->value.string.length - right->value.string.offset != length) return dl_false;
+	if (length == 0) return dl_true;
+	if ((left->value.string.internalString == right->value.string.internalString)
+	    && (left->value.string.offset == right->value.string.offset)) {
+		return dl_true;
+	}
+	if (duckVM_string_cachedHash(left, &leftHash)
+	    && duckVM_string_cachedHash(right, &rightHash)
+	    && (leftHash != rightHash)) {
+		return dl_false;
+	}
+	/**/ dl_string_compare_partial(&result,
+	                               (left->value.string.internalString->value.internalString.value
+	                                + left->value.string.offset),
+	                               (right->value.string.internalString->value.internalString.value
+	                                + right->value.string.offset),
+	                               length);
+	return result;
+}
+
+
+/* Find the bytes of a string, a string builder, or the name of a symbol. Returns false for any other type. */
+static dl_bool_t duckVM_string_bytes(const duckVM_object_t *object, const dl_uint8_t **bytes, dl_size_t *length) {
+	duckVM_object_t *internalString = dl_null;
+	dl_size_t offset = 0;
+	switch (object->type) {
+	case duckVM_object_type_string:
+		internalString = object->value.string.internalString;
+		offset = object->value.string.offset;
+		*length = object->value.string.length - offset;
+		break;
+	case duckVM_object_type_stringBuilder:
+		internalString = object->value.stringBuilder;
+		*length = internalString->value.internalString.value_length;
+		break;
+	case duckVM_object_type_symbol:
+		internalString = object->value.symbol.internalString;
+		*length = (internalString == dl_null) ? 0 : internalString->value.internalString.value_length;
+		break;
+	default:
+		return dl_false;
+	}
+	*bytes = (((internalString == dl_null) || (*length == 0))
+	          ? (const dl_uint8_t *) ""
+	          : internalString->value.internalString.value + offset);
+	return dl_true;
+}
+
+
+/* String builders */
+
+/* A string that shares the builder's internal string. */
+static duckVM_object_t duckVM_stringBuilder_string(const duckVM_object_t *builder) {
+	duckVM_object_t string;
+	string.type = duckVM_object_type_string;
+	string.value.string.internalString = builder->value.stringBuilder;
+	string.value.string.offset = 0;
+	string.value.string.length = builder->value.stringBuilder->value.internalString.value_length;
+	return string;
+}
+
+/* Append the bytes of a string or symbol to the builder. The buffer at least doubles when it is full, so the total cost
+   of building a string is proportional to its length. */
+static dl_error_t duckVM_stringBuilder_append(duckVM_t *duckVM, duckVM_object_t *builder, const duckVM_object_t *source) {
+	dl_error_t e = dl_error_ok;
+	dl_error_t eError = dl_error_ok;
+
+	duckVM_internalString_t *internalString = &builder->value.stringBuilder->value.internalString;
+	duckVM_object_t *sourceString = dl_null;
+	dl_size_t sourceOffset = 0;
+	dl_size_t sourceLength = 0;
+
+	if (source->type == duckVM_object_type_string) {
+		sourceString = source->value.string.internalString;
+		sourceOffset = source->value.string.offset;
+		sourceLength = source->value.string.length - source->value.string.offset;
+	}
+	else if (source->type == duckVM_object_type_symbol) {
+		sourceString = source->value.symbol.internalString;
+		sourceLength = sourceString ? sourceString->value.internalString.value_length : 0;
+	}
+	else if (source->type == duckVM_object_type_stringBuilder) {
+		sourceString = source->value.stringBuilder;
+		sourceLength = sourceString->value.internalString.value_length;
+	}
+	else {
+		e = dl_error_invalidValue;
+		eError = duckVM_error_pushRuntime(duckVM,
+		                                  DL_STR("duckVM_stringBuilder_append: Can only append strings, symbols and string builders."));
+		if (eError) e = eError;
+		goto cleanup;
+	}
+	if (sourceLength == 0) goto cleanup;
+
+	if (internalString->value_length + sourceLength > internalString->capacity) {
+		dl_size_t capacity = (internalString->capacity > 0) ? 2 * internalString->capacity : 16;
+		if (capacity < internalString->value_length + sourceLength) {
+			capacity = internalString->value_length + sourceLength;
+		}
+		e = DL_REALLOC(duckVM->memoryAllocation, &internalString->value, capacity, dl_uint8_t);
+		if (e) {
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_stringBuilder_append: String allocation failed."));
+			if (eError) e = eError;
+			goto cleanup;
+		}
+		internalString->capacity = capacity;
+	}
+	/* Read the source after growing since it may be the builder itself. */
+	/**/ dl_memcopy_noOverlap(internalString->value + internalString->value_length,
+	                          sourceString->value.internalString.value + sourceOffset,
+	                          sourceLength);
+	internalString->value_length += sourceLength;
+
+ cleanup:
+	return e;
+}
+
+
+/* Hash tables */
+
+/* Slots of the old table moved into the new table each time a key is added. */
+#define DUCKVM_HASHTABLE_MIGRATION_STEP 8
+
+static dl_size_t duckVM_hashTable_mix(dl_size_t hash) {
+	/* Shifting twice keeps the shift defined when `dl_size_t` is 32 bits wide. */
+	hash ^= (hash >> 16) >> 16;
+	hash ^= hash >> 16;
+	hash *= 0x45D9F3BUL;
+	hash ^= hash >> 16;
+	return hash;
+}
+
+/* Keys may be integers, symbols, strings or booleans. Symbols are hashed by ID and strings by content. Each type is
+   salted so that equal integers, symbol IDs and booleans don't collide. */
+static dl_error_t duckVM_hashTable_hash(duckVM_t *duckVM, const duckVM_object_t *key, dl_size_t *hash) {
+	dl_error_t e = dl_error_ok;
+	dl_error_t eError = dl_error_ok;
+
+	switch (key->type) {
+	case duckVM_object_type_integer:
+		*hash = duckVM_hashTable_mix((dl_size_t) key->value.integer);
+		break;
+	case duckVM_object_type_symbol:
+		*hash = duckVM_hashTable_mix(key->value.symbol.id) ^ 0x5BD1E995UL;
+		break;
+	case duckVM_object_type_bool:
+		*hash = duckVM_hashTable_mix(key->value.boolean ? 1 : 0) ^ 0x27D4EB2FUL;
+		break;
+	case duckVM_object_type_string:
+		*hash = duckVM_string_hash(duckVM, key);
+		break;
+	default:
+		e = dl_error_invalidValue;
+		eError = duckVM_error_pushRuntime(duckVM,
+		                                  DL_STR("duckVM_hashTable_hash: Keys must be integers, symbols, strings or booleans."));
+		if (eError) e = eError;
+	}
+
+	return e;
+}
+
+static dl_bool_t duckVM_hashTable_keysEqual(const duckVM_object_t *left, const duckVM_object_t *right) {
+	if (left->type != right->type) return dl_false;
+	switch (left->type) {
+	case duckVM_object_type_integer:
+		return left->value.integer == right->value.integer;
+	case duckVM_object_type_symbol:
+		return left->value.symbol.id == right->value.symbol.id;
+	case duckVM_object_type_bool:
+		return !left->value.boolean == !right->value.boolean;
+	case duckVM_object_type_string:
+		return duckVM_string_equal(left, right);
+	default:
+		return dl_false;
+	}
+}
+
+/* Find the entry for `key` in one of the two tables. Live entries are returned first. A deleted entry is only returned
+   if `deleted` is set and there is no live entry. */
+static duckVM_hashTableEntry_t *duckVM_hashTable_findIn(duckVM_hashTableEntry_t *entries,
+                                                        const dl_size_t capacity,
+                                                        const duckVM_object_t *key,
+                                                        const dl_size_t hash,
+                                                        const dl_bool_t deleted) {
+	duckVM_hashTableEntry_t *tombstone = dl_null;
+	dl_size_t index = hash & (capacity - 1);
+	if (entries == dl_null) return dl_null;
+	DL_DOTIMES(k, capacity) {
+		duckVM_hashTableEntry_t *entry = &entries[index];
+		if (entry->state == duckVM_hashTableEntry_state_empty) break;
+		if ((entry->hash == hash) && duckVM_hashTable_keysEqual(&entry->key, key)) {
+			if (entry->state == duckVM_hashTableEntry_state_full) return entry;
+			if (deleted && (tombstone == dl_null)) tombstone = entry;
+		}
+		index = (index + 1) & (capacity - 1);
+	}
+	return tombstone;
+}
+
+static duckVM_hashTableEntry_t *duckVM_hashTable_find(duckVM_internalHashTable_t *table,
+                                                      const duckVM_object_t *key,
+                                                      const dl_size_t hash) {
+	duckVM_hashTableEntry_t *entry = duckVM_hashTable_findIn(table->entries, table->capacity, key, hash, dl_false);
+	if (entry != dl_null) return entry;
+	return duckVM_hashTable_findIn(table->oldEntries, table->oldCapacity, key, hash, dl_false);
+}
+
+/* Find the slot a new entry goes in. There always is one since `used` never passes three quarters of the capacity. */
+static duckVM_hashTableEntry_t *duckVM_hashTable_freeSlot(duckVM_hashTableEntry_t *entries,
+                                                          const dl_size_t capacity,
+                                                          const dl_size_t hash) {
+	dl_size_t index = hash & (capacity - 1);
+	while (entries[index].state == duckVM_hashTableEntry_state_full) {
+		index = (index + 1) & (capacity - 1);
+	}
+	return &entries[index];
+}
+
+/* Move up to `slots` slots of the old table into the new table. The old table is freed once every slot has been
+   moved. Moved entries are marked deleted so that lookups of the entries that haven't moved yet still probe past them. */
+static dl_error_t duckVM_hashTable_migrate(duckVM_t *duckVM, duckVM_internalHashTable_t *table, dl_size_t slots) {
+	dl_error_t e = dl_error_ok;
+
+	if (table->oldEntries == dl_null) goto cleanup;
+
+	while ((slots > 0) && (table->migrated < table->oldCapacity)) {
+		duckVM_hashTableEntry_t *entry = &table->oldEntries[table->migrated++];
+		--slots;
+		if (entry->state == duckVM_hashTableEntry_state_full) {
+			duckVM_hashTableEntry_t *slot = duckVM_hashTable_freeSlot(table->entries, table->capacity, entry->hash);
+			/* The entry was already counted in `used`. */
+			if (slot->state == duckVM_hashTableEntry_state_deleted) --table->used;
+			*slot = *entry;
+			entry->state = duckVM_hashTableEntry_state_deleted;
+		}
+	}
+
+	if (table->migrated == table->oldCapacity) {
+		e = DL_FREE(duckVM->memoryAllocation, &table->oldEntries);
+		if (e) goto cleanup;
+		table->oldCapacity = 0;
+		table->migrated = 0;
+	}
+
+ cleanup:
+	return e;
+}
+
+/* Allocate a new table with room for twice the number of live entries and start moving the entries into it. */
+static dl_error_t duckVM_hashTable_grow(duckVM_t *duckVM, duckVM_internalHashTable_t *table) {
+	dl_error_t e = dl_error_ok;
+	dl_error_t eError = dl_error_ok;
+
+	duckVM_hashTableEntry_t *entries = dl_null;
+	dl_size_t capacity = 8;
+
+	/* Only one table can be moved at a time, so finish the last one. */
+	e = duckVM_hashTable_migrate(duckVM, table, table->oldCapacity);
+	if (e) goto cleanup;
+
+	while (capacity < 2 * (table->length + 1)) capacity *= 2;
+	e = DL_MALLOC(duckVM->memoryAllocation, &entries, capacity, duckVM_hashTableEntry_t);
+	if (e) {
+		eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_hashTable_grow: Table allocation failed."));
+		if (eError) e = eError;
+		goto cleanup;
+	}
+	DL_DOTIMES(k, capacity) {
+		entries[k].state = duckVM_hashTableEntry_state_empty;
+	}
+
+	if (table->length > 0) {
+		table->oldEntries = table->entries;
+		table->oldCapacity = table->capacity;
+		table->migrated = 0;
+	}
+	else if (table->entries != dl_null) {
+		/* Nothing to move. */
+		e = DL_FREE(duckVM->memoryAllocation, &table->entries);
+		if (e) {
+			(void) DL_FREE(duckVM->memoryAllocation, &entries);
+			goto cleanup;
+		}
+	}
+	table->entries = entries;
+	table->capacity = capacity;
+	table->used = table->length;
+
+ cleanup:
+	return e;
+}
+
+static dl_error_t duckVM_hashTable_set(duckVM_t *duckVM,
+                                       duckVM_internalHashTable_t *table,
+                                       const duckVM_object_t *key,
+                                       const duckVM_object_t *value) {
+	dl_error_t e = dl_error_ok;
+
+	dl_size_t hash = 0;
+	duckVM_hashTableEntry_t *entry = dl_null;
+
+	e = duckVM_hashTable_hash(duckVM, key, &hash);
+	if (e) goto cleanup;
+
+	entry = duckVM_hashTable_find(table, key, hash);
+	if (entry != dl_null) {
+		entry->value = *value;
+		goto cleanup;
+	}
+
+	e = duckVM_hashTable_migrate(duckVM, table, DUCKVM_HASHTABLE_MIGRATION_STEP);
+	if (e) goto cleanup;
+	if ((table->used + 1) * 4 > table->capacity * 3) {
+		e = duckVM_hashTable_grow(duckVM, table);
+		if (e) goto cleanup;
+	}
+
+	entry = duckVM_hashTable_freeSlot(table->entries, table->capacity, hash);
+	if (entry->state == duckVM_hashTableEntry_state_empty) table->used++;
+	entry->key = *key;
+	entry->value = *value;
+	entry->hash = hash;
+	entry->state = duckVM_hashTableEntry_state_full;
+	table->length++;
+
+ cleanup:
+	return e;
+}
+
+/* Delete the entry for `key` if there is one. `found` is set if there was. */
+static dl_error_t duckVM_hashTable_delete(duckVM_t *duckVM,
+                                          duckVM_internalHashTable_t *table,
+                                          const duckVM_object_t *key,
+                                          dl_bool_t *found) {
+	dl_error_t e = dl_error_ok;
+
+	dl_size_t hash = 0;
+	duckVM_hashTableEntry_t *entry = dl_null;
+
+	*found = dl_false;
+
+	e = duckVM_hashTable_hash(duckVM, key, &hash);
+	if (e) goto cleanup;
+
+	entry = duckVM_hashTable_findIn(table->entries, table->capacity, key, hash, dl_false);
+	if (entry == dl_null) {
+		entry = duckVM_hashTable_findIn(table->oldEntries, table->oldCapacity, key, hash, dl_false);
+		/* Entries waiting in the old table are counted in `used` but don't occupy a slot in the new one yet. */
+		if (entry != dl_null) --table->used;
+	}
+	if (entry != dl_null) {
+		entry->state = duckVM_hashTableEntry_state_deleted;
+		--table->length;
+		*found = dl_true;
+	}
+
+ cleanup:
+	return e;
+}
+
+/* Get the key after `key`, or nil if `key` is the last one. Nil gets the first key. The old table is iterated before the
+   new one. Keys deleted during iteration can still be passed as `key`. */
+static dl_error_t duckVM_hashTable_next(duckVM_t *duckVM,
+                                        duckVM_internalHashTable_t *table,
+                                        const duckVM_object_t *key,
+                                        duckVM_object_t *nextKey) {
+	dl_error_t e = dl_error_ok;
+	dl_error_t eError = dl_error_ok;
+
+	duckVM_hashTableEntry_t *tables[2];
+	dl_size_t capacities[2];
+	dl_ptrdiff_t tableIndex = 0;
+	dl_size_t index = 0;
+
+	tables[0] = table->oldEntries;
+	capacities[0] = table->oldCapacity;
+	tables[1] = table->entries;
+	capacities[1] = table->capacity;
+
+	if ((key->type != duckVM_object_type_list) || (key->value.list != dl_null)) {
+		dl_size_t hash = 0;
+		duckVM_hashTableEntry_t *entry = dl_null;
+		e = duckVM_hashTable_hash(duckVM, key, &hash);
+		if (e) goto cleanup;
+		/* Live entries first, then deleted ones. */
+		DL_DOTIMES(pass, 4) {
+			tableIndex = pass % 2;
+			entry = duckVM_hashTable_findIn(tables[tableIndex], capacities[tableIndex], key, hash, pass >= 2);
+			if (entry != dl_null) break;
+		}
+		if (entry == dl_null) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_hashTable_next: Key is not in the table."));
+			if (eError) e = eError;
+			goto cleanup;
+		}
+		index = (entry - tables[tableIndex]) + 1;
+	}
+
+	for (; tableIndex < 2; tableIndex++, index = 0) {
+		for (; index < capacities[tableIndex]; index++) {
+			if (tables[tableIndex][index].state == duckVM_hashTableEntry_state_full) {
+				*nextKey = tables[tableIndex][index].key;
+				goto cleanup;
+			}
+		}
+	}
+	nextKey->type = duckVM_object_type_list;
+	nextKey->value.list = dl_null;
+
+ cleanup:
+	return e;
+}
+
+
+/* Typed arrays */
+
+static dl_size_t duckVM_typedArray_elementSize(duckVM_typedArray_type_t type) {
+	switch (type) {
+	case duckVM_typedArray_type_f64:
+		return sizeof(double);
+	case duckVM_typedArray_type_i64:
+		return sizeof(dl_ptrdiff_t);
+	default:
+		return sizeof(dl_uint8_t);
+	}
+}
+
+/* Element types are named by the symbols `f64`, `i64` and `u8`. */
+static dl_bool_t duckVM_typedArray_typeFromSymbol(const duckVM_object_t *symbol, duckVM_typedArray_type_t *type) {
+	const dl_uint8_t *name = dl_null;
+	dl_size_t name_length = 0;
+	dl_bool_t result = dl_false;
+	if ((symbol->type != duckVM_object_type_symbol) || !duckVM_string_bytes(symbol, &name, &name_length)) {
+		return dl_false;
+	}
+	/**/ dl_string_compare(&result, name, name_length, DL_STR("f64"));
+	if (result) {
+		*type = duckVM_typedArray_type_f64;
+		return dl_true;
+	}
+	/**/ dl_string_compare(&result, name, name_length, DL_STR("i64"));
+	if (result) {
+		*type = duckVM_typedArray_type_i64;
+		return dl_true;
+	}
+	/**/ dl_string_compare(&result, name, name_length, DL_STR("u8"));
+	if (result) {
+		*type = duckVM_typedArray_type_u8;
+		return dl_true;
+	}
+	return dl_false;
+}
+
+/* Box element `index`. The caller checks the bounds. */
+static duckVM_object_t duckVM_typedArray_get(const duckVM_internalTypedArray_t *array, dl_size_t index) {
+	duckVM_object_t element;
+	switch (array->type) {
+	case duckVM_typedArray_type_f64:
+		element.type = duckVM_object_type_float;
+		element.value.floatingPoint = array->elements.f64[index];
+		break;
+	case duckVM_typedArray_type_i64:
+		element.type = duckVM_object_type_integer;
+		element.value.integer = array->elements.i64[index];
+		break;
+	default:
+		element.type = duckVM_object_type_integer;
+		element.value.integer = array->elements.u8[index];
+	}
+	return element;
+}
+
+/* Unbox `value` into element `index`. f64 elements accept integers and floats. Integer elements only accept integers,
+   and u8 elements only accept integers between 0 and 255. The caller checks the bounds. */
+static dl_bool_t duckVM_typedArray_set(duckVM_internalTypedArray_t *array,
+                                       dl_size_t index,
+                                       const duckVM_object_t *value) {
+	switch (array->type) {
+	case duckVM_typedArray_type_f64:
+		if (value->type == duckVM_object_type_float) array->elements.f64[index] = value->value.floatingPoint;
+		else if (value->type == duckVM_object_type_integer) array->elements.f64[index] = (double) value->value.integer;
+		else return dl_false;
+		break;
+	case duckVM_typedArray_type_i64:
+		if (value->type != duckVM_object_type_integer) return dl_false;
+		array->elements.i64[index] = value->value.integer;
+		break;
+	default:
+		if ((value->type != duckVM_object_type_integer)
+		    || (value->value.integer < 0)
+		    || (value->value.integer > DL_UINT8_MAX)) {
+			return dl_false;
+		}
+		array->elements.u8[index] = value->value.integer;
+	}
+	return dl_true;
+}
+
+/* The kernels below are written as plain loops over contiguous elements so that the compiler can vectorize them.
+   Floating point sums keep four partial sums, since a single running sum forces each addition to wait for the last one.
+   Integer arithmetic wraps. */
+
+static duckVM_object_t duckVM_typedArray_sum(const duckVM_internalTypedArray_t *array) {
+	duckVM_object_t result;
+	dl_size_t length = array->length;
+	dl_size_t i = 0;
+	if (array->type == duckVM_typedArray_type_f64) {
+		const double *x = array->elements.f64;
+		double sums[4] = {0.0, 0.0, 0.0, 0.0};
+		for (; i + 4 <= length; i += 4) {
+			sums[0] += x[i];
+			sums[1] += x[i + 1];
+			sums[2] += x[i + 2];
+			sums[3] += x[i + 3];
+		}
+		for (; i < length; i++) sums[0] += x[i];
+		result.type = duckVM_object_type_float;
+		result.value.floatingPoint = (sums[0] + sums[1]) + (sums[2] + sums[3]);
+	}
+	else if (array->type == duckVM_typedArray_type_i64) {
+		const dl_ptrdiff_t *x = array->elements.i64;
+		dl_size_t sum = 0;
+		for (; i < length; i++) sum += (dl_size_t) x[i];
+		result.type = duckVM_object_type_integer;
+		result.value.integer = (dl_ptrdiff_t) sum;
+	}
+	else {
+		const dl_uint8_t *x = array->elements.u8;
+		dl_size_t sum = 0;
+		for (; i < length; i++) sum += x[i];
+		result.type = duckVM_object_type_integer;
+		result.value.integer = (dl_ptrdiff_t) sum;
+	}
+	return result;
+}
+
+/* Both arrays must have the same type and length. */
+static duckVM_object_t duckVM_typedArray_dot(const duckVM_internalTypedArray_t *left,
+                                             const duckVM_internalTypedArray_t *right) {
+	duckVM_object_t result;
+	dl_size_t length = left->length;
+	dl_size_t i = 0;
+	if (left->type == duckVM_typedArray_type_f64) {
+		const double *x = left->elements.f64;
+		const double *y = right->elements.f64;
+		double sums[4] = {0.0, 0.0, 0.0, 0.0};
+		for (; i + 4 <= length; i += 4) {
+			sums[0] += x[i] * y[i];
+			sums[1] += x[i + 1] * y[i + 1];
+			sums[2] += x[i + 2] * y[i + 2];
+			sums[3] += x[i + 3] * y[i + 3];
+		}
+		for (; i < length; i++) sums[0] += x[i] * y[i];
+		result.type = duckVM_object_type_float;
+		result.value.floatingPoint = (sums[0] + sums[1]) + (sums[2] + sums[3]);
+	}
+	else if (left->type == duckVM_typedArray_type_i64) {
+		const dl_ptrdiff_t *x = left->elements.i64;
+		const dl_ptrdiff_t *y = right->elements.i64;
+		dl_size_t sum = 0;
+		for (; i < length; i++) sum += (dl_size_t) x[i] * (dl_size_t) y[i];
+		result.type = duckVM_object_type_integer;
+		result.value.integer = (dl_ptrdiff_t) sum;
+	}
+	else {
+		const dl_uint8_t *x = left->elements.u8;
+		const dl_uint8_t *y = right->elements.u8;
+		dl_size_t sum = 0;
+		for (; i < length; i++) sum += (dl_size_t) x[i] * y[i];
+		result.type = duckVM_object_type_integer;
+		result.value.integer = (dl_ptrdiff_t) sum;
+	}
+	return result;
+}
+
+/* Multiply every element by `factor`, which has already been checked to suit the array's type. */
+static void duckVM_typedArray_scale(duckVM_internalTypedArray_t *array, const duckVM_object_t *factor) {
+	dl_size_t length = array->length;
+	if (array->type == duckVM_typedArray_type_f64) {
+		double *x = array->elements.f64;
+		double f = ((factor->type == duckVM_object_type_float)
+		            ? factor->value.floatingPoint
+		            : (double) factor->value.integer);
+		for (dl_size_t i = 0; i < length; i++) x[i] *= f;
+	}
+	else if (array->type == duckVM_typedArray_type_i64) {
+		dl_ptrdiff_t *x = array->elements.i64;
+		dl_size_t f = (dl_size_t) factor->value.integer;
+		for (dl_size_t i = 0; i < length; i++) x[i] = (dl_ptrdiff_t) ((dl_size_t) x[i] * f);
+	}
+	else {
+		dl_uint8_t *x = array->elements.u8;
+		dl_uint8_t f = factor->value.integer & 0xFF;
+		for (dl_size_t i = 0; i < length; i++) x[i] = x[i] * f;
+	}
+}
+
+/* `destination` op= `source` element by element. Both arrays must have the same type and length. */
+static void duckVM_typedArray_combine(duckVM_internalTypedArray_t *destination,
+                                      const duckVM_internalTypedArray_t *source,
+                                      dl_bool_t multiply) {
+	dl_size_t length = destination->length;
+	if (destination->type == duckVM_typedArray_type_f64) {
+		double *x = destination->elements.f64;
+		const double *y = source->elements.f64;
+		if (multiply) for (dl_size_t i = 0; i < length; i++) x[i] *= y[i];
+		else for (dl_size_t i = 0; i < length; i++) x[i] += y[i];
+	}
+	else if (destination->type == duckVM_typedArray_type_i64) {
+		dl_ptrdiff_t *x = destination->elements.i64;
+		const dl_ptrdiff_t *y = source->elements.i64;
+		if (multiply) for (dl_size_t i = 0; i < length; i++) x[i] = (dl_ptrdiff_t) ((dl_size_t) x[i] * (dl_size_t) y[i]);
+		else for (dl_size_t i = 0; i < length; i++) x[i] = (dl_ptrdiff_t) ((dl_size_t) x[i] + (dl_size_t) y[i]);
+	}
+	else {
+		dl_uint8_t *x = destination->elements.u8;
+		const dl_uint8_t *y = source->elements.u8;
+		if (multiply) for (dl_size_t i = 0; i < length; i++) x[i] = x[i] * y[i];
+		else for (dl_size_t i = 0; i < length; i++) x[i] = x[i] + y[i];
+	}
+}
+
+/* Return the smallest or largest element of a non-empty array. NaNs are skipped unless every element is NaN. */
+static duckVM_object_t duckVM_typedArray_extreme(const duckVM_internalTypedArray_t *array, dl_bool_t maximum) {
+	dl_size_t length = array->length;
+	if (array->type == duckVM_typedArray_type_f64) {
+		const double *x = array->elements.f64;
+		double value = x[0];
+		for (dl_size_t i = 1; i < length; i++) {
+			/* `value != value` is true for NaN. */
+			if ((value != value) || (maximum ? (x[i] > value) : (x[i] < value))) value = x[i];
+		}
+		return duckVM_object_makeFloat(value);
+	}
+	else if (array->type == duckVM_typedArray_type_i64) {
+		const dl_ptrdiff_t *x = array->elements.i64;
+		dl_ptrdiff_t value = x[0];
+		if (maximum) for (dl_size_t i = 1; i < length; i++) value = (x[i] > value) ? x[i] : value;
+		else for (dl_size_t i = 1; i < length; i++) value = (x[i] < value) ? x[i] : value;
+		return duckVM_object_makeInteger(value);
+	}
+	else {
+		const dl_uint8_t *x = array->elements.u8;
+		dl_uint8_t value = x[0];
+		if (maximum) for (dl_size_t i = 1; i < length; i++) value = (x[i] > value) ? x[i] : value;
+		else for (dl_size_t i = 1; i < length; i++) value = (x[i] < value) ? x[i] : value;
+		return duckVM_object_makeInteger(value);
+	}
+}
+
+
+/* Comparison */
+
+/* The test that `brnz` uses. Types that aren't listed are false. */
+static dl_bool_t duckVM_object_isTruthy(const duckVM_object_t *object) {
+	if (object->type == duckVM_object_type_bool) {
+		return object->value.boolean;
+	}
+	else if (object->type == duckVM_object_type_integer) {
+		return object->value.integer != 0;
+	}
+	else if (object->type == duckVM_object_type_float) {
+		return object->value.floatingPoint != 0.0;
+	}
+	else if (object->type == duckVM_object_type_symbol) {
+		return dl_true;
+	}
+	else if (object->type == duckVM_object_type_list) {
+		return object->value.list != dl_null;
+	}
+	else if (object->type == duckVM_object_type_closure) {
+		return dl_true;
+	}
+	else if (object->type == duckVM_object_type_function) {
+		return dl_true;
+	}
+	else if (object->type == duckVM_object_type_string) {
+		return dl_true;
+	}
+	else if (object->type == duckVM_object_type_vector) {
+		return ((object->value.vector.internal_vector != dl_null)
+		        && ((dl_size_t) object->value.vector.offset
+		            < object->value.vector.internal_vector->value.internal_vector.length));
+	}
+	return dl_false;
+}
+
+/* The comparison that `=` uses. Lists, vectors and symbols are compared by identity, strings by content. The left
+   argument must be one of the types that `=` accepts. */
+static dl_error_t duckVM_object_equal(const duckVM_object_t *leftIn, const duckVM_object_t *rightIn, dl_bool_t *equal) {
+	duckVM_object_t left = *leftIn;
+	duckVM_object_t right = *rightIn;
+	/* String builders are compared by their contents so far. */
+	if (left.type == duckVM_object_type_stringBuilder) left = duckVM_stringBuilder_string(&left);
+	if (right.type == duckVM_object_type_stringBuilder) right = duckVM_stringBuilder_string(&right);
+	switch (left.type) {
+	case duckVM_object_type_list:
+		switch (right.type) {
+		case duckVM_object_type_list:
+			*equal = left.value.list == right.value.list;
+			break;
+		default:
+			*equal = dl_false;
+		}
+		break;
+	case duckVM_object_type_symbol:
+		switch (right.type) {
+		case duckVM_object_type_symbol:
+			*equal = left.value.symbol.id == right.value.symbol.id;
+			break;
+		default:
+			*equal = dl_false;
+		}
+		break;
+	case duckVM_object_type_string:
+		switch (right.type) {
+		case duckVM_object_type_string:
+			*equal = duckVM_string_equal(&left, &right);
+			break;
+		default:
+			*equal = dl_false;
+		}
+		break;
+	case duckVM_object_type_float:
+		switch (right.type) {
+		case duckVM_object_type_float:
+			*equal = left.value.floatingPoint == right.value.floatingPoint;
+			break;
+		default:
+			*equal = dl_false;
+		}
+		break;
+	case duckVM_object_type_integer:
+		switch (right.type) {
+		case duckVM_object_type_integer:
+			*equal = left.value.integer == right.value.integer;
+			break;
+		default:
+			*equal = dl_false;
+		}
+		break;
+	case duckVM_object_type_bool:
+		switch (right.type) {
+		case duckVM_object_type_bool:
+			*equal = left.value.boolean == right.value.boolean;
+			break;
+		default:
+			*equal = dl_false;
+		}
+		break;
+	case duckVM_object_type_vector:
+		switch (right.type) {
+		case duckVM_object_type_vector:
+			*equal = ((left.value.vector.internal_vector == right.value.vector.internal_vector)
+			          && (left.value.vector.offset == right.value.vector.offset));
+			break;
+		default:
+			*equal = dl_false;
+		}
+		break;
+	case duckVM_object_type_type:
+		switch (right.type) {
+		case duckVM_object_type_type:
+			*equal = (left.value.type == right.value.type);
+			break;
+		default:
+			*equal = dl_false;
+		}
+		break;
+	default:
+		return dl_error_invalidValue;
+	}
+	return dl_error_ok;
+}
+
+
+/* Lists */
+
+/* The object that `car` would push for this car. */
+static duckVM_object_t duckVM_list_element(duckVM_object_t *car) {
+	duckVM_object_t element;
+	if (car == dl_null) {
+		element.type = duckVM_object_type_list;
+		element.value.list = dl_null;
+	}
+	else if (car->type == duckVM_object_type_cons) {
+		element.type = duckVM_object_type_list;
+		element.value.list = car;
+	}
+	else {
+		element = *car;
+	}
+	return element;
+}
+
+/* Link a new cons to the end of the list at `rootIndex` on the stack. `*last` is the last cons of that list, or null
+   if nothing has been linked yet, in which case the new cons replaces the list. Both `car` and `cdr` must already be
+   reachable, since allocating the cons may collect garbage. */
+static dl_error_t duckVM_list_link(duckVM_t *duckVM,
+                                   const dl_size_t rootIndex,
+                                   duckVM_object_t **last,
+                                   duckVM_object_t *car,
+                                   duckVM_object_t *cdr) {
+	dl_error_t e = dl_error_ok;
+	duckVM_object_t *cons = dl_null;
+
+	e = duckVM_gclist_pushObject(duckVM, &cons, duckVM_object_makeCons(car, cdr));
+	if (e) goto cleanup;
+	if (*last == dl_null) {
+		DL_ARRAY_GETADDRESS(duckVM->stack, duckVM_object_t, rootIndex).value.list = cons;
+	}
+	else {
+		(*last)->value.cons.cdr = cons;
+	}
+	*last = cons;
+
+ cleanup:
+	return e;
+}
+
+
+/* Parallel map */
+
+/* A `cdr` view shares its parent's storage, so truncating the parent can leave the view's offset past the end. Such a
+   view is empty. */
+static dl_size_t duckVM_vector_length(const duckVM_object_t *vector) {
+	const duckVM_object_t *internalVector = vector->value.vector.internal_vector;
+	if ((internalVector == dl_null)
+	    || ((dl_size_t) vector->value.vector.offset >= internalVector->value.internal_vector.length)) {
+		return 0;
+	}
+	return internalVector->value.internal_vector.length - vector->value.vector.offset;
+}
+
+/* True if the storage was truncated below the start of this view. Growing or shrinking the storage through such a view
+   would touch elements the view can't see. */
+static dl_bool_t duckVM_vector_isPastEnd(const duckVM_object_t *vector) {
+	const duckVM_object_t *internalVector = vector->value.vector.internal_vector;
+	return ((internalVector != dl_null)
+	        && ((dl_size_t) vector->value.vector.offset > internalVector->value.internal_vector.length));
+}
+
+/* Call the function on each element of the vector in this VM and push a vector of the results. Both are passed by
+   their position on the stack so that the collector can see them. */
+static dl_error_t duckVM_map(duckVM_t *duckVM, dl_ptrdiff_t functionIndex, dl_ptrdiff_t vectorIndex) {
+	dl_error_t e = dl_error_ok;
+
+	duckVM_object_t vector;
+	duckVM_object_t result;
+	duckVM_object_t internalVector;
+	dl_size_t length;
+	/* `duckVM_call` clears the current bytecode when it returns. */
+	duckVM_object_t *currentBytecode = duckVM->currentBytecode;
+
+	e = stack_get(duckVM, &vector, vectorIndex);
+	if (e) goto cleanup;
+	length = duckVM_vector_length(&vector);
+
+	/**/ dl_memclear(&internalVector, sizeof(duckVM_object_t));
+	internalVector.type = duckVM_object_type_internalVector;
+	internalVector.value.internal_vector.length = length;
+	internalVector.value.internal_vector.initialized = dl_false;
+	/**/ dl_memclear(&result, sizeof(duckVM_object_t));
+	result.type = duckVM_object_type_vector;
+	result.value.vector.offset = 0;
+	e = duckVM_gclist_pushObject(duckVM, &result.value.vector.internal_vector, internalVector);
+	if (e) goto cleanup;
+	DL_DOTIMES(k, length) {
+		result.value.vector.internal_vector->value.internal_vector.values[k] = dl_null;
+	}
+	result.value.vector.internal_vector->value.internal_vector.initialized = dl_true;
+	e = stack_push(duckVM, &result);
+	if (e) goto cleanup;
+
+	DL_DOTIMES(k, length) {
+		duckVM_object_t object;
+		duckVM_object_t *element = dl_null;
+		e = stack_get(duckVM, &object, functionIndex);
+		if (e) break;
+		e = stack_push(duckVM, &object);
+		if (e) break;
+		object = *(vector.value.vector.internal_vector
+		           ->value.internal_vector.values[vector.value.vector.offset + k]);
+		e = stack_push(duckVM, &object);
+		if (e) break;
+		e = duckVM_call(duckVM, -2, 1);
+		duckVM->currentBytecode = currentBytecode;
+		if (e) break;
+		/* stack: result function returnValue */
+		e = duckVM_gclist_pushObject(duckVM, &element, DL_ARRAY_GETTOPADDRESS(duckVM->stack, duckVM_object_t));
+		if (e) break;
+		result.value.vector.internal_vector->value.internal_vector.values[k] = element;
+		e = stack_pop_multiple(duckVM, 2);
+		if (e) break;
+	}
+
+ cleanup:
+	return e;
+}
+
+/* Split the vector into one chunk per worker, map the chunks on the VM's pool, and push a vector of the results in
+   their original order. */
+static dl_error_t duckVM_parallelMap(duckVM_t *duckVM, dl_ptrdiff_t functionIndex, dl_ptrdiff_t vectorIndex) {
+	dl_error_t e = dl_error_ok;
+	dl_error_t eError = dl_error_ok;
+
+	duckVM_mapPool_t *mapPool = duckVM->mapPool;
+	duckVM_mapChunk_t *chunks = dl_null;
+	dl_size_t chunks_length = 0;
+	duckVM_object_t vector;
+	duckVM_object_t result;
+	duckVM_object_t internalVector;
+	dl_size_t length;
+	dl_size_t base = duckVM->stack.elements_length;
+
+	e = stack_get(duckVM, &vector, vectorIndex);
+	if (e) goto cleanup;
+	length = duckVM_vector_length(&vector);
+	chunks_length = (mapPool->workers < length) ? mapPool->workers : length;
+
+	e = DL_MALLOC(duckVM->memoryAllocation, &chunks, chunks_length, duckVM_mapChunk_t);
+	if (e) goto cleanup;
+	/**/ dl_memclear(chunks, chunks_length * sizeof(duckVM_mapChunk_t));
+
+	DL_DOTIMES(c, chunks_length) {
+		/* Each chunk is sent as `#(function element...)`. The elements aren't copied until the message is built. */
+		dl_size_t start = c * length / chunks_length;
+		dl_size_t end = (c + 1) * length / chunks_length;
+		duckVM_object_t chunk;
+		duckVM_object_t function;
+		duckVM_object_t **values;
+		/**/ dl_memclear(&internalVector, sizeof(duckVM_object_t));
+		internalVector.type = duckVM_object_type_internalVector;
+		internalVector.value.internal_vector.length = end - start + 1;
+		internalVector.value.internal_vector.initialized = dl_false;
+		/**/ dl_memclear(&chunk, sizeof(duckVM_object_t));
+		chunk.type = duckVM_object_type_vector;
+		chunk.value.vector.offset = 0;
+		e = duckVM_gclist_pushObject(duckVM, &chunk.value.vector.internal_vector, internalVector);
+		if (e) goto cleanup;
+		values = chunk.value.vector.internal_vector->value.internal_vector.values;
+		DL_DOTIMES(k, end - start + 1) {
+			values[k] = dl_null;
+		}
+		chunk.value.vector.internal_vector->value.internal_vector.initialized = dl_true;
+		e = stack_push(duckVM, &chunk);
+		if (e) goto cleanup;
+		e = stack_get(duckVM, &function, functionIndex);
+		if (e) goto cleanup;
+		e = duckVM_gclist_pushObject(duckVM, &values[0], function);
+		if (e) goto cleanup;
+		for (dl_size_t k = start; k < end; k++) {
+			values[k - start + 1] = vector.value.vector.internal_vector->value.internal_vector.values[vector.value.vector.offset
+			                                                                                          + k];
+		}
+		e = duckVM_message_fromObject(duckVM, mapPool->memoryAllocation, &chunk, &chunks[c].input);
+		if (e) goto cleanup;
+		e = stack_pop_multiple(duckVM, 1);
+		if (e) goto cleanup;
+	}
+
+	e = mapPool->run(mapPool->data, chunks, chunks_length);
+	if (e) goto cleanup;
+	DL_DOTIMES(c, chunks_length) {
+		if (chunks[c].e) {
+			e = chunks[c].e;
+			eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->parallel-map: A worker failed."));
+			if (eError) e = eError;
+			goto cleanup;
+		}
+	}
+
+	/* stack: chunk-result... */
+	DL_DOTIMES(c, chunks_length) {
+		e = duckVM_message_pushObject(duckVM, chunks[c].output);
+		if (e) goto cleanup;
+	}
+
+	/**/ dl_memclear(&internalVector, sizeof(duckVM_object_t));
+	internalVector.type = duckVM_object_type_internalVector;
+	internalVector.value.internal_vector.length = length;
+	internalVector.value.internal_vector.initialized = dl_false;
+	/**/ dl_memclear(&result, sizeof(duckVM_object_t));
+	result.type = duckVM_object_type_vector;
+	result.value.vector.offset = 0;
+	e = duckVM_gclist_pushObject(duckVM, &result.value.vector.internal_vector, internalVector);
+	if (e) goto cleanup;
+	{
+		duckVM_object_t **values = result.value.vector.internal_vector->value.internal_vector.values;
+		DL_DOTIMES(c, chunks_length) {
+			duckVM_object_t chunkResult = DL_ARRAY_GETADDRESS(duckVM->stack, duckVM_object_t, base + c);
+			dl_size_t start = c * length / chunks_length;
+			DL_DOTIMES(k, duckVM_vector_length(&chunkResult)) {
+				values[start + k] = (chunkResult.value.vector.internal_vector
+				                     ->value.internal_vector.values[chunkResult.value.vector.offset + k]);
+			}
+		}
+	}
+	result.value.vector.internal_vector->value.internal_vector.initialized = dl_true;
+	e = stack_set(duckVM, &result, base);
+	if (e) goto cleanup;
+	e = stack_pop_multiple(duckVM, duckVM->stack.elements_length - base - 1);
+	if (e) goto cleanup;
+
+ cleanup:
+	DL_DOTIMES(c, chunks_length) {
+		if (chunks == dl_null) break;
+		if (chunks[c].input != dl_null) {
+			eError = duckVM_message_quit(mapPool->memoryAllocation, chunks[c].input);
+			if (eError) e = eError;
+		}
+		if (chunks[c].output != dl_null) {
+			eError = duckVM_message_quit(mapPool->memoryAllocation, chunks[c].output);
+			if (eError) e = eError;
+		}
+	}
+	if (chunks != dl_null) {
+		eError = DL_FREE(duckVM->memoryAllocation, &chunks);
+		if (eError) e = eError;
+	}
+	return e;
+}
+
+
+/* JIT */
+
+/* Find the native code that can be entered at `offset`, or return `dl_null` if there is none. */
+static duckVM_native_t *duckVM_jit_find(const duckVM_bytecode_t *bytecode, const dl_size_t offset) {
+	const dl_uint8_t *entries = bytecode->nativeEntries;
+	if ((entries == dl_null) || !((entries[offset / 8] >> (offset % 8)) & 1U)) return dl_null;
+	for (duckVM_native_t *native = bytecode->native; native != dl_null; native = native->next) {
+		dl_size_t low = 0;
+		dl_size_t high = native->entries_length;
+		while (low < high) {
+			const dl_size_t middle = low + (high - low) / 2;
+			if (native->entries[middle] < offset) low = middle + 1;
+			else high = middle;
+		}
+		if ((low < native->entries_length) && (native->entries[low] == offset)) return native;
+	}
+	return dl_null;
+}
+
+/* Compile the code reachable from `ip` if it's hot and hasn't been compiled yet. If this fails the code is simply
+   interpreted. */
+static duckVM_native_t *duckVM_jit_compile(duckVM_t *duckVM, duckVM_object_t *bytecode, dl_uint8_t *ip) {
+	duckVM_jit_t *jit = duckVM->jit;
+	duckVM_bytecode_t *b = &bytecode->value.bytecode;
+	const dl_size_t offset = ip - b->bytecode;
+	const dl_size_t tried = b->bytecode_length + offset;
+	dl_size_t *count = &duckVM->jitCounts[(dl_size_t) ip % DUCKVM_JIT_COUNTS];
+	duckVM_native_t *native = dl_null;
+
+	if ((b->nativeEntries != dl_null) && ((b->nativeEntries[tried / 8] >> (tried % 8)) & 1U)) return dl_null;
+	if (++*count < jit->threshold) return dl_null;
+	*count = 0;
+	if (b->nativeEntries == dl_null) {
+		const dl_size_t length = (2 * b->bytecode_length + 7) / 8;
+		if (DL_MALLOC(duckVM->memoryAllocation, &b->nativeEntries, length, dl_uint8_t)) return dl_null;
+		/**/ dl_memclear(b->nativeEntries, length);
+	}
+	b->nativeEntries[tried / 8] |= 1U << (tried % 8);
+	if (jit->compile(jit->data, duckVM, bytecode, ip, &native) || (native == dl_null)) return dl_null;
+	native->next = b->native;
+	b->native = native;
+	DL_DOTIMES(i, native->entries_length) {
+		const dl_size_t entry = native->entries[i];
+		b->nativeEntries[entry / 8] |= 1U << (entry % 8);
+	}
+	return native;
+}
+
+/* Called when the interpreter enters a closure or jumps back to the start of a loop. Runs native code from `*ip` if
+   there is any, compiling it first if the code has become hot. */
+static void duckVM_jit_enter(duckVM_t *duckVM, duckVM_object_t *bytecode, dl_uint8_t **ip, dl_size_t *budget) {
+	duckVM_native_t *native = duckVM_jit_find(&bytecode->value.bytecode, *ip - bytecode->value.bytecode.bytecode);
+	if (native == dl_null) native = duckVM_jit_compile(duckVM, bytecode, *ip);
+	if (native == dl_null) return;
+	/**/ duckVM->jit->run(duckVM->jit->data, duckVM, native, ip, budget);
+}
+
+
+#ifndef NO_QUICKENING
+/* Rewrite an opcode in place. Shared programs may be running on other threads, so they are never written to. */
+static void duckVM_quicken(const duckVM_object_t *bytecode, unsigned char *opcodePtr, const unsigned char opcode) {
+	if (bytecode->value.bytecode.program == dl_null) *opcodePtr = opcode;
+}
+
+static dl_bool_t duckVM_isPolymorphic(const duckVM_object_t *bytecode, const unsigned char *opcodePtr) {
+	const dl_uint8_t *polymorphic = bytecode->value.bytecode.polymorphic;
+	dl_size_t index;
+	if (polymorphic == dl_null) return dl_false;
+	index = opcodePtr - bytecode->value.bytecode.bytecode;
+	return (polymorphic[index / 8] >> (index % 8)) & 1U;
+}
+
+/* Rewrite a type-specialized opcode back to its generic form after its operands failed the type check, and mark the
+   site so that it isn't specialized again. Without the mark, a site that sees both integers and floats would be
+   rewritten back and forth on every call. */
+static void duckVM_unquicken(duckVM_t *duckVM,
+                             duckVM_object_t *bytecode,
+                             unsigned char *opcodePtr,
+                             const unsigned char opcode) {
+	dl_size_t index;
+	if (bytecode->value.bytecode.program != dl_null) return;
+	*opcodePtr = opcode;
+	if (bytecode->value.bytecode.polymorphic == dl_null) {
+		const dl_size_t length = (bytecode->value.bytecode.bytecode_length + 7) / 8;
+		/* If this fails the site is simply allowed to be specialized again. */
+		if (DL_MALLOC(duckVM->memoryAllocation, &bytecode->value.bytecode.polymorphic, length, dl_uint8_t)) return;
+		/**/ dl_memclear(bytecode->value.bytecode.polymorphic, length);
+	}
+	index = opcodePtr - bytecode->value.bytecode.bytecode;
+	bytecode->value.bytecode.polymorphic[index / 8] |= 1U << (index % 8);
+}
+
+/* Rewrite a generic arithmetic opcode in place as its type-specialized form if both operands have the same numeric
+   type. The specialized instruction rewrites itself back if it ever sees operands of another type, after which the
+   site stays generic.
+   Only arithmetic is specialized. The generic car, getVecElt, and funcall already test the most common operand type
+   first, so a specialized form would have no work to skip. */
+static void duckVM_quickenArithmetic(const duckVM_object_t *bytecode,
+                                     unsigned char *opcodePtr,
+                                     const duckVM_object_t *object1,
+                                     const duckVM_object_t *object2,
+                                     const unsigned char integerOpcode,
+                                     const unsigned char floatOpcode) {
+	if (object1->type != object2->type) return;
+	if (duckVM_isPolymorphic(bytecode, opcodePtr)) return;
+	if (object1->type == duckVM_object_type_integer) duckVM_quicken(bytecode, opcodePtr, integerOpcode);
+	else if (object1->type == duckVM_object_type_float) duckVM_quicken(bytecode, opcodePtr, floatOpcode);
+}
+#endif /* NO_QUICKENING */
+
+/* Execute instructions until the VM halts or an error occurs. The loop lives in here rather than in the caller so
+   that the IP, the current bytecode, and the scratch variables stay in registers across instructions instead of being
+   written back through pointers after each one.
+   If `budget` instructions are executed before the VM halts, the loop stops in front of the next instruction and sets
+   `*halt` to `duckVM_halt_mode_suspend`.
+   `barrier` is the coroutine that was running when this loop was entered. Coroutines can't yield or return past it,
+   since that would mean yielding out of a C callback. */
+static dl_error_t duckVM_executeInstructions(duckVM_t *duckVM,
+                                             duckVM_object_t **bytecodePtr,
+                                             unsigned char **ipPtr,
+                                             dl_size_t budget,
+                                             duckVM_object_t *barrier,
+                                             duckVM_halt_mode_t *halt) {
+	dl_error_t e = dl_error_ok;
+	dl_error_t eError = dl_error_ok;
+
+	const duckVM_object_t nullObject = {0};
+	dl_uint8_t *ptr1;
+	dl_ptrdiff_t ptrdiff1;
+	dl_ptrdiff_t ptrdiff2;
+	dl_ptrdiff_t ptrdiff3;
+	dl_size_t size1;
+	dl_size_t size2;
+	dl_uint8_t uint8;
+	duckVM_object_t object1;
+	duckVM_object_t object2;
+	duckVM_object_t object3;
+	duckVM_object_t *objectPtr1;
+	duckVM_object_t *objectPtr2;
+	duckVM_object_t cons1;
+	dl_bool_t bool1;
+	dl_bool_t parsedBytecode;
+	/* Closures may live in a different bytecode object than the caller, so the current bytecode has to be passed back
+	   out along with the IP. */
+	duckVM_object_t *bytecode = *bytecodePtr;
+	unsigned char *ip = *ipPtr;
+	/* Extended instructions are decoded to values above 0xFF. */
+	unsigned int opcode;
+#ifndef NO_QUICKENING
+	/* Quickening rewrites the opcode in place. */
+	unsigned char *opcodePtr = dl_null;
+#endif /* NO_QUICKENING */
+
+	/* Callbacks call closures by starting a new loop at the closure's first instruction. */
+	if (duckVM->jit != dl_null) {
+		/**/ duckVM_jit_enter(duckVM, bytecode, &ip, &budget);
+	}
+
+ next:
+	/* Every instruction starts with fresh scratch variables. Some instructions depend on this. */
+	ptr1 = dl_null;
+	ptrdiff1 = 0;
+	ptrdiff2 = 0;
+	ptrdiff3 = 0;
+	size1 = 0;
+	size2 = 0;
+	uint8 = 0;
+	object1 = nullObject;
+	object2 = nullObject;
+	object3 = nullObject;
+	objectPtr1 = dl_null;
+	objectPtr2 = dl_null;
+	cons1 = nullObject;
+	bool1 = dl_false;
+	parsedBytecode = dl_false;
+	if (budget == 0) {
+		*halt = duckVM_halt_mode_suspend;
+		goto cleanup;
+	}
+	--budget;
+	opcode = *(ip++);
+ dispatch:
+#ifndef NO_QUICKENING
+	opcodePtr = ip - 1;
+#endif /* NO_QUICKENING */
+	switch (opcode) {
+	case duckLisp_instruction_nop:
+		break;
+
+	case duckLisp_instruction_extended:
+		opcode = duckLisp_instruction_extendedFirst + *(ip++);
+		goto dispatch;
+
+	case duckLisp_instruction_pushSymbol32:
+		size2 = *(ip++);
+		size2 = *(ip++) + (size2 << 8);
+		size2 = *(ip++) + (size2 << 8);
+		size2 = *(ip++) + (size2 << 8);
+		size1 = *(ip++);
+		size1 = *(ip++) + (size1 << 8);
+		size1 = *(ip++) + (size1 << 8);
+		size1 = *(ip++) + (size1 << 8);
+		parsedBytecode = dl_true;
+		/* Fall through */
+	case duckLisp_instruction_pushSymbol16:
+		if (!parsedBytecode) {
+			size2 = *(ip++);
+			size2 = *(ip++) + (size2 << 8);
+			size1 = *(ip++);
+			size1 = *(ip++) + (size1 << 8);
+			parsedBytecode = dl_true;
+		}
+		/* Fall through */
+	case duckLisp_instruction_pushSymbol8:
+		if (!parsedBytecode) {
+			size2 = *(ip++);
+			size1 = *(ip++);
+		}
+		{
+			dl_uint8_t *lastIp = ip;
+			ip += size1;
+			e = duckVM_object_makeSymbol(duckVM, &object1, size2, lastIp, size1);
+			if (e) break;
+		}
+		e = stack_push(duckVM, &object1);
+		if (e) {
+			eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->push-symbol: stack_push failed."));
+			if (!e) e = eError;
+		}
+		break;
+
+	case duckLisp_instruction_pushStrippedSymbol32:
+		size2 = *(ip++);
+		size2 = *(ip++) + (size2 << 8);
+		size2 = *(ip++) + (size2 << 8);
+		size2 = *(ip++) + (size2 << 8);
+		parsedBytecode = dl_true;
+		/* Fall through */
+	case duckLisp_instruction_pushStrippedSymbol16:
+		if (!parsedBytecode) {
+			size2 = *(ip++);
+			size2 = *(ip++) + (size2 << 8);
+			parsedBytecode = dl_true;
+		}
+		/* Fall through */
+	case duckLisp_instruction_pushStrippedSymbol8:
+		if (!parsedBytecode) {
+			size2 = *(ip++);
+		}
+		(void) duckVM_object_makeCompressedSymbol(&object1, size2);
+		e = stack_push(duckVM, &object1);
+		if (e) {
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->push-stripped-symbol: stack_push failed."));
+			if (!e) e = eError;
+		}
+		break;
+
+	case duckLisp_instruction_pushString32:
+		size1 = *(ip++);
+		size1 = *(ip++) + (size1 << 8);
+		// Fall through
+	case duckLisp_instruction_pushString16:
+		size1 = *(ip++) + (size1 << 8);
+		// Fall through
+	case duckLisp_instruction_pushString8:
+		size1 = *(ip++) + (size1 << 8);
+		{
+			dl_uint8_t *string = ip;
+			dl_size_t string_length = size1;
+			ip += size1;
 			e = duckVM_object_makeString(duckVM, &object1, string, string_length);
 			if (e) {
-				(eError
-				 = duckVM_error_pushRuntime(duckVM,
-				                            DL_STR("duckVM_execute->push-string: duckVM_object_makeString failed.")));
+				(eError
+				 = duckVM_error_pushRuntime(duckVM,
+				                            DL_STR("duckVM_execute->push-string: duckVM_object_makeString failed.")));
+				if (!e) e = eError;
+			}
+			e = stack_push(duckVM, &object1);
+			if (e) {
+				eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->push-string: stack_push failed."));
+				if (!e) e = eError;
+			}
+		}
+		break;
+
+	case duckLisp_instruction_pushBooleanFalse:
+		object1 = duckVM_object_makeBoolean(dl_false);
+		e = stack_push(duckVM, &object1);
+		if (e) {
+			eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->push-boolean-false: stack_push failed."));
+			if (!e) e = eError;
+		}
+		break;
+	case duckLisp_instruction_pushBooleanTrue:
+		object1 = duckVM_object_makeBoolean(dl_true);
+		e = stack_push(duckVM, &object1);
+		if (e) {
+			eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->push-boolean-true: stack_push failed."));
+			if (!e) e = eError;
+		}
+		break;
+
+	case duckLisp_instruction_pushInteger32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		parsedBytecode = dl_true;
+		size1 = 0x7FFFFFFF;
+		/* Fall through */
+	case duckLisp_instruction_pushInteger16:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			size1 = 0x7FFF;
+			parsedBytecode = dl_true;
+		}
+		/* Fall through */
+	case duckLisp_instruction_pushInteger8:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			size1 = 0x7F;
+		}
+
+		ptrdiff1 = (((dl_size_t) ptrdiff1 > size1)
+		            ? (dl_ptrdiff_t) (~size1 | (dl_size_t) ptrdiff1)
+		            : ptrdiff1);
+		object1 = duckVM_object_makeInteger(ptrdiff1);
+		e = stack_push(duckVM, &object1);
+		if (e) {
+			eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->push-integer: stack_push failed."));
+			if (!e) e = eError;
+		}
+		break;
+
+	case duckLisp_instruction_pushDoubleFloat: {
+		dl_uint64_t totallyNotADoubleFloat = 0;
+		totallyNotADoubleFloat = *(ip++);
+		totallyNotADoubleFloat = *(ip++) + (totallyNotADoubleFloat << 8);
+		totallyNotADoubleFloat = *(ip++) + (totallyNotADoubleFloat << 8);
+		totallyNotADoubleFloat = *(ip++) + (totallyNotADoubleFloat << 8);
+		totallyNotADoubleFloat = *(ip++) + (totallyNotADoubleFloat << 8);
+		totallyNotADoubleFloat = *(ip++) + (totallyNotADoubleFloat << 8);
+		totallyNotADoubleFloat = *(ip++) + (totallyNotADoubleFloat << 8);
+		totallyNotADoubleFloat = *(ip++) + (totallyNotADoubleFloat << 8);
+		object1 = duckVM_object_makeFloat(*((double *) &totallyNotADoubleFloat));
+		e = stack_push(duckVM, &object1);
+		if (e) {
+			eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->push-double-float: stack_push failed."));
+			if (!e) e = eError;
+		}
+		break;
+	}
+
+	case duckLisp_instruction_pushIndex32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		// Fall through
+	case duckLisp_instruction_pushIndex16:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		// Fall through
+	case duckLisp_instruction_pushIndex8:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) {
+			eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->push-index: dl_array_get failed."));
+			if (!e) e = eError;
+			break;
+		}
+		e = stack_push(duckVM, &object1);
+		if (e) {
+			eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->push-index: stack_push failed."));
+			if (!e) e = eError;
+		}
+		break;
+
+	case duckLisp_instruction_pushUpvalue32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through */
+	case duckLisp_instruction_pushUpvalue16:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through */
+	case duckLisp_instruction_pushUpvalue8:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		{
+			duckVM_upvalueArray_t upvalueArray;
+			if (ptrdiff1 < 0) {
+				e = dl_error_invalidValue;
+				eError = duckVM_error_pushRuntime(duckVM,
+				                                  DL_STR("duckVM_execute->push-upvalue: Index pointing to upvalue is negative."));
+				if (!e) e = eError;
+				break;
+			}
+			e = dl_array_getTop(&duckVM->upvalue_array_call_stack, &upvalueArray);
+			if (e) {
+				eError = duckVM_error_pushRuntime(duckVM,
+				                                  DL_STR("duckVM_execute->push-upvalue: dl_array_get failed."));
+				if (!e) e = eError;
+				break;
+			}
+			e = duckVM_upvalueArray_getUpvalue(duckVM, upvalueArray, &object1, ptrdiff1);
+			if (e) {
+				eError = duckVM_error_pushRuntime(duckVM,
+				                                  DL_STR("duckVM_execute->push-upvalue: duckVM_upvalueArray_getUpvalue failed."));
+				if (!e) e = eError;
+				break;
+			}
+			e = stack_push(duckVM, &object1);
+			if (e) {
+				eError = duckVM_error_pushRuntime(duckVM,
+				                                  DL_STR("duckVM_execute->push-upvalue: stack_push failed."));
+				if (!e) e = eError;
+				break;
+			}
+			break;
+		}
+
+	case duckLisp_instruction_pushClosure32:
+		/* Fall through */
+	case duckLisp_instruction_pushVaClosure32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptr1 = ip;
+		if (ptrdiff1 & 0x80000000ULL) {
+			ptrdiff1 = -((~ptrdiff1 + 1) & 0xFFFFFFFFULL);
+		}
+		parsedBytecode = dl_true;
+		/* Fall through */
+	case duckLisp_instruction_pushClosure16:
+		/* Fall through */
+	case duckLisp_instruction_pushVaClosure16:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			ptr1 = ip;
+			if (ptrdiff1 & 0x8000ULL) {
+				ptrdiff1 = -((~ptrdiff1 + 1) & 0xFFFFULL);
+			}
+			parsedBytecode = dl_true;
+		}
+		/* Fall through */
+	case duckLisp_instruction_pushClosure8:
+		/* Fall through */
+	case duckLisp_instruction_pushVaClosure8:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptr1 = ip;
+			if (ptrdiff1 & 0x80ULL) {
+				ptrdiff1 = -((~ptrdiff1 + 1) & 0xFFULL);
+			}
+		}
+
+		object1 = duckVM_object_makeClosure(ptrdiff1,
+		                                    bytecode,
+		                                    dl_null,
+		                                    *(ip++),
+		                                    ((opcode == duckLisp_instruction_pushVaClosure32)
+		                                     || (opcode == duckLisp_instruction_pushVaClosure16)
+		                                     || (opcode == duckLisp_instruction_pushVaClosure8)));
+
+		size1 = *(ip++);
+		size1 = *(ip++) + (size1 << 8);
+		size1 = *(ip++) + (size1 << 8);
+		size1 = *(ip++) + (size1 << 8);
+
+		object1.value.closure.name += ptr1 - bytecode->value.bytecode.bytecode;
+
+		/* This could also point to a static version instead since this array is never changed
+		   and multiple closures could use the same array. */
+
+		e = duckVM_gclist_pushObject(duckVM,
+		                             &object1.value.closure.upvalue_array,
+		                             duckVM_object_makeUpvalueArray(dl_null, size1));
+		if (e) {
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->push-closure: duckVM_gclist_pushObject failed."));
+			if (!e) e = eError;
+			break;
+		}
+		duckVM_upvalueArray_t upvalueArray;
+		e = duckVM_closure_getUpvalueArray(object1.value.closure, &upvalueArray);
+		if (e) break;
+		DL_DOTIMES(k, upvalueArray.length) {
+			upvalueArray.upvalues[k] = dl_null;
+		}
+		/* Immediately push on stack so that the GC can see it. Allocating upvalues could trigger a GC. */
+		e = dl_array_pushElement(&duckVM->stack, &object1);
+		if (e) {
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->push-closure: dl_array_pushElement failed."));
+			if (!e) e = eError;
+			break;
+		}
+
+		dl_bool_t recursive = dl_false;
+
+		DL_DOTIMES(k, upvalueArray.length) {
+			ptrdiff1 = *(ip++);
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			if (ptrdiff1 > 0x7FFFFFFF) {
+				/* Nested upvalue */
+				ptrdiff1 = -(0x100000000 - ptrdiff1);
+			}
+			else {
+				/* Normal upvalue */
+				/* stack - 1 because we already pushed. */
+				ptrdiff1 = (duckVM->stack.elements_length - 1) - ptrdiff1;
+				if ((ptrdiff1 < 0) || ((dl_size_t) ptrdiff1 > duckVM->upvalue_stack.elements_length)) {
+					e = dl_error_invalidValue;
+					eError = duckVM_error_pushRuntime(duckVM,
+					                                  DL_STR("duckVM_execute->push-closure: Stack index out of bounds."));
+					if (!e) e = eError;
+					break;
+				}
+			}
+			duckVM_object_t *upvalue_pointer = dl_null;
+			if ((dl_size_t) ptrdiff1 == duckVM->upvalue_stack.elements_length) {
+				/* *Recursion* Capture upvalue we are about to push. This should only happen once. */
+				recursive = dl_true;
+				/* Our upvalue definitely doesn't exist yet. */
+				duckVM_object_t upvalue;
+				upvalue.type = duckVM_object_type_upvalue;
+				upvalue.value.upvalue.type = duckVM_upvalue_type_stack_index;  /* Lie for now. */
+				upvalue.value.upvalue.value.stack_index = ptrdiff1;
+				upvalue.value.upvalue.coroutine = duckVM->currentCoroutine;
+				e = duckVM_gclist_pushObject(duckVM, &upvalue_pointer, upvalue);
+				if (e) {
+					e = dl_error_shouldntHappen;
+					eError = duckVM_error_pushRuntime(duckVM,
+					                                  DL_STR("duckVM_execute->push-closure: duckVM_gclist_pushObject failed."));
+					if (!e) e = eError;
+					break;
+				}
+				/* Break push_scope abstraction. */
+				e = dl_array_pushElement(&duckVM->upvalue_stack, dl_null);
+				if (e) {
+					e = dl_error_shouldntHappen;
+					(eError
+					 = duckVM_error_pushRuntime(duckVM,
+					                            DL_STR("duckVM_execute->push-closure: dl_array_pushElement failed.")));
+					if (!e) e = eError;
+					break;
+				}
+				/* Upvalue stack slot exists now, so insert the new UV. */
+				DL_ARRAY_GETADDRESS(duckVM->upvalue_stack, duckVM_object_t *, ptrdiff1) = upvalue_pointer;
+			}
+			else if (ptrdiff1 < 0) {
+				/* Capture upvalue in currently executing function. */
+				ptrdiff1 = -(ptrdiff1 + 1);
+				duckVM_object_t upvalue;
+				upvalue.type = duckVM_object_type_upvalue;
+				upvalue.value.upvalue.type = duckVM_upvalue_type_heap_upvalue;
+				/* Link new upvalue to upvalue from current context. */
+				upvalue.value.upvalue.value.heap_upvalue = (DL_ARRAY_GETTOPADDRESS(duckVM->upvalue_array_call_stack,
+				                                                                   duckVM_upvalueArray_t)
+				                                            .upvalues[ptrdiff1]);
+				e = duckVM_gclist_pushObject(duckVM, &upvalue_pointer, upvalue);
+				if (e) {
+					eError = duckVM_error_pushRuntime(duckVM,
+					                                  DL_STR("duckVM_execute->push-closure: duckVM_gclist_pushObject failed."));
+					if (!e) e = eError;
+					break;
+				}
+			}
+			else {
+				/* Capture upvalue on stack. */
+				e = dl_array_get(&duckVM->upvalue_stack, &upvalue_pointer, ptrdiff1);
+				if (e) {
+					eError = duckVM_error_pushRuntime(duckVM,
+					                                  DL_STR("duckVM_execute->push-closure: Retrieval of upvalue from upvalue stack failed."));
+					if (!e) e = eError;
+					break;
+				}
+				if (upvalue_pointer == dl_null) {
+					duckVM_object_t upvalue;
+					upvalue.type = duckVM_object_type_upvalue;
+					upvalue.value.upvalue.type = duckVM_upvalue_type_stack_index;
+					upvalue.value.upvalue.value.stack_index = ptrdiff1;
+					upvalue.value.upvalue.coroutine = duckVM->currentCoroutine;
+					e = duckVM_gclist_pushObject(duckVM, &upvalue_pointer, upvalue);
+					if (e) {
+						eError = duckVM_error_pushRuntime(duckVM,
+						                                  DL_STR("duckVM_execute->push-closure: duckVM_gclist_pushObject failed."));
+						if (!e) e = eError;
+						break;
+					}
+					// Is this a bug? I'm not confident that this element exists.
+					/* Keep reference to upvalue on stack so that we know where to release the object to. */
+					DL_ARRAY_GETADDRESS(duckVM->upvalue_stack, duckVM_object_t *, ptrdiff1) = upvalue_pointer;
+				}
+				if (upvalue_pointer->type != duckVM_object_type_upvalue) {
+					e = dl_error_shouldntHappen;
+					eError = duckVM_error_pushRuntime(duckVM,
+					                                  DL_STR("duckVM_execute->push-closure: Captured object is not an upvalue."));
+					if (!e) e = eError;
+					break;
+				}
+			}
+			if (e) break;
+			upvalueArray.upvalues[k] = upvalue_pointer;
+		}
+		if (e) break;
+		if (!recursive) {
+			/* Break push_scope abstraction. */
+			e = dl_array_pushElement(&duckVM->upvalue_stack, dl_null);
+			if (e) {
+				eError = duckVM_error_pushRuntime(duckVM,
+				                                  DL_STR("duckVM_execute->push-closure: dl_array_pushElement failed."));
+				if (!e) e = eError;
+				break;
+			}
+		}
+		DL_ARRAY_GETTOPADDRESS(duckVM->stack, duckVM_object_t) = object1;
+
+		break;
+
+	case duckLisp_instruction_pushGlobal32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		parsedBytecode = dl_true;
+		/* Fall through */
+	case duckLisp_instruction_pushGlobal16:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			parsedBytecode = dl_true;
+		}
+		/* Fall through */
+	case duckLisp_instruction_pushGlobal8:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+		}
+		{
+			duckVM_object_t *global;
+			e = duckVM_global_get(duckVM, &global, ptrdiff1);
+			if (e) {
+				e = dl_error_invalidValue;
+				eError = duckVM_error_pushRuntime(duckVM,
+				                                  DL_STR("duckVM_execute->push-global: Could not find dynamic variable."));
+				if (eError) e = eError;
+				break;
+			}
+			e = stack_push(duckVM, global);
+			if (e) {
+				eError = duckVM_error_pushRuntime(duckVM,
+				                                  DL_STR("duckVM_execute->push-global: stack_push failed."));
+				if (!e) e = eError;
+				break;
+			}
+		}
+		break;
+
+	case duckLisp_instruction_releaseUpvalues32:
+	case duckLisp_instruction_releaseUpvalues16:
+	case duckLisp_instruction_releaseUpvalues8:
+		size1 = *(ip++);
+
+		DL_DOTIMES(k, size1) {
+			ptrdiff1 = *(ip++);
+			switch (opcode) {
+			case duckLisp_instruction_releaseUpvalues32:
+				ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+				ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+				/* Fall through */
+			case duckLisp_instruction_releaseUpvalues16:
+				ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+				/* Fall through */
+			case duckLisp_instruction_releaseUpvalues8:
+				break;
+			default:
+				e = dl_error_invalidValue;
+				break;
+			}
+			ptrdiff1 = duckVM->stack.elements_length - ptrdiff1;
+			if (ptrdiff1 < 0) {
+				e = dl_error_invalidValue;
+				break;
+			}
+			duckVM_object_t *upvalue = DL_ARRAY_GETADDRESS(duckVM->upvalue_stack, duckVM_object_t *, ptrdiff1);
+			if (upvalue != dl_null) {
+				if (upvalue->type != duckVM_object_type_upvalue) {
+					eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->release-upvalues: Captured object is not an upvalue."));
+					if (!e) e = eError;
+					break;
+				}
+				duckVM_object_t *object = &DL_ARRAY_GETADDRESS(duckVM->stack, duckVM_object_t, ptrdiff1);
+				e = duckVM_gclist_pushObject(duckVM, &upvalue->value.upvalue.value.heap_object, *object);
+				if (e) break;
+				upvalue->value.upvalue.type = duckVM_upvalue_type_heap_object;
+				/* Render the original object unusable. */
+				object->type = duckVM_object_type_list;
+				object->value.list = dl_null;
+				DL_ARRAY_GETADDRESS(duckVM->upvalue_stack, duckVM_object_t *, ptrdiff1) = dl_null;
+			}
+		}
+		if (e) break;
+		break;
+
+	case duckLisp_instruction_setUpvalue32:
+		ptrdiff1 = *(ip++);
+		ptrdiff2 = *(ip++);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		parsedBytecode = dl_true;
+		/* Fall through */
+	case duckLisp_instruction_setUpvalue16:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff2 = *(ip++);
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			parsedBytecode = dl_true;
+		}
+		/* Fall through */
+	case duckLisp_instruction_setUpvalue8:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff2 = *(ip++);
+		}
+		{
+			// Need another stack with same depth as call stack to pull out upvalues.
+			// Like to live dangerously?
+			if (ptrdiff1 < 0) {
+				e = dl_error_invalidValue;
+				break;
+			}
+			e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff2);
+			if (e) break;
+			duckVM_object_t *upvalue = DL_ARRAY_GETTOPADDRESS(duckVM->upvalue_array_call_stack,
+			                                                  duckVM_upvalueArray_t).upvalues[ptrdiff1];
+			if (upvalue->value.upvalue.type == duckVM_upvalue_type_stack_index) {
+				e = dl_array_set(duckVM_upvalue_stack(duckVM, &upvalue->value.upvalue),
+				                 &object1,
+				                 upvalue->value.upvalue.value.stack_index);
+				if (e) break;
+			}
+			else if (upvalue->value.upvalue.type == duckVM_upvalue_type_heap_object) {
+				*upvalue->value.upvalue.value.heap_object = object1;
+			}
+			else {
+				while (upvalue->value.upvalue.type == duckVM_upvalue_type_heap_upvalue) {
+					upvalue = upvalue->value.upvalue.value.heap_upvalue;
+				}
+				if (upvalue->value.upvalue.type == duckVM_upvalue_type_stack_index) {
+					e = dl_array_set(duckVM_upvalue_stack(duckVM, &upvalue->value.upvalue),
+					                 &object1,
+					                 upvalue->value.upvalue.value.stack_index);
+					if (e) break;
+				}
+				else {
+					*upvalue->value.upvalue.value.heap_object = object1;
+				}
+			}
+		}
+		break;
+
+	case duckLisp_instruction_setGlobal32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff2 = *(ip++);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		parsedBytecode = dl_true;
+		/* Fall through */
+	case duckLisp_instruction_setGlobal16:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			ptrdiff2 = *(ip++);
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			parsedBytecode = dl_true;
+		}
+		/* Fall through */
+	case duckLisp_instruction_setGlobal8:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff2 = *(ip++);
+		}
+		e = duckVM_gclist_pushObject(duckVM,
+		                             &objectPtr1,
+		                             DL_ARRAY_GETADDRESS(duckVM->stack,
+		                                                 duckVM_object_t,
+		                                                 duckVM->stack.elements_length - ptrdiff1));
+		if (e) break;
+		e = duckVM_global_set(duckVM, objectPtr1, ptrdiff2);
+		if (e) break;
+		break;
+
+	case duckLisp_instruction_funcall32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through */
+	case duckLisp_instruction_funcall16:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through */
+	case duckLisp_instruction_funcall8:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		uint8 = *(ip++);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		while (object1.type == duckVM_object_type_composite) {
+			object1 = *object1.value.composite->value.internalComposite.function;
+		}
+		/* Most calls are to a closure that takes exactly the arguments it was given. Those don't need anything from
+		   `duckVM_instruction_prepareForFuncall`. */
+		if ((object1.type != duckVM_object_type_closure)
+		    || object1.value.closure.variadic
+		    || (object1.value.closure.arity != uint8)) {
+			e = duckVM_instruction_prepareForFuncall(duckVM, &object1, uint8);
+			if (e) break;
+		}
+		if (object1.type == duckVM_object_type_function) {
+			e = duckVM_callCallback(duckVM, object1.value.function.callback, uint8, bytecode->value.bytecode.verified);
+			break;
+		}
+		else if (object1.type != duckVM_object_type_closure) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->funcall: Object is not a callback or closure."));
+			if (!e) e = eError;
+			break;
+		}
+		/* Call. */
+		e = call_stack_push(duckVM, ip, bytecode, &object1.value.closure.upvalue_array->value.upvalue_array);
+		if (e) break;
+		bytecode = object1.value.closure.bytecode;
+		ip = &bytecode->value.bytecode.bytecode[object1.value.closure.name];
+		if (duckVM->jit != dl_null) {
+			/**/ duckVM_jit_enter(duckVM, bytecode, &ip, &budget);
+		}
+		break;
+
+	case duckLisp_instruction_apply32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through */
+	case duckLisp_instruction_apply16:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through */
+	case duckLisp_instruction_apply8:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		uint8 = *(ip++);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		while (object1.type == duckVM_object_type_composite) {
+			object1 = *object1.value.composite->value.internalComposite.function;
+		}
+		if (object1.type != duckVM_object_type_closure) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->apply: Applied object is not a closure."));
+			if (eError) e = eError;
+			break;
+		}
+		duckVM_object_t rest;
+		e = stack_pop(duckVM, &rest);
+		if (e) break;
+		if (rest.type != duckVM_object_type_list) {
+			e = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->apply: Last argument is not a list."));
+			e = dl_error_invalidValue;
+			break;
+		}
+		while ((uint8 < object1.value.closure.arity) && (rest.value.list != dl_null)) {
+			if (rest.value.list->type != duckVM_object_type_cons) {
+				e = dl_error_invalidValue;
+				eError = duckVM_error_pushRuntime(duckVM,
+				                                  DL_STR("duckVM_execute->apply: Object pointed to by list root is not a list."));
+				if (eError) e = eError;
+				break;
+			}
+			/* (push (car rest) stack) */
+			{
+				duckVM_object_t *car = rest.value.list->value.cons.car;
+				if ((car == dl_null) || (car->type == duckVM_object_type_cons)) {
+					duckVM_object_t list = duckVM_object_makeList(car);
+					e = stack_push(duckVM, &list);
+				}
+				else {
+					e = stack_push(duckVM, car);
+				}
+				if (e) break;
+			}
+			/* (setf rest (cdr rest)) */
+			rest.value.list = rest.value.list->value.cons.cdr;
+			uint8++;
+		}
+		if (e) break;
+		if (object1.value.closure.variadic) {
+			if (uint8 < object1.value.closure.arity) {
+				e = dl_error_invalidValue;
+				break;
+			}
+			/* Create list. */
+			/* The original version of this did something really dirty though it didn't look like it. It popped
+			   multiple objects off the stack, then allocated a bunch more on the heap. This is fine 99.999% of the
+			   time, but since the stack is the root the garbage collector uses to trace memory, it was possible to
+			   trigger collection of the object (and possibly all its children) during one of those allocations.
+			   Moral of the story: Never perform an allocation if you have an allocated object disconnected from the
+			   stack. */
+			/* First push the new object on the stack to register it with the collector. */
+			object2.value.list = rest.value.list;
+			object2.type = duckVM_object_type_list;
+			e = stack_push(duckVM, &object2);
+			if (e) break;
+			object3.value.list = dl_null;
+			object3.type = duckVM_object_type_list;
+			e = stack_push(duckVM, &object3);
+			if (e) break;
+			dl_size_t args_length = (uint8 - object1.value.closure.arity);
+			duckVM_object_t *lastConsPtr = rest.value.list;
+			DL_DOTIMES(k, args_length) {
+				duckVM_object_t cons;
+				duckVM_object_t *consPtr = dl_null;
+				duckVM_object_t object;
+				duckVM_object_t *objectPtr = dl_null;
+				/* Reverse order, because lisp lists are backwards. */
+				object = DL_ARRAY_GETADDRESS(duckVM->stack,
+				                             duckVM_object_t,
+				                             duckVM->stack.elements_length - 3 - k);
+				e = duckVM_gclist_pushObject(duckVM, &objectPtr, object);
+				if (e) break;
+				cons.type = duckVM_object_type_cons;
+				cons.value.cons.car = objectPtr;
+				cons.value.cons.cdr = lastConsPtr;
+				/* Make visible to collector before allocating another. */
+				DL_ARRAY_GETADDRESS(duckVM->stack,
+				                    duckVM_object_t,
+				                    duckVM->stack.elements_length - 1).value.list = objectPtr;
+				e = duckVM_gclist_pushObject(duckVM, &consPtr, cons);
+				if (e) break;
+				/* Make visible to collector before allocating another. The object just created is linked in the
+				   cons. */
+				DL_ARRAY_GETADDRESS(duckVM->stack,
+				                    duckVM_object_t,
+				                    duckVM->stack.elements_length - 2).value.list = consPtr;
+				lastConsPtr = consPtr;
+			}
+			if (e) break;
+			/* Pop the temporary object. */
+			e = stack_pop(duckVM, dl_null);
+			if (e) break;
+			/* Copy the list to the proper position. */
+			object2.value.list = lastConsPtr;
+			DL_ARRAY_GETADDRESS(duckVM->stack,
+			                    duckVM_object_t,
+			                    (duckVM->stack.elements_length - 1 - args_length)) = object2;
+			/* Pop all objects other than the list. */
+			e = stack_pop_multiple(duckVM, args_length);
+			if (e) break;
+		}
+		else {
+			if (object1.value.closure.arity != uint8) {
+				e = dl_error_invalidValue;
+				break;
+			}
+		}
+		/* Call. */
+		e = call_stack_push(duckVM, ip, bytecode, &object1.value.closure.upvalue_array->value.upvalue_array);
+		if (e) break;
+		bytecode = object1.value.closure.bytecode;
+		ip = &bytecode->value.bytecode.bytecode[object1.value.closure.name];
+		break;
+
+		/* I probably don't need an `if` if I research the standard a bit. */
+	case duckLisp_instruction_call32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through */
+	case duckLisp_instruction_call16:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through */
+	case duckLisp_instruction_call8:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff2 = *(ip++);
+		call_stack_push(duckVM, ip, bytecode, dl_null);
+		if (e) break;
+		if (opcode == duckLisp_instruction_call32) {
+			if (ptrdiff1 & 0x80000000ULL) {
+				ip -= ((~ptrdiff1 + 1) & 0xFFFFFFFFULL);
+			}
+			else {
+				ip += ptrdiff1;
+			}
+		}
+		else if (opcode == duckLisp_instruction_call16) {
+			if (ptrdiff1 & 0x8000ULL) {
+				ip -= ((~ptrdiff1 + 1) & 0xFFFFULL);
+			}
+			else {
+				ip += ptrdiff1;
+			}
+		}
+		else {
+			if (ptrdiff1 & 0x80ULL) {
+				ip -= ((~ptrdiff1 + 1) & 0xFFULL);
+			}
+			else {
+				ip += ptrdiff1;
+			}
+		}
+		--ip;
+		break;
+
+	case duckLisp_instruction_ccall32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through */
+	case duckLisp_instruction_ccall16:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through */
+	case duckLisp_instruction_ccall8:
+		// I should probably delete this and have `funcall` handle callbacks.
+		{
+			duckVM_object_t *global;
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			uint8 = *(ip++);
+			e = duckVM_global_get(duckVM, &global, ptrdiff1);
+			if (e) {
+				eError = duckVM_error_pushRuntime(duckVM,
+				                                  DL_STR("duckVM_execute->c-call: Could not find global callback."));
 				if (!e) e = eError;
+				break;
+			}
+			if (global->type != duckVM_object_type_function) {
+				e = dl_error_invalidValue;
+				eError = duckVM_error_pushRuntime(duckVM,
+				                                  DL_STR("duckVM_execute->c-call: Global is not a callback."));
+				if (eError) e = eError;
+				break;
+			}
+			e = duckVM_callCallback(duckVM, global->value.function.callback, uint8, bytecode->value.bytecode.verified);
+			if (e) break;
+		}
+		break;
+
+		// I probably don't need an `if` if I research the standard a bit.
+	case duckLisp_instruction_jump32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		if (ptrdiff1 & 0x80000000ULL) {
+			ip -= ((~ptrdiff1 + 1) & 0xFFFFFFFFULL);
+			if (duckVM->jit != dl_null) {
+				/**/ duckVM_jit_enter(duckVM, bytecode, &ip, &budget);
+			}
+		}
+		else {
+			ip += ptrdiff1;
+		}
+		break;
+	case duckLisp_instruction_jump16:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		if (ptrdiff1 & 0x8000ULL) {
+			ip -= ((~ptrdiff1 + 1) & 0xFFFFULL);
+			if (duckVM->jit != dl_null) {
+				/**/ duckVM_jit_enter(duckVM, bytecode, &ip, &budget);
+			}
+		}
+		else {
+			ip += ptrdiff1;
+		}
+		break;
+	case duckLisp_instruction_jump8:
+		ptrdiff1 = *(ip++);
+		if (ptrdiff1 & 0x80ULL) {
+			ip -= ((~ptrdiff1 + 1) & 0xFFULL);
+			if (duckVM->jit != dl_null) {
+				/**/ duckVM_jit_enter(duckVM, bytecode, &ip, &budget);
+			}
+		}
+		else {
+			ip += ptrdiff1;
+		}
+		break;
+
+		// I probably don't need an `if` if I research the standard a bit.
+	case duckLisp_instruction_brnz32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		parsedBytecode = dl_true;
+		/* Fall through */
+	case duckLisp_instruction_brnz16:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			parsedBytecode = dl_true;
+		}
+		/* Fall through */
+	case duckLisp_instruction_brnz8:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+		}
+		e = stack_getOperand(duckVM, bytecode, &object1, 1);
+		if (e) break;
+		ptrdiff2 = *(ip++);
+		e = stack_pop_multiple(duckVM, ptrdiff2);
+		if (e) break;
+		{
+			dl_bool_t truthy = duckVM_object_isTruthy(&object1);
+			if (truthy) {
+				if ((opcode == duckLisp_instruction_brnz8) && (ptrdiff1 & 0x80ULL)) {
+					ip -= ((~ptrdiff1 + 1) & 0xFFULL);
+					bool1 = dl_true;
+				}
+				else if ((opcode == duckLisp_instruction_brnz16) && (ptrdiff1 & 0x8000ULL)) {
+					ip -= ((~ptrdiff1 + 1) & 0xFFFFULL);
+					bool1 = dl_true;
+				}
+				else if ((opcode == duckLisp_instruction_brnz32) && (ptrdiff1 & 0x80000000ULL)) {
+					ip -= ((~ptrdiff1 + 1) & 0xFFFFFFFFULL);
+					bool1 = dl_true;
+				}
+				else {
+					ip += ptrdiff1;
+				}
+				--ip; /* This accounts for the pop argument. */
+				/* `bool1` is set if this jumped back to the start of a loop. */
+				if (bool1 && (duckVM->jit != dl_null)) {
+					/**/ duckVM_jit_enter(duckVM, bytecode, &ip, &budget);
+				}
+			}
+		}
+		break;
+
+		// I probably don't need an `if` if I research the standard a bit.
+	case duckLisp_instruction_pop32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		// Fall through
+	case duckLisp_instruction_pop16:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		// Fall through
+	case duckLisp_instruction_pop8:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		e = stack_pop_multiple(duckVM, ptrdiff1);
+		break;
+
+		// I probably don't need an `if` if I research the standard a bit.
+	case duckLisp_instruction_move32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff2 = *(ip++);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		parsedBytecode = dl_true;
+		// Fall through
+	case duckLisp_instruction_move16:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			ptrdiff2 = *(ip++);
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			parsedBytecode = dl_true;
+		}
+		// Fall through
+	case duckLisp_instruction_move8:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff2 = *(ip++);
+		}
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		object2 = object1;
+		e = stack_setOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		break;
+
+		// I probably don't need an `if` if I research the standard a bit.
+	case duckLisp_instruction_not32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through */
+	case duckLisp_instruction_not16:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through */
+	case duckLisp_instruction_not8:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		switch (object1.type) {
+		case duckVM_object_type_vector:
+			object1.type = duckVM_object_type_bool;
+			object1.value.boolean = object1.value.vector.internal_vector == dl_null;
+			break;
+		case duckVM_object_type_list:
+			object1.type = duckVM_object_type_bool;
+			object1.value.boolean = object1.value.list == dl_null;
+			break;
+		case duckVM_object_type_integer:
+			object1.value.integer = !object1.value.integer;
+			break;
+		case duckVM_object_type_float:
+			object1.value.floatingPoint = !object1.value.floatingPoint;
+			break;
+		case duckVM_object_type_bool:
+			object1.value.boolean = !object1.value.boolean;
+			break;
+		default:
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->not: Object is not a boolean, integer, float, list, or vector."));
+			if (!e) e = eError;
+			goto cleanup;
+		}
+		e = stack_push(duckVM, &object1);
+		break;
+
+		// I probably don't need an `if` if I research the standard a bit.
+	case duckLisp_instruction_mul32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff2 = *(ip++);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		switch (object1.type) {
+		case duckVM_object_type_float:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.floatingPoint *= object2.value.floatingPoint;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.floatingPoint *= object2.value.integer;
+				object1.type = duckVM_object_type_float;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.floatingPoint *= object2.value.boolean;
+				object1.type = duckVM_object_type_float;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		case duckVM_object_type_integer:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.floatingPoint = object1.value.integer * object2.value.floatingPoint;
+				object1.type = duckVM_object_type_float;
+				break;
+			case duckVM_object_type_integer:
+				/* Type already set. */
+				object1.value.integer *= object2.value.integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.integer *= object2.value.boolean;
+				object1.type = duckVM_object_type_integer;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		case duckVM_object_type_bool:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.floatingPoint = object1.value.boolean * object2.value.floatingPoint;
+				object1.type = duckVM_object_type_float;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.integer = object1.value.boolean * object2.value.integer;
+				object1.type = duckVM_object_type_integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.boolean *= object2.value.boolean;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		default:
+			e = dl_error_invalidValue;
+			goto cleanup;
+		}
+		e = stack_push(duckVM, &object1);
+		if (e) break;
+		break;
+	case duckLisp_instruction_mul16:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff2 = *(ip++);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		switch (object1.type) {
+		case duckVM_object_type_float:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.floatingPoint *= object2.value.floatingPoint;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.floatingPoint *= object2.value.integer;
+				object1.type = duckVM_object_type_float;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.floatingPoint *= object2.value.boolean;
+				object1.type = duckVM_object_type_float;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		case duckVM_object_type_integer:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.floatingPoint = object1.value.integer * object2.value.floatingPoint;
+				object1.type = duckVM_object_type_float;
+				break;
+			case duckVM_object_type_integer:
+				/* Type already set. */
+				object1.value.integer *= object2.value.integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.integer *= object2.value.boolean;
+				object1.type = duckVM_object_type_integer;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		case duckVM_object_type_bool:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.floatingPoint = object1.value.boolean * object2.value.floatingPoint;
+				object1.type = duckVM_object_type_float;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.integer = object1.value.boolean * object2.value.integer;
+				object1.type = duckVM_object_type_integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.boolean *= object2.value.boolean;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		default:
+			e = dl_error_invalidValue;
+			goto cleanup;
+		}
+		e = stack_push(duckVM, &object1);
+		break;
+	case duckLisp_instruction_mul8:
+		ptrdiff1 = *(ip++);
+		ptrdiff2 = *(ip++);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+#ifndef NO_QUICKENING
+		duckVM_quickenArithmetic(bytecode,
+		                         opcodePtr,
+		                         &object1,
+		                         &object2,
+		                         duckLisp_instruction_mulInteger8,
+		                         duckLisp_instruction_mulFloat8);
+#endif /* NO_QUICKENING */
+		switch (object1.type) {
+		case duckVM_object_type_float:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.floatingPoint *= object2.value.floatingPoint;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.floatingPoint *= object2.value.integer;
+				object1.type = duckVM_object_type_float;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.floatingPoint *= object2.value.boolean;
+				object1.type = duckVM_object_type_float;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		case duckVM_object_type_integer:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.floatingPoint = object1.value.integer * object2.value.floatingPoint;
+				object1.type = duckVM_object_type_float;
+				break;
+			case duckVM_object_type_integer:
+				/* Type already set. */
+				object1.value.integer *= object2.value.integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.integer *= object2.value.boolean;
+				object1.type = duckVM_object_type_integer;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		case duckVM_object_type_bool:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.floatingPoint = object1.value.boolean * object2.value.floatingPoint;
+				object1.type = duckVM_object_type_float;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.integer = object1.value.boolean * object2.value.integer;
+				object1.type = duckVM_object_type_integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.boolean *= object2.value.boolean;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		default:
+			e = dl_error_invalidValue;
+			goto cleanup;
+		}
+		e = stack_push(duckVM, &object1);
+		break;
+
+		// I probably don't need an `if` if I research the standard a bit.
+	case duckLisp_instruction_div32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff2 = *(ip++);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		switch (object1.type) {
+		case duckVM_object_type_float:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.floatingPoint /= object2.value.floatingPoint;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.floatingPoint /= object2.value.integer;
+				object1.type = duckVM_object_type_float;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.floatingPoint /= object2.value.boolean;
+				object1.type = duckVM_object_type_float;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		case duckVM_object_type_integer:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.floatingPoint = object1.value.integer / object2.value.floatingPoint;
+				object1.type = duckVM_object_type_float;
+				break;
+			case duckVM_object_type_integer:
+				/* Type already set. */
+				object1.value.integer /= object2.value.integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.integer /= object2.value.boolean;
+				object1.type = duckVM_object_type_integer;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		case duckVM_object_type_bool:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.floatingPoint = object1.value.boolean / object2.value.floatingPoint;
+				object1.type = duckVM_object_type_float;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.integer = object1.value.boolean / object2.value.integer;
+				object1.type = duckVM_object_type_integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.boolean /= object2.value.boolean;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		default:
+			e = dl_error_invalidValue;
+			goto cleanup;
+		}
+		e = stack_push(duckVM, &object1);
+		if (e) break;
+		break;
+	case duckLisp_instruction_div16:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff2 = *(ip++);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		switch (object1.type) {
+		case duckVM_object_type_float:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.floatingPoint /= object2.value.floatingPoint;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.floatingPoint /= object2.value.integer;
+				object1.type = duckVM_object_type_float;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.floatingPoint /= object2.value.boolean;
+				object1.type = duckVM_object_type_float;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		case duckVM_object_type_integer:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.floatingPoint = object1.value.integer / object2.value.floatingPoint;
+				object1.type = duckVM_object_type_float;
+				break;
+			case duckVM_object_type_integer:
+				/* Type already set. */
+				object1.value.integer /= object2.value.integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.integer /= object2.value.boolean;
+				object1.type = duckVM_object_type_integer;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		case duckVM_object_type_bool:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.floatingPoint = object1.value.boolean / object2.value.floatingPoint;
+				object1.type = duckVM_object_type_float;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.integer = object1.value.boolean / object2.value.integer;
+				object1.type = duckVM_object_type_integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.boolean /= object2.value.boolean;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		default:
+			e = dl_error_invalidValue;
+			goto cleanup;
+		}
+		e = stack_push(duckVM, &object1);
+		break;
+	case duckLisp_instruction_div8:
+		ptrdiff1 = *(ip++);
+		ptrdiff2 = *(ip++);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+#ifndef NO_QUICKENING
+		duckVM_quickenArithmetic(bytecode,
+		                         opcodePtr,
+		                         &object1,
+		                         &object2,
+		                         duckLisp_instruction_divInteger8,
+		                         duckLisp_instruction_divFloat8);
+#endif /* NO_QUICKENING */
+		switch (object1.type) {
+		case duckVM_object_type_float:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.floatingPoint /= object2.value.floatingPoint;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.floatingPoint /= object2.value.integer;
+				object1.type = duckVM_object_type_float;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.floatingPoint /= object2.value.boolean;
+				object1.type = duckVM_object_type_float;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		case duckVM_object_type_integer:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.floatingPoint = object1.value.integer / object2.value.floatingPoint;
+				object1.type = duckVM_object_type_float;
+				break;
+			case duckVM_object_type_integer:
+				/* Type already set. */
+				object1.value.integer /= object2.value.integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.integer /= object2.value.boolean;
+				object1.type = duckVM_object_type_integer;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		case duckVM_object_type_bool:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.floatingPoint = object1.value.boolean / object2.value.floatingPoint;
+				object1.type = duckVM_object_type_float;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.integer = object1.value.boolean / object2.value.integer;
+				object1.type = duckVM_object_type_integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.boolean /= object2.value.boolean;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		default:
+			e = dl_error_invalidValue;
+			goto cleanup;
+		}
+		e = stack_push(duckVM, &object1);
+		break;
+
+	case duckLisp_instruction_add32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff2 = *(ip++);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		parsedBytecode = dl_true;
+		/* Fall through */
+	case duckLisp_instruction_add16:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			ptrdiff2 = *(ip++);
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			parsedBytecode = dl_true;
+		}
+		/* Fall through */
+	case duckLisp_instruction_add8:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff2 = *(ip++);
+		}
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+#ifndef NO_QUICKENING
+		if (opcode == duckLisp_instruction_add8) {
+			duckVM_quickenArithmetic(bytecode,
+			                         opcodePtr,
+			                         &object1,
+			                         &object2,
+			                         duckLisp_instruction_addInteger8,
+			                         duckLisp_instruction_addFloat8);
+		}
+#endif /* NO_QUICKENING */
+		switch (object1.type) {
+		case duckVM_object_type_float:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.floatingPoint += object2.value.floatingPoint;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.floatingPoint += object2.value.integer;
+				object1.type = duckVM_object_type_float;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.floatingPoint += object2.value.boolean;
+				object1.type = duckVM_object_type_float;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				eError = duckVM_error_pushRuntime(duckVM,
+				                                  DL_STR("duckVM_execute->add: Invalid type combination."));
+				if (eError) e = eError;
+				break;
+			}
+			break;
+		case duckVM_object_type_integer:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.floatingPoint = object1.value.integer + object2.value.floatingPoint;
+				object1.type = duckVM_object_type_float;
+				break;
+			case duckVM_object_type_integer:
+				/* Type already set. */
+				object1.value.integer += object2.value.integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.integer += object2.value.boolean;
+				object1.type = duckVM_object_type_integer;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				eError = duckVM_error_pushRuntime(duckVM,
+				                                  DL_STR("duckVM_execute->add: Invalid type combination."));
+				if (eError) e = eError;
+				break;
+			}
+			break;
+		case duckVM_object_type_bool:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.floatingPoint = object1.value.boolean + object2.value.floatingPoint;
+				object1.type = duckVM_object_type_float;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.integer = object1.value.boolean + object2.value.integer;
+				object1.type = duckVM_object_type_integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.boolean += object2.value.boolean;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				eError = duckVM_error_pushRuntime(duckVM,
+				                                  DL_STR("duckVM_execute->add: Invalid type combination."));
+				if (eError) e = eError;
+				break;
+			}
+			break;
+		default:
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->add: Invalid type combination."));
+			if (eError) e = eError;
+			break;
+		}
+		if (e) break;
+		e = stack_push(duckVM, &object1);
+		break;
+
+		// I probably don't need an `if` if I research the standard a bit.
+	case duckLisp_instruction_sub32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff2 = *(ip++);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		switch (object1.type) {
+		case duckVM_object_type_float:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.floatingPoint -= object2.value.floatingPoint;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.floatingPoint -= object2.value.integer;
+				object1.type = duckVM_object_type_float;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.floatingPoint -= object2.value.boolean;
+				object1.type = duckVM_object_type_float;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		case duckVM_object_type_integer:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.floatingPoint = object1.value.integer - object2.value.floatingPoint;
+				object1.type = duckVM_object_type_float;
+				break;
+			case duckVM_object_type_integer:
+				/* Type already set. */
+				object1.value.integer -= object2.value.integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.integer -= object2.value.boolean;
+				object1.type = duckVM_object_type_integer;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		case duckVM_object_type_bool:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.floatingPoint = object1.value.boolean - object2.value.floatingPoint;
+				object1.type = duckVM_object_type_float;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.integer = object1.value.boolean - object2.value.integer;
+				object1.type = duckVM_object_type_integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.boolean -= object2.value.boolean;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		default:
+			e = dl_error_invalidValue;
+			goto cleanup;
+		}
+		e = stack_push(duckVM, &object1);
+		if (e) break;
+		break;
+	case duckLisp_instruction_sub16:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff2 = *(ip++);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		switch (object1.type) {
+		case duckVM_object_type_float:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.floatingPoint -= object2.value.floatingPoint;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.floatingPoint -= object2.value.integer;
+				object1.type = duckVM_object_type_float;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.floatingPoint -= object2.value.boolean;
+				object1.type = duckVM_object_type_float;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		case duckVM_object_type_integer:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.floatingPoint = object1.value.integer - object2.value.floatingPoint;
+				object1.type = duckVM_object_type_float;
+				break;
+			case duckVM_object_type_integer:
+				/* Type already set. */
+				object1.value.integer -= object2.value.integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.integer -= object2.value.boolean;
+				object1.type = duckVM_object_type_integer;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		case duckVM_object_type_bool:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.floatingPoint = object1.value.boolean - object2.value.floatingPoint;
+				object1.type = duckVM_object_type_float;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.integer = object1.value.boolean - object2.value.integer;
+				object1.type = duckVM_object_type_integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.boolean -= object2.value.boolean;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		default:
+			e = dl_error_invalidValue;
+			goto cleanup;
+		}
+		e = stack_push(duckVM, &object1);
+		break;
+	case duckLisp_instruction_sub8:
+		ptrdiff1 = *(ip++);
+		ptrdiff2 = *(ip++);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+#ifndef NO_QUICKENING
+		duckVM_quickenArithmetic(bytecode,
+		                         opcodePtr,
+		                         &object1,
+		                         &object2,
+		                         duckLisp_instruction_subInteger8,
+		                         duckLisp_instruction_subFloat8);
+#endif /* NO_QUICKENING */
+		switch (object1.type) {
+		case duckVM_object_type_float:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.floatingPoint -= object2.value.floatingPoint;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.floatingPoint -= object2.value.integer;
+				object1.type = duckVM_object_type_float;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.floatingPoint -= object2.value.boolean;
+				object1.type = duckVM_object_type_float;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		case duckVM_object_type_integer:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.floatingPoint = object1.value.integer - object2.value.floatingPoint;
+				object1.type = duckVM_object_type_float;
+				break;
+			case duckVM_object_type_integer:
+				/* Type already set. */
+				object1.value.integer -= object2.value.integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.integer -= object2.value.boolean;
+				object1.type = duckVM_object_type_integer;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		case duckVM_object_type_bool:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.floatingPoint = object1.value.boolean - object2.value.floatingPoint;
+				object1.type = duckVM_object_type_float;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.integer = object1.value.boolean - object2.value.integer;
+				object1.type = duckVM_object_type_integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.boolean -= object2.value.boolean;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		default:
+			e = dl_error_invalidValue;
+			goto cleanup;
+		}
+		e = stack_push(duckVM, &object1);
+		break;
+
+		// I probably don't need an `if` if I research the standard a bit.
+	case duckLisp_instruction_greater32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff2 = *(ip++);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		switch (object1.type) {
+		case duckVM_object_type_float:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.boolean = object1.value.floatingPoint > object2.value.floatingPoint;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.boolean = object1.value.floatingPoint > object2.value.integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.boolean = object1.value.floatingPoint > object2.value.boolean;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		case duckVM_object_type_integer:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.boolean = object1.value.integer > object2.value.floatingPoint;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.boolean = object1.value.integer > object2.value.integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.boolean = object1.value.integer > object2.value.boolean;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		case duckVM_object_type_bool:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.boolean = object1.value.boolean > object2.value.floatingPoint;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.boolean = object1.value.boolean > object2.value.integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.boolean = object1.value.boolean > object2.value.boolean;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		default:
+			e = dl_error_invalidValue;
+			goto cleanup;
+		}
+		object1.type = duckVM_object_type_bool;
+		e = stack_push(duckVM, &object1);
+		if (e) break;
+		break;
+	case duckLisp_instruction_greater16:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff2 = *(ip++);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		switch (object1.type) {
+		case duckVM_object_type_float:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.boolean = object1.value.floatingPoint > object2.value.floatingPoint;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.boolean = object1.value.floatingPoint > object2.value.integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.boolean = object1.value.floatingPoint > object2.value.boolean;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		case duckVM_object_type_integer:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.boolean = object1.value.integer > object2.value.floatingPoint;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.boolean = object1.value.integer > object2.value.integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.boolean = object1.value.integer > object2.value.boolean;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		case duckVM_object_type_bool:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.boolean = object1.value.boolean > object2.value.floatingPoint;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.boolean = object1.value.boolean > object2.value.integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.boolean = object1.value.boolean > object2.value.boolean;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		default:
+			e = dl_error_invalidValue;
+			goto cleanup;
+		}
+		object1.type = duckVM_object_type_bool;
+		e = stack_push(duckVM, &object1);
+		break;
+	case duckLisp_instruction_greater8:
+		ptrdiff1 = *(ip++);
+		ptrdiff2 = *(ip++);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+#ifndef NO_QUICKENING
+		duckVM_quickenArithmetic(bytecode,
+		                         opcodePtr,
+		                         &object1,
+		                         &object2,
+		                         duckLisp_instruction_greaterInteger8,
+		                         duckLisp_instruction_greaterFloat8);
+#endif /* NO_QUICKENING */
+		switch (object1.type) {
+		case duckVM_object_type_float:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.boolean = object1.value.floatingPoint > object2.value.floatingPoint;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.boolean = object1.value.floatingPoint > object2.value.integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.boolean = object1.value.floatingPoint > object2.value.boolean;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		case duckVM_object_type_integer:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.boolean = object1.value.integer > object2.value.floatingPoint;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.boolean = object1.value.integer > object2.value.integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.boolean = object1.value.integer > object2.value.boolean;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		case duckVM_object_type_bool:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.boolean = object1.value.boolean > object2.value.floatingPoint;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.boolean = object1.value.boolean > object2.value.integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.boolean = object1.value.boolean > object2.value.boolean;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		default:
+			e = dl_error_invalidValue;
+			goto cleanup;
+		}
+		object1.type = duckVM_object_type_bool;
+		e = stack_push(duckVM, &object1);
+		break;
+
+		// I probably don't need an `if` if I research the standard a bit.
+	case duckLisp_instruction_equal32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff2 = *(ip++);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		parsedBytecode = dl_true;
+		// Fall through
+	case duckLisp_instruction_equal16:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			ptrdiff2 = *(ip++);
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		}
+		// Fall through
+	case duckLisp_instruction_equal8:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff2 = *(ip++);
+		}
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+#ifndef NO_QUICKENING
+		if (opcode == duckLisp_instruction_equal8) {
+			duckVM_quickenArithmetic(bytecode,
+			                         opcodePtr,
+			                         &object1,
+			                         &object2,
+			                         duckLisp_instruction_equalInteger8,
+			                         duckLisp_instruction_equalFloat8);
+		}
+#endif /* NO_QUICKENING */
+		e = duckVM_object_equal(&object1, &object2, &object1.value.boolean);
+		if (e) goto cleanup;
+		object1.type = duckVM_object_type_bool;
+		e = stack_push(duckVM, &object1);
+		break;
+
+		// I probably don't need an `if` if I research the standard a bit.
+	case duckLisp_instruction_less32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff2 = *(ip++);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		switch (object1.type) {
+		case duckVM_object_type_float:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.boolean = object1.value.floatingPoint < object2.value.floatingPoint;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.boolean = object1.value.floatingPoint < object2.value.integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.boolean = object1.value.floatingPoint < object2.value.boolean;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		case duckVM_object_type_integer:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.boolean = object1.value.integer < object2.value.floatingPoint;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.boolean = object1.value.integer < object2.value.integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.boolean = object1.value.integer < object2.value.boolean;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		case duckVM_object_type_bool:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.boolean = object1.value.boolean < object2.value.floatingPoint;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.boolean = object1.value.boolean < object2.value.integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.boolean = object1.value.boolean < object2.value.boolean;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		default:
+			e = dl_error_invalidValue;
+			goto cleanup;
+		}
+		object1.type = duckVM_object_type_bool;
+		e = stack_push(duckVM, &object1);
+		if (e) break;
+		break;
+	case duckLisp_instruction_less16:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff2 = *(ip++);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		switch (object1.type) {
+		case duckVM_object_type_float:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.boolean = object1.value.floatingPoint < object2.value.floatingPoint;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.boolean = object1.value.floatingPoint < object2.value.integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.boolean = object1.value.floatingPoint < object2.value.boolean;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		case duckVM_object_type_integer:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.boolean = object1.value.integer < object2.value.floatingPoint;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.boolean = object1.value.integer < object2.value.integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.boolean = object1.value.integer < object2.value.boolean;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
 			}
-			e = stack_push(duckVM, &object1);
-			if (e) {
-				eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->push-string: stack_push failed."));
-				if (!e) e = eError;
+			break;
+		case duckVM_object_type_bool:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.boolean = object1.value.boolean < object2.value.floatingPoint;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.boolean = object1.value.boolean < object2.value.integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.boolean = object1.value.boolean < object2.value.boolean;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		default:
+			e = dl_error_invalidValue;
+			goto cleanup;
+		}
+		object1.type = duckVM_object_type_bool;
+		e = stack_push(duckVM, &object1);
+		break;
+	case duckLisp_instruction_less8:
+		ptrdiff1 = *(ip++);
+		ptrdiff2 = *(ip++);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+#ifndef NO_QUICKENING
+		duckVM_quickenArithmetic(bytecode,
+		                         opcodePtr,
+		                         &object1,
+		                         &object2,
+		                         duckLisp_instruction_lessInteger8,
+		                         duckLisp_instruction_lessFloat8);
+#endif /* NO_QUICKENING */
+		switch (object1.type) {
+		case duckVM_object_type_float:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.boolean = object1.value.floatingPoint < object2.value.floatingPoint;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.boolean = object1.value.floatingPoint < object2.value.integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.boolean = object1.value.floatingPoint < object2.value.boolean;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		case duckVM_object_type_integer:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.boolean = object1.value.integer < object2.value.floatingPoint;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.boolean = object1.value.integer < object2.value.integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.boolean = object1.value.integer < object2.value.boolean;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			break;
+		case duckVM_object_type_bool:
+			switch (object2.type) {
+			case duckVM_object_type_float:
+				object1.value.boolean = object1.value.boolean < object2.value.floatingPoint;
+				break;
+			case duckVM_object_type_integer:
+				object1.value.boolean = object1.value.boolean < object2.value.integer;
+				break;
+			case duckVM_object_type_bool:
+				object1.value.boolean = object1.value.boolean < object2.value.boolean;
+				break;
+			default:
+				e = dl_error_invalidValue;
+				goto cleanup;
 			}
+			break;
+		default:
+			e = dl_error_invalidValue;
+			goto cleanup;
+		}
+		object1.type = duckVM_object_type_bool;
+		e = stack_push(duckVM, &object1);
+		break;
+
+		/* Type-specialized arithmetic. These are emitted by the compiler when it can prove the operand types, and are
+		   also patched in by the VM when a generic instruction sees numeric operands of a single type. The types are
+		   still checked. On a mismatch the instruction is rewritten and re-dispatched as its generic form, and the site
+		   is never specialized again. */
+	case duckLisp_instruction_mulInteger8:
+		ptrdiff1 = *(ip++);
+		ptrdiff2 = *(ip++);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		if ((object1.type != duckVM_object_type_integer) || (object2.type != duckVM_object_type_integer)) {
+			ip -= 2;
+			opcode = duckLisp_instruction_mul8;
+#ifndef NO_QUICKENING
+			duckVM_unquicken(duckVM, bytecode, opcodePtr, opcode);
+#endif /* NO_QUICKENING */
+			goto dispatch;
+		}
+		object1.value.integer *= object2.value.integer;
+		e = stack_push(duckVM, &object1);
+		break;
+
+	case duckLisp_instruction_mulFloat8:
+		ptrdiff1 = *(ip++);
+		ptrdiff2 = *(ip++);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		if ((object1.type != duckVM_object_type_float) || (object2.type != duckVM_object_type_float)) {
+			ip -= 2;
+			opcode = duckLisp_instruction_mul8;
+#ifndef NO_QUICKENING
+			duckVM_unquicken(duckVM, bytecode, opcodePtr, opcode);
+#endif /* NO_QUICKENING */
+			goto dispatch;
+		}
+		object1.value.floatingPoint *= object2.value.floatingPoint;
+		e = stack_push(duckVM, &object1);
+		break;
+
+	case duckLisp_instruction_divInteger8:
+		ptrdiff1 = *(ip++);
+		ptrdiff2 = *(ip++);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		if ((object1.type != duckVM_object_type_integer) || (object2.type != duckVM_object_type_integer)) {
+			ip -= 2;
+			opcode = duckLisp_instruction_div8;
+#ifndef NO_QUICKENING
+			duckVM_unquicken(duckVM, bytecode, opcodePtr, opcode);
+#endif /* NO_QUICKENING */
+			goto dispatch;
+		}
+		object1.value.integer /= object2.value.integer;
+		e = stack_push(duckVM, &object1);
+		break;
+
+	case duckLisp_instruction_divFloat8:
+		ptrdiff1 = *(ip++);
+		ptrdiff2 = *(ip++);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		if ((object1.type != duckVM_object_type_float) || (object2.type != duckVM_object_type_float)) {
+			ip -= 2;
+			opcode = duckLisp_instruction_div8;
+#ifndef NO_QUICKENING
+			duckVM_unquicken(duckVM, bytecode, opcodePtr, opcode);
+#endif /* NO_QUICKENING */
+			goto dispatch;
+		}
+		object1.value.floatingPoint /= object2.value.floatingPoint;
+		e = stack_push(duckVM, &object1);
+		break;
+
+	case duckLisp_instruction_addInteger8:
+		ptrdiff1 = *(ip++);
+		ptrdiff2 = *(ip++);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		if ((object1.type != duckVM_object_type_integer) || (object2.type != duckVM_object_type_integer)) {
+			ip -= 2;
+			opcode = duckLisp_instruction_add8;
+#ifndef NO_QUICKENING
+			duckVM_unquicken(duckVM, bytecode, opcodePtr, opcode);
+#endif /* NO_QUICKENING */
+			goto dispatch;
+		}
+		object1.value.integer += object2.value.integer;
+		e = stack_push(duckVM, &object1);
+		break;
+
+	case duckLisp_instruction_addFloat8:
+		ptrdiff1 = *(ip++);
+		ptrdiff2 = *(ip++);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		if ((object1.type != duckVM_object_type_float) || (object2.type != duckVM_object_type_float)) {
+			ip -= 2;
+			opcode = duckLisp_instruction_add8;
+#ifndef NO_QUICKENING
+			duckVM_unquicken(duckVM, bytecode, opcodePtr, opcode);
+#endif /* NO_QUICKENING */
+			goto dispatch;
+		}
+		object1.value.floatingPoint += object2.value.floatingPoint;
+		e = stack_push(duckVM, &object1);
+		break;
+
+	case duckLisp_instruction_subInteger8:
+		ptrdiff1 = *(ip++);
+		ptrdiff2 = *(ip++);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		if ((object1.type != duckVM_object_type_integer) || (object2.type != duckVM_object_type_integer)) {
+			ip -= 2;
+			opcode = duckLisp_instruction_sub8;
+#ifndef NO_QUICKENING
+			duckVM_unquicken(duckVM, bytecode, opcodePtr, opcode);
+#endif /* NO_QUICKENING */
+			goto dispatch;
+		}
+		object1.value.integer -= object2.value.integer;
+		e = stack_push(duckVM, &object1);
+		break;
+
+	case duckLisp_instruction_subFloat8:
+		ptrdiff1 = *(ip++);
+		ptrdiff2 = *(ip++);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		if ((object1.type != duckVM_object_type_float) || (object2.type != duckVM_object_type_float)) {
+			ip -= 2;
+			opcode = duckLisp_instruction_sub8;
+#ifndef NO_QUICKENING
+			duckVM_unquicken(duckVM, bytecode, opcodePtr, opcode);
+#endif /* NO_QUICKENING */
+			goto dispatch;
+		}
+		object1.value.floatingPoint -= object2.value.floatingPoint;
+		e = stack_push(duckVM, &object1);
+		break;
+
+	case duckLisp_instruction_equalInteger8:
+		ptrdiff1 = *(ip++);
+		ptrdiff2 = *(ip++);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		if ((object1.type != duckVM_object_type_integer) || (object2.type != duckVM_object_type_integer)) {
+			ip -= 2;
+			opcode = duckLisp_instruction_equal8;
+#ifndef NO_QUICKENING
+			duckVM_unquicken(duckVM, bytecode, opcodePtr, opcode);
+#endif /* NO_QUICKENING */
+			goto dispatch;
+		}
+		object1.value.boolean = object1.value.integer == object2.value.integer;
+		object1.type = duckVM_object_type_bool;
+		e = stack_push(duckVM, &object1);
+		break;
+
+	case duckLisp_instruction_equalFloat8:
+		ptrdiff1 = *(ip++);
+		ptrdiff2 = *(ip++);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		if ((object1.type != duckVM_object_type_float) || (object2.type != duckVM_object_type_float)) {
+			ip -= 2;
+			opcode = duckLisp_instruction_equal8;
+#ifndef NO_QUICKENING
+			duckVM_unquicken(duckVM, bytecode, opcodePtr, opcode);
+#endif /* NO_QUICKENING */
+			goto dispatch;
+		}
+		object1.value.boolean = object1.value.floatingPoint == object2.value.floatingPoint;
+		object1.type = duckVM_object_type_bool;
+		e = stack_push(duckVM, &object1);
+		break;
+
+	case duckLisp_instruction_greaterInteger8:
+		ptrdiff1 = *(ip++);
+		ptrdiff2 = *(ip++);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		if ((object1.type != duckVM_object_type_integer) || (object2.type != duckVM_object_type_integer)) {
+			ip -= 2;
+			opcode = duckLisp_instruction_greater8;
+#ifndef NO_QUICKENING
+			duckVM_unquicken(duckVM, bytecode, opcodePtr, opcode);
+#endif /* NO_QUICKENING */
+			goto dispatch;
+		}
+		object1.value.boolean = object1.value.integer > object2.value.integer;
+		object1.type = duckVM_object_type_bool;
+		e = stack_push(duckVM, &object1);
+		break;
+
+	case duckLisp_instruction_greaterFloat8:
+		ptrdiff1 = *(ip++);
+		ptrdiff2 = *(ip++);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		if ((object1.type != duckVM_object_type_float) || (object2.type != duckVM_object_type_float)) {
+			ip -= 2;
+			opcode = duckLisp_instruction_greater8;
+#ifndef NO_QUICKENING
+			duckVM_unquicken(duckVM, bytecode, opcodePtr, opcode);
+#endif /* NO_QUICKENING */
+			goto dispatch;
+		}
+		object1.value.boolean = object1.value.floatingPoint > object2.value.floatingPoint;
+		object1.type = duckVM_object_type_bool;
+		e = stack_push(duckVM, &object1);
+		break;
+
+	case duckLisp_instruction_lessInteger8:
+		ptrdiff1 = *(ip++);
+		ptrdiff2 = *(ip++);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		if ((object1.type != duckVM_object_type_integer) || (object2.type != duckVM_object_type_integer)) {
+			ip -= 2;
+			opcode = duckLisp_instruction_less8;
+#ifndef NO_QUICKENING
+			duckVM_unquicken(duckVM, bytecode, opcodePtr, opcode);
+#endif /* NO_QUICKENING */
+			goto dispatch;
+		}
+		object1.value.boolean = object1.value.integer < object2.value.integer;
+		object1.type = duckVM_object_type_bool;
+		e = stack_push(duckVM, &object1);
+		break;
+
+	case duckLisp_instruction_lessFloat8:
+		ptrdiff1 = *(ip++);
+		ptrdiff2 = *(ip++);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		if ((object1.type != duckVM_object_type_float) || (object2.type != duckVM_object_type_float)) {
+			ip -= 2;
+			opcode = duckLisp_instruction_less8;
+#ifndef NO_QUICKENING
+			duckVM_unquicken(duckVM, bytecode, opcodePtr, opcode);
+#endif /* NO_QUICKENING */
+			goto dispatch;
+		}
+		object1.value.boolean = object1.value.floatingPoint < object2.value.floatingPoint;
+		object1.type = duckVM_object_type_bool;
+		e = stack_push(duckVM, &object1);
+		break;
+
+		// I probably don't need an `if` if I research the standard a bit.
+	case duckLisp_instruction_cons32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff2 = *(ip++);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		parsedBytecode = dl_true;
+		/* Fall through */
+	case duckLisp_instruction_cons16:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			ptrdiff2 = *(ip++);
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			parsedBytecode = dl_true;
+		}
+		/* Fall through */
+	case duckLisp_instruction_cons8:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff2 = *(ip++);
+		}
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		/* Push dummy cons first so that it can't get collected. */
+		cons1.type = duckVM_object_type_cons;
+		cons1.value.cons.car = dl_null;
+		cons1.value.cons.cdr = dl_null;
+		object3.type = duckVM_object_type_list;
+		e = duckVM_gclist_pushObject(duckVM, &object3.value.list, cons1);
+		if (e) break;
+		e = stack_push(duckVM, &object3);
+		if (e) break;
+		/* Create the elements of the cons. */
+		if (object1.type == duckVM_object_type_list) {
+			object3.value.list->value.cons.car = object1.value.list;
+		}
+		else {
+			e = duckVM_gclist_pushObject(duckVM, &objectPtr1, object1);
+			if (e) break;
+			object3.value.list->value.cons.car = objectPtr1;
+		}
+		if (object2.type == duckVM_object_type_list) {
+			object3.value.list->value.cons.cdr = object2.value.list;
+		}
+		else {
+			e = duckVM_gclist_pushObject(duckVM, &objectPtr2, object2);
+			if (e) break;
+			object3.value.list->value.cons.cdr = objectPtr2;
 		}
+		DL_ARRAY_GETTOPADDRESS(duckVM->stack, duckVM_object_t) = object3;
 		break;
 
-	case duckLisp_instruction_pushBooleanFalse:
-		object1 = duckVM_object_makeBoolean(dl_false);
-		e = stack_push(duckVM, &object1);
-		if (e) {
-			eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->push-boolean-false: stack_push failed."));
-			if (!e) e = eError;
+	case duckLisp_instruction_vector32:
+		size1 = *(ip++);
+		size1 = *(ip++) + (size1 << 8);
+		/* Fall through */
+	case duckLisp_instruction_vector16:
+		size1 = *(ip++) + (size1 << 8);
+		/* Fall through */
+	case duckLisp_instruction_vector8:
+		size1 = *(ip++) + (size1 << 8);
+
+		object1.type = duckVM_object_type_vector;
+		object1.value.vector.offset = 0;
+		object1.value.vector.internal_vector = dl_null;
+
+		{
+			duckVM_object_t internal_vector;
+			internal_vector.type = duckVM_object_type_internalVector;
+			internal_vector.value.internal_vector.initialized = dl_false;
+			internal_vector.value.internal_vector.length = size1;
+			e = duckVM_gclist_pushObject(duckVM, &object1.value.vector.internal_vector, internal_vector);
+			if (e) break;
 		}
-		break;
-	case duckLisp_instruction_pushBooleanTrue:
-		object1 = duckVM_object_makeBoolean(dl_true);
-		e = stack_push(duckVM, &object1);
-		if (e) {
-			eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->push-boolean-true: stack_push failed."));
-			if (!e) e = eError;
+		/* Immediately push on stack so that the GC can see it. Allocating elements could trigger a GC. */
+		e = dl_array_pushElement(&duckVM->stack, &object1);
+		if (e) break;
+		DL_DOTIMES(k, object1.value.vector.internal_vector->value.internal_vector.length) {
+			ptrdiff1 = *(ip++);
+			switch (opcode) {
+			case duckLisp_instruction_vector32:
+				ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+				ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+				/* Fall through */
+			case duckLisp_instruction_vector16:
+				ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+				/* Fall through */
+			case duckLisp_instruction_vector8:
+				break;
+			default:
+				e = dl_error_invalidValue;
+				break;
+			}
+			if (e) break;
+			/* stack - 1 because we already pushed. */
+			dl_size_t old_stack_length = duckVM->stack.elements_length - 1;
+			ptrdiff1 = old_stack_length - ptrdiff1;
+			if ((ptrdiff1 < 0) || ((dl_size_t) ptrdiff1 > old_stack_length)) {
+				e = dl_error_invalidValue;
+				break;
+			}
+
+			e = dl_array_get(&duckVM->stack, &object2, ptrdiff1);
+			if (e) break;
+			e = duckVM_gclist_pushObject(duckVM,
+			                             &object1.value.vector.internal_vector->value.internal_vector.values[k],
+			                             object2);
+			if (e) break;
 		}
+		if (e) break;
+
+		/* Break push_scope abstraction. */
+		e = dl_array_pushElement(&duckVM->upvalue_stack, dl_null);
+		if (e) break;
+		object1.value.vector.internal_vector->value.internal_vector.initialized = dl_true;
+		DL_ARRAY_GETTOPADDRESS(duckVM->stack, duckVM_object_t) = object1;
 		break;
 
-	case duckLisp_instruction_pushInteger32:
+	case duckLisp_instruction_makeVector32:
 		ptrdiff1 = *(ip++);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through */
+	case duckLisp_instruction_makeVector16:
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		parsedBytecode = dl_true;
-		size1 = 0x7FFFFFFF;
 		/* Fall through */
-	case duckLisp_instruction_pushInteger16:
-		if (!parsedBytecode) {
-			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-			size1 = 0x7FFF;
-			parsedBytecode = dl_true;
+	case duckLisp_instruction_makeVector8:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+
+		ptrdiff2 = *(ip++);
+		switch (opcode) {
+		case duckLisp_instruction_makeVector32:
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			/* Fall through */
+		case duckLisp_instruction_makeVector16:
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			/* Fall through */
+		case duckLisp_instruction_makeVector8:
+			break;
+		default:
+			e = dl_error_invalidValue;
+			break;
 		}
-		/* Fall through */
-	case duckLisp_instruction_pushInteger8:
-		if (!parsedBytecode) {
-			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-			size1 = 0x7F;
+		if (e) break;
+
+		ptrdiff1 = duckVM->stack.elements_length - ptrdiff1;
+		if ((ptrdiff1 < 0) || ((dl_size_t) ptrdiff1 > duckVM->stack.elements_length)) {
+			e = dl_error_invalidValue;
+			break;
+		}
+		e = dl_array_get(&duckVM->stack, &object1, ptrdiff1);
+		if (e) break;
+		if (object1.type != duckVM_object_type_integer) {
+			e = dl_error_invalidValue;
+			break;
+		}
+		if (object1.value.integer < 0) {
+			e = dl_error_invalidValue;
+			break;
 		}
+		size1 = object1.value.integer;
 
-		ptrdiff1 = (((dl_size_t) ptrdiff1 > size1)
-		            ? (dl_ptrdiff_t) (~size1 | (dl_size_t) ptrdiff1)
-		            : ptrdiff1);
-		object1 = duckVM_object_makeInteger(ptrdiff1);
-		e = stack_push(duckVM, &object1);
-		if (e) {
-			eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->push-integer: stack_push failed."));
-			if (!e) e = eError;
+		ptrdiff2 = duckVM->stack.elements_length - ptrdiff2;
+		if ((ptrdiff2 < 0) || ((dl_size_t) ptrdiff2 > duckVM->stack.elements_length)) {
+			e = dl_error_invalidValue;
+			break;
 		}
-		break;
+		e = dl_array_get(&duckVM->stack, &object2, ptrdiff2);
+		if (e) break;
 
-	case duckLisp_instruction_pushDoubleFloat: {
-		dl_uint64_t totallyNotADoubleFloat = 0;
-		totallyNotADoubleFloat = *(ip++);
-		totallyNotADoubleFloat = *(ip++) + (totallyNotADoubleFloat << 8);
-		totallyNotADoubleFloat = *(ip++) + (totallyNotADoubleFloat << 8);
-		totallyNotADoubleFloat = *(ip++) + (totallyNotADoubleFloat << 8);
-		totallyNotADoubleFloat = *(ip++) + (totallyNotADoubleFloat << 8);
-		totallyNotADoubleFloat = *(ip++) + (totallyNotADoubleFloat << 8);
-		totallyNotADoubleFloat = *(ip++) + (totallyNotADoubleFloat << 8);
-		totallyNotADoubleFloat = *(ip++) + (totallyNotADoubleFloat << 8);
-		object1 = duckVM_object_makeFloat(*((double *) &totallyNotADoubleFloat));
-		e = stack_push(duckVM, &object1);
-		if (e) {
-			eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->push-double-float: stack_push failed."));
-			if (!e) e = eError;
+		object1.type = duckVM_object_type_vector;
+		object1.value.vector.offset = 0;
+		object1.value.vector.internal_vector = dl_null;
+
+		{
+			duckVM_object_t internal_vector;
+			internal_vector.type = duckVM_object_type_internalVector;
+			internal_vector.value.internal_vector.initialized = dl_false;
+			internal_vector.value.internal_vector.length = size1;
+			e = duckVM_gclist_pushObject(duckVM, &object1.value.vector.internal_vector, internal_vector);
+			if (e) break;
 		}
+		/* Immediately push on stack so that the GC can see it. Allocating elements could trigger a GC. */
+		e = dl_array_pushElement(&duckVM->stack, &object1);
+		if (e) break;
+		e = duckVM_gclist_pushObject(duckVM,
+		                             &objectPtr1,
+		                             object2);
+		if (e) break;
+		DL_DOTIMES(k, object1.value.vector.internal_vector->value.internal_vector.length) {
+			object1.value.vector.internal_vector->value.internal_vector.values[k] = objectPtr1;
+		}
+
+		if (e) break;
+
+		/* Break push_scope abstraction. */
+		e = dl_array_pushElement(&duckVM->upvalue_stack, dl_null);
+		if (e) break;
+		object1.value.vector.internal_vector->value.internal_vector.initialized = dl_true;
+		DL_ARRAY_GETTOPADDRESS(duckVM->stack, duckVM_object_t) = object1;
 		break;
-	}
 
-	case duckLisp_instruction_pushIndex32:
+	case duckLisp_instruction_getVecElt32:
 		ptrdiff1 = *(ip++);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		// Fall through
-	case duckLisp_instruction_pushIndex16:
+		/* Fall through */
+	case duckLisp_instruction_getVecElt16:
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		// Fall through
-	case duckLisp_instruction_pushIndex8:
+		/* Fall through */
+	case duckLisp_instruction_getVecElt8:
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
-		if (e) {
-			eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->push-index: dl_array_get failed."));
+
+		ptrdiff2 = *(ip++);
+		switch (opcode) {
+		case duckLisp_instruction_getVecElt32:
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			/* Fall through */
+		case duckLisp_instruction_getVecElt16:
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			/* Fall through */
+		case duckLisp_instruction_getVecElt8:
+			break;
+		default:
+			e = dl_error_cantHappen;
+			break;
+		}
+		if (e) break;
+
+		ptrdiff1 = duckVM->stack.elements_length - ptrdiff1;
+		if ((ptrdiff1 < 0) || ((dl_size_t) ptrdiff1 > duckVM->stack.elements_length)) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->get-vector-element: Vector stack index out of bounds."));
+			if (!e) e = eError;
+			break;
+		}
+		e = dl_array_get(&duckVM->stack, &object1, ptrdiff1);
+		if (e) break;
+		if ((object1.type != duckVM_object_type_vector)
+		    && (object1.type != duckVM_object_type_string)
+		    && (object1.type != duckVM_object_type_typedArray)) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->get-vector-element: dl_array_get failed."));
+			if (!e) e = eError;
+			break;
+		}
+
+		ptrdiff2 = duckVM->stack.elements_length - ptrdiff2;
+		if ((ptrdiff2 < 0) || ((dl_size_t) ptrdiff2 > duckVM->stack.elements_length)) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->get-vector-element: Index stack index out of bounds."));
+			if (!e) e = eError;
+			break;
+		}
+		e = dl_array_get(&duckVM->stack, &object2, ptrdiff2);
+		if (e) break;
+		if (object2.type != duckVM_object_type_integer) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->get-vector-element: dl_array_get failed."));
 			if (!e) e = eError;
 			break;
 		}
-		e = stack_push(duckVM, &object1);
-		if (e) {
-			eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->push-index: stack_push failed."));
-			if (!e) e = eError;
-		}
-		break;
 
-	case duckLisp_instruction_pushUpvalue32:
-		ptrdiff1 = *(ip++);
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through */
-	case duckLisp_instruction_pushUpvalue16:
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through */
-	case duckLisp_instruction_pushUpvalue8:
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		{
-			duckVM_upvalueArray_t upvalueArray;
-			if (ptrdiff1 < 0) {
+		if (object1.type == duckVM_object_type_vector) {
+			ptrdiff1 = object2.value.integer;
+			if ((ptrdiff1 < 0)
+			    || ((dl_size_t) (ptrdiff1 + object1.value.vector.offset)
+			        >= object1.value.vector.internal_vector->value.internal_vector.length)) {
 				e = dl_error_invalidValue;
 				eError = duckVM_error_pushRuntime(duckVM,
-				                                  DL_STR("duckVM_execute->push-upvalue: Index pointing to upvalue is negative."));
-				if (!e) e = eError;
-				break;
-			}
-			e = dl_array_getTop(&duckVM->upvalue_array_call_stack, &upvalueArray);
-			if (e) {
-				eError = duckVM_error_pushRuntime(duckVM,
-				                                  DL_STR("duckVM_execute->push-upvalue: dl_array_get failed."));
+				                                  DL_STR("duckVM_execute->get-vector-element: Vector index out of bounds."));
 				if (!e) e = eError;
 				break;
 			}
-			e = duckVM_upvalueArray_getUpvalue(duckVM, upvalueArray, &object1, ptrdiff1);
-			if (e) {
+			object2 = *object1.value.vector.internal_vector->value.internal_vector.values[object1.value.vector.offset
+			                                                                              + ptrdiff1];
+		}
+		else if (object1.type == duckVM_object_type_string) {
+			ptrdiff1 = object2.value.integer;
+			if ((ptrdiff1 < 0) || ((dl_size_t) ptrdiff1 >= object1.value.string.length - object1.value.string.offset)) {
+				e = dl_error_invalidValue;
 				eError = duckVM_error_pushRuntime(duckVM,
-				                                  DL_STR("duckVM_execute->push-upvalue: duckVM_upvalueArray_getUpvalue failed."));
+				                                  DL_STR("duckVM_execute->get-vector-element: String index out of bounds."));
 				if (!e) e = eError;
 				break;
 			}
-			e = stack_push(duckVM, &object1);
-			if (e) {
+			object2.type = duckVM_object_type_integer;
+			object2.value.integer = (object1.value.string.internalString
+			                         ->value.internalString.value[object1.value.string.offset
+			                                                      + ptrdiff1]);
+		}
+		else if (object1.type == duckVM_object_type_typedArray) {
+			ptrdiff1 = object2.value.integer;
+			if ((ptrdiff1 < 0)
+			    || ((dl_size_t) ptrdiff1 >= object1.value.typedArray->value.internalTypedArray.length)) {
+				e = dl_error_invalidValue;
 				eError = duckVM_error_pushRuntime(duckVM,
-				                                  DL_STR("duckVM_execute->push-upvalue: stack_push failed."));
+				                                  DL_STR("duckVM_execute->get-vector-element: Typed array index out of bounds."));
 				if (!e) e = eError;
 				break;
 			}
+			object2 = duckVM_typedArray_get(&object1.value.typedArray->value.internalTypedArray, ptrdiff1);
+		}
+		e = stack_push(duckVM, &object2);
+		if (e) {
+			eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->get-vector-element: stack_push failed."));
+			if (!e) e = eError;
 			break;
 		}
+		break;
 
-	case duckLisp_instruction_pushClosure32:
-		/* Fall through */
-	case duckLisp_instruction_pushVaClosure32:
+	case duckLisp_instruction_setVecElt32:
 		ptrdiff1 = *(ip++);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		ptr1 = ip;
-		if (ptrdiff1 & 0x80000000ULL) {
-			ptrdiff1 = -((~ptrdiff1 + 1) & 0xFFFFFFFFULL);
-		}
-		parsedBytecode = dl_true;
-		/* Fall through */
-	case duckLisp_instruction_pushClosure16:
-		/* Fall through */
-	case duckLisp_instruction_pushVaClosure16:
-		if (!parsedBytecode) {
-			ptrdiff1 = *(ip++);
-			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-			ptr1 = ip;
-			if (ptrdiff1 & 0x8000ULL) {
-				ptrdiff1 = -((~ptrdiff1 + 1) & 0xFFFFULL);
-			}
-			parsedBytecode = dl_true;
-		}
 		/* Fall through */
-	case duckLisp_instruction_pushClosure8:
+	case duckLisp_instruction_setVecElt16:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
 		/* Fall through */
-	case duckLisp_instruction_pushVaClosure8:
-		if (!parsedBytecode) {
-			ptrdiff1 = *(ip++);
-			ptr1 = ip;
-			if (ptrdiff1 & 0x80ULL) {
-				ptrdiff1 = -((~ptrdiff1 + 1) & 0xFFULL);
-			}
-		}
-
-		object1 = duckVM_object_makeClosure(ptrdiff1,
-		                                    bytecode,
-		                                    dl_null,
-		                                    *(ip++),
-		                                    ((opcode == duckLisp_instruction_pushVaClosure32)
-		                                     || (opcode == duckLisp_instruction_pushVaClosure16)
-		                                     || (opcode == duckLisp_instruction_pushVaClosure8)));
-
-		size1 = *(ip++);
-		size1 = *(ip++) + (size1 << 8);
-		size1 = *(ip++) + (size1 << 8);
-		size1 = *(ip++) + (size1 << 8);
+	case duckLisp_instruction_setVecElt8:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
 
-		object1.value.closure.name += ptr1 - bytecode->value.bytecode.bytecode;
+		ptrdiff2 = *(ip++);
+		switch (opcode) {
+		case duckLisp_instruction_setVecElt32:
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			/* Fall through */
+		case duckLisp_instruction_setVecElt16:
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			/* Fall through */
+		case duckLisp_instruction_setVecElt8:
+			break;
+		default:
+			e = dl_error_invalidValue;
+			break;
+		}
+		if (e) break;
 
-		/* This could also point to a static version instead since this array is never changed
-		   and multiple closures could use the same array. */
+		ptrdiff3 = *(ip++);
+		switch (opcode) {
+		case duckLisp_instruction_setVecElt32:
+			ptrdiff3 = *(ip++) + (ptrdiff3 << 8);
+			ptrdiff3 = *(ip++) + (ptrdiff3 << 8);
+			/* Fall through */
+		case duckLisp_instruction_setVecElt16:
+			ptrdiff3 = *(ip++) + (ptrdiff3 << 8);
+			/* Fall through */
+		case duckLisp_instruction_setVecElt8:
+			break;
+		default:
+			e = dl_error_invalidValue;
+			break;
+		}
+		if (e) break;
 
-		e = duckVM_gclist_pushObject(duckVM,
-		                             &object1.value.closure.upvalue_array,
-		                             duckVM_object_makeUpvalueArray(dl_null, size1));
-		if (e) {
-			eError = duckVM_error_pushRuntime(duckVM,
-			                                  DL_STR("duckVM_execute->push-closure: duckVM_gclist_pushObject failed."));
-			if (!e) e = eError;
+		ptrdiff1 = duckVM->stack.elements_length - ptrdiff1;
+		if ((ptrdiff1 < 0) || ((dl_size_t) ptrdiff1 > duckVM->stack.elements_length)) {
+			e = dl_error_invalidValue;
 			break;
 		}
-		duckVM_upvalueArray_t upvalueArray;
-		e = duckVM_closure_getUpvalueArray(object1.value.closure, &upvalueArray);
+		e = dl_array_get(&duckVM->stack, &object1, ptrdiff1);
 		if (e) break;
-		DL_DOTIMES(k, upvalueArray.length) {
-			upvalueArray.upvalues[k] = dl_null;
+		if ((object1.type != duckVM_object_type_vector) && (object1.type != duckVM_object_type_typedArray)) {
+			e = dl_error_invalidValue;
+			break;
 		}
-		/* Immediately push on stack so that the GC can see it. Allocating upvalues could trigger a GC. */
-		e = dl_array_pushElement(&duckVM->stack, &object1);
-		if (e) {
+		if (duckVM_object_isFrozen(duckVM, &object1)) {
+			e = dl_error_invalidValue;
 			eError = duckVM_error_pushRuntime(duckVM,
-			                                  DL_STR("duckVM_execute->push-closure: dl_array_pushElement failed."));
-			if (!e) e = eError;
+			                                  DL_STR("duckVM_execute->set-vector-element: Frozen objects can't be modified."));
+			if (eError) e = eError;
 			break;
 		}
 
-		dl_bool_t recursive = dl_false;
+		ptrdiff2 = duckVM->stack.elements_length - ptrdiff2;
+		if ((ptrdiff2 < 0) || ((dl_size_t) ptrdiff2 > duckVM->stack.elements_length)) {
+			e = dl_error_invalidValue;
+			break;
+		}
+		e = dl_array_get(&duckVM->stack, &object2, ptrdiff2);
+		if (e) break;
+		if (object2.type != duckVM_object_type_integer) {
+			e = dl_error_invalidValue;
+			break;
+		}
 
-		DL_DOTIMES(k, upvalueArray.length) {
-			ptrdiff1 = *(ip++);
-			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-			if (ptrdiff1 > 0x7FFFFFFF) {
-				/* Nested upvalue */
-				ptrdiff1 = -(0x100000000 - ptrdiff1);
+		ptrdiff3 = duckVM->stack.elements_length - ptrdiff3;
+		if ((ptrdiff3 < 0) || ((dl_size_t) ptrdiff3 > duckVM->stack.elements_length)) {
+			e = dl_error_invalidValue;
+			break;
+		}
+		e = dl_array_get(&duckVM->stack, &object3, ptrdiff3);
+		if (e) break;
+
+		if (object1.type == duckVM_object_type_typedArray) {
+			/* The value is stored unboxed, so nothing is allocated. */
+			ptrdiff2 = object2.value.integer;
+			if ((ptrdiff2 < 0)
+			    || ((dl_size_t) ptrdiff2 >= object1.value.typedArray->value.internalTypedArray.length)) {
+				e = dl_error_invalidValue;
+				eError = duckVM_error_pushRuntime(duckVM,
+				                                  DL_STR("duckVM_execute->set-vector-element: Typed array index out of bounds."));
+				if (eError) e = eError;
+				break;
 			}
-			else {
-				/* Normal upvalue */
-				/* stack - 1 because we already pushed. */
-				ptrdiff1 = (duckVM->stack.elements_length - 1) - ptrdiff1;
-				if ((ptrdiff1 < 0) || ((dl_size_t) ptrdiff1 > duckVM->upvalue_stack.elements_length)) {
-					e = dl_error_invalidValue;
-					eError = duckVM_error_pushRuntime(duckVM,
-					                                  DL_STR("duckVM_execute->push-closure: Stack index out of bounds."));
-					if (!e) e = eError;
-					break;
-				}
+			if (!duckVM_typedArray_set(&object1.value.typedArray->value.internalTypedArray, ptrdiff2, &object3)) {
+				e = dl_error_invalidValue;
+				eError = duckVM_error_pushRuntime(duckVM,
+				                                  DL_STR("duckVM_execute->set-vector-element: Value doesn't fit the typed array's element type."));
+				if (eError) e = eError;
+				break;
+			}
+			e = stack_push(duckVM, &object3);
+			if (e) break;
+			break;
+		}
+
+		/* Vector bounds check. */
+		ptrdiff2 = object2.value.integer;
+		if ((dl_size_t) (ptrdiff2 + object1.value.vector.offset)
+		    >= object1.value.vector.internal_vector->value.internal_vector.length) {
+			e = dl_error_invalidValue;
+			break;
+		}
+
+		e = duckVM_gclist_pushObject(duckVM,
+		                             &(object1.value.vector.internal_vector
+		                               ->value.internal_vector.values[object1.value.vector.offset
+		                                                              + ptrdiff2]),
+		                             object3);
+		if (e) break;
+		/* Also push on stack. */
+		e = stack_push(duckVM, &object3);
+		if (e) break;
+		break;
+
+		// I probably don't need an `if` if I research the standard a bit.
+	case duckLisp_instruction_cdr32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through */
+	case duckLisp_instruction_cdr16:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through */
+	case duckLisp_instruction_cdr8:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		if (object1.type == duckVM_object_type_list) {
+			if (object1.value.list == dl_null) {
+				object2.type = duckVM_object_type_list;
+				object2.value.list = dl_null;
 			}
-			duckVM_object_t *upvalue_pointer = dl_null;
-			if ((dl_size_t) ptrdiff1 == duckVM->upvalue_stack.elements_length) {
-				/* *Recursion* Capture upvalue we are about to push. This should only happen once. */
-				recursive = dl_true;
-				/* Our upvalue definitely doesn't exist yet. */
-				duckVM_object_t upvalue;
-				upvalue.type = duckVM_object_type_upvalue;
-				upvalue.value.upvalue.type = duckVM_upvalue_type_stack_index;  /* Lie for now. */
-				upvalue.value.upvalue.value.stack_index = ptrdiff1;
-				e = duckVM_gclist_pushObject(duckVM, &upvalue_pointer, upvalue);
-				if (e) {
-					e = dl_error_shouldntHappen;
-					eError = duckVM_error_pushRuntime(duckVM,
-					                                  DL_STR("duckVM_execute->push-closure: duckVM_gclist_pushObject failed."));
-					if (!e) e = eError;
-					break;
+			else {
+				if (object1.value.list->type == duckVM_object_type_cons) {
+					duckVM_object_t *cdr = object1.value.list->value.cons.cdr;
+					if (cdr == dl_null) {
+						object2.type = duckVM_object_type_list;
+						object2.value.list = dl_null;
+					}
+					/* cdr can be a cons or something else. */
+					else if (cdr->type == duckVM_object_type_cons) {
+						object2.type = duckVM_object_type_list;
+						object2.value.list = cdr;
+					}
+					else {
+						object2 = *cdr;
+					}
 				}
-				/* Break push_scope abstraction. */
-				e = dl_array_pushElement(&duckVM->upvalue_stack, dl_null);
-				if (e) {
+				else {
 					e = dl_error_shouldntHappen;
-					(eError
-					 = duckVM_error_pushRuntime(duckVM,
-					                            DL_STR("duckVM_execute->push-closure: dl_array_pushElement failed.")));
-					if (!e) e = eError;
-					break;
-				}
-				/* Upvalue stack slot exists now, so insert the new UV. */
-				DL_ARRAY_GETADDRESS(duckVM->upvalue_stack, duckVM_object_t *, ptrdiff1) = upvalue_pointer;
-			}
-			else if (ptrdiff1 < 0) {
-				/* Capture upvalue in currently executing function. */
-				ptrdiff1 = -(ptrdiff1 + 1);
-				duckVM_object_t upvalue;
-				upvalue.type = duckVM_object_type_upvalue;
-				upvalue.value.upvalue.type = duckVM_upvalue_type_heap_upvalue;
-				/* Link new upvalue to upvalue from current context. */
-				upvalue.value.upvalue.value.heap_upvalue = (DL_ARRAY_GETTOPADDRESS(duckVM->upvalue_array_call_stack,
-				                                                                   duckVM_upvalueArray_t)
-				                                            .upvalues[ptrdiff1]);
-				e = duckVM_gclist_pushObject(duckVM, &upvalue_pointer, upvalue);
-				if (e) {
 					eError = duckVM_error_pushRuntime(duckVM,
-					                                  DL_STR("duckVM_execute->push-closure: duckVM_gclist_pushObject failed."));
+					                                  DL_STR("duckVM_execute->cdr: Non-null list does not contain a cons."));
 					if (!e) e = eError;
 					break;
 				}
 			}
+		}
+		else if (object1.type == duckVM_object_type_vector) {
+			if (object1.value.vector.internal_vector == dl_null) {
+				object2.type = duckVM_object_type_vector;
+				object2.value.vector.internal_vector = dl_null;
+			}
 			else {
-				/* Capture upvalue on stack. */
-				e = dl_array_get(&duckVM->upvalue_stack, &upvalue_pointer, ptrdiff1);
-				if (e) {
-					eError = duckVM_error_pushRuntime(duckVM,
-					                                  DL_STR("duckVM_execute->push-closure: Retrieval of upvalue from upvalue stack failed."));
-					if (!e) e = eError;
+				if (object1.value.vector.internal_vector->type == duckVM_object_type_internalVector) {
+					object2.type = duckVM_object_type_vector;
+					if ((object1.value.vector.internal_vector->value.internal_vector.length == 0)
+					    /* -1 because we are going to try to get the cdr, which is the next element after. */
+					    || ((dl_size_t) object1.value.vector.offset
+					        >= object1.value.vector.internal_vector->value.internal_vector.length - 1)) {
+						object2.value.vector.internal_vector = dl_null;
+					}
+					/* cdr can't be anything other than a vector. */
+					else {
+						object2.value.vector.internal_vector = object1.value.vector.internal_vector;
+						object2.value.vector.offset = object1.value.vector.offset + 1;
+					}
+				}
+				else {
+					e = dl_error_invalidValue;
 					break;
 				}
-				if (upvalue_pointer == dl_null) {
-					duckVM_object_t upvalue;
-					upvalue.type = duckVM_object_type_upvalue;
-					upvalue.value.upvalue.type = duckVM_upvalue_type_stack_index;
-					upvalue.value.upvalue.value.stack_index = ptrdiff1;
-					e = duckVM_gclist_pushObject(duckVM, &upvalue_pointer, upvalue);
-					if (e) {
-						eError = duckVM_error_pushRuntime(duckVM,
-						                                  DL_STR("duckVM_execute->push-closure: duckVM_gclist_pushObject failed."));
-						if (!e) e = eError;
-						break;
+			}
+		}
+		else if (object1.type == duckVM_object_type_string) {
+			if (object1.value.string.internalString == dl_null) {
+				object2.type = duckVM_object_type_string;
+				object2.value.string.internalString = dl_null;
+			}
+			else {
+				if (object1.value.string.internalString->type == duckVM_object_type_internalString) {
+					object2.type = duckVM_object_type_string;
+					if ((object1.value.string.length == 0)
+					    /* -1 because we are going to try to get the cdr, which is the next element after. */
+					    || ((dl_size_t) object1.value.string.offset >= object1.value.string.length - 1)) {
+						object2.value.string.internalString = dl_null;
+					}
+					/* cdr can't be anything other than a string. */
+					else {
+						object2.value.string.internalString = object1.value.string.internalString;
+						object2.value.string.offset = object1.value.string.offset + 1;
+						object2.value.string.length = object1.value.string.length;
 					}
-					// Is this a bug? I'm not confident that this element exists.
-					/* Keep reference to upvalue on stack so that we know where to release the object to. */
-					DL_ARRAY_GETADDRESS(duckVM->upvalue_stack, duckVM_object_t *, ptrdiff1) = upvalue_pointer;
 				}
-				if (upvalue_pointer->type != duckVM_object_type_upvalue) {
-					e = dl_error_shouldntHappen;
+				else {
+					e = dl_error_invalidValue;
 					eError = duckVM_error_pushRuntime(duckVM,
-					                                  DL_STR("duckVM_execute->push-closure: Captured object is not an upvalue."));
-					if (!e) e = eError;
+					                                  DL_STR("duckVM_execute->cdr: Internal string is wrong type."));
+					if (eError) e = eError;
 					break;
 				}
 			}
-			if (e) break;
-			upvalueArray.upvalues[k] = upvalue_pointer;
 		}
-		if (e) break;
-		if (!recursive) {
-			/* Break push_scope abstraction. */
-			e = dl_array_pushElement(&duckVM->upvalue_stack, dl_null);
-			if (e) {
-				eError = duckVM_error_pushRuntime(duckVM,
-				                                  DL_STR("duckVM_execute->push-closure: dl_array_pushElement failed."));
-				if (!e) e = eError;
-				break;
-			}
+		else {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->cdr: Argument is not a list, vector, or string."));
+			if (eError) e = eError;
+			break;
 		}
-		DL_ARRAY_GETTOPADDRESS(duckVM->stack, duckVM_object_t) = object1;
-
+		e = stack_push(duckVM, &object2);
+		if (e) break;
 		break;
 
-	case duckLisp_instruction_pushGlobal32:
+		// I probably don't need an `if` if I research the standard a bit.
+	case duckLisp_instruction_car32:
 		ptrdiff1 = *(ip++);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		parsedBytecode = dl_true;
 		/* Fall through */
-	case duckLisp_instruction_pushGlobal16:
-		if (!parsedBytecode) {
-			ptrdiff1 = *(ip++);
-			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-			parsedBytecode = dl_true;
-		}
+	case duckLisp_instruction_car16:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
 		/* Fall through */
-	case duckLisp_instruction_pushGlobal8:
-		if (!parsedBytecode) {
-			ptrdiff1 = *(ip++);
-		}
-		{
-			duckVM_object_t *global;
-			e = duckVM_global_get(duckVM, &global, ptrdiff1);
-			if (e) {
-				e = dl_error_invalidValue;
-				eError = duckVM_error_pushRuntime(duckVM,
-				                                  DL_STR("duckVM_execute->push-global: Could not find dynamic variable."));
-				if (eError) e = eError;
-				break;
+	case duckLisp_instruction_car8:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		if (object1.type == duckVM_object_type_list) {
+			if (object1.value.list == dl_null) {
+				object2.type = duckVM_object_type_list;
+				object2.value.list = dl_null;
 			}
-			e = stack_push(duckVM, global);
-			if (e) {
-				eError = duckVM_error_pushRuntime(duckVM,
-				                                  DL_STR("duckVM_execute->push-global: stack_push failed."));
-				if (!e) e = eError;
-				break;
+			else {
+				if (object1.value.list->type == duckVM_object_type_cons) {
+					duckVM_object_t *car = object1.value.list->value.cons.car;
+					if (car == dl_null) {
+						object2.type = duckVM_object_type_list;
+						object2.value.list = dl_null;
+					}
+					/* car can be a cons or something else. */
+					else if (car->type == duckVM_object_type_cons) {
+						object2.type = duckVM_object_type_list;
+						object2.value.list = car;
+					}
+					else {
+						object2 = *car;
+					}
+				}
+				else {
+					e = dl_error_shouldntHappen;
+					eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->cdr: Non-null list does not contain a cons."));
+					if (!e) e = eError;
+					break;
+				}
 			}
 		}
-		break;
-
-	case duckLisp_instruction_releaseUpvalues32:
-	case duckLisp_instruction_releaseUpvalues16:
-	case duckLisp_instruction_releaseUpvalues8:
-		size1 = *(ip++);
-
-		DL_DOTIMES(k, size1) {
-			ptrdiff1 = *(ip++);
-			switch (opcode) {
-			case duckLisp_instruction_releaseUpvalues32:
-				ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-				ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-				/* Fall through */
-			case duckLisp_instruction_releaseUpvalues16:
-				ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-				/* Fall through */
-			case duckLisp_instruction_releaseUpvalues8:
-				break;
-			default:
-				e = dl_error_invalidValue;
-				break;
+		else if (object1.type == duckVM_object_type_vector) {
+			if (object1.value.vector.internal_vector == dl_null) {
+				object2.type = duckVM_object_type_vector;
+				object2.value.vector.internal_vector = dl_null;
+			}
+			else {
+				if (object1.value.vector.internal_vector->type == duckVM_object_type_internalVector) {
+					if ((object1.value.vector.internal_vector->value.internal_vector.length == 0)
+					    || ((dl_size_t) object1.value.vector.offset
+					        >= object1.value.vector.internal_vector->value.internal_vector.length)) {
+						object2.type = duckVM_object_type_vector;
+						object2.value.vector.internal_vector = dl_null;
+					}
+					else {
+						object2 = *(object1.value.vector.internal_vector
+						            ->value.internal_vector.values[object1.value.vector.offset]);
+					}
+				}
+				else {
+					e = dl_error_invalidValue;
+					break;
+				}
 			}
-			ptrdiff1 = duckVM->stack.elements_length - ptrdiff1;
-			if (ptrdiff1 < 0) {
-				e = dl_error_invalidValue;
-				break;
+		}
+		else if (object1.type == duckVM_object_type_string) {
+			if (object1.value.string.internalString == dl_null) {
+				object2.type = duckVM_object_type_string;
+				object2.value.string.internalString = dl_null;
 			}
-			duckVM_object_t *upvalue = DL_ARRAY_GETADDRESS(duckVM->upvalue_stack, duckVM_object_t *, ptrdiff1);
-			if (upvalue != dl_null) {
-				if (upvalue->type != duckVM_object_type_upvalue) {
-					eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->release-upvalues: Captured object is not an upvalue."));
-					if (!e) e = eError;
+			else {
+				if (object1.value.string.internalString->type == duckVM_object_type_internalString) {
+					if ((object1.value.string.length == 0)
+					    || ((dl_size_t) object1.value.string.offset >= object1.value.string.length)) {
+						object2.type = duckVM_object_type_string;
+						object2.value.string.internalString = dl_null;
+					}
+					else {
+						object2.type = duckVM_object_type_integer;
+						object2.value.integer = (object1.value.string.internalString
+						                         ->value.internalString.value[object1.value.string.offset]);
+					}
+				}
+				else {
+					e = dl_error_invalidValue;
 					break;
 				}
-				duckVM_object_t *object = &DL_ARRAY_GETADDRESS(duckVM->stack, duckVM_object_t, ptrdiff1);
-				e = duckVM_gclist_pushObject(duckVM, &upvalue->value.upvalue.value.heap_object, *object);
-				if (e) break;
-				upvalue->value.upvalue.type = duckVM_upvalue_type_heap_object;
-				/* Render the original object unusable. */
-				object->type = duckVM_object_type_list;
-				object->value.list = dl_null;
-				DL_ARRAY_GETADDRESS(duckVM->upvalue_stack, duckVM_object_t *, ptrdiff1) = dl_null;
 			}
 		}
+		else {
+			e = dl_error_invalidValue;
+			break;
+		}
+		e = stack_push(duckVM, &object2);
 		if (e) break;
 		break;
 
-	case duckLisp_instruction_setUpvalue32:
+	case duckLisp_instruction_setCar32:
 		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
 		ptrdiff2 = *(ip++);
 		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
 		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
 		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
 		parsedBytecode = dl_true;
-		/* Fall through */
-	case duckLisp_instruction_setUpvalue16:
+		// Fall through
+	case duckLisp_instruction_setCar16:
 		if (!parsedBytecode) {
 			ptrdiff1 = *(ip++);
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
 			ptrdiff2 = *(ip++);
 			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
 			parsedBytecode = dl_true;
 		}
-		/* Fall through */
-	case duckLisp_instruction_setUpvalue8:
+		// Fall through
+	case duckLisp_instruction_setCar8:
 		if (!parsedBytecode) {
 			ptrdiff1 = *(ip++);
 			ptrdiff2 = *(ip++);
 		}
-		{
-			// Need another stack with same depth as call stack to pull out upvalues.
-			// Like to live dangerously?
-			if (ptrdiff1 < 0) {
-				e = dl_error_invalidValue;
-				break;
-			}
-			e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff2);
-			if (e) break;
-			duckVM_object_t *upvalue = DL_ARRAY_GETTOPADDRESS(duckVM->upvalue_array_call_stack,
-			                                                  duckVM_upvalueArray_t).upvalues[ptrdiff1];
-			if (upvalue->value.upvalue.type == duckVM_upvalue_type_stack_index) {
-				e = dl_array_set(&duckVM->stack, &object1, upvalue->value.upvalue.value.stack_index);
-				if (e) break;
-			}
-			else if (upvalue->value.upvalue.type == duckVM_upvalue_type_heap_object) {
-				*upvalue->value.upvalue.value.heap_object = object1;
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+
+		if (duckVM_object_isFrozen(duckVM, &object2)) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->set-car: Frozen objects can't be modified."));
+			if (eError) e = eError;
+			break;
+		}
+
+		if ((object2.type == duckVM_object_type_list) && (object2.value.list != dl_null)) {
+			if (object1.type == duckVM_object_type_list) {
+				if (object1.value.list == dl_null) object2.value.list->value.cons.car = dl_null;
+				else object2.value.list->value.cons.car = object1.value.list;
 			}
 			else {
-				while (upvalue->value.upvalue.type == duckVM_upvalue_type_heap_upvalue) {
-					upvalue = upvalue->value.upvalue.value.heap_upvalue;
-				}
-				if (upvalue->value.upvalue.type == duckVM_upvalue_type_stack_index) {
-					e = dl_array_set(&duckVM->stack, &object1, upvalue->value.upvalue.value.stack_index);
-					if (e) break;
-				}
-				else {
-					*upvalue->value.upvalue.value.heap_object = object1;
-				}
+				e = duckVM_gclist_pushObject(duckVM, &objectPtr1, object1);
+				if (e) break;
+				object2.value.list->value.cons.car = objectPtr1;
 			}
 		}
+		else if ((object2.type == duckVM_object_type_vector)
+		         && (object2.value.vector.internal_vector != dl_null)) {
+			e = duckVM_gclist_pushObject(duckVM, &objectPtr1, object1);
+			if (e) break;
+			(object2.value.vector.internal_vector
+			 ->value.internal_vector.values[object2.value.vector.offset]) = objectPtr1;
+		}
+		else {
+			e = dl_error_invalidValue;
+			break;
+		}
+		e = stack_push(duckVM, &object2);
 		break;
 
-	case duckLisp_instruction_setGlobal32:
+		// I probably don't need an `if` if I research the standard a bit.
+	case duckLisp_instruction_setCdr32:
 		ptrdiff1 = *(ip++);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
@@ -1345,8 +6705,8 @@ int duckVM_executeInstruction(duckVM_t *duckVM,
 		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
 		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
 		parsedBytecode = dl_true;
-		/* Fall through */
-	case duckLisp_instruction_setGlobal16:
+		// Fall through
+	case duckLisp_instruction_setCdr16:
 		if (!parsedBytecode) {
 			ptrdiff1 = *(ip++);
 			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
@@ -1354,380 +6714,319 @@ int duckVM_executeInstruction(duckVM_t *duckVM,
 			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
 			parsedBytecode = dl_true;
 		}
-		/* Fall through */
-	case duckLisp_instruction_setGlobal8:
+		// Fall through
+	case duckLisp_instruction_setCdr8:
 		if (!parsedBytecode) {
 			ptrdiff1 = *(ip++);
 			ptrdiff2 = *(ip++);
 		}
-		e = duckVM_gclist_pushObject(duckVM,
-		                             &objectPtr1,
-		                             DL_ARRAY_GETADDRESS(duckVM->stack,
-		                                                 duckVM_object_t,
-		                                                 duckVM->stack.elements_length - ptrdiff1));
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
 		if (e) break;
-		e = duckVM_global_set(duckVM, objectPtr1, ptrdiff2);
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+
+		if (duckVM_object_isFrozen(duckVM, &object2)) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->set-cdr: Frozen objects can't be modified."));
+			if (eError) e = eError;
+			break;
+		}
+
+		if ((object2.type == duckVM_object_type_list) && (object2.value.list != dl_null)) {
+			if (object1.type == duckVM_object_type_list) {
+				if (object1.value.list == dl_null) object2.value.list->value.cons.cdr = dl_null;
+				else object2.value.list->value.cons.cdr = object1.value.list;
+			}
+			else {
+				e = duckVM_gclist_pushObject(duckVM, &objectPtr1, object1);
+				if (e) break;
+				object2.value.list->value.cons.cdr = objectPtr1;
+			}
+		}
+		else if ((object2.type == duckVM_object_type_vector)
+		         && (object2.value.vector.internal_vector != dl_null)
+		         && (((object1.type == duckVM_object_type_vector)
+		              && (object1.value.vector.internal_vector == dl_null))
+		             || ((object1.type == duckVM_object_type_list)
+		                 && (object1.value.list == dl_null)))) {
+			object2.value.vector.internal_vector->value.internal_vector.length = object2.value.vector.offset;
+		}
+		else {
+			e = dl_error_invalidValue;
+			break;
+		}
+		e = stack_push(duckVM, &object2);
+		break;
+
+		// I probably don't need an `if` if I research the standard a bit.
+	case duckLisp_instruction_nullp32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through */
+	case duckLisp_instruction_nullp16:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through */
+	case duckLisp_instruction_nullp8:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		object2.type = duckVM_object_type_bool;
+		if (object1.type == duckVM_object_type_list) {
+			object2.value.boolean = (object1.value.list == dl_null);
+		}
+		else if (object1.type == duckVM_object_type_vector) {
+			object2.value.boolean = !((object1.value.vector.internal_vector != dl_null)
+			                          && ((dl_size_t) object1.value.vector.offset
+			                              < object1.value.vector.internal_vector->value.internal_vector.length));
+		}
+		else if (object1.type == duckVM_object_type_string) {
+			object2.value.boolean = !((object1.value.string.internalString != dl_null)
+			                          && ((dl_size_t) object1.value.string.offset < object1.value.string.length));
+		}
+		else {
+			object2.value.boolean = dl_false;
+		}
+		e = stack_push(duckVM, &object2);
+		if (e) break;
+		break;
+
+	case duckLisp_instruction_typeof32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_typeof16:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_typeof8:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		object2.type = duckVM_object_type_type;
+		if (object1.type == duckVM_object_type_composite) {
+			object2.value.type = object1.value.composite->value.internalComposite.type;
+		}
+		else if (object1.type == duckVM_object_type_record) {
+			object2.value.type = object1.value.record->value.internalRecord.type;
+		}
+		else {
+			object2.value.type = object1.type;
+		}
+		e = stack_push(duckVM, &object2);
+		if (e) break;
+		break;
+
+	case duckLisp_instruction_makeType:
+		object1.type = duckVM_object_type_type;
+		object1.value.type = duckVM->nextUserType++;
+		e = stack_push(duckVM, &object1);
+		if (e) break;
+		break;
+
+	case duckLisp_instruction_makeInstance32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through */
+	case duckLisp_instruction_makeInstance16:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through */
+	case duckLisp_instruction_makeInstance8:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+
+		ptrdiff2 = *(ip++);
+		switch (opcode) {
+		case duckLisp_instruction_makeInstance32:
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			/* Fall through */
+		case duckLisp_instruction_makeInstance16:
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			/* Fall through */
+		case duckLisp_instruction_makeInstance8:
+			break;
+		default:
+			e = dl_error_invalidValue;
+			break;
+		}
+		if (e) break;
+
+		ptrdiff3 = *(ip++);
+		switch (opcode) {
+		case duckLisp_instruction_makeInstance32:
+			ptrdiff3 = *(ip++) + (ptrdiff3 << 8);
+			ptrdiff3 = *(ip++) + (ptrdiff3 << 8);
+			/* Fall through */
+		case duckLisp_instruction_makeInstance16:
+			ptrdiff3 = *(ip++) + (ptrdiff3 << 8);
+			/* Fall through */
+		case duckLisp_instruction_makeInstance8:
+			break;
+		default:
+			e = dl_error_invalidValue;
+			break;
+		}
 		if (e) break;
-		break;
 
-	case duckLisp_instruction_funcall32:
-		ptrdiff1 = *(ip++);
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through */
-	case duckLisp_instruction_funcall16:
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through */
-	case duckLisp_instruction_funcall8:
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		uint8 = *(ip++);
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
-		if (e) break;
-		e = duckVM_instruction_prepareForFuncall(duckVM, &object1, uint8);
+		ptrdiff1 = duckVM->stack.elements_length - ptrdiff1;
+		if ((ptrdiff1 < 0) || ((dl_size_t) ptrdiff1 > duckVM->stack.elements_length)) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->make-instance: Index out of bounds."));
+			if (!e) e = eError;
+			break;
+		}
+		e = dl_array_get(&duckVM->stack, &object1, ptrdiff1);
 		if (e) break;
-		if (object1.type == duckVM_object_type_function) {
-			e = object1.value.function.callback(duckVM);
-			if (e) {
-				eError = duckVM_error_pushRuntime(duckVM,
-				                                  DL_STR("duckVM_execute->funcall: C callback returned error."));
-				if (!e) e = eError;
-				break;
-			}
+		if (object1.type != duckVM_object_type_type) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->make-instance: `type` argument must have type `type`."));
+			if (!e) e = eError;
 			break;
 		}
-		else if (object1.type != duckVM_object_type_closure) {
+		if (object1.value.type < duckVM_object_type_last) {
 			e = dl_error_invalidValue;
 			eError = duckVM_error_pushRuntime(duckVM,
-			                                  DL_STR("duckVM_execute->funcall: Object is not a callback or closure."));
+			                                  DL_STR("duckVM_execute->make-instance: Invalid instance type."));
 			if (!e) e = eError;
 			break;
 		}
-		/* Call. */
-		e = call_stack_push(duckVM, ip, bytecode, &object1.value.closure.upvalue_array->value.upvalue_array);
-		if (e) break;
-		bytecode = object1.value.closure.bytecode;
-		ip = &bytecode->value.bytecode.bytecode[object1.value.closure.name];
-		break;
 
-	case duckLisp_instruction_apply32:
-		ptrdiff1 = *(ip++);
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through */
-	case duckLisp_instruction_apply16:
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through */
-	case duckLisp_instruction_apply8:
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		uint8 = *(ip++);
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
-		if (e) break;
-		while (object1.type == duckVM_object_type_composite) {
-			object1 = *object1.value.composite->value.internalComposite.function;
-		}
-		if (object1.type != duckVM_object_type_closure) {
+		ptrdiff2 = duckVM->stack.elements_length - ptrdiff2;
+		if ((ptrdiff2 < 0) || ((dl_size_t) ptrdiff2 > duckVM->stack.elements_length)) {
 			e = dl_error_invalidValue;
-			eError = duckVM_error_pushRuntime(duckVM,
-			                                  DL_STR("duckVM_execute->apply: Applied object is not a closure."));
-			if (eError) e = eError;
+			eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->make-instance: Index out of bounds."));
+			if (!e) e = eError;
 			break;
 		}
-		duckVM_object_t rest;
-		e = stack_pop(duckVM, &rest);
+		e = dl_array_get(&duckVM->stack, &object2, ptrdiff2);
 		if (e) break;
-		if (rest.type != duckVM_object_type_list) {
-			e = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->apply: Last argument is not a list."));
+
+		ptrdiff3 = duckVM->stack.elements_length - ptrdiff3;
+		if ((ptrdiff3 < 0) || ((dl_size_t) ptrdiff3 > duckVM->stack.elements_length)) {
 			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->make-instance: Index out of bounds."));
+			if (!e) e = eError;
 			break;
 		}
-		while ((uint8 < object1.value.closure.arity) && (rest.value.list != dl_null)) {
-			if (rest.value.list->type != duckVM_object_type_cons) {
-				e = dl_error_invalidValue;
-				eError = duckVM_error_pushRuntime(duckVM,
-				                                  DL_STR("duckVM_execute->apply: Object pointed to by list root is not a list."));
-				if (eError) e = eError;
-				break;
-			}
-			/* (push (car rest) stack) */
-			{
-				duckVM_object_t *car = rest.value.list->value.cons.car;
-				if ((car == dl_null) || (car->type == duckVM_object_type_cons)) {
-					duckVM_object_t list = duckVM_object_makeList(car);
-					e = stack_push(duckVM, &list);
-				}
-				else {
-					e = stack_push(duckVM, car);
-				}
-				if (e) break;
-			}
-			/* (setf rest (cdr rest)) */
-			rest.value.list = rest.value.list->value.cons.cdr;
-			uint8++;
-		}
+		e = dl_array_get(&duckVM->stack, &object3, ptrdiff3);
 		if (e) break;
-		if (object1.value.closure.variadic) {
-			if (uint8 < object1.value.closure.arity) {
-				e = dl_error_invalidValue;
-				break;
-			}
-			/* Create list. */
-			/* The original version of this did something really dirty though it didn't look like it. It popped
-			   multiple objects off the stack, then allocated a bunch more on the heap. This is fine 99.999% of the
-			   time, but since the stack is the root the garbage collector uses to trace memory, it was possible to
-			   trigger collection of the object (and possibly all its children) during one of those allocations.
-			   Moral of the story: Never perform an allocation if you have an allocated object disconnected from the
-			   stack. */
-			/* First push the new object on the stack to register it with the collector. */
-			object2.value.list = rest.value.list;
-			object2.type = duckVM_object_type_list;
-			e = stack_push(duckVM, &object2);
-			if (e) break;
-			object3.value.list = dl_null;
-			object3.type = duckVM_object_type_list;
-			e = stack_push(duckVM, &object3);
+
+		{
+			/* Allocate internal composite. */
+			dl_size_t type = object1.value.type;
+			object1.type = duckVM_object_type_internalComposite;
+			/* Type. */
+			object1.value.internalComposite.type = type;
+			object1.value.internalComposite.value = dl_null;
+			object1.value.internalComposite.function = dl_null;
+			e = duckVM_gclist_pushObject(duckVM, &objectPtr1, object1);
 			if (e) break;
-			dl_size_t args_length = (uint8 - object1.value.closure.arity);
-			duckVM_object_t *lastConsPtr = rest.value.list;
-			DL_DOTIMES(k, args_length) {
-				duckVM_object_t cons;
-				duckVM_object_t *consPtr = dl_null;
-				duckVM_object_t object;
-				duckVM_object_t *objectPtr = dl_null;
-				/* Reverse order, because lisp lists are backwards. */
-				object = DL_ARRAY_GETADDRESS(duckVM->stack,
-				                             duckVM_object_t,
-				                             duckVM->stack.elements_length - 3 - k);
-				e = duckVM_gclist_pushObject(duckVM, &objectPtr, object);
-				if (e) break;
-				cons.type = duckVM_object_type_cons;
-				cons.value.cons.car = objectPtr;
-				cons.value.cons.cdr = lastConsPtr;
-				/* Make visible to collector before allocating another. */
-				DL_ARRAY_GETADDRESS(duckVM->stack,
-				                    duckVM_object_t,
-				                    duckVM->stack.elements_length - 1).value.list = objectPtr;
-				e = duckVM_gclist_pushObject(duckVM, &consPtr, cons);
-				if (e) break;
-				/* Make visible to collector before allocating another. The object just created is linked in the
-				   cons. */
-				DL_ARRAY_GETADDRESS(duckVM->stack,
-				                    duckVM_object_t,
-				                    duckVM->stack.elements_length - 2).value.list = consPtr;
-				lastConsPtr = consPtr;
-			}
+			/* Link composite and internal composite to the stack. */
+			object1.type = duckVM_object_type_composite;
+			object1.value.composite = objectPtr1;
+			e = stack_push(duckVM, &object1);
 			if (e) break;
-			/* Pop the temporary object. */
-			e = stack_pop(duckVM, dl_null);
+			/* Value. */
+			e = duckVM_gclist_pushObject(duckVM, &objectPtr1, object2);
 			if (e) break;
-			/* Copy the list to the proper position. */
-			object2.value.list = lastConsPtr;
-			DL_ARRAY_GETADDRESS(duckVM->stack,
-			                    duckVM_object_t,
-			                    (duckVM->stack.elements_length - 1 - args_length)) = object2;
-			/* Pop all objects other than the list. */
-			e = stack_pop_multiple(duckVM, args_length);
+			(DL_ARRAY_GETTOPADDRESS(duckVM->stack, duckVM_object_t).value.composite
+			 ->value.internalComposite.value) = objectPtr1;
+			/* Function. */
+			e = duckVM_gclist_pushObject(duckVM, &objectPtr1, object3);
 			if (e) break;
+			(DL_ARRAY_GETTOPADDRESS(duckVM->stack, duckVM_object_t).value.composite
+			 ->value.internalComposite.function) = objectPtr1;
 		}
-		else {
-			if (object1.value.closure.arity != uint8) {
-				e = dl_error_invalidValue;
-				break;
-			}
-		}
-		/* Call. */
-		e = call_stack_push(duckVM, ip, bytecode, &object1.value.closure.upvalue_array->value.upvalue_array);
-		if (e) break;
-		bytecode = object1.value.closure.bytecode;
-		ip = &bytecode->value.bytecode.bytecode[object1.value.closure.name];
 		break;
 
-		/* I probably don't need an `if` if I research the standard a bit. */
-	case duckLisp_instruction_call32:
+	case duckLisp_instruction_compositeValue32:
 		ptrdiff1 = *(ip++);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through */
-	case duckLisp_instruction_call16:
+		/* Fall through. */
+	case duckLisp_instruction_compositeValue16:
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through */
-	case duckLisp_instruction_call8:
+		/* Fall through. */
+	case duckLisp_instruction_compositeValue8:
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		ptrdiff2 = *(ip++);
-		call_stack_push(duckVM, ip, bytecode, dl_null);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
 		if (e) break;
-		if (opcode == duckLisp_instruction_call32) {
-			if (ptrdiff1 & 0x80000000ULL) {
-				ip -= ((~ptrdiff1 + 1) & 0xFFFFFFFFULL);
-			}
-			else {
-				ip += ptrdiff1;
-			}
-		}
-		else if (opcode == duckLisp_instruction_call16) {
-			if (ptrdiff1 & 0x8000ULL) {
-				ip -= ((~ptrdiff1 + 1) & 0xFFFFULL);
-			}
-			else {
-				ip += ptrdiff1;
-			}
-		}
-		else {
-			if (ptrdiff1 & 0x80ULL) {
-				ip -= ((~ptrdiff1 + 1) & 0xFFULL);
-			}
-			else {
-				ip += ptrdiff1;
-			}
-		}
-		--ip;
-		break;
-
-	case duckLisp_instruction_ccall32:
-		ptrdiff1 = *(ip++);
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through */
-	case duckLisp_instruction_ccall16:
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through */
-	case duckLisp_instruction_ccall8:
-		// I should probably delete this and have `funcall` handle callbacks.
-		{
-			duckVM_object_t *global;
-			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-			e = duckVM_global_get(duckVM, &global, ptrdiff1);
-			if (e) {
-				eError = duckVM_error_pushRuntime(duckVM,
-				                                  DL_STR("duckVM_execute->c-call: Could not find global callback."));
-				if (!e) e = eError;
-				break;
-			}
-			e = global->value.function.callback(duckVM);
-			if (e) {
-				eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->c-call: C callback returned error."));
-				if (!e) e = eError;
-				break;
-			}
+		if (object1.type != duckVM_object_type_composite) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->composite-value: Argument must be a composite type."));
+			if (!e) e = eError;
+			break;
 		}
+		e = stack_push(duckVM, object1.value.composite->value.internalComposite.value);
+		if (e) break;
 		break;
 
-		// I probably don't need an `if` if I research the standard a bit.
-	case duckLisp_instruction_jump32:
+	case duckLisp_instruction_compositeFunction32:
 		ptrdiff1 = *(ip++);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_compositeFunction16:
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_compositeFunction8:
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		if (ptrdiff1 & 0x80000000ULL) {
-			ip -= ((~ptrdiff1 + 1) & 0xFFFFFFFFULL);
-		}
-		else {
-			ip += ptrdiff1;
-		}
-		break;
-	case duckLisp_instruction_jump16:
-		ptrdiff1 = *(ip++);
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		if (ptrdiff1 & 0x8000ULL) {
-			ip -= ((~ptrdiff1 + 1) & 0xFFFFULL);
-		}
-		else {
-			ip += ptrdiff1;
-		}
-		break;
-	case duckLisp_instruction_jump8:
-		ptrdiff1 = *(ip++);
-		if (ptrdiff1 & 0x80ULL) {
-			ip -= ((~ptrdiff1 + 1) & 0xFFULL);
-		}
-		else {
-			ip += ptrdiff1;
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		if (object1.type != duckVM_object_type_composite) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->composite-function: Argument must be a composite type."));
+			if (!e) e = eError;
+			break;
 		}
+		e = stack_push(duckVM, object1.value.composite->value.internalComposite.function);
+		if (e) break;
 		break;
 
-		// I probably don't need an `if` if I research the standard a bit.
-	case duckLisp_instruction_brnz32:
+	case duckLisp_instruction_setCompositeValue32:
 		ptrdiff1 = *(ip++);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff2 = *(ip++);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
 		parsedBytecode = dl_true;
 		/* Fall through */
-	case duckLisp_instruction_brnz16:
+	case duckLisp_instruction_setCompositeValue16:
 		if (!parsedBytecode) {
 			ptrdiff1 = *(ip++);
 			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			ptrdiff2 = *(ip++);
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
 			parsedBytecode = dl_true;
 		}
 		/* Fall through */
-	case duckLisp_instruction_brnz8:
+	case duckLisp_instruction_setCompositeValue8:
 		if (!parsedBytecode) {
 			ptrdiff1 = *(ip++);
+			ptrdiff2 = *(ip++);
 		}
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - 1);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
 		if (e) break;
-		ptrdiff2 = *(ip++);
-		e = stack_pop_multiple(duckVM, ptrdiff2);
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
 		if (e) break;
-		{
-			dl_bool_t truthy = dl_false;
-			if (object1.type == duckVM_object_type_bool) {
-				truthy = object1.value.boolean;
-			}
-			else if (object1.type == duckVM_object_type_integer) {
-				truthy = object1.value.integer != 0;
-			}
-			else if (object1.type == duckVM_object_type_float) {
-				truthy = object1.value.floatingPoint != 0.0;
-			}
-			else if (object1.type == duckVM_object_type_symbol) {
-				truthy = dl_true;
-			}
-			else if (object1.type == duckVM_object_type_list) {
-				truthy = object1.value.list != dl_null;
-			}
-			else if (object1.type == duckVM_object_type_closure) {
-				truthy = dl_true;
-			}
-			else if (object1.type == duckVM_object_type_function) {
-				truthy = dl_true;
-			}
-			else if (object1.type == duckVM_object_type_string) {
-				truthy = dl_true;
-			}
-			else if (object1.type == duckVM_object_type_vector) {
-				truthy = ((object1.value.vector.internal_vector != dl_null)
-				          && ((dl_size_t) object1.value.vector.offset
-				              < object1.value.vector.internal_vector->value.internal_vector.length));
-			}
-			if (truthy) {
-				if ((opcode == duckLisp_instruction_brnz8) && (ptrdiff1 & 0x80ULL)) {
-					ip -= ((~ptrdiff1 + 1) & 0xFFULL);
-				}
-				else if ((opcode == duckLisp_instruction_brnz16) && (ptrdiff1 & 0x8000ULL)) {
-					ip -= ((~ptrdiff1 + 1) & 0xFFFFULL);
-				}
-				else if ((opcode == duckLisp_instruction_brnz32) && (ptrdiff1 & 0x80000000ULL)) {
-					ip -= ((~ptrdiff1 + 1) & 0xFFFFFFFFULL);
-				}
-				else {
-					ip += ptrdiff1;
-				}
-				--ip; /* This accounts for the pop argument. */
-			}
-		}
-		break;
 
-		// I probably don't need an `if` if I research the standard a bit.
-	case duckLisp_instruction_pop32:
-		ptrdiff1 = *(ip++);
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		// Fall through
-	case duckLisp_instruction_pop16:
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		// Fall through
-	case duckLisp_instruction_pop8:
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		e = stack_pop_multiple(duckVM, ptrdiff1);
+		if (object1.type != duckVM_object_type_composite) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->set-composite-value: First argument must be a composite type."));
+			if (!e) e = eError;
+			break;
+		}
+		e = duckVM_gclist_pushObject(duckVM, &objectPtr1, object2);
+		if (e) break;
+		object1.value.composite->value.internalComposite.value = objectPtr1;
+		e = stack_push(duckVM, &object1);
 		break;
 
-		// I probably don't need an `if` if I research the standard a bit.
-	case duckLisp_instruction_move32:
+	case duckLisp_instruction_setCompositeFunction32:
 		ptrdiff1 = *(ip++);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
@@ -1737,8 +7036,8 @@ int duckVM_executeInstruction(duckVM_t *duckVM,
 		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
 		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
 		parsedBytecode = dl_true;
-		// Fall through
-	case duckLisp_instruction_move16:
+		/* Fall through */
+	case duckLisp_instruction_setCompositeFunction16:
 		if (!parsedBytecode) {
 			ptrdiff1 = *(ip++);
 			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
@@ -1746,279 +7045,198 @@ int duckVM_executeInstruction(duckVM_t *duckVM,
 			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
 			parsedBytecode = dl_true;
 		}
-		// Fall through
-	case duckLisp_instruction_move8:
+		/* Fall through */
+	case duckLisp_instruction_setCompositeFunction8:
 		if (!parsedBytecode) {
 			ptrdiff1 = *(ip++);
 			ptrdiff2 = *(ip++);
 		}
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
 		if (e) break;
-		object2 = object1;
-		e = dl_array_set(&duckVM->stack, &object2, duckVM->stack.elements_length - ptrdiff2);
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
 		if (e) break;
-		break;
 
-		// I probably don't need an `if` if I research the standard a bit.
-	case duckLisp_instruction_not32:
-		ptrdiff1 = *(ip++);
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through */
-	case duckLisp_instruction_not16:
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through */
-	case duckLisp_instruction_not8:
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
-		if (e) break;
-		switch (object1.type) {
-		case duckVM_object_type_vector:
-			object1.type = duckVM_object_type_bool;
-			object1.value.boolean = object1.value.vector.internal_vector == dl_null;
-			break;
-		case duckVM_object_type_list:
-			object1.type = duckVM_object_type_bool;
-			object1.value.boolean = object1.value.list == dl_null;
-			break;
-		case duckVM_object_type_integer:
-			object1.value.integer = !object1.value.integer;
-			break;
-		case duckVM_object_type_float:
-			object1.value.floatingPoint = !object1.value.floatingPoint;
-			break;
-		case duckVM_object_type_bool:
-			object1.value.boolean = !object1.value.boolean;
-			break;
-		default:
+		if (object1.type != duckVM_object_type_composite) {
 			e = dl_error_invalidValue;
 			eError = duckVM_error_pushRuntime(duckVM,
-			                                  DL_STR("duckVM_execute->not: Object is not a boolean, integer, float, list, or vector."));
+			                                  DL_STR("duckVM_execute->set-composite-function: First argument must be a composite type."));
 			if (!e) e = eError;
-			goto cleanup;
+			break;
 		}
+		e = duckVM_gclist_pushObject(duckVM, &objectPtr1, object2);
+		if (e) break;
+		object1.value.composite->value.internalComposite.function = objectPtr1;
 		e = stack_push(duckVM, &object1);
 		break;
 
-		// I probably don't need an `if` if I research the standard a bit.
-	case duckLisp_instruction_mul32:
+	case duckLisp_instruction_length32:
 		ptrdiff1 = *(ip++);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_length16:
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_length8:
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		ptrdiff2 = *(ip++);
-		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
-		if (e) break;
-		e = dl_array_get(&duckVM->stack, &object2, duckVM->stack.elements_length - ptrdiff2);
-		if (e) break;
-		switch (object1.type) {
-		case duckVM_object_type_float:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.floatingPoint *= object2.value.floatingPoint;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.floatingPoint *= object2.value.integer;
-				object1.type = duckVM_object_type_float;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.floatingPoint *= object2.value.boolean;
-				object1.type = duckVM_object_type_float;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
+		{
+			e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+			if (e) break;
+			object2.type = duckVM_object_type_integer;
+			if (object1.type == duckVM_object_type_list) {
+				if (!duckVM_list_length(object1.value.list, &size1)) {
+					e = dl_error_invalidValue;
+					eError = duckVM_error_pushRuntime(duckVM,
+					                                  DL_STR("duckVM_execute->length: List must not be circular."));
+					if (!e) e = eError;
+					break;
+				}
+				object2.value.integer = size1;
 			}
-			break;
-		case duckVM_object_type_integer:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.floatingPoint = object1.value.integer * object2.value.floatingPoint;
-				object1.type = duckVM_object_type_float;
-				break;
-			case duckVM_object_type_integer:
-				/* Type already set. */
-				object1.value.integer *= object2.value.integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.integer *= object2.value.boolean;
-				object1.type = duckVM_object_type_integer;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
+			else if (object1.type == duckVM_object_type_vector) {
+				object2.value.integer = duckVM_vector_length(&object1);
 			}
-			break;
-		case duckVM_object_type_bool:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.floatingPoint = object1.value.boolean * object2.value.floatingPoint;
-				object1.type = duckVM_object_type_float;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.integer = object1.value.boolean * object2.value.integer;
-				object1.type = duckVM_object_type_integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.boolean *= object2.value.boolean;
-				break;
-			default:
+			else if (object1.type == duckVM_object_type_string) {
+				object2.value.integer = object1.value.string.length - object1.value.string.offset;
+			}
+			else if (object1.type == duckVM_object_type_hashTable) {
+				object2.value.integer = object1.value.hashTable->value.internalHashTable.length;
+			}
+			else if (object1.type == duckVM_object_type_stringBuilder) {
+				object2.value.integer = object1.value.stringBuilder->value.internalString.value_length;
+			}
+			else if (object1.type == duckVM_object_type_typedArray) {
+				object2.value.integer = object1.value.typedArray->value.internalTypedArray.length;
+			}
+			else {
 				e = dl_error_invalidValue;
-				goto cleanup;
+				(eError
+				 = duckVM_error_pushRuntime(duckVM,
+				                            DL_STR("duckVM_execute->length: Argument must be a list, vector, string, string builder, hash table, or typed array.")));
+				if (eError) e = eError;
+				break;
 			}
-			break;
-		default:
+			e = stack_push(duckVM, &object2);
+			if (e) break;
+		}
+		break;
+
+	case duckLisp_instruction_symbolString32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_symbolString16:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_symbolString8:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		if (object1.type != duckVM_object_type_symbol) {
 			e = dl_error_invalidValue;
-			goto cleanup;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->symbol-string: Argument must be a symbol."));
+			if (eError) e = eError;
+			break;
 		}
-		e = stack_push(duckVM, &object1);
+		object2.type = duckVM_object_type_string;
+		object2.value.string.internalString = object1.value.symbol.internalString;
+		object2.value.string.offset = 0;
+		object2.value.string.length = object1.value.symbol.internalString->value.internalString.value_length;
+		e = stack_push(duckVM, &object2);
 		if (e) break;
 		break;
-	case duckLisp_instruction_mul16:
+
+	case duckLisp_instruction_symbolId32:
 		ptrdiff1 = *(ip++);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		ptrdiff2 = *(ip++);
-		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
-		if (e) break;
-		e = dl_array_get(&duckVM->stack, &object2, duckVM->stack.elements_length - ptrdiff2);
+		/* Fall through. */
+	case duckLisp_instruction_symbolId16:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_symbolId8:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
 		if (e) break;
-		switch (object1.type) {
-		case duckVM_object_type_float:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.floatingPoint *= object2.value.floatingPoint;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.floatingPoint *= object2.value.integer;
-				object1.type = duckVM_object_type_float;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.floatingPoint *= object2.value.boolean;
-				object1.type = duckVM_object_type_float;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
-			}
-			break;
-		case duckVM_object_type_integer:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.floatingPoint = object1.value.integer * object2.value.floatingPoint;
-				object1.type = duckVM_object_type_float;
-				break;
-			case duckVM_object_type_integer:
-				/* Type already set. */
-				object1.value.integer *= object2.value.integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.integer *= object2.value.boolean;
-				object1.type = duckVM_object_type_integer;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
-			}
-			break;
-		case duckVM_object_type_bool:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.floatingPoint = object1.value.boolean * object2.value.floatingPoint;
-				object1.type = duckVM_object_type_float;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.integer = object1.value.boolean * object2.value.integer;
-				object1.type = duckVM_object_type_integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.boolean *= object2.value.boolean;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
-			}
-			break;
-		default:
+		if (object1.type != duckVM_object_type_symbol) {
 			e = dl_error_invalidValue;
-			goto cleanup;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->symbol-id: Argument must be a symbol."));
+			if (eError) e = eError;
+			break;
 		}
-		e = stack_push(duckVM, &object1);
+		object2.type = duckVM_object_type_integer;
+		object2.value.integer = object1.value.symbol.id;
+		e = stack_push(duckVM, &object2);
+		if (e) break;
 		break;
-	case duckLisp_instruction_mul8:
+
+	case duckLisp_instruction_makeCoroutine32:
 		ptrdiff1 = *(ip++);
-		ptrdiff2 = *(ip++);
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
-		if (e) break;
-		e = dl_array_get(&duckVM->stack, &object2, duckVM->stack.elements_length - ptrdiff2);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_makeCoroutine16:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_makeCoroutine8:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
 		if (e) break;
-		switch (object1.type) {
-		case duckVM_object_type_float:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.floatingPoint *= object2.value.floatingPoint;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.floatingPoint *= object2.value.integer;
-				object1.type = duckVM_object_type_float;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.floatingPoint *= object2.value.boolean;
-				object1.type = duckVM_object_type_float;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
-			}
-			break;
-		case duckVM_object_type_integer:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.floatingPoint = object1.value.integer * object2.value.floatingPoint;
-				object1.type = duckVM_object_type_float;
-				break;
-			case duckVM_object_type_integer:
-				/* Type already set. */
-				object1.value.integer *= object2.value.integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.integer *= object2.value.boolean;
-				object1.type = duckVM_object_type_integer;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
-			}
+		if ((object1.type != duckVM_object_type_closure) && (object1.type != duckVM_object_type_composite)) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->make-coroutine: Argument must be a function."));
+			if (eError) e = eError;
 			break;
-		case duckVM_object_type_bool:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.floatingPoint = object1.value.boolean * object2.value.floatingPoint;
-				object1.type = duckVM_object_type_float;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.integer = object1.value.boolean * object2.value.integer;
-				object1.type = duckVM_object_type_integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.boolean *= object2.value.boolean;
+		}
+		{
+			duckVM_coroutineContext_t *context = dl_null;
+			e = DL_MALLOC(duckVM->memoryAllocation, &context, 1, duckVM_coroutineContext_t);
+			if (e) break;
+			/**/ dl_array_init(&context->stack,
+			                   duckVM->memoryAllocation,
+			                   sizeof(duckVM_object_t),
+			                   dl_array_strategy_double);
+			/**/ dl_array_init(&context->call_stack,
+			                   duckVM->memoryAllocation,
+			                   sizeof(duckVM_callFrame_t),
+			                   dl_array_strategy_double);
+			/**/ dl_array_init(&context->upvalue_stack,
+			                   duckVM->memoryAllocation,
+			                   sizeof(duckVM_object_t *),
+			                   dl_array_strategy_double);
+			/**/ dl_array_init(&context->upvalue_array_call_stack,
+			                   duckVM->memoryAllocation,
+			                   sizeof(duckVM_upvalueArray_t),
+			                   dl_array_strategy_double);
+			context->ip = dl_null;
+			context->bytecode = dl_null;
+			/* Allocate internal coroutine. */
+			object2.type = duckVM_object_type_internalCoroutine;
+			object2.value.internalCoroutine.context = context;
+			object2.value.internalCoroutine.function = dl_null;
+			object2.value.internalCoroutine.resumer = dl_null;
+			object2.value.internalCoroutine.status = duckVM_coroutine_status_fresh;
+			e = duckVM_gclist_pushObject(duckVM, &objectPtr1, object2);
+			if (e) {
+				(void) DL_FREE(duckVM->memoryAllocation, &context);
 				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
 			}
-			break;
-		default:
-			e = dl_error_invalidValue;
-			goto cleanup;
 		}
-		e = stack_push(duckVM, &object1);
+		/* Link coroutine and internal coroutine to the stack. */
+		object2.type = duckVM_object_type_coroutine;
+		object2.value.coroutine = objectPtr1;
+		e = stack_push(duckVM, &object2);
+		if (e) break;
+		/* Function. */
+		e = duckVM_gclist_pushObject(duckVM, &objectPtr1, object1);
+		if (e) break;
+		(DL_ARRAY_GETTOPADDRESS(duckVM->stack, duckVM_object_t).value.coroutine
+		 ->value.internalCoroutine.function) = objectPtr1;
 		break;
 
-		// I probably don't need an `if` if I research the standard a bit.
-	case duckLisp_instruction_div32:
+	case duckLisp_instruction_resume32:
 		ptrdiff1 = *(ip++);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
@@ -2027,215 +7245,280 @@ int duckVM_executeInstruction(duckVM_t *duckVM,
 		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
 		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
 		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
+		parsedBytecode = dl_true;
+		/* Fall through */
+	case duckLisp_instruction_resume16:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			ptrdiff2 = *(ip++);
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			parsedBytecode = dl_true;
+		}
+		/* Fall through */
+	case duckLisp_instruction_resume8:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff2 = *(ip++);
+		}
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
 		if (e) break;
-		e = dl_array_get(&duckVM->stack, &object2, duckVM->stack.elements_length - ptrdiff2);
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
 		if (e) break;
-		switch (object1.type) {
-		case duckVM_object_type_float:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.floatingPoint /= object2.value.floatingPoint;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.floatingPoint /= object2.value.integer;
-				object1.type = duckVM_object_type_float;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.floatingPoint /= object2.value.boolean;
-				object1.type = duckVM_object_type_float;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
-			}
+		if (object1.type != duckVM_object_type_coroutine) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->resume: First argument must be a coroutine."));
+			if (eError) e = eError;
 			break;
-		case duckVM_object_type_integer:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.floatingPoint = object1.value.integer / object2.value.floatingPoint;
-				object1.type = duckVM_object_type_float;
-				break;
-			case duckVM_object_type_integer:
-				/* Type already set. */
-				object1.value.integer /= object2.value.integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.integer /= object2.value.boolean;
-				object1.type = duckVM_object_type_integer;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
-			}
+		}
+		objectPtr1 = object1.value.coroutine;
+		if (objectPtr1->value.internalCoroutine.status == duckVM_coroutine_status_running) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->resume: Coroutine is already running."));
+			if (eError) e = eError;
 			break;
-		case duckVM_object_type_bool:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.floatingPoint = object1.value.boolean / object2.value.floatingPoint;
-				object1.type = duckVM_object_type_float;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.integer = object1.value.boolean / object2.value.integer;
-				object1.type = duckVM_object_type_integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.boolean /= object2.value.boolean;
-				break;
-			default:
+		}
+		if (objectPtr1->value.internalCoroutine.status == duckVM_coroutine_status_done) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->resume: Coroutine has finished."));
+			if (eError) e = eError;
+			break;
+		}
+		bool1 = (objectPtr1->value.internalCoroutine.status == duckVM_coroutine_status_fresh);
+		objectPtr1->value.internalCoroutine.status = duckVM_coroutine_status_running;
+		objectPtr1->value.internalCoroutine.resumer = duckVM->currentCoroutine;
+		duckVM->currentCoroutine = objectPtr1;
+		/**/ duckVM_coroutine_swapContext(duckVM, objectPtr1, &ip, &bytecode);
+		/* The value is either the argument of the coroutine's function or the result of `yield`. */
+		e = stack_push(duckVM, &object2);
+		if (e) break;
+		if (bool1) {
+			/* Start the coroutine by calling its function. There is no frame to return to, so returning from the
+			   function finishes the coroutine. */
+			object1 = *objectPtr1->value.internalCoroutine.function;
+			e = duckVM_instruction_prepareForFuncall(duckVM, &object1, 1);
+			if (e) break;
+			if (object1.type != duckVM_object_type_closure) {
 				e = dl_error_invalidValue;
-				goto cleanup;
+				eError = duckVM_error_pushRuntime(duckVM,
+				                                  DL_STR("duckVM_execute->resume: Coroutine function is not a closure."));
+				if (eError) e = eError;
+				break;
 			}
+			e = dl_array_pushElement(&duckVM->upvalue_array_call_stack,
+			                         &object1.value.closure.upvalue_array->value.upvalue_array);
+			if (e) break;
+			bytecode = object1.value.closure.bytecode;
+			ip = &bytecode->value.bytecode.bytecode[object1.value.closure.name];
+		}
+		break;
+
+	case duckLisp_instruction_yield32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_yield16:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_yield8:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		if (duckVM->currentCoroutine == dl_null) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->yield: Not inside a coroutine."));
+			if (eError) e = eError;
 			break;
-		default:
+		}
+		if (duckVM->currentCoroutine == barrier) {
 			e = dl_error_invalidValue;
-			goto cleanup;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->yield: Can't yield across a C callback."));
+			if (eError) e = eError;
+			break;
 		}
+		e = duckVM_coroutine_leave(duckVM, duckVM_coroutine_status_suspended, &ip, &bytecode);
+		if (e) break;
+		/* The yielded value is the result of `resume`. */
 		e = stack_push(duckVM, &object1);
 		if (e) break;
 		break;
-	case duckLisp_instruction_div16:
+
+	case duckLisp_instruction_coroutineDonep32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_coroutineDonep16:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_coroutineDonep8:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		if (object1.type != duckVM_object_type_coroutine) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->coroutine-done?: Argument must be a coroutine."));
+			if (eError) e = eError;
+			break;
+		}
+		object2.type = duckVM_object_type_bool;
+		object2.value.boolean = (object1.value.coroutine->value.internalCoroutine.status
+		                         == duckVM_coroutine_status_done);
+		e = stack_push(duckVM, &object2);
+		if (e) break;
+		break;
+
+	case duckLisp_instruction_send32:
 		ptrdiff1 = *(ip++);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
 		ptrdiff2 = *(ip++);
 		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		parsedBytecode = dl_true;
+		/* Fall through */
+	case duckLisp_instruction_send16:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			ptrdiff2 = *(ip++);
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			parsedBytecode = dl_true;
+		}
+		/* Fall through */
+	case duckLisp_instruction_send8:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff2 = *(ip++);
+		}
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
 		if (e) break;
-		e = dl_array_get(&duckVM->stack, &object2, duckVM->stack.elements_length - ptrdiff2);
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
 		if (e) break;
-		switch (object1.type) {
-		case duckVM_object_type_float:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.floatingPoint /= object2.value.floatingPoint;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.floatingPoint /= object2.value.integer;
-				object1.type = duckVM_object_type_float;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.floatingPoint /= object2.value.boolean;
-				object1.type = duckVM_object_type_float;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
-			}
-			break;
-		case duckVM_object_type_integer:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.floatingPoint = object1.value.integer / object2.value.floatingPoint;
-				object1.type = duckVM_object_type_float;
-				break;
-			case duckVM_object_type_integer:
-				/* Type already set. */
-				object1.value.integer /= object2.value.integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.integer /= object2.value.boolean;
-				object1.type = duckVM_object_type_integer;
-				break;
-			default:
+		{
+			duckVM_mailbox_t *mailbox = dl_null;
+			e = duckVM_channel_get(duckVM, &object1, &mailbox);
+			if (e) break;
+			e = duckVM_mailbox_send(duckVM, mailbox, &object2);
+			if (e) break;
+		}
+		/* The sent object is the result. */
+		e = stack_push(duckVM, &object2);
+		if (e) break;
+		break;
+
+	case duckLisp_instruction_receive32:
+		ptr1 = ip - 1;
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		parsedBytecode = dl_true;
+		/* Fall through */
+	case duckLisp_instruction_receive16:
+		if (!parsedBytecode) {
+			ptr1 = ip - 1;
+			ptrdiff1 = *(ip++);
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			parsedBytecode = dl_true;
+		}
+		/* Fall through */
+	case duckLisp_instruction_receive8:
+		if (!parsedBytecode) {
+			ptr1 = ip - 1;
+			ptrdiff1 = *(ip++);
+		}
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		{
+			duckVM_mailbox_t *mailbox = dl_null;
+			e = duckVM_channel_get(duckVM, &object1, &mailbox);
+			if (e) break;
+			e = duckVM_mailbox_receive(duckVM, mailbox, &bool1);
+			if (e) break;
+		}
+		if (!bool1) {
+			if (duckVM->callDepth > 0) {
 				e = dl_error_invalidValue;
-				goto cleanup;
-			}
-			break;
-		case duckVM_object_type_bool:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.floatingPoint = object1.value.boolean / object2.value.floatingPoint;
-				object1.type = duckVM_object_type_float;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.integer = object1.value.boolean / object2.value.integer;
-				object1.type = duckVM_object_type_integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.boolean /= object2.value.boolean;
+				eError = duckVM_error_pushRuntime(duckVM,
+				                                  DL_STR("duckVM_execute->receive: Can't wait for a message inside a C callback."));
+				if (eError) e = eError;
 				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
 			}
-			break;
-		default:
-			e = dl_error_invalidValue;
-			goto cleanup;
+			/* Wait by suspending in front of this instruction. It runs again when the VM is resumed. */
+			ip = ptr1;
+			*halt = duckVM_halt_mode_suspend;
 		}
-		e = stack_push(duckVM, &object1);
 		break;
-	case duckLisp_instruction_div8:
+
+	case duckLisp_instruction_tryReceive32:
 		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
 		ptrdiff2 = *(ip++);
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		parsedBytecode = dl_true;
+		/* Fall through */
+	case duckLisp_instruction_tryReceive16:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			ptrdiff2 = *(ip++);
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			parsedBytecode = dl_true;
+		}
+		/* Fall through */
+	case duckLisp_instruction_tryReceive8:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff2 = *(ip++);
+		}
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
 		if (e) break;
-		e = dl_array_get(&duckVM->stack, &object2, duckVM->stack.elements_length - ptrdiff2);
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
 		if (e) break;
-		switch (object1.type) {
-		case duckVM_object_type_float:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.floatingPoint /= object2.value.floatingPoint;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.floatingPoint /= object2.value.integer;
-				object1.type = duckVM_object_type_float;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.floatingPoint /= object2.value.boolean;
-				object1.type = duckVM_object_type_float;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
-			}
-			break;
-		case duckVM_object_type_integer:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.floatingPoint = object1.value.integer / object2.value.floatingPoint;
-				object1.type = duckVM_object_type_float;
-				break;
-			case duckVM_object_type_integer:
-				/* Type already set. */
-				object1.value.integer /= object2.value.integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.integer /= object2.value.boolean;
-				object1.type = duckVM_object_type_integer;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
-			}
-			break;
-		case duckVM_object_type_bool:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.floatingPoint = object1.value.boolean / object2.value.floatingPoint;
-				object1.type = duckVM_object_type_float;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.integer = object1.value.boolean / object2.value.integer;
-				object1.type = duckVM_object_type_integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.boolean /= object2.value.boolean;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
-			}
-			break;
-		default:
-			e = dl_error_invalidValue;
-			goto cleanup;
+		{
+			duckVM_mailbox_t *mailbox = dl_null;
+			e = duckVM_channel_get(duckVM, &object1, &mailbox);
+			if (e) break;
+			e = duckVM_mailbox_receive(duckVM, mailbox, &bool1);
+			if (e) break;
 		}
-		e = stack_push(duckVM, &object1);
+		/* The mailbox was empty. Return the default. */
+		if (!bool1) {
+			e = stack_push(duckVM, &object2);
+			if (e) break;
+		}
+		break;
+
+	case duckLisp_instruction_freeze32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through */
+	case duckLisp_instruction_freeze16:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through */
+	case duckLisp_instruction_freeze8:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		{
+			duckVM_frozen_t *region = dl_null;
+			e = duckVM_frozen_fromObject(duckVM, &object1, &object2, &region);
+			if (e) break;
+		}
+		e = stack_push(duckVM, &object2);
+		if (e) break;
 		break;
 
-	case duckLisp_instruction_add32:
+	case duckLisp_instruction_parallelMap32:
 		ptrdiff1 = *(ip++);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
@@ -2246,7 +7529,7 @@ int duckVM_executeInstruction(duckVM_t *duckVM,
 		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
 		parsedBytecode = dl_true;
 		/* Fall through */
-	case duckLisp_instruction_add16:
+	case duckLisp_instruction_parallelMap16:
 		if (!parsedBytecode) {
 			ptrdiff1 = *(ip++);
 			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
@@ -2255,311 +7538,283 @@ int duckVM_executeInstruction(duckVM_t *duckVM,
 			parsedBytecode = dl_true;
 		}
 		/* Fall through */
-	case duckLisp_instruction_add8:
+	case duckLisp_instruction_parallelMap8:
 		if (!parsedBytecode) {
 			ptrdiff1 = *(ip++);
 			ptrdiff2 = *(ip++);
 		}
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
 		if (e) break;
-		e = dl_array_get(&duckVM->stack, &object2, duckVM->stack.elements_length - ptrdiff2);
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
 		if (e) break;
-		switch (object1.type) {
-		case duckVM_object_type_float:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.floatingPoint += object2.value.floatingPoint;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.floatingPoint += object2.value.integer;
-				object1.type = duckVM_object_type_float;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.floatingPoint += object2.value.boolean;
-				object1.type = duckVM_object_type_float;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				eError = duckVM_error_pushRuntime(duckVM,
-				                                  DL_STR("duckVM_execute->add: Invalid type combination."));
-				if (eError) e = eError;
-				break;
-			}
-			break;
-		case duckVM_object_type_integer:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.floatingPoint = object1.value.integer + object2.value.floatingPoint;
-				object1.type = duckVM_object_type_float;
-				break;
-			case duckVM_object_type_integer:
-				/* Type already set. */
-				object1.value.integer += object2.value.integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.integer += object2.value.boolean;
-				object1.type = duckVM_object_type_integer;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				eError = duckVM_error_pushRuntime(duckVM,
-				                                  DL_STR("duckVM_execute->add: Invalid type combination."));
-				if (eError) e = eError;
-				break;
-			}
-			break;
-		case duckVM_object_type_bool:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.floatingPoint = object1.value.boolean + object2.value.floatingPoint;
-				object1.type = duckVM_object_type_float;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.integer = object1.value.boolean + object2.value.integer;
-				object1.type = duckVM_object_type_integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.boolean += object2.value.boolean;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				eError = duckVM_error_pushRuntime(duckVM,
-				                                  DL_STR("duckVM_execute->add: Invalid type combination."));
-				if (eError) e = eError;
-				break;
-			}
-			break;
-		default:
+		if (object2.type != duckVM_object_type_vector) {
 			e = dl_error_invalidValue;
 			eError = duckVM_error_pushRuntime(duckVM,
-			                                  DL_STR("duckVM_execute->add: Invalid type combination."));
+			                                  DL_STR("duckVM_execute->parallel-map: Second argument must be a vector."));
 			if (eError) e = eError;
 			break;
 		}
+		/* Work on copies at the top of the stack so that the results can be collected above them. */
+		ptrdiff3 = duckVM->stack.elements_length;
+		e = stack_push(duckVM, &object1);
+		if (e) break;
+		e = stack_push(duckVM, &object2);
+		if (e) break;
+		/* A single element isn't worth the trip to another VM. */
+		if ((duckVM->mapPool != dl_null) && (duckVM_vector_length(&object2) > 1)) {
+			e = duckVM_parallelMap(duckVM, ptrdiff3, ptrdiff3 + 1);
+		}
+		else {
+			e = duckVM_map(duckVM, ptrdiff3, ptrdiff3 + 1);
+		}
+		if (e) break;
+		/* stack: function vector result */
+		e = stack_getTop(duckVM, &object1);
+		if (e) break;
+		e = stack_set(duckVM, &object1, ptrdiff3);
 		if (e) break;
+		e = stack_pop_multiple(duckVM, 2);
+		if (e) break;
+		break;
+
+	case duckLisp_instruction_makeHashTable:
+		object1.type = duckVM_object_type_internalHashTable;
+		object1.value.internalHashTable.entries = dl_null;
+		object1.value.internalHashTable.capacity = 0;
+		object1.value.internalHashTable.used = 0;
+		object1.value.internalHashTable.oldEntries = dl_null;
+		object1.value.internalHashTable.oldCapacity = 0;
+		object1.value.internalHashTable.migrated = 0;
+		object1.value.internalHashTable.length = 0;
+		e = duckVM_gclist_pushObject(duckVM, &objectPtr1, object1);
+		if (e) break;
+		/* Link hash table and internal hash table to the stack. */
+		object1.type = duckVM_object_type_hashTable;
+		object1.value.hashTable = objectPtr1;
 		e = stack_push(duckVM, &object1);
+		if (e) break;
 		break;
 
-		// I probably don't need an `if` if I research the standard a bit.
-	case duckLisp_instruction_sub32:
+	case duckLisp_instruction_hashTableGet32:
 		ptrdiff1 = *(ip++);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through */
+	case duckLisp_instruction_hashTableGet16:
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through */
+	case duckLisp_instruction_hashTableGet8:
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+
 		ptrdiff2 = *(ip++);
-		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
-		if (e) break;
-		e = dl_array_get(&duckVM->stack, &object2, duckVM->stack.elements_length - ptrdiff2);
-		if (e) break;
-		switch (object1.type) {
-		case duckVM_object_type_float:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.floatingPoint -= object2.value.floatingPoint;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.floatingPoint -= object2.value.integer;
-				object1.type = duckVM_object_type_float;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.floatingPoint -= object2.value.boolean;
-				object1.type = duckVM_object_type_float;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
-			}
+		switch (opcode) {
+		case duckLisp_instruction_hashTableGet32:
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			/* Fall through */
+		case duckLisp_instruction_hashTableGet16:
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			/* Fall through */
+		case duckLisp_instruction_hashTableGet8:
 			break;
-		case duckVM_object_type_integer:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.floatingPoint = object1.value.integer - object2.value.floatingPoint;
-				object1.type = duckVM_object_type_float;
-				break;
-			case duckVM_object_type_integer:
-				/* Type already set. */
-				object1.value.integer -= object2.value.integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.integer -= object2.value.boolean;
-				object1.type = duckVM_object_type_integer;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
-			}
+		default:
+			e = dl_error_cantHappen;
 			break;
-		case duckVM_object_type_bool:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.floatingPoint = object1.value.boolean - object2.value.floatingPoint;
-				object1.type = duckVM_object_type_float;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.integer = object1.value.boolean - object2.value.integer;
-				object1.type = duckVM_object_type_integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.boolean -= object2.value.boolean;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
-			}
+		}
+		if (e) break;
+
+		ptrdiff3 = *(ip++);
+		switch (opcode) {
+		case duckLisp_instruction_hashTableGet32:
+			ptrdiff3 = *(ip++) + (ptrdiff3 << 8);
+			ptrdiff3 = *(ip++) + (ptrdiff3 << 8);
+			/* Fall through */
+		case duckLisp_instruction_hashTableGet16:
+			ptrdiff3 = *(ip++) + (ptrdiff3 << 8);
+			/* Fall through */
+		case duckLisp_instruction_hashTableGet8:
 			break;
 		default:
-			e = dl_error_invalidValue;
-			goto cleanup;
+			e = dl_error_cantHappen;
+			break;
 		}
-		e = stack_push(duckVM, &object1);
 		if (e) break;
+
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object3, ptrdiff3);
+		if (e) break;
+		if (object1.type != duckVM_object_type_hashTable) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->hash-table-get: First argument must be a hash table."));
+			if (eError) e = eError;
+			break;
+		}
+		{
+			dl_size_t hash = 0;
+			duckVM_hashTableEntry_t *entry = dl_null;
+			e = duckVM_hashTable_hash(duckVM, &object2, &hash);
+			if (e) break;
+			entry = duckVM_hashTable_find(&object1.value.hashTable->value.internalHashTable, &object2, hash);
+			e = stack_push(duckVM, (entry != dl_null) ? &entry->value : &object3);
+			if (e) break;
+		}
 		break;
-	case duckLisp_instruction_sub16:
+
+	case duckLisp_instruction_hashTableSet32:
 		ptrdiff1 = *(ip++);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through */
+	case duckLisp_instruction_hashTableSet16:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through */
+	case duckLisp_instruction_hashTableSet8:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+
 		ptrdiff2 = *(ip++);
-		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
-		if (e) break;
-		e = dl_array_get(&duckVM->stack, &object2, duckVM->stack.elements_length - ptrdiff2);
-		if (e) break;
-		switch (object1.type) {
-		case duckVM_object_type_float:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.floatingPoint -= object2.value.floatingPoint;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.floatingPoint -= object2.value.integer;
-				object1.type = duckVM_object_type_float;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.floatingPoint -= object2.value.boolean;
-				object1.type = duckVM_object_type_float;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
-			}
+		switch (opcode) {
+		case duckLisp_instruction_hashTableSet32:
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			/* Fall through */
+		case duckLisp_instruction_hashTableSet16:
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			/* Fall through */
+		case duckLisp_instruction_hashTableSet8:
 			break;
-		case duckVM_object_type_integer:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.floatingPoint = object1.value.integer - object2.value.floatingPoint;
-				object1.type = duckVM_object_type_float;
-				break;
-			case duckVM_object_type_integer:
-				/* Type already set. */
-				object1.value.integer -= object2.value.integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.integer -= object2.value.boolean;
-				object1.type = duckVM_object_type_integer;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
-			}
+		default:
+			e = dl_error_cantHappen;
 			break;
-		case duckVM_object_type_bool:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.floatingPoint = object1.value.boolean - object2.value.floatingPoint;
-				object1.type = duckVM_object_type_float;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.integer = object1.value.boolean - object2.value.integer;
-				object1.type = duckVM_object_type_integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.boolean -= object2.value.boolean;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
-			}
+		}
+		if (e) break;
+
+		ptrdiff3 = *(ip++);
+		switch (opcode) {
+		case duckLisp_instruction_hashTableSet32:
+			ptrdiff3 = *(ip++) + (ptrdiff3 << 8);
+			ptrdiff3 = *(ip++) + (ptrdiff3 << 8);
+			/* Fall through */
+		case duckLisp_instruction_hashTableSet16:
+			ptrdiff3 = *(ip++) + (ptrdiff3 << 8);
+			/* Fall through */
+		case duckLisp_instruction_hashTableSet8:
 			break;
 		default:
+			e = dl_error_cantHappen;
+			break;
+		}
+		if (e) break;
+
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object3, ptrdiff3);
+		if (e) break;
+		if (object1.type != duckVM_object_type_hashTable) {
 			e = dl_error_invalidValue;
-			goto cleanup;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->hash-table-set: First argument must be a hash table."));
+			if (eError) e = eError;
+			break;
 		}
-		e = stack_push(duckVM, &object1);
+		e = duckVM_hashTable_set(duckVM, &object1.value.hashTable->value.internalHashTable, &object2, &object3);
+		if (e) break;
+		e = stack_push(duckVM, &object3);
+		if (e) break;
 		break;
-	case duckLisp_instruction_sub8:
+
+	case duckLisp_instruction_hashTableDelete32:
 		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
 		ptrdiff2 = *(ip++);
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		parsedBytecode = dl_true;
+		/* Fall through */
+	case duckLisp_instruction_hashTableDelete16:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			ptrdiff2 = *(ip++);
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			parsedBytecode = dl_true;
+		}
+		/* Fall through */
+	case duckLisp_instruction_hashTableDelete8:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff2 = *(ip++);
+		}
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
 		if (e) break;
-		e = dl_array_get(&duckVM->stack, &object2, duckVM->stack.elements_length - ptrdiff2);
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
 		if (e) break;
-		switch (object1.type) {
-		case duckVM_object_type_float:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.floatingPoint -= object2.value.floatingPoint;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.floatingPoint -= object2.value.integer;
-				object1.type = duckVM_object_type_float;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.floatingPoint -= object2.value.boolean;
-				object1.type = duckVM_object_type_float;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
-			}
-			break;
-		case duckVM_object_type_integer:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.floatingPoint = object1.value.integer - object2.value.floatingPoint;
-				object1.type = duckVM_object_type_float;
-				break;
-			case duckVM_object_type_integer:
-				/* Type already set. */
-				object1.value.integer -= object2.value.integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.integer -= object2.value.boolean;
-				object1.type = duckVM_object_type_integer;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
-			}
-			break;
-		case duckVM_object_type_bool:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.floatingPoint = object1.value.boolean - object2.value.floatingPoint;
-				object1.type = duckVM_object_type_float;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.integer = object1.value.boolean - object2.value.integer;
-				object1.type = duckVM_object_type_integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.boolean -= object2.value.boolean;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
-			}
+		if (object1.type != duckVM_object_type_hashTable) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->hash-table-delete: First argument must be a hash table."));
+			if (eError) e = eError;
 			break;
-		default:
+		}
+		object3.type = duckVM_object_type_bool;
+		e = duckVM_hashTable_delete(duckVM,
+		                            &object1.value.hashTable->value.internalHashTable,
+		                            &object2,
+		                            &object3.value.boolean);
+		if (e) break;
+		e = stack_push(duckVM, &object3);
+		if (e) break;
+		break;
+
+	case duckLisp_instruction_hashTableNext32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff2 = *(ip++);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		parsedBytecode = dl_true;
+		/* Fall through */
+	case duckLisp_instruction_hashTableNext16:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			ptrdiff2 = *(ip++);
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			parsedBytecode = dl_true;
+		}
+		/* Fall through */
+	case duckLisp_instruction_hashTableNext8:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff2 = *(ip++);
+		}
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		if (object1.type != duckVM_object_type_hashTable) {
 			e = dl_error_invalidValue;
-			goto cleanup;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->hash-table-next: First argument must be a hash table."));
+			if (eError) e = eError;
+			break;
 		}
-		e = stack_push(duckVM, &object1);
+		e = duckVM_hashTable_next(duckVM, &object1.value.hashTable->value.internalHashTable, &object2, &object3);
+		if (e) break;
+		e = stack_push(duckVM, &object3);
+		if (e) break;
 		break;
 
-		// I probably don't need an `if` if I research the standard a bit.
-	case duckLisp_instruction_greater32:
+	case duckLisp_instruction_vectorPush32:
 		ptrdiff1 = *(ip++);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
@@ -2568,198 +7823,205 @@ int duckVM_executeInstruction(duckVM_t *duckVM,
 		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
 		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
 		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
+		parsedBytecode = dl_true;
+		/* Fall through */
+	case duckLisp_instruction_vectorPush16:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			ptrdiff2 = *(ip++);
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			parsedBytecode = dl_true;
+		}
+		/* Fall through */
+	case duckLisp_instruction_vectorPush8:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff2 = *(ip++);
+		}
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
 		if (e) break;
-		e = dl_array_get(&duckVM->stack, &object2, duckVM->stack.elements_length - ptrdiff2);
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
 		if (e) break;
-		switch (object1.type) {
-		case duckVM_object_type_float:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.boolean = object1.value.floatingPoint > object2.value.floatingPoint;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.boolean = object1.value.floatingPoint > object2.value.integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.boolean = object1.value.floatingPoint > object2.value.boolean;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
-			}
+		if (object1.type != duckVM_object_type_vector) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->vector-push: First argument must be a vector."));
+			if (eError) e = eError;
 			break;
-		case duckVM_object_type_integer:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.boolean = object1.value.integer > object2.value.floatingPoint;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.boolean = object1.value.integer > object2.value.integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.boolean = object1.value.integer > object2.value.boolean;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
-			}
+		}
+		if (duckVM_object_isFrozen(duckVM, &object1)) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->vector-push: Frozen objects can't be modified."));
+			if (eError) e = eError;
 			break;
-		case duckVM_object_type_bool:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.boolean = object1.value.boolean > object2.value.floatingPoint;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.boolean = object1.value.boolean > object2.value.integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.boolean = object1.value.boolean > object2.value.boolean;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
+		}
+		if (duckVM_vector_isPastEnd(&object1)) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->vector-push: The vector was truncated below the start of this view."));
+			if (eError) e = eError;
+			break;
+		}
+		if (object1.value.vector.internal_vector == dl_null) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->vector-push: The empty `cdr` of a vector can't grow."));
+			if (eError) e = eError;
+			break;
+		}
+		{
+			duckVM_object_t *element = dl_null;
+			duckVM_internalVector_t *internalVector = &object1.value.vector.internal_vector->value.internal_vector;
+			if (internalVector->length == internalVector->capacity) {
+				/* Doubling keeps the total cost of n pushes proportional to n. */
+				size1 = (internalVector->capacity > 0) ? 2 * internalVector->capacity : 4;
+				e = DL_REALLOC(duckVM->memoryAllocation, &internalVector->values, size1, duckVM_object_t *);
+				if (e) {
+					eError = duckVM_error_pushRuntime(duckVM,
+					                                  DL_STR("duckVM_execute->vector-push: Vector allocation failed."));
+					if (eError) e = eError;
+					break;
+				}
+				internalVector->capacity = size1;
 			}
+			/* May collect garbage. The vector is held by the stack, and the new slot isn't traced until `length` is
+			   incremented. */
+			e = duckVM_gclist_pushObject(duckVM, &element, object2);
+			if (e) break;
+			internalVector->values[internalVector->length++] = element;
+		}
+		e = stack_push(duckVM, &object2);
+		if (e) break;
+		break;
+
+	case duckLisp_instruction_vectorPop32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_vectorPop16:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_vectorPop8:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		if (object1.type != duckVM_object_type_vector) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->vector-pop: First argument must be a vector."));
+			if (eError) e = eError;
+			break;
+		}
+		if (duckVM_object_isFrozen(duckVM, &object1)) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->vector-pop: Frozen objects can't be modified."));
+			if (eError) e = eError;
+			break;
+		}
+		if (duckVM_vector_isPastEnd(&object1)) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->vector-pop: The vector was truncated below the start of this view."));
+			if (eError) e = eError;
 			break;
-		default:
+		}
+		if (duckVM_vector_length(&object1) == 0) {
 			e = dl_error_invalidValue;
-			goto cleanup;
+			eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->vector-pop: Vector is empty."));
+			if (eError) e = eError;
+			break;
+		}
+		{
+			duckVM_internalVector_t *internalVector = &object1.value.vector.internal_vector->value.internal_vector;
+			/* Dropping the element from `length` is enough. The collector only traces live elements. */
+			e = stack_push(duckVM, internalVector->values[--internalVector->length]);
+			if (e) break;
 		}
-		object1.type = duckVM_object_type_bool;
-		e = stack_push(duckVM, &object1);
-		if (e) break;
 		break;
-	case duckLisp_instruction_greater16:
+
+	case duckLisp_instruction_vectorTruncate32:
 		ptrdiff1 = *(ip++);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
 		ptrdiff2 = *(ip++);
 		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		parsedBytecode = dl_true;
+		/* Fall through */
+	case duckLisp_instruction_vectorTruncate16:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			ptrdiff2 = *(ip++);
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			parsedBytecode = dl_true;
+		}
+		/* Fall through */
+	case duckLisp_instruction_vectorTruncate8:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff2 = *(ip++);
+		}
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
 		if (e) break;
-		e = dl_array_get(&duckVM->stack, &object2, duckVM->stack.elements_length - ptrdiff2);
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
 		if (e) break;
-		switch (object1.type) {
-		case duckVM_object_type_float:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.boolean = object1.value.floatingPoint > object2.value.floatingPoint;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.boolean = object1.value.floatingPoint > object2.value.integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.boolean = object1.value.floatingPoint > object2.value.boolean;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
-			}
+		if (object1.type != duckVM_object_type_vector) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->vector-truncate: First argument must be a vector."));
+			if (eError) e = eError;
 			break;
-		case duckVM_object_type_integer:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.boolean = object1.value.integer > object2.value.floatingPoint;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.boolean = object1.value.integer > object2.value.integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.boolean = object1.value.integer > object2.value.boolean;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
-			}
+		}
+		if (duckVM_object_isFrozen(duckVM, &object1)) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->vector-truncate: Frozen objects can't be modified."));
+			if (eError) e = eError;
 			break;
-		case duckVM_object_type_bool:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.boolean = object1.value.boolean > object2.value.floatingPoint;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.boolean = object1.value.boolean > object2.value.integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.boolean = object1.value.boolean > object2.value.boolean;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
-			}
+		}
+		if (duckVM_vector_isPastEnd(&object1)) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->vector-truncate: The vector was truncated below the start of this view."));
+			if (eError) e = eError;
 			break;
-		default:
+		}
+		if ((object2.type != duckVM_object_type_integer)
+		    || (object2.value.integer < 0)
+		    || ((dl_size_t) object2.value.integer > duckVM_vector_length(&object1))) {
 			e = dl_error_invalidValue;
-			goto cleanup;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->vector-truncate: Second argument must be an integer between zero and the length of the vector."));
+			if (eError) e = eError;
+			break;
+		}
+		if (object1.value.vector.internal_vector != dl_null) {
+			(object1.value.vector.internal_vector->value.internal_vector.length
+			 = object1.value.vector.offset + object2.value.integer);
 		}
-		object1.type = duckVM_object_type_bool;
 		e = stack_push(duckVM, &object1);
-		break;
-	case duckLisp_instruction_greater8:
-		ptrdiff1 = *(ip++);
-		ptrdiff2 = *(ip++);
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
 		if (e) break;
-		e = dl_array_get(&duckVM->stack, &object2, duckVM->stack.elements_length - ptrdiff2);
+		break;
+
+	case duckLisp_instruction_makeStringBuilder:
+		object1.type = duckVM_object_type_internalString;
+		object1.value.internalString.value = dl_null;
+		object1.value.internalString.value_length = 0;
+		e = duckVM_gclist_pushObject(duckVM, &objectPtr1, object1);
 		if (e) break;
-		switch (object1.type) {
-		case duckVM_object_type_float:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.boolean = object1.value.floatingPoint > object2.value.floatingPoint;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.boolean = object1.value.floatingPoint > object2.value.integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.boolean = object1.value.floatingPoint > object2.value.boolean;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
-			}
-			break;
-		case duckVM_object_type_integer:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.boolean = object1.value.integer > object2.value.floatingPoint;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.boolean = object1.value.integer > object2.value.integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.boolean = object1.value.integer > object2.value.boolean;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
-			}
-			break;
-		case duckVM_object_type_bool:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.boolean = object1.value.boolean > object2.value.floatingPoint;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.boolean = object1.value.boolean > object2.value.integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.boolean = object1.value.boolean > object2.value.boolean;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
-			}
-			break;
-		default:
-			e = dl_error_invalidValue;
-			goto cleanup;
-		}
-		object1.type = duckVM_object_type_bool;
+		object1.type = duckVM_object_type_stringBuilder;
+		object1.value.stringBuilder = objectPtr1;
 		e = stack_push(duckVM, &object1);
+		if (e) break;
 		break;
 
-		// I probably don't need an `if` if I research the standard a bit.
-	case duckLisp_instruction_equal32:
+	case duckLisp_instruction_stringBuilderAppend32:
 		ptrdiff1 = *(ip++);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
@@ -2769,125 +8031,146 @@ int duckVM_executeInstruction(duckVM_t *duckVM,
 		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
 		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
 		parsedBytecode = dl_true;
-		// Fall through
-	case duckLisp_instruction_equal16:
+		/* Fall through */
+	case duckLisp_instruction_stringBuilderAppend16:
 		if (!parsedBytecode) {
 			ptrdiff1 = *(ip++);
 			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
 			ptrdiff2 = *(ip++);
 			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			parsedBytecode = dl_true;
 		}
-		// Fall through
-	case duckLisp_instruction_equal8:
+		/* Fall through */
+	case duckLisp_instruction_stringBuilderAppend8:
 		if (!parsedBytecode) {
 			ptrdiff1 = *(ip++);
 			ptrdiff2 = *(ip++);
 		}
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
 		if (e) break;
-		e = dl_array_get(&duckVM->stack, &object2, duckVM->stack.elements_length - ptrdiff2);
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
 		if (e) break;
-		switch (object1.type) {
-		case duckVM_object_type_list:
-			switch (object2.type) {
-			case duckVM_object_type_list:
-				object1.value.boolean = object1.value.list == object2.value.list;
-				break;
-			default:
-				object1.value.boolean = dl_false;
-			}
+		if (object1.type != duckVM_object_type_stringBuilder) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->string-builder-append: First argument must be a string builder."));
+			if (eError) e = eError;
 			break;
-		case duckVM_object_type_symbol:
-			switch (object2.type) {
-			case duckVM_object_type_symbol:
-				object1.value.boolean = object1.value.symbol.id == object2.value.symbol.id;
-				break;
-			default:
-				object1.value.boolean = dl_false;
-			}
+		}
+		e = duckVM_stringBuilder_append(duckVM, &object1, &object2);
+		if (e) break;
+		e = stack_push(duckVM, &object1);
+		if (e) break;
+		break;
+
+	case duckLisp_instruction_stringSearch32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through */
+	case duckLisp_instruction_stringSearch16:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through */
+	case duckLisp_instruction_stringSearch8:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+
+		ptrdiff2 = *(ip++);
+		switch (opcode) {
+		case duckLisp_instruction_stringSearch32:
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			/* Fall through */
+		case duckLisp_instruction_stringSearch16:
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			/* Fall through */
+		case duckLisp_instruction_stringSearch8:
 			break;
-		case duckVM_object_type_string:
-			switch (object2.type) {
-			case duckVM_object_type_string:
-				if ((object1.value.string.length - object1.value.string.offset == 0)
-				    && (object2.value.string.length - object2.value.string.offset == 0)) {
-					object1.value.boolean = dl_true;
-				}
-				else if ((object1.value.string.length - object1.value.string.offset == 0)
-				         || (object2.value.string.length - object2.value.string.offset == 0)) {
-					object1.value.boolean = dl_false;
-				}
-				else {
-					/**/ dl_string_compare(&bool1,
-					                       (object1.value.string.internalString->value.internalString.value
-					                        + object1.value.string.offset),
-					                       object1.value.string.length - object1.value.string.offset,
-					                       (object2.value.string.internalString->value.internalString.value
-					                        + object2.value.string.offset),
-					                       object2.value.string.length - object2.value.string.offset);
-					object1.value.boolean = bool1;
-				}
-				break;
-			default:
-				object1.value.boolean = dl_false;
-			}
+		default:
+			e = dl_error_cantHappen;
 			break;
-		case duckVM_object_type_float:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.boolean = object1.value.floatingPoint == object2.value.floatingPoint;
-				break;
-			default:
-				object1.value.boolean = dl_false;
-			}
+		}
+		if (e) break;
+
+		ptrdiff3 = *(ip++);
+		switch (opcode) {
+		case duckLisp_instruction_stringSearch32:
+			ptrdiff3 = *(ip++) + (ptrdiff3 << 8);
+			ptrdiff3 = *(ip++) + (ptrdiff3 << 8);
+			/* Fall through */
+		case duckLisp_instruction_stringSearch16:
+			ptrdiff3 = *(ip++) + (ptrdiff3 << 8);
+			/* Fall through */
+		case duckLisp_instruction_stringSearch8:
 			break;
-		case duckVM_object_type_integer:
-			switch (object2.type) {
-			case duckVM_object_type_integer:
-				object1.value.boolean = object1.value.integer == object2.value.integer;
-				break;
-			default:
-				object1.value.boolean = dl_false;
-			}
+		default:
+			e = dl_error_cantHappen;
 			break;
-		case duckVM_object_type_bool:
-			switch (object2.type) {
-			case duckVM_object_type_bool:
-				object1.value.boolean = object1.value.boolean == object2.value.boolean;
+		}
+		if (e) break;
+
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object3, ptrdiff3);
+		if (e) break;
+		{
+			const dl_uint8_t *bytes1 = dl_null;
+			const dl_uint8_t *bytes2 = dl_null;
+			dl_uint8_t byte = 0;
+			if (!duckVM_string_bytes(&object1, &bytes1, &size1)) {
+				e = dl_error_invalidValue;
+				eError = duckVM_error_pushRuntime(duckVM,
+				                                  DL_STR("duckVM_execute->string-search: First argument must be a string."));
+				if (eError) e = eError;
 				break;
-			default:
-				object1.value.boolean = dl_false;
 			}
-			break;
-		case duckVM_object_type_vector:
-			switch (object2.type) {
-			case duckVM_object_type_vector:
-				object1.value.boolean = ((object1.value.vector.internal_vector == object2.value.vector.internal_vector)
-				                         && (object1.value.vector.offset == object2.value.vector.offset));
+			if (object2.type == duckVM_object_type_integer) {
+				/* Searching for a single byte. */
+				if ((object2.value.integer < 0) || (object2.value.integer > 0xFF)) {
+					e = dl_error_invalidValue;
+					eError = duckVM_error_pushRuntime(duckVM,
+					                                  DL_STR("duckVM_execute->string-search: Byte must be between 0 and 255."));
+					if (eError) e = eError;
+					break;
+				}
+				byte = object2.value.integer;
+				bytes2 = &byte;
+				size2 = 1;
+			}
+			else if (!duckVM_string_bytes(&object2, &bytes2, &size2)) {
+				e = dl_error_invalidValue;
+				eError = duckVM_error_pushRuntime(duckVM,
+				                                  DL_STR("duckVM_execute->string-search: Second argument must be a string or an integer."));
+				if (eError) e = eError;
 				break;
-			default:
-				object1.value.boolean = dl_false;
 			}
-			break;
-		case duckVM_object_type_type:
-			switch (object2.type) {
-			case duckVM_object_type_type:
-				object1.value.boolean = (object1.value.type == object2.value.type);
+			if ((object3.type != duckVM_object_type_integer)
+			    || (object3.value.integer < 0)
+			    || ((dl_size_t) object3.value.integer > size1)) {
+				e = dl_error_invalidValue;
+				eError = duckVM_error_pushRuntime(duckVM,
+				                                  DL_STR("duckVM_execute->string-search: Third argument must be an integer between zero and the length of the string."));
+				if (eError) e = eError;
 				break;
-			default:
-				object1.value.boolean = dl_false;
 			}
-			break;
-		default:
-			e = dl_error_invalidValue;
-			goto cleanup;
+			ptrdiff1 = dl_string_find(bytes1 + object3.value.integer,
+			                          size1 - object3.value.integer,
+			                          bytes2,
+			                          size2);
+			if (ptrdiff1 < 0) {
+				object1.type = duckVM_object_type_list;
+				object1.value.list = dl_null;
+			}
+			else {
+				object1.type = duckVM_object_type_integer;
+				object1.value.integer = object3.value.integer + ptrdiff1;
+			}
 		}
-		object1.type = duckVM_object_type_bool;
 		e = stack_push(duckVM, &object1);
+		if (e) break;
 		break;
 
-		// I probably don't need an `if` if I research the standard a bit.
-	case duckLisp_instruction_less32:
+	case duckLisp_instruction_stringCompare32:
 		ptrdiff1 = *(ip++);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
@@ -2896,198 +8179,329 @@ int duckVM_executeInstruction(duckVM_t *duckVM,
 		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
 		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
 		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
+		parsedBytecode = dl_true;
+		/* Fall through */
+	case duckLisp_instruction_stringCompare16:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			ptrdiff2 = *(ip++);
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			parsedBytecode = dl_true;
+		}
+		/* Fall through */
+	case duckLisp_instruction_stringCompare8:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff2 = *(ip++);
+		}
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
 		if (e) break;
-		e = dl_array_get(&duckVM->stack, &object2, duckVM->stack.elements_length - ptrdiff2);
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
 		if (e) break;
-		switch (object1.type) {
-		case duckVM_object_type_float:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.boolean = object1.value.floatingPoint < object2.value.floatingPoint;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.boolean = object1.value.floatingPoint < object2.value.integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.boolean = object1.value.floatingPoint < object2.value.boolean;
-				break;
-			default:
+		{
+			const dl_uint8_t *bytes1 = dl_null;
+			const dl_uint8_t *bytes2 = dl_null;
+			int order = 0;
+			if (!duckVM_string_bytes(&object1, &bytes1, &size1)) {
 				e = dl_error_invalidValue;
-				goto cleanup;
-			}
-			break;
-		case duckVM_object_type_integer:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.boolean = object1.value.integer < object2.value.floatingPoint;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.boolean = object1.value.integer < object2.value.integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.boolean = object1.value.integer < object2.value.boolean;
+				eError = duckVM_error_pushRuntime(duckVM,
+				                                  DL_STR("duckVM_execute->string-compare: First argument must be a string."));
+				if (eError) e = eError;
 				break;
-			default:
+			}
+			if (!duckVM_string_bytes(&object2, &bytes2, &size2)) {
 				e = dl_error_invalidValue;
-				goto cleanup;
+				eError = duckVM_error_pushRuntime(duckVM,
+				                                  DL_STR("duckVM_execute->string-compare: Second argument must be a string."));
+				if (eError) e = eError;
+				break;
 			}
-			break;
-		case duckVM_object_type_bool:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.boolean = object1.value.boolean < object2.value.floatingPoint;
+			/* A string that is a prefix of the other comes first. */
+			order = dl_memorder(bytes1, bytes2, dl_min(size1, size2));
+			if (order == 0) order = (size1 > size2) - (size1 < size2);
+			object3.type = duckVM_object_type_integer;
+			object3.value.integer = (order > 0) - (order < 0);
+		}
+		e = stack_push(duckVM, &object3);
+		if (e) break;
+		break;
+
+	case duckLisp_instruction_utf8Validp32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_utf8Validp16:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_utf8Validp8:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		{
+			const dl_uint8_t *bytes1 = dl_null;
+			if (!duckVM_string_bytes(&object1, &bytes1, &size1)) {
+				e = dl_error_invalidValue;
+				eError = duckVM_error_pushRuntime(duckVM,
+				                                  DL_STR("duckVM_execute->utf-8-valid?: First argument must be a string."));
+				if (eError) e = eError;
 				break;
-			case duckVM_object_type_integer:
-				object1.value.boolean = object1.value.boolean < object2.value.integer;
+			}
+			object2.type = duckVM_object_type_bool;
+			object2.value.boolean = dl_string_isValidUtf8(bytes1, size1);
+		}
+		e = stack_push(duckVM, &object2);
+		if (e) break;
+		break;
+
+	case duckLisp_instruction_utf8Length32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_utf8Length16:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_utf8Length8:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		{
+			const dl_uint8_t *bytes1 = dl_null;
+			if (!duckVM_string_bytes(&object1, &bytes1, &size1)) {
+				e = dl_error_invalidValue;
+				eError = duckVM_error_pushRuntime(duckVM,
+				                                  DL_STR("duckVM_execute->utf-8-length: First argument must be a string."));
+				if (eError) e = eError;
 				break;
-			case duckVM_object_type_bool:
-				object1.value.boolean = object1.value.boolean < object2.value.boolean;
+			}
+			object2.type = duckVM_object_type_integer;
+			object2.value.integer = dl_string_utf8Length(bytes1, size1);
+		}
+		e = stack_push(duckVM, &object2);
+		if (e) break;
+		break;
+
+	case duckLisp_instruction_stringUpcase32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_stringUpcase16:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_stringUpcase8:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		{
+			const dl_uint8_t *bytes1 = dl_null;
+			if (!duckVM_string_bytes(&object1, &bytes1, &size1)) {
+				e = dl_error_invalidValue;
+				eError = duckVM_error_pushRuntime(duckVM,
+				                                  DL_STR("duckVM_execute->string-upcase: First argument must be a string."));
+				if (eError) e = eError;
 				break;
-			default:
+			}
+			/* May collect garbage, but the source string is still on the stack. */
+			e = duckVM_object_makeString(duckVM, &object2, (dl_uint8_t *) bytes1, size1);
+			if (e) break;
+			if (size1 > 0) {
+				/**/ dl_string_toUpperCase(object2.value.string.internalString->value.internalString.value, size1);
+			}
+		}
+		e = stack_push(duckVM, &object2);
+		if (e) break;
+		break;
+
+	case duckLisp_instruction_stringDowncase32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_stringDowncase16:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_stringDowncase8:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		{
+			const dl_uint8_t *bytes1 = dl_null;
+			if (!duckVM_string_bytes(&object1, &bytes1, &size1)) {
 				e = dl_error_invalidValue;
-				goto cleanup;
+				eError = duckVM_error_pushRuntime(duckVM,
+				                                  DL_STR("duckVM_execute->string-downcase: First argument must be a string."));
+				if (eError) e = eError;
+				break;
+			}
+			/* May collect garbage, but the source string is still on the stack. */
+			e = duckVM_object_makeString(duckVM, &object2, (dl_uint8_t *) bytes1, size1);
+			if (e) break;
+			if (size1 > 0) {
+				/**/ dl_string_toLowerCase(object2.value.string.internalString->value.internalString.value, size1);
 			}
-			break;
-		default:
-			e = dl_error_invalidValue;
-			goto cleanup;
 		}
-		object1.type = duckVM_object_type_bool;
-		e = stack_push(duckVM, &object1);
+		e = stack_push(duckVM, &object2);
 		if (e) break;
 		break;
-	case duckLisp_instruction_less16:
+
+	case duckLisp_instruction_makeTypedArray32:
 		ptrdiff1 = *(ip++);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
 		ptrdiff2 = *(ip++);
 		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		parsedBytecode = dl_true;
+		/* Fall through */
+	case duckLisp_instruction_makeTypedArray16:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			ptrdiff2 = *(ip++);
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			parsedBytecode = dl_true;
+		}
+		/* Fall through */
+	case duckLisp_instruction_makeTypedArray8:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff2 = *(ip++);
+		}
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
 		if (e) break;
-		e = dl_array_get(&duckVM->stack, &object2, duckVM->stack.elements_length - ptrdiff2);
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
 		if (e) break;
-		switch (object1.type) {
-		case duckVM_object_type_float:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.boolean = object1.value.floatingPoint < object2.value.floatingPoint;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.boolean = object1.value.floatingPoint < object2.value.integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.boolean = object1.value.floatingPoint < object2.value.boolean;
-				break;
-			default:
+		{
+			duckVM_typedArray_type_t type = duckVM_typedArray_type_f64;
+			if (!duckVM_typedArray_typeFromSymbol(&object1, &type)) {
 				e = dl_error_invalidValue;
-				goto cleanup;
-			}
-			break;
-		case duckVM_object_type_integer:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.boolean = object1.value.integer < object2.value.floatingPoint;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.boolean = object1.value.integer < object2.value.integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.boolean = object1.value.integer < object2.value.boolean;
+				eError = duckVM_error_pushRuntime(duckVM,
+				                                  DL_STR("duckVM_execute->make-typed-array: First argument must be one of the symbols f64, i64 or u8."));
+				if (eError) e = eError;
 				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
 			}
-			break;
-		case duckVM_object_type_bool:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.boolean = object1.value.boolean < object2.value.floatingPoint;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.boolean = object1.value.boolean < object2.value.integer;
+			if ((object2.type != duckVM_object_type_integer) || (object2.value.integer < 0)) {
+				e = dl_error_invalidValue;
+				eError = duckVM_error_pushRuntime(duckVM,
+				                                  DL_STR("duckVM_execute->make-typed-array: Second argument must be a non-negative integer."));
+				if (eError) e = eError;
 				break;
-			case duckVM_object_type_bool:
-				object1.value.boolean = object1.value.boolean < object2.value.boolean;
+			}
+			object3.type = duckVM_object_type_internalTypedArray;
+			object3.value.internalTypedArray.type = type;
+			object3.value.internalTypedArray.length = object2.value.integer;
+			object3.value.internalTypedArray.elements.u8 = dl_null;
+			size1 = object2.value.integer * duckVM_typedArray_elementSize(type);
+			if (size1 > 0) {
+				e = DL_MALLOC(duckVM->memoryAllocation, &object3.value.internalTypedArray.elements.u8, size1, dl_uint8_t);
+				if (e) {
+					eError = duckVM_error_pushRuntime(duckVM,
+					                                  DL_STR("duckVM_execute->make-typed-array: Array allocation failed."));
+					if (eError) e = eError;
+					break;
+				}
+				/* All bits zero is 0.0 as well as 0. */
+				/**/ dl_memclear(object3.value.internalTypedArray.elements.u8, size1);
+			}
+			e = duckVM_gclist_pushObject(duckVM, &objectPtr1, object3);
+			if (e) {
+				if (object3.value.internalTypedArray.elements.u8 != dl_null) {
+					(void) DL_FREE(duckVM->memoryAllocation, &object3.value.internalTypedArray.elements.u8);
+				}
 				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
 			}
-			break;
-		default:
+		}
+		/* Link typed array and internal typed array to the stack. */
+		object1.type = duckVM_object_type_typedArray;
+		object1.value.typedArray = objectPtr1;
+		e = stack_push(duckVM, &object1);
+		if (e) break;
+		break;
+
+	case duckLisp_instruction_typedArraySum32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_typedArraySum16:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_typedArraySum8:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		if (object1.type != duckVM_object_type_typedArray) {
 			e = dl_error_invalidValue;
-			goto cleanup;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->typed-array-sum: First argument must be a typed array."));
+			if (eError) e = eError;
+			break;
 		}
-		object1.type = duckVM_object_type_bool;
-		e = stack_push(duckVM, &object1);
+		object2 = duckVM_typedArray_sum(&object1.value.typedArray->value.internalTypedArray);
+		e = stack_push(duckVM, &object2);
+		if (e) break;
 		break;
-	case duckLisp_instruction_less8:
+
+	case duckLisp_instruction_typedArrayDot32:
 		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
 		ptrdiff2 = *(ip++);
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		parsedBytecode = dl_true;
+		/* Fall through */
+	case duckLisp_instruction_typedArrayDot16:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			ptrdiff2 = *(ip++);
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			parsedBytecode = dl_true;
+		}
+		/* Fall through */
+	case duckLisp_instruction_typedArrayDot8:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff2 = *(ip++);
+		}
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
 		if (e) break;
-		e = dl_array_get(&duckVM->stack, &object2, duckVM->stack.elements_length - ptrdiff2);
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
 		if (e) break;
-		switch (object1.type) {
-		case duckVM_object_type_float:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.boolean = object1.value.floatingPoint < object2.value.floatingPoint;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.boolean = object1.value.floatingPoint < object2.value.integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.boolean = object1.value.floatingPoint < object2.value.boolean;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
-			}
-			break;
-		case duckVM_object_type_integer:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.boolean = object1.value.integer < object2.value.floatingPoint;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.boolean = object1.value.integer < object2.value.integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.boolean = object1.value.integer < object2.value.boolean;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
-			}
+		if (object1.type != duckVM_object_type_typedArray) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->typed-array-dot: First argument must be a typed array."));
+			if (eError) e = eError;
 			break;
-		case duckVM_object_type_bool:
-			switch (object2.type) {
-			case duckVM_object_type_float:
-				object1.value.boolean = object1.value.boolean < object2.value.floatingPoint;
-				break;
-			case duckVM_object_type_integer:
-				object1.value.boolean = object1.value.boolean < object2.value.integer;
-				break;
-			case duckVM_object_type_bool:
-				object1.value.boolean = object1.value.boolean < object2.value.boolean;
-				break;
-			default:
-				e = dl_error_invalidValue;
-				goto cleanup;
-			}
+		}
+		if (object2.type != duckVM_object_type_typedArray) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->typed-array-dot: Second argument must be a typed array."));
+			if (eError) e = eError;
 			break;
-		default:
+		}
+		if ((object1.value.typedArray->value.internalTypedArray.type
+		     != object2.value.typedArray->value.internalTypedArray.type)
+		    || (object1.value.typedArray->value.internalTypedArray.length
+		        != object2.value.typedArray->value.internalTypedArray.length)) {
 			e = dl_error_invalidValue;
-			goto cleanup;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->typed-array-dot: Typed arrays must have the same element type and length."));
+			if (eError) e = eError;
+			break;
 		}
-		object1.type = duckVM_object_type_bool;
-		e = stack_push(duckVM, &object1);
+		object3 = duckVM_typedArray_dot(&object1.value.typedArray->value.internalTypedArray,
+		                                &object2.value.typedArray->value.internalTypedArray);
+		e = stack_push(duckVM, &object3);
+		if (e) break;
 		break;
 
-		// I probably don't need an `if` if I research the standard a bit.
-	case duckLisp_instruction_cons32:
+	case duckLisp_instruction_typedArrayScale32:
 		ptrdiff1 = *(ip++);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
@@ -3098,7 +8512,7 @@ int duckVM_executeInstruction(duckVM_t *duckVM,
 		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
 		parsedBytecode = dl_true;
 		/* Fall through */
-	case duckLisp_instruction_cons16:
+	case duckLisp_instruction_typedArrayScale16:
 		if (!parsedBytecode) {
 			ptrdiff1 = *(ip++);
 			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
@@ -3107,214 +8521,357 @@ int duckVM_executeInstruction(duckVM_t *duckVM,
 			parsedBytecode = dl_true;
 		}
 		/* Fall through */
-	case duckLisp_instruction_cons8:
+	case duckLisp_instruction_typedArrayScale8:
 		if (!parsedBytecode) {
 			ptrdiff1 = *(ip++);
 			ptrdiff2 = *(ip++);
 		}
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
 		if (e) break;
-		e = dl_array_get(&duckVM->stack, &object2, duckVM->stack.elements_length - ptrdiff2);
-		if (e) break;
-		/* Push dummy cons first so that it can't get collected. */
-		cons1.type = duckVM_object_type_cons;
-		cons1.value.cons.car = dl_null;
-		cons1.value.cons.cdr = dl_null;
-		object3.type = duckVM_object_type_list;
-		e = duckVM_gclist_pushObject(duckVM, &object3.value.list, cons1);
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
 		if (e) break;
-		e = stack_push(duckVM, &object3);
+		if (object1.type != duckVM_object_type_typedArray) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->typed-array-scale: First argument must be a typed array."));
+			if (eError) e = eError;
+			break;
+		}
+		if (!((object2.type == duckVM_object_type_integer)
+		      || ((object2.type == duckVM_object_type_float)
+		          && (object1.value.typedArray->value.internalTypedArray.type == duckVM_typedArray_type_f64)))) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->typed-array-scale: Factor must be an integer, or a float if the array holds floats."));
+			if (eError) e = eError;
+			break;
+		}
+		/**/ duckVM_typedArray_scale(&object1.value.typedArray->value.internalTypedArray, &object2);
+		e = stack_push(duckVM, &object1);
 		if (e) break;
-		/* Create the elements of the cons. */
-		if (object1.type == duckVM_object_type_list) {
-			object3.value.list->value.cons.car = object1.value.list;
+		break;
+
+	case duckLisp_instruction_typedArrayAdd32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff2 = *(ip++);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		parsedBytecode = dl_true;
+		/* Fall through */
+	case duckLisp_instruction_typedArrayAdd16:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			ptrdiff2 = *(ip++);
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			parsedBytecode = dl_true;
 		}
-		else {
-			e = duckVM_gclist_pushObject(duckVM, &objectPtr1, object1);
-			if (e) break;
-			object3.value.list->value.cons.car = objectPtr1;
+		/* Fall through */
+	case duckLisp_instruction_typedArrayAdd8:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff2 = *(ip++);
 		}
-		if (object2.type == duckVM_object_type_list) {
-			object3.value.list->value.cons.cdr = object2.value.list;
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		if (object1.type != duckVM_object_type_typedArray) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->typed-array-add: First argument must be a typed array."));
+			if (eError) e = eError;
+			break;
 		}
-		else {
-			e = duckVM_gclist_pushObject(duckVM, &objectPtr2, object2);
-			if (e) break;
-			object3.value.list->value.cons.cdr = objectPtr2;
+		if (object2.type != duckVM_object_type_typedArray) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->typed-array-add: Second argument must be a typed array."));
+			if (eError) e = eError;
+			break;
 		}
-		DL_ARRAY_GETTOPADDRESS(duckVM->stack, duckVM_object_t) = object3;
+		if ((object1.value.typedArray->value.internalTypedArray.type
+		     != object2.value.typedArray->value.internalTypedArray.type)
+		    || (object1.value.typedArray->value.internalTypedArray.length
+		        != object2.value.typedArray->value.internalTypedArray.length)) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->typed-array-add: Typed arrays must have the same element type and length."));
+			if (eError) e = eError;
+			break;
+		}
+		/**/ duckVM_typedArray_combine(&object1.value.typedArray->value.internalTypedArray,
+		                               &object2.value.typedArray->value.internalTypedArray,
+		                               dl_false);
+		e = stack_push(duckVM, &object1);
+		if (e) break;
 		break;
 
-	case duckLisp_instruction_vector32:
-		size1 = *(ip++);
-		size1 = *(ip++) + (size1 << 8);
+	case duckLisp_instruction_typedArrayMul32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff2 = *(ip++);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		parsedBytecode = dl_true;
 		/* Fall through */
-	case duckLisp_instruction_vector16:
-		size1 = *(ip++) + (size1 << 8);
+	case duckLisp_instruction_typedArrayMul16:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			ptrdiff2 = *(ip++);
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			parsedBytecode = dl_true;
+		}
 		/* Fall through */
-	case duckLisp_instruction_vector8:
-		size1 = *(ip++) + (size1 << 8);
-
-		object1.type = duckVM_object_type_vector;
-		object1.value.vector.offset = 0;
-		object1.value.vector.internal_vector = dl_null;
-
-		{
-			duckVM_object_t internal_vector;
-			internal_vector.type = duckVM_object_type_internalVector;
-			internal_vector.value.internal_vector.initialized = dl_false;
-			internal_vector.value.internal_vector.length = size1;
-			e = duckVM_gclist_pushObject(duckVM, &object1.value.vector.internal_vector, internal_vector);
-			if (e) break;
+	case duckLisp_instruction_typedArrayMul8:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff2 = *(ip++);
 		}
-		/* Immediately push on stack so that the GC can see it. Allocating elements could trigger a GC. */
-		e = dl_array_pushElement(&duckVM->stack, &object1);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
 		if (e) break;
-		DL_DOTIMES(k, object1.value.vector.internal_vector->value.internal_vector.length) {
-			ptrdiff1 = *(ip++);
-			switch (opcode) {
-			case duckLisp_instruction_vector32:
-				ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-				ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-				/* Fall through */
-			case duckLisp_instruction_vector16:
-				ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-				/* Fall through */
-			case duckLisp_instruction_vector8:
-				break;
-			default:
-				e = dl_error_invalidValue;
-				break;
-			}
-			if (e) break;
-			/* stack - 1 because we already pushed. */
-			dl_size_t old_stack_length = duckVM->stack.elements_length - 1;
-			ptrdiff1 = old_stack_length - ptrdiff1;
-			if ((ptrdiff1 < 0) || ((dl_size_t) ptrdiff1 > old_stack_length)) {
-				e = dl_error_invalidValue;
-				break;
-			}
-
-			e = dl_array_get(&duckVM->stack, &object2, ptrdiff1);
-			if (e) break;
-			e = duckVM_gclist_pushObject(duckVM,
-			                             &object1.value.vector.internal_vector->value.internal_vector.values[k],
-			                             object2);
-			if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		if (object1.type != duckVM_object_type_typedArray) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->typed-array-mul: First argument must be a typed array."));
+			if (eError) e = eError;
+			break;
+		}
+		if (object2.type != duckVM_object_type_typedArray) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->typed-array-mul: Second argument must be a typed array."));
+			if (eError) e = eError;
+			break;
+		}
+		if ((object1.value.typedArray->value.internalTypedArray.type
+		     != object2.value.typedArray->value.internalTypedArray.type)
+		    || (object1.value.typedArray->value.internalTypedArray.length
+		        != object2.value.typedArray->value.internalTypedArray.length)) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->typed-array-mul: Typed arrays must have the same element type and length."));
+			if (eError) e = eError;
+			break;
 		}
+		/**/ duckVM_typedArray_combine(&object1.value.typedArray->value.internalTypedArray,
+		                               &object2.value.typedArray->value.internalTypedArray,
+		                               dl_true);
+		e = stack_push(duckVM, &object1);
 		if (e) break;
-
-		/* Break push_scope abstraction. */
-		e = dl_array_pushElement(&duckVM->upvalue_stack, dl_null);
-		if (e) break;
-		object1.value.vector.internal_vector->value.internal_vector.initialized = dl_true;
-		DL_ARRAY_GETTOPADDRESS(duckVM->stack, duckVM_object_t) = object1;
 		break;
 
-	case duckLisp_instruction_makeVector32:
+	case duckLisp_instruction_typedArrayMin32:
 		ptrdiff1 = *(ip++);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through */
-	case duckLisp_instruction_makeVector16:
+		/* Fall through. */
+	case duckLisp_instruction_typedArrayMin16:
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through */
-	case duckLisp_instruction_makeVector8:
+		/* Fall through. */
+	case duckLisp_instruction_typedArrayMin8:
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-
-		ptrdiff2 = *(ip++);
-		switch (opcode) {
-		case duckLisp_instruction_makeVector32:
-			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-			/* Fall through */
-		case duckLisp_instruction_makeVector16:
-			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-			/* Fall through */
-		case duckLisp_instruction_makeVector8:
-			break;
-		default:
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		if (object1.type != duckVM_object_type_typedArray) {
 			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->typed-array-min: First argument must be a typed array."));
+			if (eError) e = eError;
 			break;
 		}
+		if (object1.value.typedArray->value.internalTypedArray.length == 0) {
+			object2.type = duckVM_object_type_list;
+			object2.value.list = dl_null;
+		}
+		else {
+			object2 = duckVM_typedArray_extreme(&object1.value.typedArray->value.internalTypedArray, dl_false);
+		}
+		e = stack_push(duckVM, &object2);
 		if (e) break;
+		break;
 
-		ptrdiff1 = duckVM->stack.elements_length - ptrdiff1;
-		if ((ptrdiff1 < 0) || ((dl_size_t) ptrdiff1 > duckVM->stack.elements_length)) {
+	case duckLisp_instruction_typedArrayMax32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_typedArrayMax16:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_typedArrayMax8:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		if (object1.type != duckVM_object_type_typedArray) {
 			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->typed-array-max: First argument must be a typed array."));
+			if (eError) e = eError;
 			break;
 		}
-		e = dl_array_get(&duckVM->stack, &object1, ptrdiff1);
+		if (object1.value.typedArray->value.internalTypedArray.length == 0) {
+			object2.type = duckVM_object_type_list;
+			object2.value.list = dl_null;
+		}
+		else {
+			object2 = duckVM_typedArray_extreme(&object1.value.typedArray->value.internalTypedArray, dl_true);
+		}
+		e = stack_push(duckVM, &object2);
 		if (e) break;
-		if (object1.type != duckVM_object_type_integer) {
+		break;
+
+	case duckLisp_instruction_makeRecord32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff2 = *(ip++);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		parsedBytecode = dl_true;
+		/* Fall through */
+	case duckLisp_instruction_makeRecord16:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			ptrdiff2 = *(ip++);
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			parsedBytecode = dl_true;
+		}
+		/* Fall through */
+	case duckLisp_instruction_makeRecord8:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff2 = *(ip++);
+		}
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		if ((object1.type != duckVM_object_type_type) || (object1.value.type < duckVM_object_type_last)) {
 			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->make-record: First argument must be a type made by make-type."));
+			if (eError) e = eError;
 			break;
 		}
-		if (object1.value.integer < 0) {
+		if ((object2.type != duckVM_object_type_integer) || (object2.value.integer < 0)) {
 			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->make-record: Second argument must be a non-negative integer."));
+			if (eError) e = eError;
 			break;
 		}
-		size1 = object1.value.integer;
-
-		ptrdiff2 = duckVM->stack.elements_length - ptrdiff2;
-		if ((ptrdiff2 < 0) || ((dl_size_t) ptrdiff2 > duckVM->stack.elements_length)) {
-			e = dl_error_invalidValue;
+		object3.type = duckVM_object_type_internalRecord;
+		object3.value.internalRecord.type = object1.value.type;
+		object3.value.internalRecord.slots_length = object2.value.integer;
+		object3.value.internalRecord.slots = dl_null;
+		if (object3.value.internalRecord.slots_length > 0) {
+			e = DL_MALLOC(duckVM->memoryAllocation,
+			              &object3.value.internalRecord.slots,
+			              object3.value.internalRecord.slots_length,
+			              duckVM_object_t);
+			if (e) {
+				eError = duckVM_error_pushRuntime(duckVM,
+				                                  DL_STR("duckVM_execute->make-record: Slot allocation failed."));
+				if (eError) e = eError;
+				break;
+			}
+			DL_DOTIMES(k, object3.value.internalRecord.slots_length) {
+				object3.value.internalRecord.slots[k].type = duckVM_object_type_list;
+				object3.value.internalRecord.slots[k].value.list = dl_null;
+			}
+		}
+		e = duckVM_gclist_pushObject(duckVM, &objectPtr1, object3);
+		if (e) {
+			if (object3.value.internalRecord.slots != dl_null) {
+				(void) DL_FREE(duckVM->memoryAllocation, &object3.value.internalRecord.slots);
+			}
 			break;
 		}
-		e = dl_array_get(&duckVM->stack, &object2, ptrdiff2);
+		/* Link record and internal record to the stack. */
+		object1.type = duckVM_object_type_record;
+		object1.value.record = objectPtr1;
+		e = stack_push(duckVM, &object1);
 		if (e) break;
+		break;
 
-		object1.type = duckVM_object_type_vector;
-		object1.value.vector.offset = 0;
-		object1.value.vector.internal_vector = dl_null;
-
-		{
-			duckVM_object_t internal_vector;
-			internal_vector.type = duckVM_object_type_internalVector;
-			internal_vector.value.internal_vector.initialized = dl_false;
-			internal_vector.value.internal_vector.length = size1;
-			e = duckVM_gclist_pushObject(duckVM, &object1.value.vector.internal_vector, internal_vector);
-			if (e) break;
+	case duckLisp_instruction_recordSlot32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff2 = *(ip++);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		parsedBytecode = dl_true;
+		/* Fall through */
+	case duckLisp_instruction_recordSlot16:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			ptrdiff2 = *(ip++);
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			parsedBytecode = dl_true;
 		}
-		/* Immediately push on stack so that the GC can see it. Allocating elements could trigger a GC. */
-		e = dl_array_pushElement(&duckVM->stack, &object1);
-		if (e) break;
-		e = duckVM_gclist_pushObject(duckVM,
-		                             &objectPtr1,
-		                             object2);
-		if (e) break;
-		DL_DOTIMES(k, object1.value.vector.internal_vector->value.internal_vector.length) {
-			object1.value.vector.internal_vector->value.internal_vector.values[k] = objectPtr1;
+		/* Fall through */
+	case duckLisp_instruction_recordSlot8:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff2 = *(ip++);
 		}
-
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
 		if (e) break;
-
-		/* Break push_scope abstraction. */
-		e = dl_array_pushElement(&duckVM->upvalue_stack, dl_null);
+		/* `ptrdiff2` is the slot itself, not a stack index. */
+		if (object1.type != duckVM_object_type_record) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->record-slot: First argument must be a record."));
+			if (eError) e = eError;
+			break;
+		}
+		if ((dl_size_t) ptrdiff2 >= object1.value.record->value.internalRecord.slots_length) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->record-slot: Slot out of bounds."));
+			if (eError) e = eError;
+			break;
+		}
+		e = stack_push(duckVM, &object1.value.record->value.internalRecord.slots[ptrdiff2]);
 		if (e) break;
-		object1.value.vector.internal_vector->value.internal_vector.initialized = dl_true;
-		DL_ARRAY_GETTOPADDRESS(duckVM->stack, duckVM_object_t) = object1;
 		break;
 
-	case duckLisp_instruction_getVecElt32:
+	case duckLisp_instruction_setRecordSlot32:
 		ptrdiff1 = *(ip++);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
 		/* Fall through */
-	case duckLisp_instruction_getVecElt16:
+	case duckLisp_instruction_setRecordSlot16:
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
 		/* Fall through */
-	case duckLisp_instruction_getVecElt8:
+	case duckLisp_instruction_setRecordSlot8:
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
 
 		ptrdiff2 = *(ip++);
 		switch (opcode) {
-		case duckLisp_instruction_getVecElt32:
+		case duckLisp_instruction_setRecordSlot32:
 			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
 			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
 			/* Fall through */
-		case duckLisp_instruction_getVecElt16:
+		case duckLisp_instruction_setRecordSlot16:
 			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
 			/* Fall through */
-		case duckLisp_instruction_getVecElt8:
+		case duckLisp_instruction_setRecordSlot8:
 			break;
 		default:
 			e = dl_error_cantHappen;
@@ -3322,379 +8879,425 @@ int duckVM_executeInstruction(duckVM_t *duckVM,
 		}
 		if (e) break;
 
-		ptrdiff1 = duckVM->stack.elements_length - ptrdiff1;
-		if ((ptrdiff1 < 0) || ((dl_size_t) ptrdiff1 > duckVM->stack.elements_length)) {
-			e = dl_error_invalidValue;
-			eError = duckVM_error_pushRuntime(duckVM,
-			                                  DL_STR("duckVM_execute->get-vector-element: Vector stack index out of bounds."));
-			if (!e) e = eError;
+		ptrdiff3 = *(ip++);
+		switch (opcode) {
+		case duckLisp_instruction_setRecordSlot32:
+			ptrdiff3 = *(ip++) + (ptrdiff3 << 8);
+			ptrdiff3 = *(ip++) + (ptrdiff3 << 8);
+			/* Fall through */
+		case duckLisp_instruction_setRecordSlot16:
+			ptrdiff3 = *(ip++) + (ptrdiff3 << 8);
+			/* Fall through */
+		case duckLisp_instruction_setRecordSlot8:
+			break;
+		default:
+			e = dl_error_cantHappen;
 			break;
 		}
-		e = dl_array_get(&duckVM->stack, &object1, ptrdiff1);
 		if (e) break;
-		if ((object1.type != duckVM_object_type_vector) && (object1.type != duckVM_object_type_string)) {
+
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		/* `ptrdiff2` is the slot itself, not a stack index. */
+		e = stack_getOperand(duckVM, bytecode, &object3, ptrdiff3);
+		if (e) break;
+		if (object1.type != duckVM_object_type_record) {
 			e = dl_error_invalidValue;
 			eError = duckVM_error_pushRuntime(duckVM,
-			                                  DL_STR("duckVM_execute->get-vector-element: dl_array_get failed."));
-			if (!e) e = eError;
+			                                  DL_STR("duckVM_execute->set-record-slot: First argument must be a record."));
+			if (eError) e = eError;
 			break;
 		}
-
-		ptrdiff2 = duckVM->stack.elements_length - ptrdiff2;
-		if ((ptrdiff2 < 0) || ((dl_size_t) ptrdiff2 > duckVM->stack.elements_length)) {
+		if ((dl_size_t) ptrdiff2 >= object1.value.record->value.internalRecord.slots_length) {
 			e = dl_error_invalidValue;
 			eError = duckVM_error_pushRuntime(duckVM,
-			                                  DL_STR("duckVM_execute->get-vector-element: Index stack index out of bounds."));
-			if (!e) e = eError;
+			                                  DL_STR("duckVM_execute->set-record-slot: Slot out of bounds."));
+			if (eError) e = eError;
 			break;
 		}
-		e = dl_array_get(&duckVM->stack, &object2, ptrdiff2);
+		object1.value.record->value.internalRecord.slots[ptrdiff2] = object3;
+		e = stack_push(duckVM, &object3);
 		if (e) break;
-		if (object2.type != duckVM_object_type_integer) {
-			e = dl_error_invalidValue;
-			eError = duckVM_error_pushRuntime(duckVM,
-			                                  DL_STR("duckVM_execute->get-vector-element: dl_array_get failed."));
-			if (!e) e = eError;
-			break;
+		break;
+
+	case duckLisp_instruction_pushQuoted32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_pushQuoted16:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_pushQuoted8:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* `ptrdiff1` is the slot. A slot that hasn't been set yet reads as nil. */
+		if ((dl_size_t) ptrdiff1 < bytecode->value.bytecode.quoted_length) {
+			object1 = bytecode->value.bytecode.quoted[ptrdiff1];
 		}
+		else {
+			object1.type = duckVM_object_type_list;
+			object1.value.list = dl_null;
+		}
+		e = stack_push(duckVM, &object1);
+		if (e) break;
+		break;
 
-		if (object1.type == duckVM_object_type_vector) {
-			ptrdiff1 = object2.value.integer;
-			if ((ptrdiff1 < 0)
-			    || ((dl_size_t) (ptrdiff1 + object1.value.vector.offset)
-			        >= object1.value.vector.internal_vector->value.internal_vector.length)) {
-				e = dl_error_invalidValue;
-				eError = duckVM_error_pushRuntime(duckVM,
-				                                  DL_STR("duckVM_execute->get-vector-element: Vector index out of bounds."));
-				if (!e) e = eError;
-				break;
-			}
-			object2 = *object1.value.vector.internal_vector->value.internal_vector.values[object1.value.vector.offset
-			                                                                              + ptrdiff1];
+	case duckLisp_instruction_setQuoted32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff2 = *(ip++);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		parsedBytecode = dl_true;
+		/* Fall through */
+	case duckLisp_instruction_setQuoted16:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			ptrdiff2 = *(ip++);
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			parsedBytecode = dl_true;
 		}
-		else if (object1.type == duckVM_object_type_string) {
-			ptrdiff1 = object2.value.integer;
-			if ((ptrdiff1 < 0) || ((dl_size_t) ptrdiff1 >= object1.value.string.length - object1.value.string.offset)) {
-				e = dl_error_invalidValue;
+		/* Fall through */
+	case duckLisp_instruction_setQuoted8:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff2 = *(ip++);
+		}
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		/* `ptrdiff2` is the slot. */
+		{
+			duckVM_frozen_t *region = dl_null;
+			e = duckVM_frozen_fromObject(duckVM, &object1, &object2, &region);
+			if (e) break;
+		}
+		if ((dl_size_t) ptrdiff2 >= bytecode->value.bytecode.quoted_length) {
+			e = DL_REALLOC(duckVM->memoryAllocation, &bytecode->value.bytecode.quoted, ptrdiff2 + 1, duckVM_object_t);
+			if (e) {
 				eError = duckVM_error_pushRuntime(duckVM,
-				                                  DL_STR("duckVM_execute->get-vector-element: String index out of bounds."));
-				if (!e) e = eError;
+				                                  DL_STR("duckVM_execute->set-quoted: Constant allocation failed."));
+				if (eError) e = eError;
 				break;
 			}
-			object2.type = duckVM_object_type_integer;
-			object2.value.integer = (object1.value.string.internalString
-			                         ->value.internalString.value[object1.value.string.offset
-			                                                      + ptrdiff1]);
-		}
-		e = stack_push(duckVM, &object2);
-		if (e) {
-			eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->get-vector-element: stack_push failed."));
-			if (!e) e = eError;
-			break;
+			for (size1 = bytecode->value.bytecode.quoted_length; size1 <= (dl_size_t) ptrdiff2; size1++) {
+				bytecode->value.bytecode.quoted[size1].type = duckVM_object_type_list;
+				bytecode->value.bytecode.quoted[size1].value.list = dl_null;
+			}
+			bytecode->value.bytecode.quoted_length = ptrdiff2 + 1;
 		}
+		bytecode->value.bytecode.quoted[ptrdiff2] = object2;
+		/* This evaluation returns the frozen copy too, so every evaluation sees the same object. */
+		e = stack_setOperand(duckVM, bytecode, &object2, ptrdiff1);
+		if (e) break;
 		break;
 
-	case duckLisp_instruction_setVecElt32:
+	case duckLisp_instruction_nth32:
 		ptrdiff1 = *(ip++);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through */
-	case duckLisp_instruction_setVecElt16:
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through */
-	case duckLisp_instruction_setVecElt8:
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-
 		ptrdiff2 = *(ip++);
-		switch (opcode) {
-		case duckLisp_instruction_setVecElt32:
-			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-			/* Fall through */
-		case duckLisp_instruction_setVecElt16:
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		parsedBytecode = dl_true;
+		/* Fall through */
+	case duckLisp_instruction_nth16:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			ptrdiff2 = *(ip++);
 			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-			/* Fall through */
-		case duckLisp_instruction_setVecElt8:
-			break;
-		default:
-			e = dl_error_invalidValue;
-			break;
+			parsedBytecode = dl_true;
 		}
-		if (e) break;
-
-		ptrdiff3 = *(ip++);
-		switch (opcode) {
-		case duckLisp_instruction_setVecElt32:
-			ptrdiff3 = *(ip++) + (ptrdiff3 << 8);
-			ptrdiff3 = *(ip++) + (ptrdiff3 << 8);
-			/* Fall through */
-		case duckLisp_instruction_setVecElt16:
-			ptrdiff3 = *(ip++) + (ptrdiff3 << 8);
-			/* Fall through */
-		case duckLisp_instruction_setVecElt8:
-			break;
-		default:
-			e = dl_error_invalidValue;
-			break;
+		/* Fall through */
+	case duckLisp_instruction_nth8:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff2 = *(ip++);
 		}
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
 		if (e) break;
-
-		ptrdiff1 = duckVM->stack.elements_length - ptrdiff1;
-		if ((ptrdiff1 < 0) || ((dl_size_t) ptrdiff1 > duckVM->stack.elements_length)) {
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		if ((object1.type != duckVM_object_type_integer) || (object1.value.integer < 0)) {
 			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->nth: First argument must be a non-negative integer."));
+			if (eError) e = eError;
 			break;
 		}
-		e = dl_array_get(&duckVM->stack, &object1, ptrdiff1);
-		if (e) break;
-		if (object1.type != duckVM_object_type_vector) {
+		if (object2.type != duckVM_object_type_list) {
 			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->nth: Second argument must be a list."));
+			if (eError) e = eError;
 			break;
 		}
+		/* Stops at the end of the list, so circular lists are fine. */
+		objectPtr1 = object2.value.list;
+		for (size1 = object1.value.integer;
+		     (size1 > 0) && (objectPtr1 != dl_null) && (objectPtr1->type == duckVM_object_type_cons);
+		     --size1) {
+			objectPtr1 = objectPtr1->value.cons.cdr;
+		}
+		if ((objectPtr1 != dl_null) && (objectPtr1->type == duckVM_object_type_cons)) {
+			object1 = duckVM_list_element(objectPtr1->value.cons.car);
+		}
+		else {
+			object1.type = duckVM_object_type_list;
+			object1.value.list = dl_null;
+		}
+		e = stack_push(duckVM, &object1);
+		if (e) break;
+		break;
 
-		ptrdiff2 = duckVM->stack.elements_length - ptrdiff2;
-		if ((ptrdiff2 < 0) || ((dl_size_t) ptrdiff2 > duckVM->stack.elements_length)) {
-			e = dl_error_invalidValue;
-			break;
+	case duckLisp_instruction_nthcdr32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		ptrdiff2 = *(ip++);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		parsedBytecode = dl_true;
+		/* Fall through */
+	case duckLisp_instruction_nthcdr16:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			ptrdiff2 = *(ip++);
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			parsedBytecode = dl_true;
 		}
-		e = dl_array_get(&duckVM->stack, &object2, ptrdiff2);
+		/* Fall through */
+	case duckLisp_instruction_nthcdr8:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff2 = *(ip++);
+		}
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
 		if (e) break;
-		if (object2.type != duckVM_object_type_integer) {
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		if ((object1.type != duckVM_object_type_integer) || (object1.value.integer < 0)) {
 			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->nthcdr: First argument must be a non-negative integer."));
+			if (eError) e = eError;
 			break;
 		}
-
-		ptrdiff3 = duckVM->stack.elements_length - ptrdiff3;
-		if ((ptrdiff3 < 0) || ((dl_size_t) ptrdiff3 > duckVM->stack.elements_length)) {
+		if (object2.type != duckVM_object_type_list) {
 			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->nthcdr: Second argument must be a list."));
+			if (eError) e = eError;
 			break;
 		}
-		e = dl_array_get(&duckVM->stack, &object3, ptrdiff3);
-		if (e) break;
-
-		/* Vector bounds check. */
-		ptrdiff2 = object2.value.integer;
-		if ((dl_size_t) (ptrdiff2 + object1.value.vector.offset)
-		    >= object1.value.vector.internal_vector->value.internal_vector.length) {
-			e = dl_error_invalidValue;
-			break;
+		/* Stops at the end of the list, so circular lists are fine. */
+		objectPtr1 = object2.value.list;
+		for (size1 = object1.value.integer;
+		     (size1 > 0) && (objectPtr1 != dl_null) && (objectPtr1->type == duckVM_object_type_cons);
+		     --size1) {
+			objectPtr1 = objectPtr1->value.cons.cdr;
 		}
-
-		e = duckVM_gclist_pushObject(duckVM,
-		                             &(object1.value.vector.internal_vector
-		                               ->value.internal_vector.values[object1.value.vector.offset
-		                                                              + ptrdiff2]),
-		                             object3);
-		if (e) break;
-		/* Also push on stack. */
-		e = stack_push(duckVM, &object3);
+		object1 = duckVM_list_element(objectPtr1);
+		e = stack_push(duckVM, &object1);
 		if (e) break;
 		break;
 
-		// I probably don't need an `if` if I research the standard a bit.
-	case duckLisp_instruction_cdr32:
+	case duckLisp_instruction_append32:
 		ptrdiff1 = *(ip++);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through */
-	case duckLisp_instruction_cdr16:
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through */
-	case duckLisp_instruction_cdr8:
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
+		ptrdiff2 = *(ip++);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		parsedBytecode = dl_true;
+		/* Fall through */
+	case duckLisp_instruction_append16:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			ptrdiff2 = *(ip++);
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			parsedBytecode = dl_true;
+		}
+		/* Fall through */
+	case duckLisp_instruction_append8:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff2 = *(ip++);
+		}
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
 		if (e) break;
-		if (object1.type == duckVM_object_type_list) {
-			if (object1.value.list == dl_null) {
-				object2.type = duckVM_object_type_list;
-				object2.value.list = dl_null;
-			}
-			else {
-				if (object1.value.list->type == duckVM_object_type_cons) {
-					duckVM_object_t *cdr = object1.value.list->value.cons.cdr;
-					if (cdr == dl_null) {
-						object2.type = duckVM_object_type_list;
-						object2.value.list = dl_null;
-					}
-					/* cdr can be a cons or something else. */
-					else if (cdr->type == duckVM_object_type_cons) {
-						object2.type = duckVM_object_type_list;
-						object2.value.list = cdr;
-					}
-					else {
-						object2 = *cdr;
-					}
-				}
-				else {
-					e = dl_error_shouldntHappen;
-					eError = duckVM_error_pushRuntime(duckVM,
-					                                  DL_STR("duckVM_execute->cdr: Non-null list does not contain a cons."));
-					if (!e) e = eError;
-					break;
-				}
-			}
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		if (object1.type != duckVM_object_type_list) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->append: First argument must be a list."));
+			if (eError) e = eError;
+			break;
 		}
-		else if (object1.type == duckVM_object_type_vector) {
-			if (object1.value.vector.internal_vector == dl_null) {
-				object2.type = duckVM_object_type_vector;
-				object2.value.vector.internal_vector = dl_null;
-			}
-			else {
-				if (object1.value.vector.internal_vector->type == duckVM_object_type_internalVector) {
-					object2.type = duckVM_object_type_vector;
-					if ((object1.value.vector.internal_vector->value.internal_vector.length == 0)
-					    /* -1 because we are going to try to get the cdr, which is the next element after. */
-					    || ((dl_size_t) object1.value.vector.offset
-					        >= object1.value.vector.internal_vector->value.internal_vector.length - 1)) {
-						object2.value.vector.internal_vector = dl_null;
-					}
-					/* cdr can't be anything other than a vector. */
-					else {
-						object2.value.vector.internal_vector = object1.value.vector.internal_vector;
-						object2.value.vector.offset = object1.value.vector.offset + 1;
-					}
-				}
-				else {
-					e = dl_error_invalidValue;
-					break;
-				}
-			}
+		if (object2.type != duckVM_object_type_list) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->append: Second argument must be a list."));
+			if (eError) e = eError;
+			break;
 		}
-		else if (object1.type == duckVM_object_type_string) {
-			if (object1.value.string.internalString == dl_null) {
-				object2.type = duckVM_object_type_string;
-				object2.value.string.internalString = dl_null;
-			}
-			else {
-				if (object1.value.string.internalString->type == duckVM_object_type_internalString) {
-					object2.type = duckVM_object_type_string;
-					if ((object1.value.string.length == 0)
-					    /* -1 because we are going to try to get the cdr, which is the next element after. */
-					    || ((dl_size_t) object1.value.string.offset >= object1.value.string.length - 1)) {
-						object2.value.string.internalString = dl_null;
-					}
-					/* cdr can't be anything other than a string. */
-					else {
-						object2.value.string.internalString = object1.value.string.internalString;
-						object2.value.string.offset = object1.value.string.offset + 1;
-						object2.value.string.length = object1.value.string.length;
-					}
-				}
-				else {
-					e = dl_error_invalidValue;
-					eError = duckVM_error_pushRuntime(duckVM,
-					                                  DL_STR("duckVM_execute->cdr: Internal string is wrong type."));
-					if (eError) e = eError;
-					break;
-				}
+		if (duckVM_listIsCyclic(object1.value.list)) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->append: List must not be circular."));
+			if (eError) e = eError;
+			break;
+		}
+		/* The copy starts out as the second list, so appending to nil returns it unchanged. */
+		ptrdiff3 = duckVM->stack.elements_length;
+		e = stack_push(duckVM, &object2);
+		if (e) break;
+		{
+			duckVM_object_t *last = dl_null;
+			for (objectPtr1 = object1.value.list;
+			     (objectPtr1 != dl_null) && (objectPtr1->type == duckVM_object_type_cons);
+			     objectPtr1 = objectPtr1->value.cons.cdr) {
+				/* Each copy points at the second list until the next one is linked after it. */
+				e = duckVM_list_link(duckVM, ptrdiff3, &last, objectPtr1->value.cons.car, object2.value.list);
+				if (e) break;
 			}
 		}
-		else {
+		if (e) break;
+		break;
+
+	case duckLisp_instruction_reverse32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_reverse16:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_reverse8:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+		if (e) break;
+		if (object1.type != duckVM_object_type_list) {
 			e = dl_error_invalidValue;
 			eError = duckVM_error_pushRuntime(duckVM,
-			                                  DL_STR("duckVM_execute->cdr: Argument is not a list, vector, or string."));
+			                                  DL_STR("duckVM_execute->reverse: First argument must be a list."));
+			if (eError) e = eError;
+			break;
+		}
+		if (duckVM_listIsCyclic(object1.value.list)) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->reverse: List must not be circular."));
 			if (eError) e = eError;
 			break;
 		}
+		ptrdiff3 = duckVM->stack.elements_length;
+		object2.type = duckVM_object_type_list;
+		object2.value.list = dl_null;
 		e = stack_push(duckVM, &object2);
 		if (e) break;
+		for (objectPtr1 = object1.value.list;
+		     (objectPtr1 != dl_null) && (objectPtr1->type == duckVM_object_type_cons);
+		     objectPtr1 = objectPtr1->value.cons.cdr) {
+			/* Each new cons goes on the front, and the list so far is kept on the stack. */
+			objectPtr2 = dl_null;
+			e = duckVM_gclist_pushObject(duckVM,
+			                             &objectPtr2,
+			                             duckVM_object_makeCons(objectPtr1->value.cons.car,
+			                                                    DL_ARRAY_GETADDRESS(duckVM->stack,
+			                                                                        duckVM_object_t,
+			                                                                        ptrdiff3).value.list));
+			if (e) break;
+			DL_ARRAY_GETADDRESS(duckVM->stack, duckVM_object_t, ptrdiff3).value.list = objectPtr2;
+		}
+		if (e) break;
 		break;
 
-		// I probably don't need an `if` if I research the standard a bit.
-	case duckLisp_instruction_car32:
+	case duckLisp_instruction_assoc32:
 		ptrdiff1 = *(ip++);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through */
-	case duckLisp_instruction_car16:
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through */
-	case duckLisp_instruction_car8:
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
+		ptrdiff2 = *(ip++);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+		parsedBytecode = dl_true;
+		/* Fall through */
+	case duckLisp_instruction_assoc16:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+			ptrdiff2 = *(ip++);
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			parsedBytecode = dl_true;
+		}
+		/* Fall through */
+	case duckLisp_instruction_assoc8:
+		if (!parsedBytecode) {
+			ptrdiff1 = *(ip++);
+			ptrdiff2 = *(ip++);
+		}
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
 		if (e) break;
-		if (object1.type == duckVM_object_type_list) {
-			if (object1.value.list == dl_null) {
-				object2.type = duckVM_object_type_list;
-				object2.value.list = dl_null;
-			}
-			else {
-				if (object1.value.list->type == duckVM_object_type_cons) {
-					duckVM_object_t *car = object1.value.list->value.cons.car;
-					if (car == dl_null) {
-						object2.type = duckVM_object_type_list;
-						object2.value.list = dl_null;
-					}
-					/* car can be a cons or something else. */
-					else if (car->type == duckVM_object_type_cons) {
-						object2.type = duckVM_object_type_list;
-						object2.value.list = car;
-					}
-					else {
-						object2 = *car;
-					}
-				}
-				else {
-					e = dl_error_shouldntHappen;
-					eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->cdr: Non-null list does not contain a cons."));
-					if (!e) e = eError;
-					break;
-				}
-			}
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		if (object2.type != duckVM_object_type_list) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->assoc: Second argument must be a list."));
+			if (eError) e = eError;
+			break;
 		}
-		else if (object1.type == duckVM_object_type_vector) {
-			if (object1.value.vector.internal_vector == dl_null) {
-				object2.type = duckVM_object_type_vector;
-				object2.value.vector.internal_vector = dl_null;
-			}
-			else {
-				if (object1.value.vector.internal_vector->type == duckVM_object_type_internalVector) {
-					if ((object1.value.vector.internal_vector->value.internal_vector.length == 0)
-					    || ((dl_size_t) object1.value.vector.offset
-					        >= object1.value.vector.internal_vector->value.internal_vector.length)) {
-						object2.type = duckVM_object_type_vector;
-						object2.value.vector.internal_vector = dl_null;
-					}
-					else {
-						object2 = *(object1.value.vector.internal_vector
-						            ->value.internal_vector.values[object1.value.vector.offset]);
-					}
-				}
-				else {
-					e = dl_error_invalidValue;
-					break;
-				}
-			}
+		if (duckVM_listIsCyclic(object2.value.list)) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->assoc: List must not be circular."));
+			if (eError) e = eError;
+			break;
 		}
-		else if (object1.type == duckVM_object_type_string) {
-			if (object1.value.string.internalString == dl_null) {
-				object2.type = duckVM_object_type_string;
-				object2.value.string.internalString = dl_null;
-			}
-			else {
-				if (object1.value.string.internalString->type == duckVM_object_type_internalString) {
-					if ((object1.value.string.length == 0)
-					    || ((dl_size_t) object1.value.string.offset >= object1.value.string.length)) {
-						object2.type = duckVM_object_type_string;
-						object2.value.string.internalString = dl_null;
-					}
-					else {
-						object2.type = duckVM_object_type_integer;
-						object2.value.integer = (object1.value.string.internalString
-						                         ->value.internalString.value[object1.value.string.offset]);
-					}
+		{
+			duckVM_object_t *found = dl_null;
+			for (objectPtr1 = object2.value.list;
+			     (objectPtr1 != dl_null) && (objectPtr1->type == duckVM_object_type_cons);
+			     objectPtr1 = objectPtr1->value.cons.cdr) {
+				dl_bool_t equal = dl_false;
+				duckVM_object_t *pair = objectPtr1->value.cons.car;
+				duckVM_object_t element;
+				if ((pair == dl_null) || (pair->type != duckVM_object_type_cons)) continue;
+				element = duckVM_list_element(pair->value.cons.car);
+				e = duckVM_object_equal(&object1, &element, &equal);
+				if (e) {
+					eError = duckVM_error_pushRuntime(duckVM,
+					                                  DL_STR("duckVM_execute->assoc: Key can't be compared with `=`."));
+					if (eError) e = eError;
+					break;
 				}
-				else {
-					e = dl_error_invalidValue;
+				if (equal) {
+					found = pair;
 					break;
 				}
 			}
+			if (e) break;
+			object3.type = duckVM_object_type_list;
+			object3.value.list = found;
 		}
-		else {
-			e = dl_error_invalidValue;
-			break;
-		}
-		e = stack_push(duckVM, &object2);
+		e = stack_push(duckVM, &object3);
 		if (e) break;
 		break;
 
-	case duckLisp_instruction_setCar32:
+	case duckLisp_instruction_member32:
 		ptrdiff1 = *(ip++);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
@@ -3704,8 +9307,8 @@ int duckVM_executeInstruction(duckVM_t *duckVM,
 		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
 		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
 		parsedBytecode = dl_true;
-		// Fall through
-	case duckLisp_instruction_setCar16:
+		/* Fall through */
+	case duckLisp_instruction_member16:
 		if (!parsedBytecode) {
 			ptrdiff1 = *(ip++);
 			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
@@ -3713,197 +9316,324 @@ int duckVM_executeInstruction(duckVM_t *duckVM,
 			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
 			parsedBytecode = dl_true;
 		}
-		// Fall through
-	case duckLisp_instruction_setCar8:
+		/* Fall through */
+	case duckLisp_instruction_member8:
 		if (!parsedBytecode) {
 			ptrdiff1 = *(ip++);
 			ptrdiff2 = *(ip++);
 		}
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
+		e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
 		if (e) break;
-		e = dl_array_get(&duckVM->stack, &object2, duckVM->stack.elements_length - ptrdiff2);
+		e = stack_getOperand(duckVM, bytecode, &object2, ptrdiff2);
+		if (e) break;
+		if (object2.type != duckVM_object_type_list) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->member: Second argument must be a list."));
+			if (eError) e = eError;
+			break;
+		}
+		if (duckVM_listIsCyclic(object2.value.list)) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->member: List must not be circular."));
+			if (eError) e = eError;
+			break;
+		}
+		{
+			duckVM_object_t *found = dl_null;
+			for (objectPtr1 = object2.value.list;
+			     (objectPtr1 != dl_null) && (objectPtr1->type == duckVM_object_type_cons);
+			     objectPtr1 = objectPtr1->value.cons.cdr) {
+				dl_bool_t equal = dl_false;
+				duckVM_object_t element = duckVM_list_element(objectPtr1->value.cons.car);
+				e = duckVM_object_equal(&object1, &element, &equal);
+				if (e) {
+					eError = duckVM_error_pushRuntime(duckVM,
+					                                  DL_STR("duckVM_execute->member: Value can't be compared with `=`."));
+					if (eError) e = eError;
+					break;
+				}
+				if (equal) {
+					found = objectPtr1;
+					break;
+				}
+			}
+			if (e) break;
+			object3.type = duckVM_object_type_list;
+			object3.value.list = found;
+		}
+		e = stack_push(duckVM, &object3);
 		if (e) break;
+		break;
 
-		if ((object2.type == duckVM_object_type_list) && (object2.value.list != dl_null)) {
-			if (object1.type == duckVM_object_type_list) {
-				if (object1.value.list == dl_null) object2.value.list->value.cons.car = dl_null;
-				else object2.value.list->value.cons.car = object1.value.list;
+	case duckLisp_instruction_makeString32:
+		ptrdiff1 = *(ip++);
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_makeString16:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through. */
+	case duckLisp_instruction_makeString8:
+		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		{
+			dl_uint8_t *string = dl_null;
+			dl_size_t string_length = 0;
+			e = stack_getOperand(duckVM, bytecode, &object1, ptrdiff1);
+			if (e) break;
+			if (object1.type == duckVM_object_type_stringBuilder) {
+				object1 = duckVM_stringBuilder_string(&object1);
+				e = stack_push(duckVM, &object1);
+				break;
 			}
-			else {
-				e = duckVM_gclist_pushObject(duckVM, &objectPtr1, object1);
+			if (object1.type == duckVM_object_type_vector) {
+				dl_size_t vector_length = object1.value.vector.internal_vector->value.internal_vector.length;
+				string_length = duckVM_vector_length(&object1);
+				e = DL_MALLOC(duckVM->memoryAllocation, &string, string_length, dl_uint8_t);
 				if (e) break;
-				object2.value.list->value.cons.car = objectPtr1;
+				for (dl_ptrdiff_t i = object1.value.vector.offset; (dl_size_t) i < vector_length; i++) {
+					duckVM_object_t *element = object1.value.vector.internal_vector->value.internal_vector.values[i];
+					if (element->type != duckVM_object_type_integer) {
+						e = dl_error_invalidValue;
+						eError = duckVM_error_pushRuntime(duckVM,
+						                                  DL_STR("duckVM_execute->make-string: All elements of vector must be integers."));
+						if (eError) e = eError;
+						eError = DL_FREE(duckVM->memoryAllocation, &string);
+						if (eError) e = eError;
+						break;
+					}
+					/* Truncate to 8 bits. */
+					string[i - object1.value.vector.offset] = element->value.integer;
+				}
+			}
+			else if (object1.type == duckVM_object_type_list) {
+				dl_array_t string_array;
+				/**/ dl_array_init(&string_array, duckVM->memoryAllocation, sizeof(char), dl_array_strategy_double);
+				objectPtr1 = object1.value.list;
+				while (objectPtr1 != dl_null) {
+					if (objectPtr1->type == duckVM_object_type_list) {
+						objectPtr1 = objectPtr1->value.list;
+					}
+					else if (objectPtr1->type == duckVM_object_type_cons) {
+						duckVM_object_t *car = objectPtr1->value.cons.car;
+						if (car->type != duckVM_object_type_integer) {
+							e = dl_error_invalidValue;
+							eError = duckVM_error_pushRuntime(duckVM,
+							                                  DL_STR("duckVM_execute->make-string: All list elements must be integers."));
+							if (eError) e = eError;
+							eError = dl_array_quit(&string_array);
+							if (eError) e = eError;
+							break;
+						}
+						uint8 = car->value.integer & 0xFF;
+						e = dl_array_pushElement(&string_array, &uint8);
+						if (e) {
+							e = dl_error_invalidValue;
+							eError = dl_array_quit(&string_array);
+							if (eError) e = eError;
+							break;
+						}
+						objectPtr1 = objectPtr1->value.cons.cdr;
+					}
+					else {
+						e = dl_error_invalidValue;
+						eError = duckVM_error_pushRuntime(duckVM,
+						                                  DL_STR("duckVM_execute->make-string: Not a proper list."));
+						if (eError) e = eError;
+						eError = dl_array_quit(&string_array);
+						if (eError) e = eError;
+						break;
+					}
+				}
+				string = string_array.elements;
+				string_length = string_array.elements_length;
+			}
+			else {
+				e = dl_error_invalidValue;
+				eError = duckVM_error_pushRuntime(duckVM,
+				                                  DL_STR("duckVM_execute->make-string: Only vector arguments are supported."));
+				if (eError) e = eError;
+				eError = DL_FREE(duckVM->memoryAllocation, &string);
+				if (eError) e = eError;
+				break;
 			}
-		}
-		else if ((object2.type == duckVM_object_type_vector)
-		         && (object2.value.vector.internal_vector != dl_null)) {
+			object1.type = duckVM_object_type_internalString;
+			object1.value.internalString.value = string;
+			object1.value.internalString.value_length = string_length;
 			e = duckVM_gclist_pushObject(duckVM, &objectPtr1, object1);
+			if (e) {
+				eError = DL_FREE(duckVM->memoryAllocation, &string);
+				if (eError) e = eError;
+				break;
+			}
+			e = DL_FREE(duckVM->memoryAllocation, &string);
+			if (e) break;
+			object1.type = duckVM_object_type_string;
+			object1.value.string.internalString = objectPtr1;
+			object1.value.string.offset = 0;
+			object1.value.string.length = string_length;
+			e = stack_push(duckVM, &object1);
 			if (e) break;
-			(object2.value.vector.internal_vector
-			 ->value.internal_vector.values[object2.value.vector.offset]) = objectPtr1;
-		}
-		else {
-			e = dl_error_invalidValue;
-			break;
 		}
-		e = stack_push(duckVM, &object2);
 		break;
 
-		// I probably don't need an `if` if I research the standard a bit.
-	case duckLisp_instruction_setCdr32:
+	case duckLisp_instruction_concatenate32:
 		ptrdiff1 = *(ip++);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through */
+	case duckLisp_instruction_concatenate16:
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		/* Fall through */
+	case duckLisp_instruction_concatenate8:
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+
 		ptrdiff2 = *(ip++);
-		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-		parsedBytecode = dl_true;
-		// Fall through
-	case duckLisp_instruction_setCdr16:
-		if (!parsedBytecode) {
-			ptrdiff1 = *(ip++);
-			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-			ptrdiff2 = *(ip++);
+		switch (opcode) {
+		case duckLisp_instruction_concatenate32:
 			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-			parsedBytecode = dl_true;
-		}
-		// Fall through
-	case duckLisp_instruction_setCdr8:
-		if (!parsedBytecode) {
-			ptrdiff1 = *(ip++);
-			ptrdiff2 = *(ip++);
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			/* Fall through */
+		case duckLisp_instruction_concatenate16:
+			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
+			/* Fall through */
+		case duckLisp_instruction_concatenate8:
+			break;
+		default:
+			e = dl_error_cantHappen;
+			break;
 		}
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
-		if (e) break;
-		e = dl_array_get(&duckVM->stack, &object2, duckVM->stack.elements_length - ptrdiff2);
 		if (e) break;
 
-		if ((object2.type == duckVM_object_type_list) && (object2.value.list != dl_null)) {
-			if (object1.type == duckVM_object_type_list) {
-				if (object1.value.list == dl_null) object2.value.list->value.cons.cdr = dl_null;
-				else object2.value.list->value.cons.cdr = object1.value.list;
-			}
-			else {
-				e = duckVM_gclist_pushObject(duckVM, &objectPtr1, object1);
-				if (e) break;
-				object2.value.list->value.cons.cdr = objectPtr1;
-			}
-		}
-		else if ((object2.type == duckVM_object_type_vector)
-		         && (object2.value.vector.internal_vector != dl_null)
-		         && (((object1.type == duckVM_object_type_vector)
-		              && (object1.value.vector.internal_vector == dl_null))
-		             || ((object1.type == duckVM_object_type_list)
-		                 && (object1.value.list == dl_null)))) {
-			object2.value.vector.internal_vector->value.internal_vector.length = object2.value.vector.offset;
-		}
-		else {
+		ptrdiff1 = duckVM->stack.elements_length - ptrdiff1;
+		if ((ptrdiff1 < 0) || ((dl_size_t) ptrdiff1 > duckVM->stack.elements_length)) {
 			e = dl_error_invalidValue;
+			(eError
+			 = duckVM_error_pushRuntime(duckVM,
+			                            DL_STR("duckVM_execute->concatenate: First string stack index out of bounds.")));
+			if (!e) e = eError;
 			break;
 		}
-		e = stack_push(duckVM, &object2);
-		break;
-
-		// I probably don't need an `if` if I research the standard a bit.
-	case duckLisp_instruction_nullp32:
-		ptrdiff1 = *(ip++);
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through */
-	case duckLisp_instruction_nullp16:
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through */
-	case duckLisp_instruction_nullp8:
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
+		e = dl_array_get(&duckVM->stack, &object1, ptrdiff1);
 		if (e) break;
-		object2.type = duckVM_object_type_bool;
-		if (object1.type == duckVM_object_type_list) {
-			object2.value.boolean = (object1.value.list == dl_null);
-		}
-		else if (object1.type == duckVM_object_type_vector) {
-			object2.value.boolean = !((object1.value.vector.internal_vector != dl_null)
-			                          && ((dl_size_t) object1.value.vector.offset
-			                              < object1.value.vector.internal_vector->value.internal_vector.length));
-		}
-		else if (object1.type == duckVM_object_type_string) {
-			object2.value.boolean = !((object1.value.string.internalString != dl_null)
-			                          && ((dl_size_t) object1.value.string.offset < object1.value.string.length));
-		}
-		else {
-			object2.value.boolean = dl_false;
+		if ((object1.type != duckVM_object_type_string) && (object1.type != duckVM_object_type_symbol)) {
+			e = dl_error_invalidValue;
+			(eError
+			 = duckVM_error_pushRuntime(duckVM,
+			                            DL_STR("duckVM_execute->concatenate: First argument must be a string or symbol.")));
+			if (!e) e = eError;
+			break;
 		}
-		e = stack_push(duckVM, &object2);
-		if (e) break;
-		break;
 
-	case duckLisp_instruction_typeof32:
-		ptrdiff1 = *(ip++);
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through. */
-	case duckLisp_instruction_typeof16:
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through. */
-	case duckLisp_instruction_typeof8:
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
-		if (e) break;
-		object2.type = duckVM_object_type_type;
-		object2.value.type = ((object1.type == duckVM_object_type_composite)
-		                      ? object1.value.composite->value.internalComposite.type
-		                      : object1.type);
-		e = stack_push(duckVM, &object2);
+		ptrdiff2 = duckVM->stack.elements_length - ptrdiff2;
+		if ((ptrdiff2 < 0) || ((dl_size_t) ptrdiff2 > duckVM->stack.elements_length)) {
+			e = dl_error_invalidValue;
+			(eError
+			 = duckVM_error_pushRuntime(duckVM,
+			                            DL_STR("duckVM_execute->concatenate: Second string stack index out of bounds.")));
+			if (!e) e = eError;
+			break;
+		}
+		e = dl_array_get(&duckVM->stack, &object2, ptrdiff2);
 		if (e) break;
-		break;
+		if ((object2.type != duckVM_object_type_string) && (object2.type != duckVM_object_type_symbol)) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->concatenate: Second argument must be a string or symbol."));
+			if (!e) e = eError;
+			break;
+		}
 
-	case duckLisp_instruction_makeType:
-		object1.type = duckVM_object_type_type;
-		object1.value.type = duckVM->nextUserType++;
-		e = stack_push(duckVM, &object1);
-		if (e) break;
+		{
+			dl_uint8_t *object1_string = dl_null;
+			dl_size_t object1_string_length = 0;
+			dl_uint8_t *object2_string = dl_null;
+			dl_size_t object2_string_length = 0;
+			if (object1.type == duckVM_object_type_string) {
+				object1_string = (object1.value.string.internalString->value.internalString.value
+				                  + object1.value.string.offset);
+				object1_string_length = object1.value.string.length;
+			}
+			else {
+				object1_string = object1.value.symbol.internalString->value.internalString.value;
+				object1_string_length = object1.value.symbol.internalString->value.internalString.value_length;
+			}
+			if (object2.type == duckVM_object_type_string) {
+				object2_string = (object2.value.string.internalString->value.internalString.value
+				                  + object2.value.string.offset);
+				object2_string_length = object2.value.string.length;
+			}
+			else {
+				object2_string = object2.value.symbol.internalString->value.internalString.value;
+				object2_string_length = object2.value.symbol.internalString->value.internalString.value_length;
+			}
+			object3.type = duckVM_object_type_internalString;
+			object3.value.internalString.value = object1_string;
+			object3.value.internalString.value_length = object1_string_length;
+			e = duckVM_gclist_pushObject(duckVM, &objectPtr1, object3);
+			if (e) break;
+			objectPtr1->value.internalString.value_length = object1_string_length + object2_string_length;
+			e = DL_REALLOC(duckVM->memoryAllocation,
+			               &objectPtr1->value.internalString.value,
+			               objectPtr1->value.internalString.value_length,
+			               dl_uint8_t);
+			if (e) break;
+			objectPtr1->value.internalString.capacity = objectPtr1->value.internalString.value_length;
+			/**/ dl_memcopy_noOverlap((objectPtr1->value.internalString.value + object1_string_length),
+			                          object2_string,
+			                          object2_string_length);
+			object3.type = duckVM_object_type_string;
+			object3.value.string.offset = 0;
+			object3.value.string.length = objectPtr1->value.internalString.value_length;
+			object3.value.string.internalString = objectPtr1;
+			e = stack_push(duckVM, &object3);
+			if (e) {
+				eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->concatenate: stack_push failed."));
+				if (!e) e = eError;
+				break;
+			}
+		}
 		break;
 
-	case duckLisp_instruction_makeInstance32:
+	case duckLisp_instruction_substring32:
 		ptrdiff1 = *(ip++);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
 		/* Fall through */
-	case duckLisp_instruction_makeInstance16:
+	case duckLisp_instruction_substring16:
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
 		/* Fall through */
-	case duckLisp_instruction_makeInstance8:
+	case duckLisp_instruction_substring8:
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
 
 		ptrdiff2 = *(ip++);
 		switch (opcode) {
-		case duckLisp_instruction_makeInstance32:
+		case duckLisp_instruction_substring32:
 			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
 			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
 			/* Fall through */
-		case duckLisp_instruction_makeInstance16:
+		case duckLisp_instruction_substring16:
 			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
 			/* Fall through */
-		case duckLisp_instruction_makeInstance8:
+		case duckLisp_instruction_substring8:
 			break;
 		default:
-			e = dl_error_invalidValue;
+			e = dl_error_cantHappen;
 			break;
 		}
 		if (e) break;
 
 		ptrdiff3 = *(ip++);
 		switch (opcode) {
-		case duckLisp_instruction_makeInstance32:
+		case duckLisp_instruction_substring32:
 			ptrdiff3 = *(ip++) + (ptrdiff3 << 8);
 			ptrdiff3 = *(ip++) + (ptrdiff3 << 8);
 			/* Fall through */
-		case duckLisp_instruction_makeInstance16:
+		case duckLisp_instruction_substring16:
 			ptrdiff3 = *(ip++) + (ptrdiff3 << 8);
 			/* Fall through */
-		case duckLisp_instruction_makeInstance8:
+		case duckLisp_instruction_substring8:
 			break;
 		default:
-			e = dl_error_invalidValue;
+			e = dl_error_cantHappen;
 			break;
 		}
 		if (e) break;
@@ -3911,769 +9641,1307 @@ int duckVM_executeInstruction(duckVM_t *duckVM,
 		ptrdiff1 = duckVM->stack.elements_length - ptrdiff1;
 		if ((ptrdiff1 < 0) || ((dl_size_t) ptrdiff1 > duckVM->stack.elements_length)) {
 			e = dl_error_invalidValue;
-			eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->make-instance: Index out of bounds."));
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->substring: String stack index out of bounds."));
 			if (!e) e = eError;
 			break;
 		}
 		e = dl_array_get(&duckVM->stack, &object1, ptrdiff1);
 		if (e) break;
-		if (object1.type != duckVM_object_type_type) {
+		if (object1.type == duckVM_object_type_stringBuilder) {
+			object1 = duckVM_stringBuilder_string(&object1);
+		}
+		if (object1.type != duckVM_object_type_string) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->substring: dl_array_get failed."));
+			if (!e) e = eError;
+			break;
+		}
+
+		ptrdiff2 = duckVM->stack.elements_length - ptrdiff2;
+		if ((ptrdiff2 < 0) || ((dl_size_t) ptrdiff2 > duckVM->stack.elements_length)) {
 			e = dl_error_invalidValue;
 			eError = duckVM_error_pushRuntime(duckVM,
-			                                  DL_STR("duckVM_execute->make-instance: `type` argument must have type `type`."));
+			                                  DL_STR("duckVM_execute->substring: First integer stack index out of bounds."));
 			if (!e) e = eError;
 			break;
 		}
-		if (object1.value.type < duckVM_object_type_last) {
+		e = dl_array_get(&duckVM->stack, &object2, ptrdiff2);
+		if (e) break;
+		if (object2.type != duckVM_object_type_integer) {
 			e = dl_error_invalidValue;
 			eError = duckVM_error_pushRuntime(duckVM,
-			                                  DL_STR("duckVM_execute->make-instance: Invalid instance type."));
+			                                  DL_STR("duckVM_execute->substring: dl_array_get failed."));
 			if (!e) e = eError;
 			break;
 		}
-
-		ptrdiff2 = duckVM->stack.elements_length - ptrdiff2;
-		if ((ptrdiff2 < 0) || ((dl_size_t) ptrdiff2 > duckVM->stack.elements_length)) {
+		if ((object2.value.integer < 0)
+		    || ((dl_size_t) object2.value.integer > object1.value.string.length - object1.value.string.offset)) {
 			e = dl_error_invalidValue;
-			eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->make-instance: Index out of bounds."));
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->substring: First integer out of bounds."));
 			if (!e) e = eError;
 			break;
 		}
-		e = dl_array_get(&duckVM->stack, &object2, ptrdiff2);
-		if (e) break;
 
 		ptrdiff3 = duckVM->stack.elements_length - ptrdiff3;
 		if ((ptrdiff3 < 0) || ((dl_size_t) ptrdiff3 > duckVM->stack.elements_length)) {
 			e = dl_error_invalidValue;
-			eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->make-instance: Index out of bounds."));
+			eError = duckVM_error_pushRuntime(duckVM,
+			                                  DL_STR("duckVM_execute->substring: Second integer stack index out of bounds."));
 			if (!e) e = eError;
 			break;
 		}
 		e = dl_array_get(&duckVM->stack, &object3, ptrdiff3);
 		if (e) break;
-
-		{
-			/* Allocate internal composite. */
-			dl_size_t type = object1.value.type;
-			object1.type = duckVM_object_type_internalComposite;
-			/* Type. */
-			object1.value.internalComposite.type = type;
-			object1.value.internalComposite.value = dl_null;
-			object1.value.internalComposite.function = dl_null;
-			e = duckVM_gclist_pushObject(duckVM, &objectPtr1, object1);
-			if (e) break;
-			/* Link composite and internal composite to the stack. */
-			object1.type = duckVM_object_type_composite;
-			object1.value.composite = objectPtr1;
-			e = stack_push(duckVM, &object1);
-			if (e) break;
-			/* Value. */
-			e = duckVM_gclist_pushObject(duckVM, &objectPtr1, object2);
-			if (e) break;
-			(DL_ARRAY_GETTOPADDRESS(duckVM->stack, duckVM_object_t).value.composite
-			 ->value.internalComposite.value) = objectPtr1;
-			/* Function. */
-			e = duckVM_gclist_pushObject(duckVM, &objectPtr1, object3);
-			if (e) break;
-			(DL_ARRAY_GETTOPADDRESS(duckVM->stack, duckVM_object_t).value.composite
-			 ->value.internalComposite.function) = objectPtr1;
-		}
-		break;
-
-	case duckLisp_instruction_compositeValue32:
-		ptrdiff1 = *(ip++);
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through. */
-	case duckLisp_instruction_compositeValue16:
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through. */
-	case duckLisp_instruction_compositeValue8:
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
-		if (e) break;
-		if (object1.type != duckVM_object_type_composite) {
+		if (object3.type != duckVM_object_type_integer) {
 			e = dl_error_invalidValue;
 			eError = duckVM_error_pushRuntime(duckVM,
-			                                  DL_STR("duckVM_execute->composite-value: Argument must be a composite type."));
+			                                  DL_STR("duckVM_execute->concatenate: dl_array_get failed."));
 			if (!e) e = eError;
 			break;
 		}
-		e = stack_push(duckVM, object1.value.composite->value.internalComposite.value);
-		if (e) break;
-		break;
-
-	case duckLisp_instruction_compositeFunction32:
-		ptrdiff1 = *(ip++);
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through. */
-	case duckLisp_instruction_compositeFunction16:
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through. */
-	case duckLisp_instruction_compositeFunction8:
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
-		if (e) break;
-		if (object1.type != duckVM_object_type_composite) {
+		if ((object3.value.integer < 0)
+		    || ((dl_size_t) object3.value.integer > object1.value.string.length - object1.value.string.offset)) {
 			e = dl_error_invalidValue;
 			eError = duckVM_error_pushRuntime(duckVM,
-			                                  DL_STR("duckVM_execute->composite-function: Argument must be a composite type."));
+			                                  DL_STR("duckVM_execute->substring: Second integer out of bounds."));
 			if (!e) e = eError;
 			break;
 		}
-		e = stack_push(duckVM, object1.value.composite->value.internalComposite.function);
-		if (e) break;
-		break;
-
-	case duckLisp_instruction_setCompositeValue32:
-		ptrdiff1 = *(ip++);
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		ptrdiff2 = *(ip++);
-		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-		parsedBytecode = dl_true;
-		/* Fall through */
-	case duckLisp_instruction_setCompositeValue16:
-		if (!parsedBytecode) {
-			ptrdiff1 = *(ip++);
-			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-			ptrdiff2 = *(ip++);
-			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-			parsedBytecode = dl_true;
-		}
-		/* Fall through */
-	case duckLisp_instruction_setCompositeValue8:
-		if (!parsedBytecode) {
-			ptrdiff1 = *(ip++);
-			ptrdiff2 = *(ip++);
-		}
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
-		if (e) break;
-		e = dl_array_get(&duckVM->stack, &object2, duckVM->stack.elements_length - ptrdiff2);
-		if (e) break;
 
-		if (object1.type != duckVM_object_type_composite) {
+		if (object3.value.integer < object2.value.integer) {
 			e = dl_error_invalidValue;
 			eError = duckVM_error_pushRuntime(duckVM,
-			                                  DL_STR("duckVM_execute->set-composite-value: First argument must be a composite type."));
+			                                  DL_STR("duckVM_execute->substring: Second integer must be greater than the first."));
 			if (!e) e = eError;
 			break;
 		}
-		e = duckVM_gclist_pushObject(duckVM, &objectPtr1, object2);
-		if (e) break;
-		object1.value.composite->value.internalComposite.value = objectPtr1;
+
+		object1.value.string.length = object1.value.string.offset + object3.value.integer;
+		object1.value.string.offset = object1.value.string.offset + object2.value.integer;
 		e = stack_push(duckVM, &object1);
+		if (e) {
+			eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->concatenate: stack_push failed."));
+			if (!e) e = eError;
+			break;
+		}
 		break;
 
-	case duckLisp_instruction_setCompositeFunction32:
+	case duckLisp_instruction_return32:
 		ptrdiff1 = *(ip++);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
 		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		ptrdiff2 = *(ip++);
-		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-		ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
 		parsedBytecode = dl_true;
 		/* Fall through */
-	case duckLisp_instruction_setCompositeFunction16:
+	case duckLisp_instruction_return16:
 		if (!parsedBytecode) {
 			ptrdiff1 = *(ip++);
 			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-			ptrdiff2 = *(ip++);
-			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
 			parsedBytecode = dl_true;
 		}
 		/* Fall through */
-	case duckLisp_instruction_setCompositeFunction8:
+	case duckLisp_instruction_return8:
 		if (!parsedBytecode) {
 			ptrdiff1 = *(ip++);
-			ptrdiff2 = *(ip++);
 		}
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
-		if (e) break;
-		e = dl_array_get(&duckVM->stack, &object2, duckVM->stack.elements_length - ptrdiff2);
-		if (e) break;
 
-		if (object1.type != duckVM_object_type_composite) {
-			e = dl_error_invalidValue;
-			eError = duckVM_error_pushRuntime(duckVM,
-			                                  DL_STR("duckVM_execute->set-composite-function: First argument must be a composite type."));
-			if (!e) e = eError;
-			break;
+		if (duckVM->stack.elements_length > 0) {
+			e = dl_array_getTop(&duckVM->stack, &object1);
+			if (e) break;
 		}
-		e = duckVM_gclist_pushObject(duckVM, &objectPtr1, object2);
+		e = stack_pop_multiple(duckVM, ptrdiff1);
 		if (e) break;
-		object1.value.composite->value.internalComposite.function = objectPtr1;
-		e = stack_push(duckVM, &object1);
-		break;
-
-	case duckLisp_instruction_length32:
-		ptrdiff1 = *(ip++);
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through. */
-	case duckLisp_instruction_length16:
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through. */
-	case duckLisp_instruction_length8:
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		{
-			e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
+		if (duckVM->stack.elements_length > 0) {
+			e = stack_pop_multiple(duckVM, 1);
 			if (e) break;
-			object2.type = duckVM_object_type_integer;
-			if (object1.type == duckVM_object_type_list) {
-				if (duckVM_listIsCyclic(object1.value.list)) {
-					e = dl_error_invalidValue;
-					eError = duckVM_error_pushRuntime(duckVM,
-					                                  DL_STR("duckVM_execute->length: List must not be circular."));
-					if (!e) e = eError;
-					break;
-				}
-				object2.value.integer = 0;
-				{
-					objectPtr1 = object1.value.list;
-					while ((objectPtr1 != dl_null) && (objectPtr1->type == duckVM_object_type_cons)) {
-						object2.value.integer++;
-						objectPtr1 = objectPtr1->value.cons.cdr;
-					}
-				}
-			}
-			else if (object1.type == duckVM_object_type_vector) {
-				object2.value.integer = (object1.value.vector.internal_vector
-				                         ? (object1.value.vector.internal_vector->value.internal_vector.length
-				                            - object1.value.vector.offset)
-				                         : 0);
+			e = stack_push(duckVM, &object1);
+			if (e) break;
+		}
+		e = call_stack_pop(duckVM, &ip, &bytecode);
+		if (e == dl_error_bufferUnderflow) {
+			if (duckVM->currentCoroutine != barrier) {
+				e = duckVM_coroutine_finish(duckVM, &ip, &bytecode);
+				break;
 			}
-			else if (object1.type == duckVM_object_type_string) {
-				object2.value.integer = object1.value.string.length - object1.value.string.offset;
+			*halt = duckVM_halt_mode_halt;
+			e = dl_error_ok;
+		}
+		break;
+	case duckLisp_instruction_return0:
+		e = call_stack_pop(duckVM, &ip, &bytecode);
+		if (e == dl_error_bufferUnderflow) {
+			if (duckVM->currentCoroutine != barrier) {
+				e = duckVM_coroutine_finish(duckVM, &ip, &bytecode);
+				break;
 			}
-			else {
+			*halt = duckVM_halt_mode_halt;
+			e = dl_error_ok;
+		}
+		break;
+
+	case duckLisp_instruction_halt:
+		*halt = duckVM_halt_mode_halt;
+		break;
+
+	case duckLisp_instruction_nil:
+		object1.type = duckVM_object_type_list;
+		object1.value.list = dl_null;
+		e = stack_push(duckVM, &object1);
+		if (e) break;
+		break;
+
+	default:
+		e = dl_error_invalidValue;
+		eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute: Invalid opcode."));
+		if (!e) e = eError;
+		goto cleanup;
+	}
+	if (!e && (*halt == duckVM_halt_mode_run)) goto next;
+
+ cleanup:
+	*ipPtr = ip;
+	*bytecodePtr = bytecode;
+	return e;
+}
+
+/* Bytecode verification */
+
+typedef struct {
+	dl_ptrdiff_t ip;
+	dl_ptrdiff_t depth;
+} duckVM_verify_path_t;
+
+/* Read a big-endian operand. Fails if the operand runs off the end of the bytecode. */
+static dl_error_t duckVM_verify_readOperand(const dl_uint8_t *bytecode,
+                                            const dl_size_t bytecode_length,
+                                            dl_size_t *ip,
+                                            const dl_size_t width,
+                                            dl_size_t *operand) {
+	if ((*ip > bytecode_length) || (width > bytecode_length - *ip)) return dl_error_bufferOverflow;
+	*operand = 0;
+	DL_DOTIMES(k, width) {
+		*operand = bytecode[(*ip)++] + (*operand << 8);
+	}
+	return dl_error_ok;
+}
+
+/* Read a relative address and convert it into an absolute one. */
+static dl_error_t duckVM_verify_readAddress(const dl_uint8_t *bytecode,
+                                            const dl_size_t bytecode_length,
+                                            dl_size_t *ip,
+                                            const dl_size_t width,
+                                            dl_ptrdiff_t *address) {
+	dl_size_t operand = 0;
+	dl_error_t e = duckVM_verify_readOperand(bytecode, bytecode_length, ip, width, &operand);
+	if (e) return e;
+	*address = operand;
+	if (operand & (0x80ULL << 8*(width - 1))) {
+		*address -= (dl_ptrdiff_t) (0x100ULL << 8*(width - 1));
+	}
+	*address += *ip;
+	return dl_error_ok;
+}
+
+/* Read a stack index and check that it is inside the current frame. */
+static dl_error_t duckVM_verify_readIndex(const dl_uint8_t *bytecode,
+                                          const dl_size_t bytecode_length,
+                                          dl_size_t *ip,
+                                          const dl_size_t width,
+                                          const dl_ptrdiff_t depth) {
+	dl_size_t index = 0;
+	dl_error_t e = duckVM_verify_readOperand(bytecode, bytecode_length, ip, width, &index);
+	if (e) return e;
+	if ((index < 1) || (index > (dl_size_t) depth)) return dl_error_invalidValue;
+	return dl_error_ok;
+}
+
+static dl_error_t duckVM_verify_pushPath(dl_array_t *paths, const dl_ptrdiff_t ip, const dl_ptrdiff_t depth) {
+	duckVM_verify_path_t path;
+	if (depth < 0) return dl_error_invalidValue;
+	path.ip = ip;
+	path.depth = depth;
+	return dl_array_pushElement(paths, &path);
+}
+
+/* Abstractly interpret the bytecode starting at the first byte. Every instruction that can be reached, including the
+   bodies of closures, is visited once and assigned a stack depth relative to the bottom of its frame. Top-level code
+   may index into whatever is already on the stack, so it starts at `stackLength`. Returns `dl_error_invalidValue` if
+   the bytecode cannot be proven safe. */
+static dl_error_t duckVM_verifyBytecode(dl_memoryAllocation_t *memoryAllocation,
+                                        const dl_uint8_t *bytecode,
+                                        const dl_size_t bytecode_length,
+                                        const dl_size_t stackLength) {
+	dl_error_t e = dl_error_ok;
+	dl_error_t eError = dl_error_ok;
+
+	/* -1: Not visited, -2: Operand byte, >= 0: Start of an instruction with this frame depth. */
+	dl_ptrdiff_t *depths = dl_null;
+	dl_array_t paths;
+	/**/ dl_array_init(&paths, memoryAllocation, sizeof(duckVM_verify_path_t), dl_array_strategy_double);
+
+	if (bytecode_length == 0) goto cleanup;
+
+	e = DL_MALLOC(memoryAllocation, &depths, bytecode_length, dl_ptrdiff_t);
+	if (e) goto cleanup;
+	DL_DOTIMES(i, bytecode_length) {
+		depths[i] = -1;
+	}
+
+	e = duckVM_verify_pushPath(&paths, 0, stackLength);
+	if (e) goto cleanup;
+
+	while (paths.elements_length > 0) {
+		duckVM_verify_path_t path;
+		dl_size_t ip = 0;
+		dl_size_t width = 1;
+		dl_size_t operand = 0;
+		dl_size_t count = 0;
+		dl_ptrdiff_t address = 0;
+		dl_ptrdiff_t depth = 0;
+		dl_bool_t fallsThrough = dl_true;
+		dl_size_t opcode;
+
+		e = dl_array_popElement(&paths, &path);
+		if (e) goto cleanup;
+		ip = path.ip;
+		depth = path.depth;
+
+		if ((path.ip < 0) || ((dl_size_t) path.ip >= bytecode_length)) {
+			e = dl_error_invalidValue;
+			goto cleanup;
+		}
+		if (depths[ip] >= 0) {
+			/* Paths that merge must agree on the depth of the stack. */
+			if (depths[ip] != depth) {
 				e = dl_error_invalidValue;
-				(eError
-				 = duckVM_error_pushRuntime(duckVM,
-				                            DL_STR("duckVM_execute->length: Argument must be a list, vector, or string.")));
-				if (eError) e = eError;
-				break;
+				goto cleanup;
 			}
-			e = stack_push(duckVM, &object2);
-			if (e) break;
+			continue;
 		}
-		break;
-
-	case duckLisp_instruction_symbolString32:
-		ptrdiff1 = *(ip++);
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through. */
-	case duckLisp_instruction_symbolString16:
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through. */
-	case duckLisp_instruction_symbolString8:
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
-		if (e) break;
-		if (object1.type != duckVM_object_type_symbol) {
+		if (depths[ip] == -2) {
+			/* Branched into the middle of an instruction. */
 			e = dl_error_invalidValue;
-			eError = duckVM_error_pushRuntime(duckVM,
-			                                  DL_STR("duckVM_execute->symbol-string: Argument must be a symbol."));
-			if (eError) e = eError;
+			goto cleanup;
+		}
+		depths[ip] = depth;
+
+		opcode = bytecode[ip++];
+		if (opcode == duckLisp_instruction_extended) {
+			if (ip >= bytecode_length) {
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			opcode = duckLisp_instruction_extendedFirst + bytecode[ip++];
+		}
+		switch (opcode) {
+		case duckLisp_instruction_pushString32:
+		case duckLisp_instruction_pushIndex32:
+		case duckLisp_instruction_pushInteger32:
+		case duckLisp_instruction_pushSymbol32:
+		case duckLisp_instruction_pushStrippedSymbol32:
+		case duckLisp_instruction_pushUpvalue32:
+		case duckLisp_instruction_pushClosure32:
+		case duckLisp_instruction_pushVaClosure32:
+		case duckLisp_instruction_pushGlobal32:
+		case duckLisp_instruction_setUpvalue32:
+		case duckLisp_instruction_setGlobal32:
+		case duckLisp_instruction_releaseUpvalues32:
+		case duckLisp_instruction_funcall32:
+		case duckLisp_instruction_apply32:
+		case duckLisp_instruction_jump32:
+		case duckLisp_instruction_brnz32:
+		case duckLisp_instruction_move32:
+		case duckLisp_instruction_not32:
+		case duckLisp_instruction_mul32:
+		case duckLisp_instruction_div32:
+		case duckLisp_instruction_add32:
+		case duckLisp_instruction_sub32:
+		case duckLisp_instruction_equal32:
+		case duckLisp_instruction_greater32:
+		case duckLisp_instruction_less32:
+		case duckLisp_instruction_cons32:
+		case duckLisp_instruction_vector32:
+		case duckLisp_instruction_makeVector32:
+		case duckLisp_instruction_getVecElt32:
+		case duckLisp_instruction_setVecElt32:
+		case duckLisp_instruction_car32:
+		case duckLisp_instruction_cdr32:
+		case duckLisp_instruction_setCar32:
+		case duckLisp_instruction_setCdr32:
+		case duckLisp_instruction_nullp32:
+		case duckLisp_instruction_typeof32:
+		case duckLisp_instruction_makeInstance32:
+		case duckLisp_instruction_compositeValue32:
+		case duckLisp_instruction_compositeFunction32:
+		case duckLisp_instruction_setCompositeValue32:
+		case duckLisp_instruction_setCompositeFunction32:
+		case duckLisp_instruction_makeString32:
+		case duckLisp_instruction_concatenate32:
+		case duckLisp_instruction_substring32:
+		case duckLisp_instruction_length32:
+		case duckLisp_instruction_symbolString32:
+		case duckLisp_instruction_symbolId32:
+		case duckLisp_instruction_makeCoroutine32:
+		case duckLisp_instruction_resume32:
+		case duckLisp_instruction_yield32:
+		case duckLisp_instruction_coroutineDonep32:
+		case duckLisp_instruction_send32:
+		case duckLisp_instruction_receive32:
+		case duckLisp_instruction_tryReceive32:
+		case duckLisp_instruction_freeze32:
+		case duckLisp_instruction_parallelMap32:
+		case duckLisp_instruction_hashTableGet32:
+		case duckLisp_instruction_hashTableSet32:
+		case duckLisp_instruction_hashTableDelete32:
+		case duckLisp_instruction_hashTableNext32:
+		case duckLisp_instruction_vectorPush32:
+		case duckLisp_instruction_vectorPop32:
+		case duckLisp_instruction_vectorTruncate32:
+		case duckLisp_instruction_stringBuilderAppend32:
+		case duckLisp_instruction_stringSearch32:
+		case duckLisp_instruction_stringCompare32:
+		case duckLisp_instruction_utf8Validp32:
+		case duckLisp_instruction_utf8Length32:
+		case duckLisp_instruction_stringUpcase32:
+		case duckLisp_instruction_stringDowncase32:
+		case duckLisp_instruction_makeTypedArray32:
+		case duckLisp_instruction_typedArraySum32:
+		case duckLisp_instruction_typedArrayDot32:
+		case duckLisp_instruction_typedArrayScale32:
+		case duckLisp_instruction_typedArrayAdd32:
+		case duckLisp_instruction_typedArrayMul32:
+		case duckLisp_instruction_typedArrayMin32:
+		case duckLisp_instruction_typedArrayMax32:
+		case duckLisp_instruction_makeRecord32:
+		case duckLisp_instruction_recordSlot32:
+		case duckLisp_instruction_setRecordSlot32:
+		case duckLisp_instruction_pushQuoted32:
+		case duckLisp_instruction_setQuoted32:
+		case duckLisp_instruction_nth32:
+		case duckLisp_instruction_nthcdr32:
+		case duckLisp_instruction_append32:
+		case duckLisp_instruction_reverse32:
+		case duckLisp_instruction_assoc32:
+		case duckLisp_instruction_member32:
+		case duckLisp_instruction_pop32:
+		case duckLisp_instruction_return32:
+			width = 4;
+			break;
+		case duckLisp_instruction_pushString16:
+		case duckLisp_instruction_pushIndex16:
+		case duckLisp_instruction_pushInteger16:
+		case duckLisp_instruction_pushSymbol16:
+		case duckLisp_instruction_pushStrippedSymbol16:
+		case duckLisp_instruction_pushUpvalue16:
+		case duckLisp_instruction_pushClosure16:
+		case duckLisp_instruction_pushVaClosure16:
+		case duckLisp_instruction_pushGlobal16:
+		case duckLisp_instruction_setUpvalue16:
+		case duckLisp_instruction_setGlobal16:
+		case duckLisp_instruction_releaseUpvalues16:
+		case duckLisp_instruction_funcall16:
+		case duckLisp_instruction_apply16:
+		case duckLisp_instruction_jump16:
+		case duckLisp_instruction_brnz16:
+		case duckLisp_instruction_move16:
+		case duckLisp_instruction_not16:
+		case duckLisp_instruction_mul16:
+		case duckLisp_instruction_div16:
+		case duckLisp_instruction_add16:
+		case duckLisp_instruction_sub16:
+		case duckLisp_instruction_equal16:
+		case duckLisp_instruction_greater16:
+		case duckLisp_instruction_less16:
+		case duckLisp_instruction_cons16:
+		case duckLisp_instruction_vector16:
+		case duckLisp_instruction_makeVector16:
+		case duckLisp_instruction_getVecElt16:
+		case duckLisp_instruction_setVecElt16:
+		case duckLisp_instruction_car16:
+		case duckLisp_instruction_cdr16:
+		case duckLisp_instruction_setCar16:
+		case duckLisp_instruction_setCdr16:
+		case duckLisp_instruction_nullp16:
+		case duckLisp_instruction_typeof16:
+		case duckLisp_instruction_makeInstance16:
+		case duckLisp_instruction_compositeValue16:
+		case duckLisp_instruction_compositeFunction16:
+		case duckLisp_instruction_setCompositeValue16:
+		case duckLisp_instruction_setCompositeFunction16:
+		case duckLisp_instruction_makeString16:
+		case duckLisp_instruction_concatenate16:
+		case duckLisp_instruction_substring16:
+		case duckLisp_instruction_length16:
+		case duckLisp_instruction_symbolString16:
+		case duckLisp_instruction_symbolId16:
+		case duckLisp_instruction_makeCoroutine16:
+		case duckLisp_instruction_resume16:
+		case duckLisp_instruction_yield16:
+		case duckLisp_instruction_coroutineDonep16:
+		case duckLisp_instruction_send16:
+		case duckLisp_instruction_receive16:
+		case duckLisp_instruction_tryReceive16:
+		case duckLisp_instruction_freeze16:
+		case duckLisp_instruction_parallelMap16:
+		case duckLisp_instruction_hashTableGet16:
+		case duckLisp_instruction_hashTableSet16:
+		case duckLisp_instruction_hashTableDelete16:
+		case duckLisp_instruction_hashTableNext16:
+		case duckLisp_instruction_vectorPush16:
+		case duckLisp_instruction_vectorPop16:
+		case duckLisp_instruction_vectorTruncate16:
+		case duckLisp_instruction_stringBuilderAppend16:
+		case duckLisp_instruction_stringSearch16:
+		case duckLisp_instruction_stringCompare16:
+		case duckLisp_instruction_utf8Validp16:
+		case duckLisp_instruction_utf8Length16:
+		case duckLisp_instruction_stringUpcase16:
+		case duckLisp_instruction_stringDowncase16:
+		case duckLisp_instruction_makeTypedArray16:
+		case duckLisp_instruction_typedArraySum16:
+		case duckLisp_instruction_typedArrayDot16:
+		case duckLisp_instruction_typedArrayScale16:
+		case duckLisp_instruction_typedArrayAdd16:
+		case duckLisp_instruction_typedArrayMul16:
+		case duckLisp_instruction_typedArrayMin16:
+		case duckLisp_instruction_typedArrayMax16:
+		case duckLisp_instruction_makeRecord16:
+		case duckLisp_instruction_recordSlot16:
+		case duckLisp_instruction_setRecordSlot16:
+		case duckLisp_instruction_pushQuoted16:
+		case duckLisp_instruction_setQuoted16:
+		case duckLisp_instruction_nth16:
+		case duckLisp_instruction_nthcdr16:
+		case duckLisp_instruction_append16:
+		case duckLisp_instruction_reverse16:
+		case duckLisp_instruction_assoc16:
+		case duckLisp_instruction_member16:
+		case duckLisp_instruction_pop16:
+		case duckLisp_instruction_return16:
+			width = 2;
 			break;
+		default:
+			width = 1;
 		}
-		object2.type = duckVM_object_type_string;
-		object2.value.string.internalString = object1.value.symbol.internalString;
-		object2.value.string.offset = 0;
-		object2.value.string.length = object1.value.symbol.internalString->value.internalString.value_length;
-		e = stack_push(duckVM, &object2);
-		if (e) break;
-		break;
 
-	case duckLisp_instruction_symbolId32:
-		ptrdiff1 = *(ip++);
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through. */
-	case duckLisp_instruction_symbolId16:
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through. */
-	case duckLisp_instruction_symbolId8:
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
+		switch (opcode) {
+		case duckLisp_instruction_nop:
+			break;
+
+		case duckLisp_instruction_pushBooleanFalse:
+		case duckLisp_instruction_pushBooleanTrue:
+		case duckLisp_instruction_makeType:
+		case duckLisp_instruction_nil:
+		case duckLisp_instruction_makeStringBuilder:
+		case duckLisp_instruction_makeHashTable:
+			depth++;
+			break;
+
+		case duckLisp_instruction_pushInteger8:
+		case duckLisp_instruction_pushInteger16:
+		case duckLisp_instruction_pushInteger32:
+		case duckLisp_instruction_pushStrippedSymbol8:
+		case duckLisp_instruction_pushStrippedSymbol16:
+		case duckLisp_instruction_pushStrippedSymbol32:
+		case duckLisp_instruction_pushUpvalue8:
+		case duckLisp_instruction_pushUpvalue16:
+		case duckLisp_instruction_pushUpvalue32:
+		case duckLisp_instruction_pushGlobal8:
+		case duckLisp_instruction_pushGlobal16:
+		case duckLisp_instruction_pushGlobal32:
+			e = duckVM_verify_readOperand(bytecode, bytecode_length, &ip, width, &operand);
+			if (e) break;
+			depth++;
+			break;
 
-		e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
-		if (e) break;
-		if (object1.type != duckVM_object_type_symbol) {
-			e = dl_error_invalidValue;
-			eError = duckVM_error_pushRuntime(duckVM,
-			                                  DL_STR("duckVM_execute->symbol-id: Argument must be a symbol."));
-			if (eError) e = eError;
+		case duckLisp_instruction_pushDoubleFloat:
+			e = duckVM_verify_readOperand(bytecode, bytecode_length, &ip, 8, &operand);
+			if (e) break;
+			depth++;
 			break;
-		}
-		object2.type = duckVM_object_type_integer;
-		object2.value.integer = object1.value.symbol.id;
-		e = stack_push(duckVM, &object2);
-		if (e) break;
-		break;
 
-	case duckLisp_instruction_makeString32:
-		ptrdiff1 = *(ip++);
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through. */
-	case duckLisp_instruction_makeString16:
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through. */
-	case duckLisp_instruction_makeString8:
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		{
-			dl_uint8_t *string = dl_null;
-			dl_size_t string_length = 0;
-			e = dl_array_get(&duckVM->stack, &object1, duckVM->stack.elements_length - ptrdiff1);
+		case duckLisp_instruction_pushString8:
+		case duckLisp_instruction_pushString16:
+		case duckLisp_instruction_pushString32:
+			e = duckVM_verify_readOperand(bytecode, bytecode_length, &ip, width, &count);
 			if (e) break;
-			if (object1.type == duckVM_object_type_vector) {
-				dl_size_t vector_length = object1.value.vector.internal_vector->value.internal_vector.length;
-				string_length = vector_length - object1.value.vector.offset;
-				e = DL_MALLOC(duckVM->memoryAllocation, &string, string_length, dl_uint8_t);
-				if (e) break;
-				for (dl_ptrdiff_t i = object1.value.vector.offset; (dl_size_t) i < vector_length; i++) {
-					duckVM_object_t *element = object1.value.vector.internal_vector->value.internal_vector.values[i];
-					if (element->type != duckVM_object_type_integer) {
-						e = dl_error_invalidValue;
-						eError = duckVM_error_pushRuntime(duckVM,
-						                                  DL_STR("duckVM_execute->make-string: All elements of vector must be integers."));
-						if (eError) e = eError;
-						eError = DL_FREE(duckVM->memoryAllocation, &string);
-						if (eError) e = eError;
-						break;
-					}
-					/* Truncate to 8 bits. */
-					string[i - object1.value.vector.offset] = element->value.integer;
-				}
-			}
-			else if (object1.type == duckVM_object_type_list) {
-				dl_array_t string_array;
-				/**/ dl_array_init(&string_array, duckVM->memoryAllocation, sizeof(char), dl_array_strategy_double);
-				objectPtr1 = object1.value.list;
-				while (objectPtr1 != dl_null) {
-					if (objectPtr1->type == duckVM_object_type_list) {
-						objectPtr1 = objectPtr1->value.list;
-					}
-					else if (objectPtr1->type == duckVM_object_type_cons) {
-						duckVM_object_t *car = objectPtr1->value.cons.car;
-						if (car->type != duckVM_object_type_integer) {
-							e = dl_error_invalidValue;
-							eError = duckVM_error_pushRuntime(duckVM,
-							                                  DL_STR("duckVM_execute->make-string: All list elements must be integers."));
-							if (eError) e = eError;
-							eError = dl_array_quit(&string_array);
-							if (eError) e = eError;
-							break;
-						}
-						uint8 = car->value.integer & 0xFF;
-						e = dl_array_pushElement(&string_array, &uint8);
-						if (e) {
-							e = dl_error_invalidValue;
-							eError = dl_array_quit(&string_array);
-							if (eError) e = eError;
-							break;
-						}
-						objectPtr1 = objectPtr1->value.cons.cdr;
-					}
-					else {
-						e = dl_error_invalidValue;
-						eError = duckVM_error_pushRuntime(duckVM,
-						                                  DL_STR("duckVM_execute->make-string: Not a proper list."));
-						if (eError) e = eError;
-						eError = dl_array_quit(&string_array);
-						if (eError) e = eError;
-						break;
-					}
-				}
-				string = string_array.elements;
-				string_length = string_array.elements_length;
-			}
-			else {
-				e = dl_error_invalidValue;
-				eError = duckVM_error_pushRuntime(duckVM,
-				                                  DL_STR("duckVM_execute->make-string: Only vector arguments are supported."));
-				if (eError) e = eError;
-				eError = DL_FREE(duckVM->memoryAllocation, &string);
-				if (eError) e = eError;
-				break;
-			}
-			object1.type = duckVM_object_type_internalString;
-			object1.value.internalString.value = string;
-			object1.value.internalString.value_length = string_length;
-			e = duckVM_gclist_pushObject(duckVM, &objectPtr1, object1);
-			if (e) {
-				eError = DL_FREE(duckVM->memoryAllocation, &string);
-				if (eError) e = eError;
+			if (count > bytecode_length - ip) {
+				e = dl_error_bufferOverflow;
 				break;
 			}
-			e = DL_FREE(duckVM->memoryAllocation, &string);
+			ip += count;
+			depth++;
+			break;
+
+		case duckLisp_instruction_pushSymbol8:
+		case duckLisp_instruction_pushSymbol16:
+		case duckLisp_instruction_pushSymbol32:
+			/* ID */
+			e = duckVM_verify_readOperand(bytecode, bytecode_length, &ip, width, &operand);
 			if (e) break;
-			object1.type = duckVM_object_type_string;
-			object1.value.string.internalString = objectPtr1;
-			object1.value.string.offset = 0;
-			object1.value.string.length = string_length;
-			e = stack_push(duckVM, &object1);
+			/* Name */
+			e = duckVM_verify_readOperand(bytecode, bytecode_length, &ip, width, &count);
 			if (e) break;
-		}
-		break;
-
-	case duckLisp_instruction_concatenate32:
-		ptrdiff1 = *(ip++);
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through */
-	case duckLisp_instruction_concatenate16:
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through */
-	case duckLisp_instruction_concatenate8:
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-
-		ptrdiff2 = *(ip++);
-		switch (opcode) {
-		case duckLisp_instruction_concatenate32:
-			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-			/* Fall through */
-		case duckLisp_instruction_concatenate16:
-			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-			/* Fall through */
+			if (count > bytecode_length - ip) {
+				e = dl_error_bufferOverflow;
+				break;
+			}
+			ip += count;
+			depth++;
+			break;
+
+		case duckLisp_instruction_pushIndex8:
+		case duckLisp_instruction_pushIndex16:
+		case duckLisp_instruction_pushIndex32:
+		case duckLisp_instruction_not8:
+		case duckLisp_instruction_not16:
+		case duckLisp_instruction_not32:
+		case duckLisp_instruction_car8:
+		case duckLisp_instruction_car16:
+		case duckLisp_instruction_car32:
+		case duckLisp_instruction_cdr8:
+		case duckLisp_instruction_cdr16:
+		case duckLisp_instruction_cdr32:
+		case duckLisp_instruction_nullp8:
+		case duckLisp_instruction_nullp16:
+		case duckLisp_instruction_nullp32:
+		case duckLisp_instruction_typeof8:
+		case duckLisp_instruction_typeof16:
+		case duckLisp_instruction_typeof32:
+		case duckLisp_instruction_compositeValue8:
+		case duckLisp_instruction_compositeValue16:
+		case duckLisp_instruction_compositeValue32:
+		case duckLisp_instruction_compositeFunction8:
+		case duckLisp_instruction_compositeFunction16:
+		case duckLisp_instruction_compositeFunction32:
+		case duckLisp_instruction_makeString8:
+		case duckLisp_instruction_makeString16:
+		case duckLisp_instruction_makeString32:
+		case duckLisp_instruction_length8:
+		case duckLisp_instruction_length16:
+		case duckLisp_instruction_length32:
+		case duckLisp_instruction_symbolString8:
+		case duckLisp_instruction_symbolString16:
+		case duckLisp_instruction_symbolString32:
+		case duckLisp_instruction_symbolId8:
+		case duckLisp_instruction_symbolId16:
+		case duckLisp_instruction_symbolId32:
+		case duckLisp_instruction_makeCoroutine8:
+		case duckLisp_instruction_makeCoroutine16:
+		case duckLisp_instruction_makeCoroutine32:
+		case duckLisp_instruction_yield8:
+		case duckLisp_instruction_yield16:
+		case duckLisp_instruction_yield32:
+		case duckLisp_instruction_coroutineDonep8:
+		case duckLisp_instruction_coroutineDonep16:
+		case duckLisp_instruction_coroutineDonep32:
+		case duckLisp_instruction_receive8:
+		case duckLisp_instruction_receive16:
+		case duckLisp_instruction_receive32:
+		case duckLisp_instruction_freeze8:
+		case duckLisp_instruction_freeze16:
+		case duckLisp_instruction_freeze32:
+		case duckLisp_instruction_vectorPop8:
+		case duckLisp_instruction_vectorPop16:
+		case duckLisp_instruction_vectorPop32:
+		case duckLisp_instruction_utf8Validp8:
+		case duckLisp_instruction_utf8Validp16:
+		case duckLisp_instruction_utf8Validp32:
+		case duckLisp_instruction_utf8Length8:
+		case duckLisp_instruction_utf8Length16:
+		case duckLisp_instruction_utf8Length32:
+		case duckLisp_instruction_stringUpcase8:
+		case duckLisp_instruction_stringUpcase16:
+		case duckLisp_instruction_stringUpcase32:
+		case duckLisp_instruction_stringDowncase8:
+		case duckLisp_instruction_stringDowncase16:
+		case duckLisp_instruction_stringDowncase32:
+		case duckLisp_instruction_typedArraySum8:
+		case duckLisp_instruction_typedArraySum16:
+		case duckLisp_instruction_typedArraySum32:
+		case duckLisp_instruction_typedArrayMin8:
+		case duckLisp_instruction_typedArrayMin16:
+		case duckLisp_instruction_typedArrayMin32:
+		case duckLisp_instruction_typedArrayMax8:
+		case duckLisp_instruction_typedArrayMax16:
+		case duckLisp_instruction_typedArrayMax32:
+		case duckLisp_instruction_reverse8:
+		case duckLisp_instruction_reverse16:
+		case duckLisp_instruction_reverse32:
+			e = duckVM_verify_readIndex(bytecode, bytecode_length, &ip, width, depth);
+			if (e) break;
+			depth++;
+			break;
+
+		case duckLisp_instruction_mul8:
+		case duckLisp_instruction_mul16:
+		case duckLisp_instruction_mul32:
+		case duckLisp_instruction_div8:
+		case duckLisp_instruction_div16:
+		case duckLisp_instruction_div32:
+		case duckLisp_instruction_add8:
+		case duckLisp_instruction_add16:
+		case duckLisp_instruction_add32:
+		case duckLisp_instruction_sub8:
+		case duckLisp_instruction_sub16:
+		case duckLisp_instruction_sub32:
+		case duckLisp_instruction_equal8:
+		case duckLisp_instruction_equal16:
+		case duckLisp_instruction_equal32:
+		case duckLisp_instruction_greater8:
+		case duckLisp_instruction_greater16:
+		case duckLisp_instruction_greater32:
+		case duckLisp_instruction_less8:
+		case duckLisp_instruction_less16:
+		case duckLisp_instruction_less32:
+		case duckLisp_instruction_cons8:
+		case duckLisp_instruction_cons16:
+		case duckLisp_instruction_cons32:
+		case duckLisp_instruction_makeVector8:
+		case duckLisp_instruction_makeVector16:
+		case duckLisp_instruction_makeVector32:
+		case duckLisp_instruction_getVecElt8:
+		case duckLisp_instruction_getVecElt16:
+		case duckLisp_instruction_getVecElt32:
+		case duckLisp_instruction_setCar8:
+		case duckLisp_instruction_setCar16:
+		case duckLisp_instruction_setCar32:
+		case duckLisp_instruction_setCdr8:
+		case duckLisp_instruction_setCdr16:
+		case duckLisp_instruction_setCdr32:
+		case duckLisp_instruction_setCompositeValue8:
+		case duckLisp_instruction_setCompositeValue16:
+		case duckLisp_instruction_setCompositeValue32:
+		case duckLisp_instruction_setCompositeFunction8:
+		case duckLisp_instruction_setCompositeFunction16:
+		case duckLisp_instruction_setCompositeFunction32:
 		case duckLisp_instruction_concatenate8:
+		case duckLisp_instruction_concatenate16:
+		case duckLisp_instruction_concatenate32:
+		case duckLisp_instruction_resume8:
+		case duckLisp_instruction_resume16:
+		case duckLisp_instruction_resume32:
+		case duckLisp_instruction_send8:
+		case duckLisp_instruction_send16:
+		case duckLisp_instruction_send32:
+		case duckLisp_instruction_tryReceive8:
+		case duckLisp_instruction_tryReceive16:
+		case duckLisp_instruction_tryReceive32:
+		case duckLisp_instruction_parallelMap8:
+		case duckLisp_instruction_parallelMap16:
+		case duckLisp_instruction_parallelMap32:
+		case duckLisp_instruction_hashTableDelete8:
+		case duckLisp_instruction_hashTableDelete16:
+		case duckLisp_instruction_hashTableDelete32:
+		case duckLisp_instruction_hashTableNext8:
+		case duckLisp_instruction_hashTableNext16:
+		case duckLisp_instruction_hashTableNext32:
+		case duckLisp_instruction_vectorPush8:
+		case duckLisp_instruction_vectorPush16:
+		case duckLisp_instruction_vectorPush32:
+		case duckLisp_instruction_vectorTruncate8:
+		case duckLisp_instruction_vectorTruncate16:
+		case duckLisp_instruction_vectorTruncate32:
+		case duckLisp_instruction_stringBuilderAppend8:
+		case duckLisp_instruction_stringBuilderAppend16:
+		case duckLisp_instruction_stringBuilderAppend32:
+		case duckLisp_instruction_stringCompare8:
+		case duckLisp_instruction_stringCompare16:
+		case duckLisp_instruction_stringCompare32:
+		case duckLisp_instruction_makeTypedArray8:
+		case duckLisp_instruction_makeTypedArray16:
+		case duckLisp_instruction_makeTypedArray32:
+		case duckLisp_instruction_typedArrayDot8:
+		case duckLisp_instruction_typedArrayDot16:
+		case duckLisp_instruction_typedArrayDot32:
+		case duckLisp_instruction_typedArrayScale8:
+		case duckLisp_instruction_typedArrayScale16:
+		case duckLisp_instruction_typedArrayScale32:
+		case duckLisp_instruction_typedArrayAdd8:
+		case duckLisp_instruction_typedArrayAdd16:
+		case duckLisp_instruction_typedArrayAdd32:
+		case duckLisp_instruction_typedArrayMul8:
+		case duckLisp_instruction_typedArrayMul16:
+		case duckLisp_instruction_typedArrayMul32:
+		case duckLisp_instruction_makeRecord8:
+		case duckLisp_instruction_makeRecord16:
+		case duckLisp_instruction_makeRecord32:
+		case duckLisp_instruction_nth8:
+		case duckLisp_instruction_nth16:
+		case duckLisp_instruction_nth32:
+		case duckLisp_instruction_nthcdr8:
+		case duckLisp_instruction_nthcdr16:
+		case duckLisp_instruction_nthcdr32:
+		case duckLisp_instruction_append8:
+		case duckLisp_instruction_append16:
+		case duckLisp_instruction_append32:
+		case duckLisp_instruction_assoc8:
+		case duckLisp_instruction_assoc16:
+		case duckLisp_instruction_assoc32:
+		case duckLisp_instruction_member8:
+		case duckLisp_instruction_member16:
+		case duckLisp_instruction_member32:
+		case duckLisp_instruction_mulInteger8:
+		case duckLisp_instruction_mulFloat8:
+		case duckLisp_instruction_divInteger8:
+		case duckLisp_instruction_divFloat8:
+		case duckLisp_instruction_addInteger8:
+		case duckLisp_instruction_addFloat8:
+		case duckLisp_instruction_subInteger8:
+		case duckLisp_instruction_subFloat8:
+		case duckLisp_instruction_equalInteger8:
+		case duckLisp_instruction_equalFloat8:
+		case duckLisp_instruction_greaterInteger8:
+		case duckLisp_instruction_greaterFloat8:
+		case duckLisp_instruction_lessInteger8:
+		case duckLisp_instruction_lessFloat8:
+			DL_DOTIMES(k, 2) {
+				e = duckVM_verify_readIndex(bytecode, bytecode_length, &ip, width, depth);
+				if (e) break;
+			}
+			if (e) break;
+			depth++;
 			break;
-		default:
-			e = dl_error_cantHappen;
+
+		case duckLisp_instruction_setVecElt8:
+		case duckLisp_instruction_setVecElt16:
+		case duckLisp_instruction_setVecElt32:
+		case duckLisp_instruction_makeInstance8:
+		case duckLisp_instruction_makeInstance16:
+		case duckLisp_instruction_makeInstance32:
+		case duckLisp_instruction_substring8:
+		case duckLisp_instruction_substring16:
+		case duckLisp_instruction_substring32:
+		case duckLisp_instruction_hashTableGet8:
+		case duckLisp_instruction_hashTableGet16:
+		case duckLisp_instruction_hashTableGet32:
+		case duckLisp_instruction_hashTableSet8:
+		case duckLisp_instruction_hashTableSet16:
+		case duckLisp_instruction_hashTableSet32:
+		case duckLisp_instruction_stringSearch8:
+		case duckLisp_instruction_stringSearch16:
+		case duckLisp_instruction_stringSearch32:
+			DL_DOTIMES(k, 3) {
+				e = duckVM_verify_readIndex(bytecode, bytecode_length, &ip, width, depth);
+				if (e) break;
+			}
+			if (e) break;
+			depth++;
 			break;
-		}
-		if (e) break;
 
-		ptrdiff1 = duckVM->stack.elements_length - ptrdiff1;
-		if ((ptrdiff1 < 0) || ((dl_size_t) ptrdiff1 > duckVM->stack.elements_length)) {
-			e = dl_error_invalidValue;
-			(eError
-			 = duckVM_error_pushRuntime(duckVM,
-			                            DL_STR("duckVM_execute->concatenate: First string stack index out of bounds.")));
-			if (!e) e = eError;
+		case duckLisp_instruction_pushQuoted8:
+		case duckLisp_instruction_pushQuoted16:
+		case duckLisp_instruction_pushQuoted32:
+			e = duckVM_verify_readOperand(bytecode, bytecode_length, &ip, width, &operand);
+			if (e) break;
+			depth++;
 			break;
-		}
-		e = dl_array_get(&duckVM->stack, &object1, ptrdiff1);
-		if (e) break;
-		if ((object1.type != duckVM_object_type_string) && (object1.type != duckVM_object_type_symbol)) {
-			e = dl_error_invalidValue;
-			(eError
-			 = duckVM_error_pushRuntime(duckVM,
-			                            DL_STR("duckVM_execute->concatenate: First argument must be a string or symbol.")));
-			if (!e) e = eError;
+
+		case duckLisp_instruction_setQuoted8:
+		case duckLisp_instruction_setQuoted16:
+		case duckLisp_instruction_setQuoted32:
+			e = duckVM_verify_readIndex(bytecode, bytecode_length, &ip, width, depth);
+			if (e) break;
+			e = duckVM_verify_readOperand(bytecode, bytecode_length, &ip, width, &operand);
+			if (e) break;
+			break;
+
+		case duckLisp_instruction_recordSlot8:
+		case duckLisp_instruction_recordSlot16:
+		case duckLisp_instruction_recordSlot32:
+			/* The slot is an immediate. It is checked against the record's length when the instruction runs. */
+			e = duckVM_verify_readIndex(bytecode, bytecode_length, &ip, width, depth);
+			if (e) break;
+			e = duckVM_verify_readOperand(bytecode, bytecode_length, &ip, width, &operand);
+			if (e) break;
+			depth++;
 			break;
-		}
 
-		ptrdiff2 = duckVM->stack.elements_length - ptrdiff2;
-		if ((ptrdiff2 < 0) || ((dl_size_t) ptrdiff2 > duckVM->stack.elements_length)) {
-			e = dl_error_invalidValue;
-			(eError
-			 = duckVM_error_pushRuntime(duckVM,
-			                            DL_STR("duckVM_execute->concatenate: Second string stack index out of bounds.")));
-			if (!e) e = eError;
-			break;
-		}
-		e = dl_array_get(&duckVM->stack, &object2, ptrdiff2);
-		if (e) break;
-		if ((object2.type != duckVM_object_type_string) && (object2.type != duckVM_object_type_symbol)) {
-			e = dl_error_invalidValue;
-			eError = duckVM_error_pushRuntime(duckVM,
-			                                  DL_STR("duckVM_execute->concatenate: Second argument must be a string or symbol."));
-			if (!e) e = eError;
+		case duckLisp_instruction_setRecordSlot8:
+		case duckLisp_instruction_setRecordSlot16:
+		case duckLisp_instruction_setRecordSlot32:
+			e = duckVM_verify_readIndex(bytecode, bytecode_length, &ip, width, depth);
+			if (e) break;
+			e = duckVM_verify_readOperand(bytecode, bytecode_length, &ip, width, &operand);
+			if (e) break;
+			e = duckVM_verify_readIndex(bytecode, bytecode_length, &ip, width, depth);
+			if (e) break;
+			depth++;
 			break;
-		}
 
-		{
-			dl_uint8_t *object1_string = dl_null;
-			dl_size_t object1_string_length = 0;
-			dl_uint8_t *object2_string = dl_null;
-			dl_size_t object2_string_length = 0;
-			if (object1.type == duckVM_object_type_string) {
-				object1_string = (object1.value.string.internalString->value.internalString.value
-				                  + object1.value.string.offset);
-				object1_string_length = object1.value.string.length;
-			}
-			else {
-				object1_string = object1.value.symbol.internalString->value.internalString.value;
-				object1_string_length = object1.value.symbol.internalString->value.internalString.value_length;
+		case duckLisp_instruction_vector8:
+		case duckLisp_instruction_vector16:
+		case duckLisp_instruction_vector32:
+			e = duckVM_verify_readOperand(bytecode, bytecode_length, &ip, width, &count);
+			if (e) break;
+			DL_DOTIMES(k, count) {
+				e = duckVM_verify_readIndex(bytecode, bytecode_length, &ip, width, depth);
+				if (e) break;
 			}
-			if (object2.type == duckVM_object_type_string) {
-				object2_string = (object2.value.string.internalString->value.internalString.value
-				                  + object2.value.string.offset);
-				object2_string_length = object2.value.string.length;
+			if (e) break;
+			depth++;
+			break;
+
+		case duckLisp_instruction_move8:
+		case duckLisp_instruction_move16:
+		case duckLisp_instruction_move32:
+			DL_DOTIMES(k, 2) {
+				e = duckVM_verify_readIndex(bytecode, bytecode_length, &ip, width, depth);
+				if (e) break;
 			}
-			else {
-				object2_string = object2.value.symbol.internalString->value.internalString.value;
-				object2_string_length = object2.value.symbol.internalString->value.internalString.value_length;
+			break;
+
+		case duckLisp_instruction_setUpvalue8:
+		case duckLisp_instruction_setUpvalue16:
+		case duckLisp_instruction_setUpvalue32:
+			/* Upvalue */
+			e = duckVM_verify_readOperand(bytecode, bytecode_length, &ip, 1, &operand);
+			if (e) break;
+			/* Object */
+			e = duckVM_verify_readIndex(bytecode, bytecode_length, &ip, width, depth);
+			break;
+
+		case duckLisp_instruction_setGlobal8:
+		case duckLisp_instruction_setGlobal16:
+		case duckLisp_instruction_setGlobal32:
+			/* Object */
+			e = duckVM_verify_readIndex(bytecode, bytecode_length, &ip, width, depth);
+			if (e) break;
+			/* Key */
+			e = duckVM_verify_readOperand(bytecode, bytecode_length, &ip, width, &operand);
+			break;
+
+		case duckLisp_instruction_releaseUpvalues8:
+		case duckLisp_instruction_releaseUpvalues16:
+		case duckLisp_instruction_releaseUpvalues32:
+			e = duckVM_verify_readOperand(bytecode, bytecode_length, &ip, 1, &count);
+			if (e) break;
+			DL_DOTIMES(k, count) {
+				e = duckVM_verify_readIndex(bytecode, bytecode_length, &ip, width, depth);
+				if (e) break;
 			}
-			object3.type = duckVM_object_type_internalString;
-			object3.value.internalString.value = object1_string;
-			object3.value.internalString.value_length = object1_string_length;
-			e = duckVM_gclist_pushObject(duckVM, &objectPtr1, object3);
+			break;
+
+		case duckLisp_instruction_pushClosure8:
+		case duckLisp_instruction_pushClosure16:
+		case duckLisp_instruction_pushClosure32:
+		case duckLisp_instruction_pushVaClosure8:
+		case duckLisp_instruction_pushVaClosure16:
+		case duckLisp_instruction_pushVaClosure32: {
+			dl_size_t arity = 0;
+			e = duckVM_verify_readAddress(bytecode, bytecode_length, &ip, width, &address);
 			if (e) break;
-			objectPtr1->value.internalString.value_length = object1_string_length + object2_string_length;
-			e = DL_REALLOC(duckVM->memoryAllocation,
-			               &objectPtr1->value.internalString.value,
-			               objectPtr1->value.internalString.value_length,
-			               dl_uint8_t);
+			e = duckVM_verify_readOperand(bytecode, bytecode_length, &ip, 1, &arity);
 			if (e) break;
-			/**/ dl_memcopy_noOverlap((objectPtr1->value.internalString.value + object1_string_length),
-			                          object2_string,
-			                          object2_string_length);
-			object3.type = duckVM_object_type_string;
-			object3.value.string.offset = 0;
-			object3.value.string.length = objectPtr1->value.internalString.value_length;
-			object3.value.string.internalString = objectPtr1;
-			e = stack_push(duckVM, &object3);
-			if (e) {
-				eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->concatenate: stack_push failed."));
-				if (!e) e = eError;
-				break;
+			e = duckVM_verify_readOperand(bytecode, bytecode_length, &ip, 4, &count);
+			if (e) break;
+			DL_DOTIMES(k, count) {
+				e = duckVM_verify_readOperand(bytecode, bytecode_length, &ip, 4, &operand);
+				if (e) break;
+				/* Negative captures are upvalues of the current function. Index 0 is the closure itself. */
+				if ((operand <= 0x7FFFFFFF) && (operand > (dl_size_t) depth)) {
+					e = dl_error_invalidValue;
+					break;
+				}
+			}
+			if (e) break;
+			/* The body of the closure runs in a new frame that starts out holding the arguments. */
+			if ((opcode == duckLisp_instruction_pushVaClosure8)
+			    || (opcode == duckLisp_instruction_pushVaClosure16)
+			    || (opcode == duckLisp_instruction_pushVaClosure32)) {
+				arity++;
 			}
+			e = duckVM_verify_pushPath(&paths, address, arity);
+			if (e) break;
+			depth++;
+			break;
 		}
-		break;
-
-	case duckLisp_instruction_substring32:
-		ptrdiff1 = *(ip++);
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through */
-	case duckLisp_instruction_substring16:
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		/* Fall through */
-	case duckLisp_instruction_substring8:
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
 
-		ptrdiff2 = *(ip++);
-		switch (opcode) {
-		case duckLisp_instruction_substring32:
-			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-			/* Fall through */
-		case duckLisp_instruction_substring16:
-			ptrdiff2 = *(ip++) + (ptrdiff2 << 8);
-			/* Fall through */
-		case duckLisp_instruction_substring8:
-			break;
-		default:
-			e = dl_error_cantHappen;
+		case duckLisp_instruction_funcall8:
+		case duckLisp_instruction_funcall16:
+		case duckLisp_instruction_funcall32:
+			e = duckVM_verify_readIndex(bytecode, bytecode_length, &ip, width, depth);
+			if (e) break;
+			e = duckVM_verify_readOperand(bytecode, bytecode_length, &ip, 1, &count);
+			if (e) break;
+			/* The arguments are replaced by the return value. */
+			depth = depth - (dl_ptrdiff_t) count + 1;
+			if (depth < 1) e = dl_error_invalidValue;
 			break;
-		}
-		if (e) break;
 
-		ptrdiff3 = *(ip++);
-		switch (opcode) {
-		case duckLisp_instruction_substring32:
-			ptrdiff3 = *(ip++) + (ptrdiff3 << 8);
-			ptrdiff3 = *(ip++) + (ptrdiff3 << 8);
-			/* Fall through */
-		case duckLisp_instruction_substring16:
-			ptrdiff3 = *(ip++) + (ptrdiff3 << 8);
-			/* Fall through */
-		case duckLisp_instruction_substring8:
+		case duckLisp_instruction_ccall8:
+		case duckLisp_instruction_ccall16:
+		case duckLisp_instruction_ccall32:
+			/* The callback key isn't a stack index. `duckVM_callCallback` checks the callback's stack effect. */
+			e = duckVM_verify_readOperand(bytecode, bytecode_length, &ip, width, &count);
+			if (e) break;
+			e = duckVM_verify_readOperand(bytecode, bytecode_length, &ip, 1, &count);
+			if (e) break;
+			/* The arguments are replaced by the return value. */
+			depth = depth - (dl_ptrdiff_t) count + 1;
+			if (depth < 1) e = dl_error_invalidValue;
 			break;
-		default:
-			e = dl_error_cantHappen;
+
+		case duckLisp_instruction_apply8:
+		case duckLisp_instruction_apply16:
+		case duckLisp_instruction_apply32:
+			e = duckVM_verify_readIndex(bytecode, bytecode_length, &ip, width, depth);
+			if (e) break;
+			e = duckVM_verify_readOperand(bytecode, bytecode_length, &ip, 1, &count);
+			if (e) break;
+			/* The arguments and the list are replaced by the return value. */
+			depth = depth - (dl_ptrdiff_t) count;
+			if (depth < 1) e = dl_error_invalidValue;
 			break;
-		}
-		if (e) break;
 
-		ptrdiff1 = duckVM->stack.elements_length - ptrdiff1;
-		if ((ptrdiff1 < 0) || ((dl_size_t) ptrdiff1 > duckVM->stack.elements_length)) {
-			e = dl_error_invalidValue;
-			eError = duckVM_error_pushRuntime(duckVM,
-			                                  DL_STR("duckVM_execute->substring: String stack index out of bounds."));
-			if (!e) e = eError;
+		case duckLisp_instruction_jump8:
+		case duckLisp_instruction_jump16:
+		case duckLisp_instruction_jump32:
+			e = duckVM_verify_readAddress(bytecode, bytecode_length, &ip, width, &address);
+			if (e) break;
+			e = duckVM_verify_pushPath(&paths, address, depth);
+			fallsThrough = dl_false;
 			break;
-		}
-		e = dl_array_get(&duckVM->stack, &object1, ptrdiff1);
-		if (e) break;
-		if (object1.type != duckVM_object_type_string) {
-			e = dl_error_invalidValue;
-			eError = duckVM_error_pushRuntime(duckVM,
-			                                  DL_STR("duckVM_execute->substring: dl_array_get failed."));
-			if (!e) e = eError;
+
+		case duckLisp_instruction_brnz8:
+		case duckLisp_instruction_brnz16:
+		case duckLisp_instruction_brnz32:
+			e = duckVM_verify_readAddress(bytecode, bytecode_length, &ip, width, &address);
+			if (e) break;
+			e = duckVM_verify_readOperand(bytecode, bytecode_length, &ip, 1, &count);
+			if (e) break;
+			/* The condition is read from the top of the stack before the pops. */
+			if ((depth < 1) || (count > (dl_size_t) depth)) {
+				e = dl_error_invalidValue;
+				break;
+			}
+			depth -= count;
+			e = duckVM_verify_pushPath(&paths, address, depth);
 			break;
-		}
 
-		ptrdiff2 = duckVM->stack.elements_length - ptrdiff2;
-		if ((ptrdiff2 < 0) || ((dl_size_t) ptrdiff2 > duckVM->stack.elements_length)) {
-			e = dl_error_invalidValue;
-			eError = duckVM_error_pushRuntime(duckVM,
-			                                  DL_STR("duckVM_execute->substring: First integer stack index out of bounds."));
-			if (!e) e = eError;
+		case duckLisp_instruction_pop8:
+		case duckLisp_instruction_pop16:
+		case duckLisp_instruction_pop32:
+			e = duckVM_verify_readOperand(bytecode, bytecode_length, &ip, width, &count);
+			if (e) break;
+			if (count > (dl_size_t) depth) {
+				e = dl_error_invalidValue;
+				break;
+			}
+			depth -= count;
 			break;
-		}
-		e = dl_array_get(&duckVM->stack, &object2, ptrdiff2);
-		if (e) break;
-		if (object2.type != duckVM_object_type_integer) {
-			e = dl_error_invalidValue;
-			eError = duckVM_error_pushRuntime(duckVM,
-			                                  DL_STR("duckVM_execute->substring: dl_array_get failed."));
-			if (!e) e = eError;
+
+		case duckLisp_instruction_return0:
+		case duckLisp_instruction_return8:
+		case duckLisp_instruction_return16:
+		case duckLisp_instruction_return32:
+			count = 0;
+			if (opcode != duckLisp_instruction_return0) {
+				e = duckVM_verify_readOperand(bytecode, bytecode_length, &ip, width, &count);
+				if (e) break;
+			}
+			/* Everything but the return value must be popped, or the caller's frame will be corrupted. */
+			if (count + 1 != (dl_size_t) depth) {
+				e = dl_error_invalidValue;
+				break;
+			}
+			fallsThrough = dl_false;
 			break;
-		}
-		if ((object2.value.integer < 0)
-		    || ((dl_size_t) object2.value.integer > object1.value.string.length - object1.value.string.offset)) {
-			e = dl_error_invalidValue;
-			eError = duckVM_error_pushRuntime(duckVM,
-			                                  DL_STR("duckVM_execute->substring: First integer out of bounds."));
-			if (!e) e = eError;
+
+		case duckLisp_instruction_halt:
+			fallsThrough = dl_false;
 			break;
-		}
 
-		ptrdiff3 = duckVM->stack.elements_length - ptrdiff3;
-		if ((ptrdiff3 < 0) || ((dl_size_t) ptrdiff3 > duckVM->stack.elements_length)) {
+		default:
+			/* `call`, `acall`, and `brz` have no verifiable stack effect. */
 			e = dl_error_invalidValue;
-			eError = duckVM_error_pushRuntime(duckVM,
-			                                  DL_STR("duckVM_execute->substring: Second integer stack index out of bounds."));
-			if (!e) e = eError;
-			break;
 		}
-		e = dl_array_get(&duckVM->stack, &object3, ptrdiff3);
-		if (e) break;
-		if (object3.type != duckVM_object_type_integer) {
-			e = dl_error_invalidValue;
-			eError = duckVM_error_pushRuntime(duckVM,
-			                                  DL_STR("duckVM_execute->concatenate: dl_array_get failed."));
-			if (!e) e = eError;
-			break;
+		if (e) goto cleanup;
+
+		/* Claim the operand bytes. Any branch into them will be caught. */
+		for (dl_size_t k = path.ip + 1; k < ip; k++) {
+			if (depths[k] != -1) {
+				e = dl_error_invalidValue;
+				goto cleanup;
+			}
+			depths[k] = -2;
 		}
-		if ((object3.value.integer < 0)
-		    || ((dl_size_t) object3.value.integer > object1.value.string.length - object1.value.string.offset)) {
-			e = dl_error_invalidValue;
-			eError = duckVM_error_pushRuntime(duckVM,
-			                                  DL_STR("duckVM_execute->substring: Second integer out of bounds."));
-			if (!e) e = eError;
-			break;
+
+		if (fallsThrough) {
+			e = duckVM_verify_pushPath(&paths, ip, depth);
+			if (e) goto cleanup;
 		}
+	}
+
+ cleanup:
+	if (e == dl_error_bufferOverflow) e = dl_error_invalidValue;
+
+	if (depths != dl_null) {
+		eError = DL_FREE(memoryAllocation, &depths);
+		if (eError) e = eError;
+	}
+
+	eError = dl_array_quit(&paths);
+	if (eError) e = eError;
+
+	return e;
+}
+
+dl_error_t duckVM_verify(duckVM_t *duckVM, const dl_uint8_t *bytecode, const dl_size_t bytecode_length) {
+	dl_error_t e = dl_error_ok;
+	dl_error_t eError = dl_error_ok;
+
+	e = duckVM_verifyBytecode(duckVM->memoryAllocation,
+	                          bytecode,
+	                          bytecode_length,
+	                          duckVM->stack.elements_length);
+	if (e == dl_error_invalidValue) {
+		eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_verify: Bytecode failed verification."));
+		if (eError) e = eError;
+	}
+
+	return e;
+}
+
+/* Run until the VM halts, fails, or uses up its budget. A suspended VM keeps the current bytecode alive through
+   `currentBytecode` and remembers where it stopped so that `duckVM_resume` can pick up from there. */
+static dl_error_t duckVM_run(duckVM_t *duckVM,
+                             duckVM_object_t *bytecodeObject,
+                             dl_uint8_t *ip,
+                             dl_size_t budget,
+                             duckVM_object_t *barrier,
+                             duckVM_halt_mode_t *halt) {
+	dl_error_t e = dl_error_ok;
+
+	*halt = duckVM_halt_mode_run;
+	duckVM->currentBytecode = bytecodeObject;
+	e = duckVM_executeInstructions(duckVM, &bytecodeObject, &ip, budget, barrier, halt);
+	if (e) {
+		/* Put the stacks of the code that was running when this loop was entered back in place. */
+		(void) duckVM_coroutine_unwind(duckVM, barrier);
+	}
+	if (!e && (*halt == duckVM_halt_mode_suspend)) {
+		duckVM->currentBytecode = bytecodeObject;
+		duckVM->suspendedIp = ip;
+	}
+	else {
+		duckVM->currentBytecode = dl_null;
+	}
+
+	return e;
+}
+
+/* Start executing a bytecode object at `ipOffset`. */
+static dl_error_t duckVM_executeBytecode(duckVM_t *duckVM,
+                                         duckVM_object_t *bytecodeObject,
+                                         dl_ptrdiff_t ipOffset,
+                                         dl_size_t budget,
+                                         duckVM_object_t *barrier,
+                                         duckVM_halt_mode_t *halt) {
+	dl_error_t e = dl_error_ok;
+	dl_error_t eError = dl_error_ok;
+
+	*halt = duckVM_halt_mode_halt;
+	if ((ipOffset < 0) || (bytecodeObject->value.bytecode.bytecode_length <= (dl_size_t) ipOffset)) {
+		e = dl_error_invalidValue;
+		eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_executeBytecode: IP out of bounds."));
+		if (eError) e = eError;
+		goto cleanup;
+	}
+	if (duckVM->suspendedIp != dl_null) {
+		/* Running something else would unwind the suspended program's call stack. */
+		e = dl_error_invalidValue;
+		eError = duckVM_error_pushRuntime(duckVM,
+		                                  DL_STR("duckVM_executeBytecode: VM is suspended. Resume or reset it first."));
+		if (eError) e = eError;
+		goto cleanup;
+	}
+	e = duckVM_run(duckVM,
+	               bytecodeObject,
+	               &bytecodeObject->value.bytecode.bytecode[ipOffset],
+	               budget,
+	               barrier,
+	               halt);
 
-		if (object3.value.integer < object2.value.integer) {
-			e = dl_error_invalidValue;
-			eError = duckVM_error_pushRuntime(duckVM,
-			                                  DL_STR("duckVM_execute->substring: Second integer must be greater than the first."));
-			if (!e) e = eError;
-			break;
-		}
+ cleanup: return e;
+}
 
-		object1.value.string.length = object1.value.string.offset + object3.value.integer;
-		object1.value.string.offset = object1.value.string.offset + object2.value.integer;
-		e = stack_push(duckVM, &object1);
-		if (e) {
-			eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute->concatenate: stack_push failed."));
-			if (!e) e = eError;
-			break;
-		}
-		break;
+dl_error_t duckVM_executeWithIp(duckVM_t *duckVM,
+                                dl_uint8_t *bytecode,
+                                dl_ptrdiff_t ipOffset,
+                                dl_size_t bytecode_length,
+                                dl_bool_t verified,
+                                dl_size_t budget,
+                                duckVM_object_t *barrier,
+                                duckVM_halt_mode_t *halt) {
+	dl_error_t e = dl_error_ok;
+	/* Why a reference to bytecode? So it can be switched out with other bytecodes by `duckVM_executeInstructions`. */
+	duckVM_object_t *bytecodeObject;
+	duckVM_object_t temp;
+	*halt = duckVM_halt_mode_halt;
+	temp.type = duckVM_object_type_bytecode;
+	temp.value.bytecode.bytecode = bytecode;
+	temp.value.bytecode.bytecode_length = bytecode_length;
+	temp.value.bytecode.verified = verified;
+	temp.value.bytecode.program = dl_null;
+	e = duckVM_gclist_pushObject(duckVM, &bytecodeObject, temp);
+	if (e) return e;
+	return duckVM_executeBytecode(duckVM, bytecodeObject, ipOffset, budget, barrier, halt);
+}
 
-	case duckLisp_instruction_return32:
-		ptrdiff1 = *(ip++);
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-		parsedBytecode = dl_true;
-		/* Fall through */
-	case duckLisp_instruction_return16:
-		if (!parsedBytecode) {
-			ptrdiff1 = *(ip++);
-			ptrdiff1 = *(ip++) + (ptrdiff1 << 8);
-			parsedBytecode = dl_true;
-		}
-		/* Fall through */
-	case duckLisp_instruction_return8:
-		if (!parsedBytecode) {
-			ptrdiff1 = *(ip++);
-		}
+dl_error_t duckVM_executeBudgeted(duckVM_t *duckVM,
+                                  dl_uint8_t *bytecode,
+                                  dl_size_t bytecode_length,
+                                  dl_size_t budget,
+                                  duckVM_halt_mode_t *halt) {
+	dl_error_t e = dl_error_ok;
+	dl_bool_t verified = dl_true;
 
-		if (duckVM->stack.elements_length > 0) {
-			e = dl_array_getTop(&duckVM->stack, &object1);
-			if (e) break;
-		}
-		e = stack_pop_multiple(duckVM, ptrdiff1);
-		if (e) break;
-		if (duckVM->stack.elements_length > 0) {
-			e = stack_pop_multiple(duckVM, 1);
-			if (e) break;
-			e = stack_push(duckVM, &object1);
-			if (e) break;
-		}
-		e = call_stack_pop(duckVM, &ip, &bytecode);
-		if (e == dl_error_bufferUnderflow) {
-			*halt = duckVM_halt_mode_halt;
+	*halt = duckVM_halt_mode_halt;
+
+	/* Hosts often run the same bytecode over and over, e.g. once per frame or event. Comparing it against the last
+	   bytecode is much cheaper than verifying it again. */
+	if ((duckVM->lastBytecode.elements_length > 0)
+	    && (duckVM->lastBytecode.elements_length == bytecode_length)
+	    && (duckVM->lastBytecode_stackLength == duckVM->stack.elements_length)
+	    && dl_memequal(duckVM->lastBytecode.elements, bytecode, bytecode_length)) {
+		verified = duckVM->lastBytecode_verified;
+	}
+	else {
+		/* Bytecode that can't be verified is still run, but every operand access is checked. */
+		e = duckVM_verifyBytecode(duckVM->memoryAllocation,
+		                          bytecode,
+		                          bytecode_length,
+		                          duckVM->stack.elements_length);
+		if (e == dl_error_invalidValue) {
+			verified = dl_false;
 			e = dl_error_ok;
 		}
-		break;
-	case duckLisp_instruction_return0:
-		e = call_stack_pop(duckVM, &ip, &bytecode);
-		if (e == dl_error_bufferUnderflow) {
-			*halt = duckVM_halt_mode_halt;
-			e = dl_error_ok;
+		if (e) goto cleanup;
+
+		/* Reuse the old copy's memory. If the copy can't be made, the next run is simply verified again. */
+		duckVM->lastBytecode.elements_length = 0;
+		if (!dl_array_pushElements(&duckVM->lastBytecode, bytecode, bytecode_length)) {
+			duckVM->lastBytecode_stackLength = duckVM->stack.elements_length;
+			duckVM->lastBytecode_verified = verified;
 		}
-		break;
+	}
 
-	case duckLisp_instruction_halt:
-		*halt = duckVM_halt_mode_halt;
-		break;
+	e = duckVM_executeWithIp(duckVM, bytecode, 0, bytecode_length, verified, budget, dl_null, halt);
 
-	case duckLisp_instruction_nil:
-		object1.type = duckVM_object_type_list;
-		object1.value.list = dl_null;
-		e = stack_push(duckVM, &object1);
-		if (e) break;
-		break;
+ cleanup: return e;
+}
 
-	default:
+dl_error_t duckVM_execute(duckVM_t *duckVM, dl_uint8_t *bytecode, dl_size_t bytecode_length) {
+	dl_error_t e = dl_error_ok;
+	duckVM_halt_mode_t halt;
+	e = duckVM_executeBudgeted(duckVM, bytecode, bytecode_length, DUCKVM_BUDGET_UNLIMITED, &halt);
+	if (!e && (halt == duckVM_halt_mode_suspend)) {
+		/* Only `receive` can suspend an unlimited run. Nothing else can send while this thread waits. */
+		dl_error_t eError = dl_error_ok;
+		e = dl_error_invalidValue;
+		eError = duckVM_error_pushRuntime(duckVM,
+		                                  DL_STR("duckVM_execute: Program is waiting for a message. Send one and call duckVM_resume, or call duckVM_softReset."));
+		if (eError) e = eError;
+	}
+	return e;
+}
+
+dl_error_t duckVM_program_init(duckVM_program_t **program,
+                               dl_memoryAllocation_t *memoryAllocation,
+                               const dl_uint8_t *bytecode,
+                               const dl_size_t bytecode_length) {
+	dl_error_t e = dl_error_ok;
+
+	duckVM_program_t *newProgram = dl_null;
+
+	if (bytecode_length == 0) {
 		e = dl_error_invalidValue;
-		eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_execute: Invalid opcode."));
-		if (!e) e = eError;
 		goto cleanup;
 	}
+
+	e = DL_MALLOC(memoryAllocation, &newProgram, 1, duckVM_program_t);
+	if (e) goto cleanup;
+	newProgram->memoryAllocation = memoryAllocation;
+	newProgram->bytecode_length = bytecode_length;
+	newProgram->references = 1;
+	newProgram->bytecode = dl_null;
+	e = DL_MALLOC(memoryAllocation, &newProgram->bytecode, bytecode_length, dl_uint8_t);
+	if (e) goto cleanup;
+	/**/ dl_memcopy_noOverlap(newProgram->bytecode, bytecode, bytecode_length);
+
+	/* Verifying against an empty stack is the strictest check, so it holds for whatever stack the program runs on. */
+	newProgram->verified = dl_true;
+	e = duckVM_verifyBytecode(memoryAllocation, newProgram->bytecode, bytecode_length, 0);
+	if (e == dl_error_invalidValue) {
+		newProgram->verified = dl_false;
+		e = dl_error_ok;
+	}
+	if (e) goto cleanup;
+
+	*program = newProgram;
+
  cleanup:
-	*ipPtr = ip;
+	if (e && (newProgram != dl_null)) {
+		if (newProgram->bytecode != dl_null) (void) DL_FREE(memoryAllocation, &newProgram->bytecode);
+		(void) DL_FREE(memoryAllocation, &newProgram);
+	}
 	return e;
 }
 
-dl_error_t duckVM_executeWithIp(duckVM_t *duckVM,
-                                dl_uint8_t *bytecode,
-                                dl_ptrdiff_t ipOffset,
-                                dl_size_t bytecode_length) {
+void duckVM_program_retain(duckVM_program_t *program) {
+	DUCKVM_ATOMIC_INCREMENT(&program->references);
+}
+
+dl_error_t duckVM_program_release(duckVM_program_t *program) {
 	dl_error_t e = dl_error_ok;
+	dl_memoryAllocation_t *memoryAllocation = program->memoryAllocation;
+	if (DUCKVM_ATOMIC_DECREMENT(&program->references) > 0) return e;
+	e = DL_FREE(memoryAllocation, &program->bytecode);
+	if (e) return e;
+	return DL_FREE(memoryAllocation, &program);
+}
 
-	duckVM_halt_mode_t halt = duckVM_halt_mode_run;
-	/* Why a reference to bytecode? So it can be switched out with other bytecodes by `duckVM_executeInstruction`. */
+dl_error_t duckVM_executeProgram(duckVM_t *duckVM,
+                                 duckVM_program_t *program,
+                                 dl_size_t budget,
+                                 duckVM_halt_mode_t *halt) {
+	dl_error_t e = dl_error_ok;
 	duckVM_object_t *bytecodeObject;
-	dl_uint8_t *ip = dl_null;
-	if ((ipOffset < 0) || (bytecode_length <= (dl_size_t) ipOffset)) {
+	duckVM_object_t temp;
+	*halt = duckVM_halt_mode_halt;
+	temp.type = duckVM_object_type_bytecode;
+	temp.value.bytecode.bytecode = program->bytecode;
+	temp.value.bytecode.bytecode_length = program->bytecode_length;
+	temp.value.bytecode.verified = program->verified;
+	temp.value.bytecode.program = program;
+	/* Takes a reference to the program instead of copying it. */
+	e = duckVM_gclist_pushObject(duckVM, &bytecodeObject, temp);
+	if (e) return e;
+	return duckVM_executeBytecode(duckVM, bytecodeObject, 0, budget, dl_null, halt);
+}
+
+dl_error_t duckVM_resume(duckVM_t *duckVM, dl_size_t budget, duckVM_halt_mode_t *halt) {
+	dl_error_t e = dl_error_ok;
+
+	dl_uint8_t *ip = duckVM->suspendedIp;
+	*halt = duckVM_halt_mode_halt;
+	if (ip == dl_null) {
 		dl_error_t eError = dl_error_ok;
 		e = dl_error_invalidValue;
-		eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_executeWithIp: IP out of bounds."));
+		eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_resume: VM is not suspended."));
 		if (eError) e = eError;
 		goto cleanup;
 	}
-	{
-		duckVM_object_t temp;
-		temp.type = duckVM_object_type_bytecode;
-		temp.value.bytecode.bytecode = bytecode;
-		temp.value.bytecode.bytecode_length = bytecode_length;
-		e = duckVM_gclist_pushObject(duckVM, &bytecodeObject, temp);
-		if (e) goto cleanup;
-	}
-	ip = &bytecodeObject->value.bytecode.bytecode[ipOffset];
-	duckVM->currentBytecode = bytecodeObject;
-	if (bytecode_length == 0) goto cleanup;
-	do {
-		e = duckVM_executeInstruction(duckVM, bytecodeObject, &ip, &halt);
-	} while (!e && (halt == duckVM_halt_mode_run));
-	duckVM->currentBytecode = dl_null;
+	duckVM->suspendedIp = dl_null;
+	e = duckVM_run(duckVM, duckVM->currentBytecode, ip, budget, dl_null, halt);
 
  cleanup: return e;
 }
 
-dl_error_t duckVM_execute(duckVM_t *duckVM, dl_uint8_t *bytecode, dl_size_t bytecode_length) {
-	return duckVM_executeWithIp(duckVM, bytecode, 0, bytecode_length);
-}
-
 dl_error_t duckVM_linkCFunction(duckVM_t *duckVM, dl_ptrdiff_t key, dl_error_t (*callback)(duckVM_t *)) {
 	dl_error_t e = dl_error_ok;
 
@@ -4695,6 +10963,107 @@ dl_error_t duckVM_linkCFunction(duckVM_t *duckVM, dl_ptrdiff_t key, dl_error_t (
 	return e;
 }
 
+dl_error_t duckVM_linkChannel(duckVM_t *duckVM, dl_ptrdiff_t key, duckVM_mailbox_t *mailbox) {
+	dl_error_t e = dl_error_ok;
+	duckVM_mailbox_t *none = dl_null;
+
+	if (key < 0) {
+		e = dl_error_invalidValue;
+		goto cleanup;
+	}
+	while (duckVM->channels.elements_length <= (dl_size_t) key) {
+		e = dl_array_pushElement(&duckVM->channels, &none);
+		if (e) goto cleanup;
+	}
+	DL_ARRAY_GETADDRESS(duckVM->channels, duckVM_mailbox_t *, key) = mailbox;
+
+ cleanup:
+	return e;
+}
+
+void duckVM_linkMapPool(duckVM_t *duckVM, duckVM_mapPool_t *mapPool) {
+	duckVM->mapPool = mapPool;
+}
+
+void duckVM_linkJit(duckVM_t *duckVM, duckVM_jit_t *jit) {
+	duckVM->jit = jit;
+}
+
+dl_error_t duckVM_send(duckVM_t *duckVM, duckVM_mailbox_t *mailbox) {
+	dl_error_t e = dl_error_ok;
+	duckVM_object_t object;
+	e = stack_getTop(duckVM, &object);
+	if (e) return e;
+	return duckVM_mailbox_send(duckVM, mailbox, &object);
+}
+
+dl_error_t duckVM_tryReceive(duckVM_t *duckVM, duckVM_mailbox_t *mailbox, dl_bool_t *received) {
+	return duckVM_mailbox_receive(duckVM, mailbox, received);
+}
+
+dl_error_t duckVM_mapChunk(duckVM_t *duckVM, duckVM_mapPool_t *mapPool, duckVM_mapChunk_t *chunk) {
+	dl_error_t e = dl_error_ok;
+	dl_error_t eError = dl_error_ok;
+	dl_size_t base = duckVM->stack.elements_length;
+	duckVM_object_t object;
+
+	chunk->output = dl_null;
+	e = duckVM_message_pushObject(duckVM, chunk->input);
+	if (e) goto cleanup;
+	/* stack: #(function element...) */
+	e = stack_getTop(duckVM, &object);
+	if (e) goto cleanup;
+	{
+		duckVM_object_t function = *object.value.vector.internal_vector->value.internal_vector.values[0];
+		e = stack_push(duckVM, &function);
+		if (e) goto cleanup;
+	}
+	/* The elements are the rest of the vector. */
+	object.value.vector.offset++;
+	e = stack_push(duckVM, &object);
+	if (e) goto cleanup;
+	/* stack: chunk function elements */
+	e = duckVM_map(duckVM, base + 1, base + 2);
+	if (e) goto cleanup;
+	e = stack_getTop(duckVM, &object);
+	if (e) goto cleanup;
+	e = duckVM_message_fromObject(duckVM, mapPool->memoryAllocation, &object, &chunk->output);
+	if (e) goto cleanup;
+
+ cleanup:
+	if (duckVM->stack.elements_length > base) {
+		eError = stack_pop_multiple(duckVM, duckVM->stack.elements_length - base);
+		if (eError) e = eError;
+	}
+	chunk->e = e;
+	return e;
+}
+
+dl_error_t duckVM_freeze(duckVM_t *duckVM, duckVM_frozen_t **region) {
+	dl_error_t e = dl_error_ok;
+	duckVM_object_t object;
+	duckVM_object_t frozenObject;
+	duckVM_frozen_t *newRegion = dl_null;
+	if (region != dl_null) *region = dl_null;
+	e = stack_getTop(duckVM, &object);
+	if (e) return e;
+	e = duckVM_frozen_fromObject(duckVM, &object, &frozenObject, &newRegion);
+	if (e) return e;
+	DL_ARRAY_GETADDRESS(duckVM->stack, duckVM_object_t, duckVM->stack.elements_length - 1) = frozenObject;
+	if ((region != dl_null) && (newRegion != dl_null)) {
+		/**/ duckVM_frozen_retain(newRegion);
+		*region = newRegion;
+	}
+	return e;
+}
+
+dl_error_t duckVM_pushFrozen(duckVM_t *duckVM, duckVM_frozen_t *region) {
+	dl_error_t e = dl_error_ok;
+	e = duckVM_frozen_adopt(duckVM, region);
+	if (e) return e;
+	return stack_push(duckVM, &region->root);
+}
+
 ///////////////////////////////////////
 // Functions for C callbacks to use. //
 ///////////////////////////////////////
@@ -4735,12 +11104,16 @@ dl_error_t duckVM_allocateHeapObject(duckVM_t *duckVM, duckVM_object_t **heapObj
 
 dl_error_t duckVM_softReset(duckVM_t *duckVM) {
 	dl_error_t e = dl_error_ok;
+	e = duckVM_coroutine_unwind(duckVM, dl_null);
+	if (e) goto cleanup;
 	e = stack_pop_multiple(duckVM, duckVM->stack.elements_length);
 	if (e) goto cleanup;
 	e = dl_array_popElements(&duckVM->upvalue_array_call_stack, dl_null, duckVM->call_stack.elements_length);
 	if (e) goto cleanup;
 	e = dl_array_popElements(&duckVM->call_stack, dl_null, duckVM->call_stack.elements_length);
 	if (e) goto cleanup;
+	duckVM->currentBytecode = dl_null;
+	duckVM->suspendedIp = dl_null;
  cleanup:
 	if (e) {
 		dl_error_t eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_softReset: Failed."));
@@ -4792,6 +11165,8 @@ duckVM_object_t duckVM_object_makeInternalString(dl_uint8_t *value, dl_size_t le
 	o.type = duckVM_object_type_internalString;
 	o.value.internalString.value = value;
 	o.value.internalString.value_length = length;
+	o.value.internalString.capacity = length;
+	o.value.internalString.hashed = dl_false;
 	return o;
 }
 
@@ -4893,6 +11268,7 @@ duckVM_object_t duckVM_object_makeInternalVector(duckVM_object_t **values, dl_si
 	o.type = duckVM_object_type_internalVector;
 	o.value.internal_vector.values = values;
 	o.value.internal_vector.length = length;
+	o.value.internal_vector.capacity = length;
 	o.value.internal_vector.initialized = initialized;
 	return o;
 }
@@ -4924,6 +11300,8 @@ duckVM_object_t duckVM_object_makeBytecode(dl_uint8_t *bytecode, dl_size_t lengt
 	o.type = duckVM_object_type_bytecode;
 	o.value.bytecode.bytecode = bytecode;
 	o.value.bytecode.bytecode_length = length;
+	o.value.bytecode.verified = dl_false;
+	o.value.bytecode.program = dl_null;
 	return o;
 }
 
@@ -5178,7 +11556,7 @@ dl_error_t duckVM_upvalueArray_getUpvalue(duckVM_t *duckVM,
 
 	/* Get the object. */
 	if (upvalue.type == duckVM_upvalue_type_stack_index) {
-		e = dl_array_get(&duckVM->stack, object, upvalue.value.stack_index);
+		e = dl_array_get(duckVM_upvalue_stack(duckVM, &upvalue), object, upvalue.value.stack_index);
 		if (e) return e;
 	}
 	else if (upvalue.type == duckVM_upvalue_type_heap_object) {
@@ -5214,7 +11592,7 @@ dl_error_t duckVM_upvalueArray_setUpvalue(duckVM_t *duckVM,
 
 	/* Get the object. */
 	if (upvalue.type == duckVM_upvalue_type_stack_index) {
-		e = dl_array_set(&duckVM->stack, object, upvalue.value.stack_index);
+		e = dl_array_set(duckVM_upvalue_stack(duckVM, &upvalue), object, upvalue.value.stack_index);
 		if (e) return e;
 	}
 	else if (upvalue.type == duckVM_upvalue_type_heap_object) {
@@ -5246,7 +11624,9 @@ dl_error_t duckVM_vector_getLength(duckVM_vector_t vector, dl_size_t *length) {
 	duckVM_internalVector_t internalVector;
 	dl_error_t e = duckVM_vector_getInternalVector(vector, &internalVector);
 	if (e) return e;
-	*length = internalVector.length - vector.offset;
+	*length = (((dl_size_t) vector.offset < internalVector.length)
+	           ? internalVector.length - vector.offset
+	           : 0);
 	return e;
 }
 
@@ -5565,14 +11945,12 @@ dl_error_t duckVM_call(duckVM_t *duckVM, dl_ptrdiff_t stackIndex, dl_uint8_t num
 		e = duckVM_instruction_prepareForFuncall(duckVM, &functionObject, numberOfArgs);
 		if (e) break;
 		if (functionObject.type == duckVM_object_type_function) {
-			/* Call callback. */
-			e = functionObject.value.function.callback(duckVM);
-			if (e) {
-				eError = duckVM_error_pushRuntime(duckVM,
-				                                  DL_STR("duckVM_instruction_funcall: C callback returned error."));
-				if (!e) e = eError;
-				break;
-			}
+			/* Callers such as `map` continue running verified bytecode afterward. */
+			e = duckVM_callCallback(duckVM,
+			                        functionObject.value.function.callback,
+			                        numberOfArgs,
+			                        ((duckVM->currentBytecode != dl_null)
+			                         && duckVM->currentBytecode->value.bytecode.verified));
 			break;
 		}
 		else if (functionObject.type != duckVM_object_type_closure) {
@@ -5591,7 +11969,6 @@ dl_error_t duckVM_call(duckVM_t *duckVM, dl_ptrdiff_t stackIndex, dl_uint8_t num
 			dl_uint8_t *shim_ip = shim_bytecode;
 
 			duckVM_object_t *bytecode_object = functionObject.value.closure.bytecode;
-			duckVM_bytecode_t bytecode = bytecode_object->value.bytecode;
 			dl_ptrdiff_t bytecode_offset = functionObject.value.closure.name;
 			e = call_stack_push(duckVM,
 			                    shim_ip,
@@ -5599,7 +11976,18 @@ dl_error_t duckVM_call(duckVM_t *duckVM, dl_ptrdiff_t stackIndex, dl_uint8_t num
 			                    &functionObject.value.closure.upvalue_array->value.upvalue_array);
 			if (e) break;
 			/* stack: function *args */
-			e = duckVM_executeWithIp(duckVM, bytecode.bytecode, bytecode_offset, bytecode.bytecode_length);
+			{
+				duckVM_halt_mode_t halt;
+				/* The closure keeps its bytecode alive, so run it in place rather than copying it. */
+				duckVM->callDepth++;
+				e = duckVM_executeBytecode(duckVM,
+				                           bytecode_object,
+				                           bytecode_offset,
+				                           DUCKVM_BUDGET_UNLIMITED,
+				                           duckVM->currentCoroutine,
+				                           &halt);
+				--duckVM->callDepth;
+			}
 			if (e) break;
 			/* stack: returnValue */
 		}
@@ -6449,6 +12837,12 @@ dl_error_t duckVM_setFirst(duckVM_t *duckVM, dl_ptrdiff_t stack_index) {
 		if (e) break;
 		e = stack_get(duckVM, &sequence, stack_index);
 		if (e) break;
+		if (duckVM_object_isFrozen(duckVM, &sequence)) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_setFirst: Frozen objects can't be modified."));
+			if (eError) e = eError;
+			break;
+		}
 		type = sequence.type;
 		switch (type) {
 		case duckVM_object_type_list: {
@@ -6521,6 +12915,12 @@ dl_error_t duckVM_setRest(duckVM_t *duckVM, dl_ptrdiff_t stack_index) {
 		if (e) break;
 		e = stack_get(duckVM, &sequence, stack_index);
 		if (e) break;
+		if (duckVM_object_isFrozen(duckVM, &sequence)) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_setRest: Frozen objects can't be modified."));
+			if (eError) e = eError;
+			break;
+		}
 		type = sequence.type;
 		switch (type) {
 		case duckVM_object_type_list: {
@@ -6666,6 +13066,12 @@ dl_error_t duckVM_setElement(duckVM_t *duckVM, dl_ptrdiff_t sequence_index, dl_p
 		if (e) break;
 		e = stack_get(duckVM, &sequence, stack_index);
 		if (e) break;
+		if (duckVM_object_isFrozen(duckVM, &sequence)) {
+			e = dl_error_invalidValue;
+			eError = duckVM_error_pushRuntime(duckVM, DL_STR("duckVM_setElement: Frozen objects can't be modified."));
+			if (eError) e = eError;
+			break;
+		}
 		type = sequence.type;
 		switch (type) {
 		case duckVM_object_type_list: {
@@ -6763,7 +13169,6 @@ dl_error_t duckVM_length(duckVM_t *duckVM, dl_size_t *length) {
 	dl_error_t eError = dl_error_ok;
 	do {
 		duckVM_object_t sequence;
-		duckVM_object_t *sequencePointer = dl_null;
 		duckVM_object_type_t type;
 		dl_size_t local_length = 0;
 		e = dl_array_getTop(&duckVM->stack, &sequence);
@@ -6771,29 +13176,17 @@ dl_error_t duckVM_length(duckVM_t *duckVM, dl_size_t *length) {
 		type = sequence.type;
 		switch (type) {
 		case duckVM_object_type_list: {
-			if (duckVM_listIsCyclic(sequence.value.list)) {
+			if (!duckVM_list_length(sequence.value.list, &local_length)) {
 				e = dl_error_invalidValue;
 				eError = duckVM_error_pushRuntime(duckVM,
 				                                  DL_STR("duckVM_length: List is circular."));
 				if (!e) e = eError;
 				break;
 			}
-			local_length = 0;
-			{
-				sequencePointer = sequence.value.list;
-				while ((sequencePointer != dl_null) && (sequencePointer->type == duckVM_object_type_cons)) {
-					local_length++;
-					sequencePointer = sequencePointer->value.cons.cdr;
-				}
-			}
 			break;
 		}
 		case duckVM_object_type_vector: {
-			duckVM_vector_t vector = sequence.value.vector;
-			duckVM_object_t *internal_vector = vector.internal_vector;
-			local_length = (internal_vector
-			                ? (internal_vector->value.internal_vector.length - vector.offset)
-			                : 0);
+			local_length = duckVM_vector_length(&sequence);
 			break;
 		}
 		case duckVM_object_type_string: {
@@ -7001,6 +13394,20 @@ dl_error_t duckVM_prettyPrint(dl_array_t *string_array, duckVM_t duckVM) {
 	e = dl_array_pushElements(string_array, DL_STR(", "));
 	if (e) goto cleanup;
 
+	e = dl_array_pushElements(string_array, DL_STR("suspendedIp = "));
+	if (e) goto cleanup;
+	if (duckVM.suspendedIp == dl_null) {
+		e = dl_array_pushElements(string_array, DL_STR("NULL"));
+		if (e) goto cleanup;
+	}
+	else {
+		e = dl_array_pushElements(string_array, DL_STR("..."));
+		if (e) goto cleanup;
+	}
+
+	e = dl_array_pushElements(string_array, DL_STR(", "));
+	if (e) goto cleanup;
+
 	e = dl_array_pushElements(string_array, DL_STR("upvalue_stack = {"));
 	if (e) goto cleanup;
 	DL_DOTIMES(i, duckVM.upvalue_stack.elements_length) {
@@ -7388,7 +13795,9 @@ dl_error_t duckVM_upvalue_prettyPrint(dl_array_t *string_array, duckVM_upvalue_t
 	switch (upvalue.type) {
 	case duckVM_upvalue_type_stack_index:
 		e = duckVM_object_prettyPrint(string_array,
-		                              DL_ARRAY_GETADDRESS(duckVM.stack, duckVM_object_t, upvalue.value.stack_index),
+		                              DL_ARRAY_GETADDRESS(*duckVM_upvalue_stack(&duckVM, &upvalue),
+		                                                  duckVM_object_t,
+		                                                  upvalue.value.stack_index),
 		                              duckVM);
 		if (e) goto cleanup;
 		break;
@@ -7684,6 +14093,16 @@ dl_error_t duckVM_object_type_prettyPrint(dl_array_t *string_array, duckVM_objec
 		return dl_array_pushElements(string_array, DL_STR("duckVM_object_type_composite"));
 	case duckVM_object_type_user:
 		return dl_array_pushElements(string_array, DL_STR("duckVM_object_type_user"));
+	case duckVM_object_type_coroutine:
+		return dl_array_pushElements(string_array, DL_STR("duckVM_object_type_coroutine"));
+	case duckVM_object_type_hashTable:
+		return dl_array_pushElements(string_array, DL_STR("duckVM_object_type_hashTable"));
+	case duckVM_object_type_stringBuilder:
+		return dl_array_pushElements(string_array, DL_STR("duckVM_object_type_stringBuilder"));
+	case duckVM_object_type_typedArray:
+		return dl_array_pushElements(string_array, DL_STR("duckVM_object_type_typedArray"));
+	case duckVM_object_type_record:
+		return dl_array_pushElements(string_array, DL_STR("duckVM_object_type_record"));
 	case duckVM_object_type_cons:
 		return dl_array_pushElements(string_array, DL_STR("duckVM_object_type_cons"));
 	case duckVM_object_type_upvalue:
@@ -7698,6 +14117,14 @@ dl_error_t duckVM_object_type_prettyPrint(dl_array_t *string_array, duckVM_objec
 		return dl_array_pushElements(string_array, DL_STR("duckVM_object_type_internalComposite"));
 	case duckVM_object_type_internalString:
 		return dl_array_pushElements(string_array, DL_STR("duckVM_object_type_internalString"));
+	case duckVM_object_type_internalCoroutine:
+		return dl_array_pushElements(string_array, DL_STR("duckVM_object_type_internalCoroutine"));
+	case duckVM_object_type_internalHashTable:
+		return dl_array_pushElements(string_array, DL_STR("duckVM_object_type_internalHashTable"));
+	case duckVM_object_type_internalTypedArray:
+		return dl_array_pushElements(string_array, DL_STR("duckVM_object_type_internalTypedArray"));
+	case duckVM_object_type_internalRecord:
+		return dl_array_pushElements(string_array, DL_STR("duckVM_object_type_internalRecord"));
 	case duckVM_object_type_last:
 		return dl_array_pushElements(string_array, DL_STR("duckVM_object_type_last"));
 	default:
@@ -7804,6 +14231,54 @@ dl_error_t duckVM_object_prettyPrint(dl_array_t *string_array, duckVM_object_t o
 		e = duckVM_user_prettyPrint(string_array, object.value.user);
 		if (e) goto cleanup;
 		break;
+	case duckVM_object_type_coroutine:
+		e = dl_array_pushElements(string_array, DL_STR("coroutine: ..."));
+		if (e) goto cleanup;
+		break;
+	case duckVM_object_type_internalCoroutine:
+		e = dl_array_pushElements(string_array, DL_STR("status: (duckVM_coroutine_status_t) "));
+		if (e) goto cleanup;
+		e = dl_string_fromSize(string_array, object.value.internalCoroutine.status);
+		if (e) goto cleanup;
+		break;
+	case duckVM_object_type_hashTable:
+		e = dl_array_pushElements(string_array, DL_STR("hashTable: ..."));
+		if (e) goto cleanup;
+		break;
+	case duckVM_object_type_stringBuilder:
+		e = dl_array_pushElements(string_array, DL_STR("stringBuilder: ..."));
+		if (e) goto cleanup;
+		break;
+	case duckVM_object_type_typedArray:
+		e = dl_array_pushElements(string_array, DL_STR("typedArray: ..."));
+		if (e) goto cleanup;
+		break;
+	case duckVM_object_type_internalTypedArray:
+		e = dl_array_pushElements(string_array, DL_STR("length: (dl_size_t) "));
+		if (e) goto cleanup;
+		e = dl_string_fromSize(string_array, object.value.internalTypedArray.length);
+		if (e) goto cleanup;
+		break;
+	case duckVM_object_type_record:
+		e = dl_array_pushElements(string_array, DL_STR("record: ..."));
+		if (e) goto cleanup;
+		break;
+	case duckVM_object_type_internalRecord:
+		e = dl_array_pushElements(string_array, DL_STR("type: (dl_size_t) "));
+		if (e) goto cleanup;
+		e = dl_string_fromSize(string_array, object.value.internalRecord.type);
+		if (e) goto cleanup;
+		e = dl_array_pushElements(string_array, DL_STR(", slots_length: (dl_size_t) "));
+		if (e) goto cleanup;
+		e = dl_string_fromSize(string_array, object.value.internalRecord.slots_length);
+		if (e) goto cleanup;
+		break;
+	case duckVM_object_type_internalHashTable:
+		e = dl_array_pushElements(string_array, DL_STR("length: (dl_size_t) "));
+		if (e) goto cleanup;
+		e = dl_string_fromSize(string_array, object.value.internalHashTable.length);
+		if (e) goto cleanup;
+		break;
 	default:
 		e = dl_array_pushElements(string_array, DL_STR("INVALID"));
 		if (e) goto cleanup;
@@ -44,6 +44,8 @@ typedef struct duckVM_gclist_s {
 	dl_array_strategy_t strategy;
 	dl_memoryAllocation_t *memoryAllocation;
 	struct duckVM_s *duckVM;
+	/* Only set during a collection. One flag for each region in `duckVM->frozen`, set once the region is reached. */
+	dl_bool_t *frozenReached;
 } duckVM_gclist_t;
 
 typedef struct {
@@ -51,6 +53,9 @@ typedef struct {
 	struct duckVM_object_s *bytecode;
 } duckVM_callFrame_t;
 
+/* Number of counters the VM uses to find hot code for its JIT. */
+#define DUCKVM_JIT_COUNTS 64
+
 typedef struct duckVM_s {
 	dl_memoryAllocation_t *memoryAllocation;
 	dl_array_t errors;  /* Runtime errors. */
@@ -58,6 +63,31 @@ typedef struct duckVM_s {
 	dl_array_t call_stack;  /* duckVM_callFrame_t */
 	/* I'm lazy and I don't want to bother with correct GC. */
 	struct duckVM_object_s *currentBytecode;
+	/* Where a budgeted run stopped. `dl_null` unless the VM is suspended. */
+	dl_uint8_t *suspendedIp;
+	/* The innermost running coroutine, or `dl_null` if no coroutine is running. */
+	struct duckVM_object_s *currentCoroutine;
+	/* Number of `duckVM_call`s in progress. The VM can't wait for a message while C code is on the call stack. */
+	dl_size_t callDepth;
+	/* Mailboxes the program can send to and receive from, addressed by channel number. */
+	dl_array_t channels;  /* duckVM_mailbox_t * */
+	/* Scratch space for `duckVM_send`. Maps heap objects to message nodes. Allocated on first use. */
+	dl_ptrdiff_t *messageMap;
+	/* Runs `parallel-map` on other VMs if set. */
+	struct duckVM_mapPool_s *mapPool;
+	/* Compiles hot bytecode to native code if set. */
+	struct duckVM_jit_s *jit;
+	/* Counts how often closures and loops are entered. Indexed by a hash of the address they start at, so unrelated code
+	   may share a counter. */
+	dl_size_t jitCounts[DUCKVM_JIT_COUNTS];
+	/* A copy of the bytecode most recently passed to `duckVM_executeBudgeted`, the stack length it was checked against,
+	   and whether it passed verification. Running the same bytecode on the same stack again skips the verifier. */
+	dl_array_t lastBytecode;  /* dl_uint8_t */
+	dl_size_t lastBytecode_stackLength;
+	dl_bool_t lastBytecode_verified;
+	/* Frozen regions this VM holds a reference to, sorted by the address of their objects. The garbage collector
+	   releases the ones that it can no longer reach. */
+	dl_array_t frozen;  /* duckVM_frozen_t * */
 	dl_array_t upvalue_stack;  /* duckVM_upvalue_t * */
 	dl_array_t upvalue_array_call_stack;  /* duckVM_upvalueArray_t */
 	/* Addressed by symbol number. */
@@ -77,6 +107,13 @@ typedef struct duckVM_s {
 typedef struct {
 	dl_uint8_t *value;
 	dl_size_t value_length;
+	/* Bytes `value` has room for. Only string builders leave room past `value_length`. */
+	dl_size_t capacity;
+	/* Hash of the first `hash_length` bytes, computed the first time it is needed. Bytes are never changed once written,
+	   so the hash stays valid when a builder appends to the string. Only valid if `hashed` is set. */
+	dl_size_t hash;
+	dl_size_t hash_length;
+	dl_bool_t hashed;
 } duckVM_internalString_t;
 
 typedef struct {
@@ -120,6 +157,9 @@ typedef struct {
 		struct duckVM_object_s *heap_object;
 		struct duckVM_object_s *heap_upvalue;
 	} value;
+	/* The coroutine whose stack `stack_index` points into, or `dl_null` for the stack used outside of coroutines. Only
+	   set while the upvalue is open. */
+	struct duckVM_object_s *coroutine;
 	duckVM_upvalue_type_t type;
 } duckVM_upvalue_t;
 
@@ -133,6 +173,8 @@ typedef struct {
 typedef struct {
 	struct duckVM_object_s **values;
 	dl_size_t length;
+	/* Number of elements `values` has room for. Only the first `length` are live. */
+	dl_size_t capacity;
 	dl_bool_t initialized;
 } duckVM_internalVector_t;
 
@@ -141,10 +183,43 @@ typedef struct {
 	dl_ptrdiff_t offset;
 } duckVM_vector_t;
 
+/* Compiled bytecode that can be run by any number of VMs at once, including VMs on different threads. It is created
+   once, verified once, and never written to afterward. VMs hold a reference to it instead of copying the bytecode into
+   their own heaps. Symbol names and constants are stored in the bytecode itself, so they are shared too. */
+typedef struct duckVM_program_s {
+	dl_memoryAllocation_t *memoryAllocation;
+	dl_uint8_t *bytecode;
+	dl_size_t bytecode_length;
+	/* Set if the bytecode was verified against an empty stack, which means it is safe on any stack. */
+	dl_bool_t verified;
+	/* Only touched through atomic operations. */
+	dl_size_t references;
+} duckVM_program_t;
+
 /* Should never appear on the stack */
 typedef struct {
 	dl_uint8_t *bytecode;
 	dl_size_t bytecode_length;
+	/* Set if the bytecode has been proven to never index outside of its stack frame. Operands are then read without
+	   bounds checks. */
+	dl_bool_t verified;
+	/* If set, the bytecode belongs to this program and must not be modified or freed. */
+	duckVM_program_t *program;
+	/* Frozen copies of quoted constants, made the first time each one is evaluated. Indexed by the slot operand of
+	   `pushQuoted` and `setQuoted`. Frozen objects aren't traced by the collector, so only the array itself is freed with
+	   the bytecode. */
+	struct duckVM_object_s *quoted;
+	dl_size_t quoted_length;
+	/* One bit per byte of bytecode, set on the opcode of each arithmetic instruction whose type-specialized form has
+	   seen operands of another type. Those instructions are not quickened again. Allocated on the first such miss and
+	   freed with the bytecode. */
+	dl_uint8_t *polymorphic;
+	/* Native code compiled from this bytecode by the VM's JIT. Freed with the bytecode. */
+	struct duckVM_native_s *native;
+	/* Two bits per byte of bytecode, allocated the first time the JIT is asked to compile part of this bytecode. Bit
+	   `i` is set if native code can be entered at offset `i`. Bit `bytecode_length + i` is set once compiling from
+	   offset `i` has been tried, so that it isn't tried again. */
+	dl_uint8_t *nativeEntries;
 } duckVM_bytecode_t;
 
 /* Should never appear on the stack */
@@ -156,6 +231,92 @@ typedef struct {
 
 typedef struct duckVM_object_s * duckVM_composite_t;
 
+/* The execution state a coroutine swaps with the VM when it is resumed or yields. While the coroutine runs, this holds
+   the state of whoever resumed it. Should never appear on the stack. */
+typedef struct {
+	dl_array_t stack;  /* duckVM_object_t */
+	dl_array_t call_stack;  /* duckVM_callFrame_t */
+	dl_array_t upvalue_stack;  /* duckVM_upvalue_t * */
+	dl_array_t upvalue_array_call_stack;  /* duckVM_upvalueArray_t */
+	dl_uint8_t *ip;
+	struct duckVM_object_s *bytecode;
+} duckVM_coroutineContext_t;
+
+typedef enum {
+	duckVM_coroutine_status_fresh,
+	duckVM_coroutine_status_suspended,
+	duckVM_coroutine_status_running,
+	duckVM_coroutine_status_done,
+} duckVM_coroutine_status_t;
+
+/* Should never appear on the stack */
+typedef struct {
+	duckVM_coroutineContext_t *context;
+	/* The closure the coroutine runs. It is called with the value passed to the first `resume`. */
+	struct duckVM_object_s *function;
+	/* The coroutine that resumed this one, or `dl_null` if it was resumed from outside of any coroutine. */
+	struct duckVM_object_s *resumer;
+	duckVM_coroutine_status_t status;
+} duckVM_internalCoroutine_t;
+
+typedef struct duckVM_object_s * duckVM_coroutine_t;
+
+/* Should never appear on the stack. Open addressing with linear probing. When the table grows, the old entries are
+   moved into the new table a few slots at a time each time a key is added, so no single insertion pays for rehashing
+   the whole table. */
+typedef struct {
+	/* `capacity` is zero or a power of two. */
+	struct duckVM_hashTableEntry_s *entries;
+	dl_size_t capacity;
+	/* Slots in `entries` that aren't empty plus live entries in `oldEntries` that will be moved into `entries`. */
+	dl_size_t used;
+	/* The table being moved into `entries`, or `dl_null`. */
+	struct duckVM_hashTableEntry_s *oldEntries;
+	dl_size_t oldCapacity;
+	/* Slots of `oldEntries` below this index have been moved. */
+	dl_size_t migrated;
+	/* Live entries in both tables. */
+	dl_size_t length;
+} duckVM_internalHashTable_t;
+
+typedef struct duckVM_object_s * duckVM_hashTable_t;
+
+/* Points to an internal string that grows as bytes are appended. Bytes that have been written are never changed, so
+   strings taken from the builder share its internal string instead of copying it. */
+typedef struct duckVM_object_s * duckVM_stringBuilder_t;
+
+typedef enum {
+	duckVM_typedArray_type_f64,
+	/* The VM's integer type, which is 64 bits wide on 64-bit hosts. */
+	duckVM_typedArray_type_i64,
+	duckVM_typedArray_type_u8,
+} duckVM_typedArray_type_t;
+
+/* Should never appear on the stack. Elements are stored unboxed in one contiguous block, so the collector never looks at
+   them and numeric kernels can stream through them. */
+typedef struct {
+	union {
+		double *f64;
+		dl_ptrdiff_t *i64;
+		dl_uint8_t *u8;
+	} elements;
+	dl_size_t length;
+	duckVM_typedArray_type_t type;
+} duckVM_internalTypedArray_t;
+
+typedef struct duckVM_object_s * duckVM_typedArray_t;
+
+/* Should never appear on the stack. Slots hold objects by value in one block, so a slot whose offset is known at compile
+   time is read with a single indexed load. */
+typedef struct {
+	struct duckVM_object_s *slots;
+	dl_size_t slots_length;
+	/* A type made by `make-type`. */
+	dl_size_t type;
+} duckVM_internalRecord_t;
+
+typedef struct duckVM_object_s * duckVM_record_t;
+
 typedef struct {
 	void *data;
 	dl_error_t (*destructor)(duckVM_gclist_t *, struct duckVM_object_s *);
@@ -180,6 +341,11 @@ typedef enum {
   duckVM_object_type_composite,
   /* User-defined type */
   duckVM_object_type_user,
+  duckVM_object_type_coroutine,
+  duckVM_object_type_hashTable,
+  duckVM_object_type_stringBuilder,
+  duckVM_object_type_typedArray,
+  duckVM_object_type_record,
 
   /* These types should never appear on the stack. */
   duckVM_object_type_cons,
@@ -189,6 +355,10 @@ typedef enum {
   duckVM_object_type_bytecode,
   duckVM_object_type_internalComposite,
   duckVM_object_type_internalString,
+  duckVM_object_type_internalCoroutine,
+  duckVM_object_type_internalHashTable,
+  duckVM_object_type_internalTypedArray,
+  duckVM_object_type_internalRecord,
 
   /* This is... you guessed it... the last entry in the enum. */
   duckVM_object_type_last,
@@ -215,18 +385,206 @@ typedef struct duckVM_object_s {
 		duckVM_internalComposite_t internalComposite;
 		duckVM_composite_t composite;
 		duckVM_user_t user;
+		duckVM_internalCoroutine_t internalCoroutine;
+		duckVM_coroutine_t coroutine;
+		duckVM_internalHashTable_t internalHashTable;
+		duckVM_hashTable_t hashTable;
+		duckVM_stringBuilder_t stringBuilder;
+		duckVM_internalTypedArray_t internalTypedArray;
+		duckVM_typedArray_t typedArray;
+		duckVM_internalRecord_t internalRecord;
+		duckVM_record_t record;
 	} value;
 	duckVM_object_type_t type;
 	dl_bool_t inUse;
 } duckVM_object_t;
 
+typedef enum {
+	duckVM_hashTableEntry_state_empty,
+	duckVM_hashTableEntry_state_full,
+	/* Deleted entries keep their key so that iteration can continue past a key that was deleted while iterating. */
+	duckVM_hashTableEntry_state_deleted,
+} duckVM_hashTableEntry_state_t;
+
+/* Keys and values are held by value, like objects on the stack. */
+typedef struct duckVM_hashTableEntry_s {
+	duckVM_object_t key;
+	duckVM_object_t value;
+	dl_size_t hash;
+	duckVM_hashTableEntry_state_t state;
+} duckVM_hashTableEntry_t;
+
 typedef dl_error_t (*duckVM_gclist_destructor_t)(duckVM_gclist_t *, duckVM_object_t *);
 
+/* An immutable copy of an object graph that lives outside of every VM's heap. The garbage collector never marks or
+   sweeps it, and any number of VMs, including VMs on different threads, may reference it at once. Writes to frozen
+   objects fail. Objects only point to objects in the same region or in one of its dependencies.
+   The region is freed by whichever thread releases the last reference, so `memoryAllocation` must be thread-safe if
+   the region is shared between threads. */
+typedef struct duckVM_frozen_s {
+	dl_memoryAllocation_t *memoryAllocation;
+	/* The value that was frozen. It refers to `objects`. */
+	duckVM_object_t root;
+	duckVM_object_t *objects;
+	dl_size_t objects_length;
+	/* Storage for the elements of frozen vectors and the contents of frozen strings. */
+	duckVM_object_t **elements;
+	dl_uint8_t *bytes;
+	/* Regions that objects in this region point into. */
+	dl_array_t dependencies;  /* duckVM_frozen_t * */
+	/* Only touched through atomic operations. */
+	dl_size_t references;
+} duckVM_frozen_t;
+
+/* One object in a message. References to other objects are node indices, or -1 for `dl_null`. A node with the type
+   `duckVM_object_type_none` is a frozen object, which is shared instead of copied. */
+typedef struct {
+	duckVM_object_type_t type;
+	union {
+		struct {
+			duckVM_object_t *object;
+			duckVM_frozen_t *region;
+		} frozen;
+		dl_bool_t boolean;
+		dl_ptrdiff_t integer;
+		double floatingPoint;
+		dl_size_t type;
+		dl_ptrdiff_t list;
+		struct {
+			dl_ptrdiff_t car;
+			dl_ptrdiff_t cdr;
+		} cons;
+		struct {
+			dl_ptrdiff_t internalString;
+			dl_ptrdiff_t offset;
+			dl_size_t length;
+		} string;
+		struct {
+			dl_size_t id;
+			dl_ptrdiff_t internalString;
+		} symbol;
+		struct {
+			dl_ptrdiff_t internalVector;
+			dl_ptrdiff_t offset;
+		} vector;
+		/* Internal strings, internal vectors and upvalue arrays. A range of `bytes` or `elements`. */
+		struct {
+			dl_ptrdiff_t offset;
+			dl_size_t length;
+			dl_bool_t initialized;
+		} range;
+		struct {
+			dl_ptrdiff_t name;
+			dl_ptrdiff_t bytecode;
+			dl_ptrdiff_t upvalueArray;
+			dl_uint8_t arity;
+			dl_bool_t variadic;
+		} closure;
+		/* The message holds a reference to the program. */
+		duckVM_program_t *program;
+		/* Open upvalues are sent as a copy of the captured value, so they always arrive closed. */
+		struct {
+			dl_ptrdiff_t value;
+			duckVM_upvalue_type_t type;
+		} upvalue;
+	} value;
+} duckVM_messageNode_t;
+
+/* An object copied out of one VM's heap so that it can be copied into another's. Each heap object is copied once, so
+   shared structure and cycles survive the trip. Frozen objects are referenced instead of copied. Closures can be sent if
+   their bytecode belongs to a shared program, which the receiver references instead of copying. Captured variables are
+   copied along with the closure. C functions, composites, coroutines, hash tables, string builders and user objects
+   can't be sent. */
+typedef struct duckVM_message_s {
+	/* Node 0 is the object that was sent. */
+	dl_array_t nodes;  /* duckVM_messageNode_t */
+	dl_array_t elements;  /* dl_ptrdiff_t */
+	dl_array_t bytes;  /* dl_uint8_t */
+	struct duckVM_message_s *next;
+} duckVM_message_t;
+
+/* A queue of messages. A mailbox has no owner. Any VM linked to it may send or receive.
+   Messages are allocated from `memoryAllocation` by the sender and freed by the receiver, so if the mailbox is shared
+   between threads the allocator must be thread-safe. The default allocator, which calls `malloc`, is. The one enabled
+   by `USE_DUCKLIB_MALLOC` isn't. */
+typedef struct {
+	dl_memoryAllocation_t *memoryAllocation;
+	duckVM_message_t *head;
+	duckVM_message_t *tail;
+	dl_size_t length;
+	/* Optional. If set, the queue is only touched between these calls. Set them to share the mailbox between
+	   threads. */
+	void (*lock)(void *lockData);
+	void (*unlock)(void *lockData);
+	void *lockData;
+} duckVM_mailbox_t;
+
+/* One slice of the vector passed to `parallel-map`. */
+typedef struct {
+	/* A vector of the function followed by the slice's elements. */
+	duckVM_message_t *input;
+	/* The vector of results. Set by `duckVM_mapChunk`. */
+	duckVM_message_t *output;
+	dl_error_t e;
+} duckVM_mapChunk_t;
+
+/* Lets `parallel-map` run on other VMs. A VM without a pool maps in place.
+   The function and the elements are sent to the workers as messages and the results are sent back, so everything
+   involved has to follow the rules for messages: the function has to be a closure from a shared program, and the
+   elements, the captured variables and the results can't contain C functions, composites, coroutines, hash tables,
+   string builders or user objects. Workers don't share the caller's globals. */
+typedef struct duckVM_mapPool_s {
+	/* Run `duckVM_mapChunk` on each chunk, each in a VM that isn't running anything else, and return once every chunk
+	   is done. Errors are returned in the chunks. */
+	dl_error_t (*run)(void *data, duckVM_mapChunk_t *chunks, dl_size_t chunks_length);
+	void *data;
+	/* The vector is split into at most this many chunks. */
+	dl_size_t workers;
+	/* Messages are allocated by the caller and the workers and freed by the caller, so this has to be thread-safe if
+	   the workers run on other threads. */
+	dl_memoryAllocation_t *memoryAllocation;
+} duckVM_mapPool_t;
+
+/* Native code compiled by a JIT from part of a bytecode object. A JIT's own data about the code follows this struct in
+   the same allocation. */
+typedef struct duckVM_native_s {
+	struct duckVM_native_s *next;
+	/* Offsets of the instructions the code can be entered at, in increasing order. */
+	dl_size_t *entries;
+	dl_size_t entries_length;
+} duckVM_native_t;
+
+/* Lets the VM run hot bytecode as native code. The VM interprets each closure and loop until it has been entered
+   `threshold` times, and then asks the JIT to compile the bytecode reachable from its first instruction. Native code
+   has to leave the VM exactly as the interpreter would have, so that the interpreter can take over at any
+   instruction. See "jit.h" for an implementation. */
+typedef struct duckVM_jit_s {
+	/* Compile the code reachable from `ip`. Set `*native` to code that can be entered at `ip`, or to `dl_null` if none
+	   could be compiled. */
+	dl_error_t (*compile)(void *data,
+	                      duckVM_t *duckVM,
+	                      struct duckVM_object_s *bytecode,
+	                      dl_uint8_t *ip,
+	                      duckVM_native_t **native);
+	/* Run native code from the entry at `*ip` until it reaches an instruction it can't run or `*budget` runs out. Set
+	   `*ip` to the instruction the interpreter continues at and subtract the instructions run from `*budget`. */
+	void (*run)(void *data, duckVM_t *duckVM, duckVM_native_t *native, dl_uint8_t **ip, dl_size_t *budget);
+	/* Free code returned by `compile`. */
+	void (*free)(void *data, duckVM_t *duckVM, duckVM_native_t *native);
+	void *data;
+	dl_size_t threshold;
+} duckVM_jit_t;
+
 typedef enum {
 	duckVM_halt_mode_run,
 	duckVM_halt_mode_halt,
+	/* Ran out of budget, or `receive` is waiting for a message. Continue with `duckVM_resume`. */
+	duckVM_halt_mode_suspend,
 } duckVM_halt_mode_t;
 
+/* Pass as the budget to run until the VM halts. */
+#define DUCKVM_BUDGET_UNLIMITED ((dl_size_t) -1)
+
 
 
 /* VM management */
@@ -235,10 +593,81 @@ typedef enum {
 dl_error_t duckVM_init(duckVM_t *duckVM, dl_memoryAllocation_t *memoryAllocation, dl_size_t maxObjects);
 /* Destroy the VM. This will free up any external resources that the VM is currently using. */
 void duckVM_quit(duckVM_t *duckVM);
-/* Execute bytecode. */
+/* Execute bytecode. Fails if the program waits for a message on an empty channel. */
 dl_error_t duckVM_execute(duckVM_t *duckVM, dl_uint8_t *bytecode, dl_size_t bytecode_length);
+/* Execute at most `budget` instructions. If the program hasn't halted by then, `*halt` is set to
+   `duckVM_halt_mode_suspend` and all state is kept in the VM until `duckVM_resume` is called. Otherwise `*halt` is set
+   to `duckVM_halt_mode_halt`. `bytecode` is copied into the VM, so it may be freed as soon as this returns. */
+dl_error_t duckVM_executeBudgeted(duckVM_t *duckVM,
+                                  dl_uint8_t *bytecode,
+                                  dl_size_t bytecode_length,
+                                  dl_size_t budget,
+                                  duckVM_halt_mode_t *halt);
+/* Execute a shared program as in `duckVM_executeBudgeted`. The VM holds a reference to the program until the last
+   closure created by it is collected. */
+dl_error_t duckVM_executeProgram(duckVM_t *duckVM,
+                                 duckVM_program_t *program,
+                                 dl_size_t budget,
+                                 duckVM_halt_mode_t *halt);
+/* Continue a suspended program for at most `budget` more instructions. `*halt` is set as in `duckVM_executeBudgeted`.
+   `duckVM_softReset` abandons a suspended program. */
+dl_error_t duckVM_resume(duckVM_t *duckVM, dl_size_t budget, duckVM_halt_mode_t *halt);
+/* Copy and verify bytecode as a shared program with a reference count of one. Run it with `duckVM_executeProgram`.
+   Quickening is disabled for shared programs since they can be executed by several threads at once.
+   `memoryAllocation` is only used here and when the last reference is released, which may happen on any thread. */
+dl_error_t duckVM_program_init(duckVM_program_t **program,
+                               dl_memoryAllocation_t *memoryAllocation,
+                               const dl_uint8_t *bytecode,
+                               const dl_size_t bytecode_length);
+/* Take another reference to the program. Thread-safe. */
+void duckVM_program_retain(duckVM_program_t *program);
+/* Drop a reference to the program, and free it if that was the last one. Thread-safe. */
+dl_error_t duckVM_program_release(duckVM_program_t *program);
+/* Check that branches land on instructions and that stack indices stay within their frame on every path, given the
+   current contents of the stack. Returns `dl_error_invalidValue` if the bytecode could not be verified.
+   `duckVM_execute` does this automatically and runs verified bytecode without bounds checks. */
+dl_error_t duckVM_verify(duckVM_t *duckVM, const dl_uint8_t *bytecode, const dl_size_t bytecode_length);
 /* Pass a C callback to the VM. `key` can be found by querying the compiler. */
 dl_error_t duckVM_linkCFunction(duckVM_t *duckVM, dl_ptrdiff_t key, dl_error_t (*callback)(duckVM_t *));
+/* Make a mailbox available to the program as channel number `key`. The mailbox must outlive the VM or be unlinked by
+   linking `dl_null`. */
+dl_error_t duckVM_linkChannel(duckVM_t *duckVM, dl_ptrdiff_t key, duckVM_mailbox_t *mailbox);
+/* Make `parallel-map` run on the pool's workers. The pool must outlive the VM or be unlinked by linking `dl_null`. */
+void duckVM_linkMapPool(duckVM_t *duckVM, duckVM_mapPool_t *mapPool);
+/* Run hot code as native code compiled by `jit`. Once linked, the JIT can't be unlinked and has to outlive the VM, since
+   the VM frees the code it compiled when the code's bytecode is collected. */
+void duckVM_linkJit(duckVM_t *duckVM, duckVM_jit_t *jit);
+
+/* Messages */
+
+/* Initialize an empty mailbox without a lock. */
+void duckVM_mailbox_init(duckVM_mailbox_t *mailbox, dl_memoryAllocation_t *memoryAllocation);
+/* Free all messages still in the mailbox. */
+dl_error_t duckVM_mailbox_quit(duckVM_mailbox_t *mailbox);
+/* Copy the object on top of the stack into a message and add it to the end of the mailbox. The stack is not changed.
+   Frozen objects are shared with the receiver instead of copied. */
+dl_error_t duckVM_send(duckVM_t *duckVM, duckVM_mailbox_t *mailbox);
+/* If the mailbox isn't empty, take the oldest message, copy it into the VM's heap, and push it on the stack. */
+dl_error_t duckVM_tryReceive(duckVM_t *duckVM, duckVM_mailbox_t *mailbox, dl_bool_t *received);
+
+/* Run one chunk of a `parallel-map` in this VM. Called by a pool's `run` function. The VM must be idle and able to run
+   the program that the function belongs to. The stack is left as it was. */
+dl_error_t duckVM_mapChunk(duckVM_t *duckVM, duckVM_mapPool_t *mapPool, duckVM_mapChunk_t *chunk);
+
+/* Frozen objects */
+
+/* Replace the object on top of the stack with a frozen copy. The copy is owned by the VM. If `region` isn't `dl_null`,
+   it is set to a new reference to the frozen region, or to `dl_null` if the object has nothing to freeze, like an
+   integer. Objects that are already frozen are not copied again. The region is allocated with the VM's allocator, so
+   that allocator has to outlive every VM the region is shared with. */
+dl_error_t duckVM_freeze(duckVM_t *duckVM, duckVM_frozen_t **region);
+/* Push the value of a frozen region onto the stack without copying it. The VM takes its own reference to the
+   region. */
+dl_error_t duckVM_pushFrozen(duckVM_t *duckVM, duckVM_frozen_t *region);
+/* Take another reference to the region. Thread-safe. */
+void duckVM_frozen_retain(duckVM_frozen_t *region);
+/* Drop a reference to the region, and free it if that was the last one. Thread-safe. */
+dl_error_t duckVM_frozen_release(duckVM_frozen_t *region);
 
 /* Empty the stack. */
 dl_error_t duckVM_popAll(duckVM_t *duckVM);
@@ -287,6 +287,530 @@ dl_error_t duckLisp_emit_symbolId(duckLisp_t *duckLisp,
 	                                        source_index);
 }
 
+dl_error_t duckLisp_emit_makeCoroutine(duckLisp_t *duckLisp,
+                                       duckLisp_compileState_t *compileState,
+                                       dl_array_t *assembly,
+                                       const dl_ptrdiff_t function_index) {
+	return duckLisp_emit_unaryStackOperator(duckLisp,
+	                                        compileState,
+	                                        assembly,
+	                                        duckLisp_instructionClass_makeCoroutine,
+	                                        function_index);
+}
+
+dl_error_t duckLisp_emit_resume(duckLisp_t *duckLisp,
+                                duckLisp_compileState_t *compileState,
+                                dl_array_t *assembly,
+                                const dl_ptrdiff_t coroutine_index,
+                                const dl_ptrdiff_t value_index) {
+	return duckLisp_emit_binaryStackOperator(duckLisp,
+	                                         compileState,
+	                                         assembly,
+	                                         duckLisp_instructionClass_resume,
+	                                         coroutine_index,
+	                                         value_index);
+}
+
+dl_error_t duckLisp_emit_yield(duckLisp_t *duckLisp,
+                               duckLisp_compileState_t *compileState,
+                               dl_array_t *assembly,
+                               const dl_ptrdiff_t value_index) {
+	return duckLisp_emit_unaryStackOperator(duckLisp,
+	                                        compileState,
+	                                        assembly,
+	                                        duckLisp_instructionClass_yield,
+	                                        value_index);
+}
+
+dl_error_t duckLisp_emit_coroutineDonep(duckLisp_t *duckLisp,
+                                        duckLisp_compileState_t *compileState,
+                                        dl_array_t *assembly,
+                                        const dl_ptrdiff_t coroutine_index) {
+	return duckLisp_emit_unaryStackOperator(duckLisp,
+	                                        compileState,
+	                                        assembly,
+	                                        duckLisp_instructionClass_coroutineDonep,
+	                                        coroutine_index);
+}
+
+dl_error_t duckLisp_emit_send(duckLisp_t *duckLisp,
+                              duckLisp_compileState_t *compileState,
+                              dl_array_t *assembly,
+                              const dl_ptrdiff_t channel_index,
+                              const dl_ptrdiff_t value_index) {
+	return duckLisp_emit_binaryStackOperator(duckLisp,
+	                                         compileState,
+	                                         assembly,
+	                                         duckLisp_instructionClass_send,
+	                                         channel_index,
+	                                         value_index);
+}
+
+dl_error_t duckLisp_emit_receive(duckLisp_t *duckLisp,
+                                 duckLisp_compileState_t *compileState,
+                                 dl_array_t *assembly,
+                                 const dl_ptrdiff_t channel_index) {
+	return duckLisp_emit_unaryStackOperator(duckLisp,
+	                                        compileState,
+	                                        assembly,
+	                                        duckLisp_instructionClass_receive,
+	                                        channel_index);
+}
+
+dl_error_t duckLisp_emit_tryReceive(duckLisp_t *duckLisp,
+                                    duckLisp_compileState_t *compileState,
+                                    dl_array_t *assembly,
+                                    const dl_ptrdiff_t channel_index,
+                                    const dl_ptrdiff_t default_index) {
+	return duckLisp_emit_binaryStackOperator(duckLisp,
+	                                         compileState,
+	                                         assembly,
+	                                         duckLisp_instructionClass_tryReceive,
+	                                         channel_index,
+	                                         default_index);
+}
+
+dl_error_t duckLisp_emit_freeze(duckLisp_t *duckLisp,
+                                duckLisp_compileState_t *compileState,
+                                dl_array_t *assembly,
+                                const dl_ptrdiff_t value_index) {
+	return duckLisp_emit_unaryStackOperator(duckLisp,
+	                                        compileState,
+	                                        assembly,
+	                                        duckLisp_instructionClass_freeze,
+	                                        value_index);
+}
+
+dl_error_t duckLisp_emit_parallelMap(duckLisp_t *duckLisp,
+                                     duckLisp_compileState_t *compileState,
+                                     dl_array_t *assembly,
+                                     const dl_ptrdiff_t function_index,
+                                     const dl_ptrdiff_t vector_index) {
+	return duckLisp_emit_binaryStackOperator(duckLisp,
+	                                         compileState,
+	                                         assembly,
+	                                         duckLisp_instructionClass_parallelMap,
+	                                         function_index,
+	                                         vector_index);
+}
+
+dl_error_t duckLisp_emit_makeHashTable(duckLisp_t *duckLisp, duckLisp_compileState_t *compileState, dl_array_t *assembly) {
+	return duckLisp_emit_nullaryOperator(duckLisp, compileState, assembly, duckLisp_instructionClass_makeHashTable);
+}
+
+dl_error_t duckLisp_emit_hashTableGet(duckLisp_t *duckLisp,
+                                      duckLisp_compileState_t *compileState,
+                                      dl_array_t *assembly,
+                                      const dl_ptrdiff_t table_index,
+                                      const dl_ptrdiff_t key_index,
+                                      const dl_ptrdiff_t default_index) {
+	return duckLisp_emit_ternaryStackOperator(duckLisp,
+	                                          compileState,
+	                                          assembly,
+	                                          duckLisp_instructionClass_hashTableGet,
+	                                          table_index,
+	                                          key_index,
+	                                          default_index);
+}
+
+dl_error_t duckLisp_emit_hashTableSet(duckLisp_t *duckLisp,
+                                      duckLisp_compileState_t *compileState,
+                                      dl_array_t *assembly,
+                                      const dl_ptrdiff_t table_index,
+                                      const dl_ptrdiff_t key_index,
+                                      const dl_ptrdiff_t value_index) {
+	return duckLisp_emit_ternaryStackOperator(duckLisp,
+	                                          compileState,
+	                                          assembly,
+	                                          duckLisp_instructionClass_hashTableSet,
+	                                          table_index,
+	                                          key_index,
+	                                          value_index);
+}
+
+dl_error_t duckLisp_emit_hashTableDelete(duckLisp_t *duckLisp,
+                                         duckLisp_compileState_t *compileState,
+                                         dl_array_t *assembly,
+                                         const dl_ptrdiff_t table_index,
+                                         const dl_ptrdiff_t key_index) {
+	return duckLisp_emit_binaryStackOperator(duckLisp,
+	                                         compileState,
+	                                         assembly,
+	                                         duckLisp_instructionClass_hashTableDelete,
+	                                         table_index,
+	                                         key_index);
+}
+
+dl_error_t duckLisp_emit_hashTableNext(duckLisp_t *duckLisp,
+                                       duckLisp_compileState_t *compileState,
+                                       dl_array_t *assembly,
+                                       const dl_ptrdiff_t table_index,
+                                       const dl_ptrdiff_t key_index) {
+	return duckLisp_emit_binaryStackOperator(duckLisp,
+	                                         compileState,
+	                                         assembly,
+	                                         duckLisp_instructionClass_hashTableNext,
+	                                         table_index,
+	                                         key_index);
+}
+
+dl_error_t duckLisp_emit_vectorPush(duckLisp_t *duckLisp,
+                                    duckLisp_compileState_t *compileState,
+                                    dl_array_t *assembly,
+                                    const dl_ptrdiff_t vector_index,
+                                    const dl_ptrdiff_t value_index) {
+	return duckLisp_emit_binaryStackOperator(duckLisp,
+	                                         compileState,
+	                                         assembly,
+	                                         duckLisp_instructionClass_vectorPush,
+	                                         vector_index,
+	                                         value_index);
+}
+
+dl_error_t duckLisp_emit_vectorPop(duckLisp_t *duckLisp,
+                                   duckLisp_compileState_t *compileState,
+                                   dl_array_t *assembly,
+                                   const dl_ptrdiff_t vector_index) {
+	return duckLisp_emit_unaryStackOperator(duckLisp,
+	                                        compileState,
+	                                        assembly,
+	                                        duckLisp_instructionClass_vectorPop,
+	                                        vector_index);
+}
+
+dl_error_t duckLisp_emit_vectorTruncate(duckLisp_t *duckLisp,
+                                        duckLisp_compileState_t *compileState,
+                                        dl_array_t *assembly,
+                                        const dl_ptrdiff_t vector_index,
+                                        const dl_ptrdiff_t length_index) {
+	return duckLisp_emit_binaryStackOperator(duckLisp,
+	                                         compileState,
+	                                         assembly,
+	                                         duckLisp_instructionClass_vectorTruncate,
+	                                         vector_index,
+	                                         length_index);
+}
+
+dl_error_t duckLisp_emit_makeStringBuilder(duckLisp_t *duckLisp, duckLisp_compileState_t *compileState, dl_array_t *assembly) {
+	return duckLisp_emit_nullaryOperator(duckLisp, compileState, assembly, duckLisp_instructionClass_makeStringBuilder);
+}
+
+dl_error_t duckLisp_emit_stringBuilderAppend(duckLisp_t *duckLisp,
+                                             duckLisp_compileState_t *compileState,
+                                             dl_array_t *assembly,
+                                             const dl_ptrdiff_t builder_index,
+                                             const dl_ptrdiff_t string_index) {
+	return duckLisp_emit_binaryStackOperator(duckLisp,
+	                                         compileState,
+	                                         assembly,
+	                                         duckLisp_instructionClass_stringBuilderAppend,
+	                                         builder_index,
+	                                         string_index);
+}
+
+dl_error_t duckLisp_emit_stringSearch(duckLisp_t *duckLisp,
+                                      duckLisp_compileState_t *compileState,
+                                      dl_array_t *assembly,
+                                      const dl_ptrdiff_t string_index,
+                                      const dl_ptrdiff_t pattern_index,
+                                      const dl_ptrdiff_t start_index) {
+	return duckLisp_emit_ternaryStackOperator(duckLisp,
+	                                          compileState,
+	                                          assembly,
+	                                          duckLisp_instructionClass_stringSearch,
+	                                          string_index,
+	                                          pattern_index,
+	                                          start_index);
+}
+
+dl_error_t duckLisp_emit_stringCompare(duckLisp_t *duckLisp,
+                                       duckLisp_compileState_t *compileState,
+                                       dl_array_t *assembly,
+                                       const dl_ptrdiff_t left_index,
+                                       const dl_ptrdiff_t right_index) {
+	return duckLisp_emit_binaryStackOperator(duckLisp,
+	                                         compileState,
+	                                         assembly,
+	                                         duckLisp_instructionClass_stringCompare,
+	                                         left_index,
+	                                         right_index);
+}
+
+dl_error_t duckLisp_emit_utf8Validp(duckLisp_t *duckLisp,
+                                    duckLisp_compileState_t *compileState,
+                                    dl_array_t *assembly,
+                                    const dl_ptrdiff_t string_index) {
+	return duckLisp_emit_unaryStackOperator(duckLisp,
+	                                        compileState,
+	                                        assembly,
+	                                        duckLisp_instructionClass_utf8Validp,
+	                                        string_index);
+}
+
+dl_error_t duckLisp_emit_utf8Length(duckLisp_t *duckLisp,
+                                    duckLisp_compileState_t *compileState,
+                                    dl_array_t *assembly,
+                                    const dl_ptrdiff_t string_index) {
+	return duckLisp_emit_unaryStackOperator(duckLisp,
+	                                        compileState,
+	                                        assembly,
+	                                        duckLisp_instructionClass_utf8Length,
+	                                        string_index);
+}
+
+dl_error_t duckLisp_emit_stringUpcase(duckLisp_t *duckLisp,
+                                      duckLisp_compileState_t *compileState,
+                                      dl_array_t *assembly,
+                                      const dl_ptrdiff_t string_index) {
+	return duckLisp_emit_unaryStackOperator(duckLisp,
+	                                        compileState,
+	                                        assembly,
+	                                        duckLisp_instructionClass_stringUpcase,
+	                                        string_index);
+}
+
+dl_error_t duckLisp_emit_stringDowncase(duckLisp_t *duckLisp,
+                                        duckLisp_compileState_t *compileState,
+                                        dl_array_t *assembly,
+                                        const dl_ptrdiff_t string_index) {
+	return duckLisp_emit_unaryStackOperator(duckLisp,
+	                                        compileState,
+	                                        assembly,
+	                                        duckLisp_instructionClass_stringDowncase,
+	                                        string_index);
+}
+
+dl_error_t duckLisp_emit_makeTypedArray(duckLisp_t *duckLisp,
+                                        duckLisp_compileState_t *compileState,
+                                        dl_array_t *assembly,
+                                        const dl_ptrdiff_t type_index,
+                                        const dl_ptrdiff_t length_index) {
+	return duckLisp_emit_binaryStackOperator(duckLisp,
+	                                         compileState,
+	                                         assembly,
+	                                         duckLisp_instructionClass_makeTypedArray,
+	                                         type_index,
+	                                         length_index);
+}
+
+dl_error_t duckLisp_emit_typedArraySum(duckLisp_t *duckLisp,
+                                       duckLisp_compileState_t *compileState,
+                                       dl_array_t *assembly,
+                                       const dl_ptrdiff_t array_index) {
+	return duckLisp_emit_unaryStackOperator(duckLisp,
+	                                        compileState,
+	                                        assembly,
+	                                        duckLisp_instructionClass_typedArraySum,
+	                                        array_index);
+}
+
+dl_error_t duckLisp_emit_typedArrayDot(duckLisp_t *duckLisp,
+                                       duckLisp_compileState_t *compileState,
+                                       dl_array_t *assembly,
+                                       const dl_ptrdiff_t left_index,
+                                       const dl_ptrdiff_t right_index) {
+	return duckLisp_emit_binaryStackOperator(duckLisp,
+	                                         compileState,
+	                                         assembly,
+	                                         duckLisp_instructionClass_typedArrayDot,
+	                                         left_index,
+	                                         right_index);
+}
+
+dl_error_t duckLisp_emit_typedArrayScale(duckLisp_t *duckLisp,
+                                         duckLisp_compileState_t *compileState,
+                                         dl_array_t *assembly,
+                                         const dl_ptrdiff_t array_index,
+                                         const dl_ptrdiff_t factor_index) {
+	return duckLisp_emit_binaryStackOperator(duckLisp,
+	                                         compileState,
+	                                         assembly,
+	                                         duckLisp_instructionClass_typedArrayScale,
+	                                         array_index,
+	                                         factor_index);
+}
+
+dl_error_t duckLisp_emit_typedArrayAdd(duckLisp_t *duckLisp,
+                                       duckLisp_compileState_t *compileState,
+                                       dl_array_t *assembly,
+                                       const dl_ptrdiff_t destination_index,
+                                       const dl_ptrdiff_t source_index) {
+	return duckLisp_emit_binaryStackOperator(duckLisp,
+	                                         compileState,
+	                                         assembly,
+	                                         duckLisp_instructionClass_typedArrayAdd,
+	                                         destination_index,
+	                                         source_index);
+}
+
+dl_error_t duckLisp_emit_typedArrayMul(duckLisp_t *duckLisp,
+                                       duckLisp_compileState_t *compileState,
+                                       dl_array_t *assembly,
+                                       const dl_ptrdiff_t destination_index,
+                                       const dl_ptrdiff_t source_index) {
+	return duckLisp_emit_binaryStackOperator(duckLisp,
+	                                         compileState,
+	                                         assembly,
+	                                         duckLisp_instructionClass_typedArrayMul,
+	                                         destination_index,
+	                                         source_index);
+}
+
+dl_error_t duckLisp_emit_typedArrayMin(duckLisp_t *duckLisp,
+                                       duckLisp_compileState_t *compileState,
+                                       dl_array_t *assembly,
+                                       const dl_ptrdiff_t array_index) {
+	return duckLisp_emit_unaryStackOperator(duckLisp,
+	                                        compileState,
+	                                        assembly,
+	                                        duckLisp_instructionClass_typedArrayMin,
+	                                        array_index);
+}
+
+dl_error_t duckLisp_emit_typedArrayMax(duckLisp_t *duckLisp,
+                                       duckLisp_compileState_t *compileState,
+                                       dl_array_t *assembly,
+                                       const dl_ptrdiff_t array_index) {
+	return duckLisp_emit_unaryStackOperator(duckLisp,
+	                                        compileState,
+	                                        assembly,
+	                                        duckLisp_instructionClass_typedArrayMax,
+	                                        array_index);
+}
+
+dl_error_t duckLisp_emit_makeRecord(duckLisp_t *duckLisp,
+                                    duckLisp_compileState_t *compileState,
+                                    dl_array_t *assembly,
+                                    const dl_ptrdiff_t type_index,
+                                    const dl_ptrdiff_t length_index) {
+	return duckLisp_emit_binaryStackOperator(duckLisp,
+	                                         compileState,
+	                                         assembly,
+	                                         duckLisp_instructionClass_makeRecord,
+	                                         type_index,
+	                                         length_index);
+}
+
+/* The slot is an immediate operand so that the VM doesn't have to look it up or type check it. */
+dl_error_t duckLisp_emit_recordSlot(duckLisp_t *duckLisp,
+                                    duckLisp_compileState_t *compileState,
+                                    dl_array_t *assembly,
+                                    const dl_ptrdiff_t record_index,
+                                    const dl_ptrdiff_t slot) {
+	duckLisp_instructionArgClass_t argument0 = {0};
+	duckLisp_instructionArgClass_t argument1 = {0};
+	argument0.type = duckLisp_instructionArgClass_type_index;
+	argument0.value.index = duckLisp_localsLength_get(compileState) - record_index;
+	argument1.type = duckLisp_instructionArgClass_type_integer;
+	argument1.value.integer = slot;
+	return duckLisp_emit_binaryOperator(duckLisp,
+	                                    compileState,
+	                                    assembly,
+	                                    duckLisp_instructionClass_recordSlot,
+	                                    argument0,
+	                                    argument1);
+}
+
+dl_error_t duckLisp_emit_setRecordSlot(duckLisp_t *duckLisp,
+                                       duckLisp_compileState_t *compileState,
+                                       dl_array_t *assembly,
+                                       const dl_ptrdiff_t record_index,
+                                       const dl_ptrdiff_t slot,
+                                       const dl_ptrdiff_t value_index) {
+	duckLisp_instructionArgClass_t argument0 = {0};
+	duckLisp_instructionArgClass_t argument1 = {0};
+	duckLisp_instructionArgClass_t argument2 = {0};
+	argument0.type = duckLisp_instructionArgClass_type_index;
+	argument0.value.index = duckLisp_localsLength_get(compileState) - record_index;
+	argument1.type = duckLisp_instructionArgClass_type_integer;
+	argument1.value.integer = slot;
+	argument2.type = duckLisp_instructionArgClass_type_index;
+	argument2.value.index = duckLisp_localsLength_get(compileState) - value_index;
+	return duckLisp_emit_ternaryOperator(duckLisp,
+	                                     compileState,
+	                                     assembly,
+	                                     duckLisp_instructionClass_setRecordSlot,
+	                                     argument0,
+	                                     argument1,
+	                                     argument2);
+}
+
+dl_error_t duckLisp_emit_nth(duckLisp_t *duckLisp,
+                             duckLisp_compileState_t *compileState,
+                             dl_array_t *assembly,
+                             const dl_ptrdiff_t index_index,
+                             const dl_ptrdiff_t list_index) {
+	return duckLisp_emit_binaryStackOperator(duckLisp,
+	                                         compileState,
+	                                         assembly,
+	                                         duckLisp_instructionClass_nth,
+	                                         index_index,
+	                                         list_index);
+}
+
+dl_error_t duckLisp_emit_nthcdr(duckLisp_t *duckLisp,
+                                duckLisp_compileState_t *compileState,
+                                dl_array_t *assembly,
+                                const dl_ptrdiff_t index_index,
+                                const dl_ptrdiff_t list_index) {
+	return duckLisp_emit_binaryStackOperator(duckLisp,
+	                                         compileState,
+	                                         assembly,
+	                                         duckLisp_instructionClass_nthcdr,
+	                                         index_index,
+	                                         list_index);
+}
+
+dl_error_t duckLisp_emit_append(duckLisp_t *duckLisp,
+                                duckLisp_compileState_t *compileState,
+                                dl_array_t *assembly,
+                                const dl_ptrdiff_t left_index,
+                                const dl_ptrdiff_t right_index) {
+	return duckLisp_emit_binaryStackOperator(duckLisp,
+	                                         compileState,
+	                                         assembly,
+	                                         duckLisp_instructionClass_append,
+	                                         left_index,
+	                                         right_index);
+}
+
+dl_error_t duckLisp_emit_reverse(duckLisp_t *duckLisp,
+                                 duckLisp_compileState_t *compileState,
+                                 dl_array_t *assembly,
+                                 const dl_ptrdiff_t list_index) {
+	return duckLisp_emit_unaryStackOperator(duckLisp,
+	                                        compileState,
+	                                        assembly,
+	                                        duckLisp_instructionClass_reverse,
+	                                        list_index);
+}
+
+dl_error_t duckLisp_emit_assoc(duckLisp_t *duckLisp,
+                               duckLisp_compileState_t *compileState,
+                               dl_array_t *assembly,
+                               const dl_ptrdiff_t key_index,
+                               const dl_ptrdiff_t list_index) {
+	return duckLisp_emit_binaryStackOperator(duckLisp,
+	                                         compileState,
+	                                         assembly,
+	                                         duckLisp_instructionClass_assoc,
+	                                         key_index,
+	                                         list_index);
+}
+
+dl_error_t duckLisp_emit_member(duckLisp_t *duckLisp,
+                                duckLisp_compileState_t *compileState,
+                                dl_array_t *assembly,
+                                const dl_ptrdiff_t value_index,
+                                const dl_ptrdiff_t list_index) {
+	return duckLisp_emit_binaryStackOperator(duckLisp,
+	                                         compileState,
+	                                         assembly,
+	                                         duckLisp_instructionClass_member,
+	                                         value_index,
+	                                         list_index);
+}
+
 dl_error_t duckLisp_emit_typeof(duckLisp_t *duckLisp,
                                 duckLisp_compileState_t *compileState,
                                 dl_array_t *assembly,
@@ -768,8 +1292,6 @@ dl_error_t duckLisp_emit_setStatic(duckLisp_t *duckLisp,
 	duckLisp_instructionArgClass_t argument0 = {0};
 	duckLisp_instructionArgClass_t argument1 = {0};
 
-	if (destination_static_index == source_stack_index) goto cleanup;
-
 	argument0.type = duckLisp_instructionArgClass_type_index;
 	argument0.value.index = duckLisp_localsLength_get(compileState) - source_stack_index;
 	argument1.type = duckLisp_instructionArgClass_type_index;
@@ -781,7 +1303,6 @@ dl_error_t duckLisp_emit_setStatic(duckLisp_t *duckLisp,
 	                                 argument0,
 	                                 argument1);
 	duckLisp_localsLength_decrement(compileState);
- cleanup:
 	return e;
 }
 
@@ -821,6 +1342,48 @@ dl_error_t duckLisp_emit_move(duckLisp_t *duckLisp,
 	return e;
 }
 
+/* Push constant `slot` of the running bytecode, or nil if it hasn't been set. */
+dl_error_t duckLisp_emit_pushQuoted(duckLisp_t *duckLisp,
+                                    duckLisp_compileState_t *compileState,
+                                    dl_array_t *assembly,
+                                    const dl_ptrdiff_t slot) {
+	duckLisp_instructionArgClass_t argument = {0};
+	argument.type = duckLisp_instructionArgClass_type_integer;
+	argument.value.integer = slot;
+	return duckLisp_emit_unaryOperator(duckLisp,
+	                                   compileState,
+	                                   assembly,
+	                                   duckLisp_instructionClass_pushQuoted,
+	                                   argument);
+}
+
+/* Freeze the object at `index` in place and keep it as constant `slot` of the running bytecode. */
+dl_error_t duckLisp_emit_setQuoted(duckLisp_t *duckLisp,
+                                   duckLisp_compileState_t *compileState,
+                                   dl_array_t *assembly,
+                                   const dl_ptrdiff_t index,
+                                   const dl_ptrdiff_t slot) {
+	dl_error_t e = dl_error_ok;
+
+	duckLisp_instructionArgClass_t argument0 = {0};
+	duckLisp_instructionArgClass_t argument1 = {0};
+	argument0.type = duckLisp_instructionArgClass_type_index;
+	argument0.value.index = duckLisp_localsLength_get(compileState) - index;
+	argument1.type = duckLisp_instructionArgClass_type_integer;
+	argument1.value.integer = slot;
+	e = duckLisp_emit_binaryOperator(duckLisp,
+	                                 compileState,
+	                                 assembly,
+	                                 duckLisp_instructionClass_setQuoted,
+	                                 argument0,
+	                                 argument1);
+	if (e) goto cleanup;
+	/**/ duckLisp_localsLength_decrement(compileState);
+
+ cleanup:
+	return e;
+}
+
 dl_error_t duckLisp_emit_pushBoolean(duckLisp_t *duckLisp,
                                      duckLisp_compileState_t *compileState,
                                      dl_array_t *assembly,
@@ -1133,11 +1696,22 @@ dl_error_t duckLisp_emit_releaseUpvalues(duckLisp_t *duckLisp,
 dl_error_t duckLisp_emit_ccall(duckLisp_t *duckLisp,
                                duckLisp_compileState_t *compileState,
                                dl_array_t *assembly,
-                               dl_ptrdiff_t callback_index) {
-	duckLisp_instructionArgClass_t argument = {0};
-	argument.type = duckLisp_instructionArgClass_type_integer;
-	argument.value.integer = callback_index;
-	return duckLisp_emit_unaryOperator(duckLisp, compileState, assembly, duckLisp_instructionClass_ccall, argument);
+                               dl_ptrdiff_t callback_index,
+                               dl_uint8_t arity) {
+	duckLisp_instructionArgClass_t argument0 = {0};
+	duckLisp_instructionArgClass_t argument1 = {0};
+	/* Callback key. */
+	argument0.type = duckLisp_instructionArgClass_type_integer;
+	argument0.value.integer = callback_index;
+	/* Arity */
+	argument1.type = duckLisp_instructionArgClass_type_integer;
+	argument1.value.integer = arity;
+	return duckLisp_emit_binaryOperator(duckLisp,
+	                                    compileState,
+	                                    assembly,
+	                                    duckLisp_instructionClass_ccall,
+	                                    argument0,
+	                                    argument1);
 }
 
 dl_error_t duckLisp_emit_pushIndex(duckLisp_t *duckLisp,
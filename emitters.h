@@ -110,6 +110,240 @@ dl_error_t duckLisp_emit_symbolId(duckLisp_t *duckLisp,
                                   dl_array_t *assembly,
                                   const dl_ptrdiff_t source_index);
 
+dl_error_t duckLisp_emit_makeCoroutine(duckLisp_t *duckLisp,
+                                       duckLisp_compileState_t *compileState,
+                                       dl_array_t *assembly,
+                                       const dl_ptrdiff_t function_index);
+
+dl_error_t duckLisp_emit_resume(duckLisp_t *duckLisp,
+                                duckLisp_compileState_t *compileState,
+                                dl_array_t *assembly,
+                                const dl_ptrdiff_t coroutine_index,
+                                const dl_ptrdiff_t value_index);
+
+dl_error_t duckLisp_emit_yield(duckLisp_t *duckLisp,
+                               duckLisp_compileState_t *compileState,
+                               dl_array_t *assembly,
+                               const dl_ptrdiff_t value_index);
+
+dl_error_t duckLisp_emit_coroutineDonep(duckLisp_t *duckLisp,
+                                        duckLisp_compileState_t *compileState,
+                                        dl_array_t *assembly,
+                                        const dl_ptrdiff_t coroutine_index);
+
+dl_error_t duckLisp_emit_send(duckLisp_t *duckLisp,
+                              duckLisp_compileState_t *compileState,
+                              dl_array_t *assembly,
+                              const dl_ptrdiff_t channel_index,
+                              const dl_ptrdiff_t value_index);
+
+dl_error_t duckLisp_emit_receive(duckLisp_t *duckLisp,
+                                 duckLisp_compileState_t *compileState,
+                                 dl_array_t *assembly,
+                                 const dl_ptrdiff_t channel_index);
+
+dl_error_t duckLisp_emit_tryReceive(duckLisp_t *duckLisp,
+                                    duckLisp_compileState_t *compileState,
+                                    dl_array_t *assembly,
+                                    const dl_ptrdiff_t channel_index,
+                                    const dl_ptrdiff_t default_index);
+
+dl_error_t duckLisp_emit_freeze(duckLisp_t *duckLisp,
+                                duckLisp_compileState_t *compileState,
+                                dl_array_t *assembly,
+                                const dl_ptrdiff_t value_index);
+
+dl_error_t duckLisp_emit_parallelMap(duckLisp_t *duckLisp,
+                                     duckLisp_compileState_t *compileState,
+                                     dl_array_t *assembly,
+                                     const dl_ptrdiff_t function_index,
+                                     const dl_ptrdiff_t vector_index);
+
+dl_error_t duckLisp_emit_makeHashTable(duckLisp_t *duckLisp, duckLisp_compileState_t *compileState, dl_array_t *assembly);
+
+dl_error_t duckLisp_emit_hashTableGet(duckLisp_t *duckLisp,
+                                      duckLisp_compileState_t *compileState,
+                                      dl_array_t *assembly,
+                                      const dl_ptrdiff_t table_index,
+                                      const dl_ptrdiff_t key_index,
+                                      const dl_ptrdiff_t default_index);
+
+dl_error_t duckLisp_emit_hashTableSet(duckLisp_t *duckLisp,
+                                      duckLisp_compileState_t *compileState,
+                                      dl_array_t *assembly,
+                                      const dl_ptrdiff_t table_index,
+                                      const dl_ptrdiff_t key_index,
+                                      const dl_ptrdiff_t value_index);
+
+dl_error_t duckLisp_emit_hashTableDelete(duckLisp_t *duckLisp,
+                                         duckLisp_compileState_t *compileState,
+                                         dl_array_t *assembly,
+                                         const dl_ptrdiff_t table_index,
+                                         const dl_ptrdiff_t key_index);
+
+dl_error_t duckLisp_emit_hashTableNext(duckLisp_t *duckLisp,
+                                       duckLisp_compileState_t *compileState,
+                                       dl_array_t *assembly,
+                                       const dl_ptrdiff_t table_index,
+                                       const dl_ptrdiff_t key_index);
+
+dl_error_t duckLisp_emit_vectorPush(duckLisp_t *duckLisp,
+                                    duckLisp_compileState_t *compileState,
+                                    dl_array_t *assembly,
+                                    const dl_ptrdiff_t vector_index,
+                                    const dl_ptrdiff_t value_index);
+
+dl_error_t duckLisp_emit_vectorPop(duckLisp_t *duckLisp,
+                                   duckLisp_compileState_t *compileState,
+                                   dl_array_t *assembly,
+                                   const dl_ptrdiff_t vector_index);
+
+dl_error_t duckLisp_emit_vectorTruncate(duckLisp_t *duckLisp,
+                                        duckLisp_compileState_t *compileState,
+                                        dl_array_t *assembly,
+                                        const dl_ptrdiff_t vector_index,
+                                        const dl_ptrdiff_t length_index);
+
+dl_error_t duckLisp_emit_makeStringBuilder(duckLisp_t *duckLisp, duckLisp_compileState_t *compileState, dl_array_t *assembly);
+
+dl_error_t duckLisp_emit_stringBuilderAppend(duckLisp_t *duckLisp,
+                                             duckLisp_compileState_t *compileState,
+                                             dl_array_t *assembly,
+                                             const dl_ptrdiff_t builder_index,
+                                             const dl_ptrdiff_t string_index);
+
+dl_error_t duckLisp_emit_stringSearch(duckLisp_t *duckLisp,
+                                      duckLisp_compileState_t *compileState,
+                                      dl_array_t *assembly,
+                                      const dl_ptrdiff_t string_index,
+                                      const dl_ptrdiff_t pattern_index,
+                                      const dl_ptrdiff_t start_index);
+
+dl_error_t duckLisp_emit_stringCompare(duckLisp_t *duckLisp,
+                                       duckLisp_compileState_t *compileState,
+                                       dl_array_t *assembly,
+                                       const dl_ptrdiff_t left_index,
+                                       const dl_ptrdiff_t right_index);
+
+dl_error_t duckLisp_emit_utf8Validp(duckLisp_t *duckLisp,
+                                    duckLisp_compileState_t *compileState,
+                                    dl_array_t *assembly,
+                                    const dl_ptrdiff_t string_index);
+
+dl_error_t duckLisp_emit_utf8Length(duckLisp_t *duckLisp,
+                                    duckLisp_compileState_t *compileState,
+                                    dl_array_t *assembly,
+                                    const dl_ptrdiff_t string_index);
+
+dl_error_t duckLisp_emit_stringUpcase(duckLisp_t *duckLisp,
+                                      duckLisp_compileState_t *compileState,
+                                      dl_array_t *assembly,
+                                      const dl_ptrdiff_t string_index);
+
+dl_error_t duckLisp_emit_stringDowncase(duckLisp_t *duckLisp,
+                                        duckLisp_compileState_t *compileState,
+                                        dl_array_t *assembly,
+                                        const dl_ptrdiff_t string_index);
+
+dl_error_t duckLisp_emit_makeTypedArray(duckLisp_t *duckLisp,
+                                        duckLisp_compileState_t *compileState,
+                                        dl_array_t *assembly,
+                                        const dl_ptrdiff_t type_index,
+                                        const dl_ptrdiff_t length_index);
+
+dl_error_t duckLisp_emit_typedArraySum(duckLisp_t *duckLisp,
+                                       duckLisp_compileState_t *compileState,
+                                       dl_array_t *assembly,
+                                       const dl_ptrdiff_t array_index);
+
+dl_error_t duckLisp_emit_typedArrayDot(duckLisp_t *duckLisp,
+                                       duckLisp_compileState_t *compileState,
+                                       dl_array_t *assembly,
+                                       const dl_ptrdiff_t left_index,
+                                       const dl_ptrdiff_t right_index);
+
+dl_error_t duckLisp_emit_typedArrayScale(duckLisp_t *duckLisp,
+                                         duckLisp_compileState_t *compileState,
+                                         dl_array_t *assembly,
+                                         const dl_ptrdiff_t array_index,
+                                         const dl_ptrdiff_t factor_index);
+
+dl_error_t duckLisp_emit_typedArrayAdd(duckLisp_t *duckLisp,
+                                       duckLisp_compileState_t *compileState,
+                                       dl_array_t *assembly,
+                                       const dl_ptrdiff_t destination_index,
+                                       const dl_ptrdiff_t source_index);
+
+dl_error_t duckLisp_emit_typedArrayMul(duckLisp_t *duckLisp,
+                                       duckLisp_compileState_t *compileState,
+                                       dl_array_t *assembly,
+                                       const dl_ptrdiff_t destination_index,
+                                       const dl_ptrdiff_t source_index);
+
+dl_error_t duckLisp_emit_typedArrayMin(duckLisp_t *duckLisp,
+                                       duckLisp_compileState_t *compileState,
+                                       dl_array_t *assembly,
+                                       const dl_ptrdiff_t array_index);
+
+dl_error_t duckLisp_emit_typedArrayMax(duckLisp_t *duckLisp,
+                                       duckLisp_compileState_t *compileState,
+                                       dl_array_t *assembly,
+                                       const dl_ptrdiff_t array_index);
+
+dl_error_t duckLisp_emit_makeRecord(duckLisp_t *duckLisp,
+                                    duckLisp_compileState_t *compileState,
+                                    dl_array_t *assembly,
+                                    const dl_ptrdiff_t type_index,
+                                    const dl_ptrdiff_t length_index);
+
+dl_error_t duckLisp_emit_recordSlot(duckLisp_t *duckLisp,
+                                    duckLisp_compileState_t *compileState,
+                                    dl_array_t *assembly,
+                                    const dl_ptrdiff_t record_index,
+                                    const dl_ptrdiff_t slot);
+
+dl_error_t duckLisp_emit_setRecordSlot(duckLisp_t *duckLisp,
+                                       duckLisp_compileState_t *compileState,
+                                       dl_array_t *assembly,
+                                       const dl_ptrdiff_t record_index,
+                                       const dl_ptrdiff_t slot,
+                                       const dl_ptrdiff_t value_index);
+
+dl_error_t duckLisp_emit_nth(duckLisp_t *duckLisp,
+                             duckLisp_compileState_t *compileState,
+                             dl_array_t *assembly,
+                             const dl_ptrdiff_t index_index,
+                             const dl_ptrdiff_t list_index);
+
+dl_error_t duckLisp_emit_nthcdr(duckLisp_t *duckLisp,
+                                duckLisp_compileState_t *compileState,
+                                dl_array_t *assembly,
+                                const dl_ptrdiff_t index_index,
+                                const dl_ptrdiff_t list_index);
+
+dl_error_t duckLisp_emit_append(duckLisp_t *duckLisp,
+                                duckLisp_compileState_t *compileState,
+                                dl_array_t *assembly,
+                                const dl_ptrdiff_t left_index,
+                                const dl_ptrdiff_t right_index);
+
+dl_error_t duckLisp_emit_reverse(duckLisp_t *duckLisp,
+                                 duckLisp_compileState_t *compileState,
+                                 dl_array_t *assembly,
+                                 const dl_ptrdiff_t list_index);
+
+dl_error_t duckLisp_emit_assoc(duckLisp_t *duckLisp,
+                               duckLisp_compileState_t *compileState,
+                               dl_array_t *assembly,
+                               const dl_ptrdiff_t key_index,
+                               const dl_ptrdiff_t list_index);
+
+dl_error_t duckLisp_emit_member(duckLisp_t *duckLisp,
+                                duckLisp_compileState_t *compileState,
+                                dl_array_t *assembly,
+                                const dl_ptrdiff_t value_index,
+                                const dl_ptrdiff_t list_index);
+
 dl_error_t duckLisp_emit_typeof(duckLisp_t *duckLisp,
                                 duckLisp_compileState_t *compileState,
                                 dl_array_t *assembly,
@@ -284,6 +518,17 @@ dl_error_t duckLisp_emit_move(duckLisp_t *duckLisp,
                               const dl_ptrdiff_t destination_index,
                               const dl_ptrdiff_t source_index);
 
+dl_error_t duckLisp_emit_pushQuoted(duckLisp_t *duckLisp,
+                                    duckLisp_compileState_t *compileState,
+                                    dl_array_t *assembly,
+                                    const dl_ptrdiff_t slot);
+
+dl_error_t duckLisp_emit_setQuoted(duckLisp_t *duckLisp,
+                                   duckLisp_compileState_t *compileState,
+                                   dl_array_t *assembly,
+                                   const dl_ptrdiff_t index,
+                                   const dl_ptrdiff_t slot);
+
 dl_error_t duckLisp_emit_pushBoolean(duckLisp_t *duckLisp,
                                      duckLisp_compileState_t *compileState,
                                      dl_array_t *assembly,
@@ -336,7 +581,8 @@ dl_error_t duckLisp_emit_releaseUpvalues(duckLisp_t *duckLisp,
 dl_error_t duckLisp_emit_ccall(duckLisp_t *duckLisp,
                                duckLisp_compileState_t *compileState,
                                dl_array_t *assembly,
-                               dl_ptrdiff_t callback_index);
+                               dl_ptrdiff_t callback_index,
+                               dl_uint8_t arity);
 
 dl_error_t duckLisp_emit_pushIndex(duckLisp_t *duckLisp,
                                    duckLisp_compileState_t *compileState,
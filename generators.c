@@ -147,6 +147,65 @@ dl_error_t duckLisp_generator_binaryArithmeticOperator(duckLisp_t *duckLisp,
 	return e;
 }
 
+/* Like `duckLisp_generator_binaryArithmeticOperator`, but emits a type-specialized instruction when both operands are
+   known to be integers or known to be floats. */
+dl_error_t duckLisp_generator_numericBinaryOperator(duckLisp_t *duckLisp,
+                                                   duckLisp_compileState_t *compileState,
+                                                   dl_array_t *assembly,
+                                                   duckLisp_ast_expression_t *expression,
+                                                   duckLisp_instructionClass_t genericClass,
+                                                   duckLisp_instructionClass_t integerClass,
+                                                   duckLisp_instructionClass_t floatClass) {
+	dl_error_t e = dl_error_ok;
+
+	dl_ptrdiff_t destination_index;
+	dl_ptrdiff_t source_index;
+	duckLisp_ast_type_t destination_type;
+	duckLisp_ast_type_t source_type;
+	duckLisp_instructionClass_t instructionClass = genericClass;
+
+	e = duckLisp_checkArgsAndReportError(duckLisp, *expression, 3, dl_false);
+	if (e) goto cleanup;
+
+	e = duckLisp_compile_compoundExpression(duckLisp,
+	                                        compileState,
+	                                        assembly,
+	                                        expression->compoundExpressions[0].value.identifier.value,
+	                                        expression->compoundExpressions[0].value.identifier.value_length,
+	                                        &expression->compoundExpressions[1],
+	                                        &destination_index,
+	                                        &destination_type,
+	                                        dl_false);
+	if (e) goto cleanup;
+
+	e = duckLisp_compile_compoundExpression(duckLisp,
+	                                        compileState,
+	                                        assembly,
+	                                        expression->compoundExpressions[0].value.identifier.value,
+	                                        expression->compoundExpressions[0].value.identifier.value_length,
+	                                        &expression->compoundExpressions[2],
+	                                        &source_index,
+	                                        &source_type,
+	                                        dl_false);
+	if (e) goto cleanup;
+
+	if (destination_type == source_type) {
+		if (destination_type == duckLisp_ast_type_int) instructionClass = integerClass;
+		else if (destination_type == duckLisp_ast_type_float) instructionClass = floatClass;
+	}
+
+	e = duckLisp_emit_binaryStackOperator(duckLisp,
+	                                      compileState,
+	                                      assembly,
+	                                      instructionClass,
+	                                      destination_index,
+	                                      source_index);
+	if (e) goto cleanup;
+
+ cleanup:
+	return e;
+}
+
 dl_error_t duckLisp_generator_ternaryArithmeticOperator(duckLisp_t *duckLisp,
                                                         duckLisp_compileState_t *compileState,
                                                         dl_array_t *assembly,
@@ -185,8 +244,556 @@ dl_error_t duckLisp_generator_ternaryArithmeticOperator(duckLisp_t *duckLisp,
 	                                        assembly,
 	                                        expression->compoundExpressions[0].value.identifier.value,
 	                                        expression->compoundExpressions[0].value.identifier.value_length,
-	                                        &expression->compoundExpressions[2],
-	                                        &second_index,
+	                                        &expression->compoundExpressions[2],
+	                                        &second_index,
+	                                        dl_null,
+	                                        dl_false);
+	if (e) goto cleanup;
+
+	e = duckLisp_compile_compoundExpression(duckLisp,
+	                                        compileState,
+	                                        assembly,
+	                                        expression->compoundExpressions[0].value.identifier.value,
+	                                        expression->compoundExpressions[0].value.identifier.value_length,
+	                                        &expression->compoundExpressions[3],
+	                                        &third_index,
+	                                        dl_null,
+	                                        dl_false);
+	if (e) goto cleanup;
+
+	e = emitter(duckLisp, compileState, assembly, first_index, second_index, third_index);
+	if (e) goto cleanup;
+
+ cleanup:
+
+	eError = dl_array_quit(&eString);
+	if (eError) e = eError;
+
+	return e;
+}
+
+
+/* Generator for the `__declare` keyword that is recognized by the parenthesis inferrer. Expands to nil, no matter what
+   arguments are passed to it. */
+dl_error_t duckLisp_generator_declare(duckLisp_t *duckLisp,
+                                      duckLisp_compileState_t *compileState,
+                                      dl_array_t *assembly,
+                                      duckLisp_ast_expression_t *expression) {
+	(void) expression;
+	return duckLisp_emit_nil(duckLisp, compileState, assembly);
+}
+
+dl_error_t duckLisp_generator_makeString(duckLisp_t *duckLisp,
+                                         duckLisp_compileState_t *compileState,
+                                         dl_array_t *assembly,
+                                         duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_unaryArithmeticOperator(duckLisp,
+	                                                  compileState,
+	                                                  assembly,
+	                                                  expression,
+	                                                  duckLisp_emit_makeString);
+}
+
+dl_error_t duckLisp_generator_concatenate(duckLisp_t *duckLisp,
+                                          duckLisp_compileState_t *compileState,
+                                          dl_array_t *assembly,
+                                          duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_binaryArithmeticOperator(duckLisp,
+	                                                   compileState,
+	                                                   assembly,
+	                                                   expression,
+	                                                   duckLisp_emit_concatenate);
+}
+
+dl_error_t duckLisp_generator_substring(duckLisp_t *duckLisp,
+                                        duckLisp_compileState_t *compileState,
+                                        dl_array_t *assembly,
+                                        duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_ternaryArithmeticOperator(duckLisp,
+	                                                    compileState,
+	                                                    assembly,
+	                                                    expression,
+	                                                    duckLisp_emit_substring);
+}
+
+dl_error_t duckLisp_generator_length(duckLisp_t *duckLisp,
+                                     duckLisp_compileState_t *compileState,
+                                     dl_array_t *assembly,
+                                     duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_unaryArithmeticOperator(duckLisp,
+	                                                  compileState,
+	                                                  assembly,
+	                                                  expression,
+	                                                  duckLisp_emit_length);
+}
+
+dl_error_t duckLisp_generator_symbolString(duckLisp_t *duckLisp,
+                                           duckLisp_compileState_t *compileState,
+                                           dl_array_t *assembly,
+                                           duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_unaryArithmeticOperator(duckLisp,
+	                                                  compileState,
+	                                                  assembly,
+	                                                  expression,
+	                                                  duckLisp_emit_symbolString);
+}
+
+dl_error_t duckLisp_generator_symbolId(duckLisp_t *duckLisp,
+                                       duckLisp_compileState_t *compileState,
+                                       dl_array_t *assembly,
+                                       duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_unaryArithmeticOperator(duckLisp,
+	                                                  compileState,
+	                                                  assembly,
+	                                                  expression,
+	                                                  duckLisp_emit_symbolId);
+}
+
+dl_error_t duckLisp_generator_makeCoroutine(duckLisp_t *duckLisp,
+                                            duckLisp_compileState_t *compileState,
+                                            dl_array_t *assembly,
+                                            duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_unaryArithmeticOperator(duckLisp,
+                                                  compileState,
+                                                  assembly,
+                                                  expression,
+                                                  duckLisp_emit_makeCoroutine);
+}
+
+dl_error_t duckLisp_generator_resume(duckLisp_t *duckLisp,
+                                     duckLisp_compileState_t *compileState,
+                                     dl_array_t *assembly,
+                                     duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_binaryArithmeticOperator(duckLisp,
+                                                   compileState,
+                                                   assembly,
+                                                   expression,
+                                                   duckLisp_emit_resume);
+}
+
+dl_error_t duckLisp_generator_yield(duckLisp_t *duckLisp,
+                                    duckLisp_compileState_t *compileState,
+                                    dl_array_t *assembly,
+                                    duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_unaryArithmeticOperator(duckLisp,
+                                                  compileState,
+                                                  assembly,
+                                                  expression,
+                                                  duckLisp_emit_yield);
+}
+
+dl_error_t duckLisp_generator_coroutineDonep(duckLisp_t *duckLisp,
+                                             duckLisp_compileState_t *compileState,
+                                             dl_array_t *assembly,
+                                             duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_unaryArithmeticOperator(duckLisp,
+                                                  compileState,
+                                                  assembly,
+                                                  expression,
+                                                  duckLisp_emit_coroutineDonep);
+}
+
+dl_error_t duckLisp_generator_send(duckLisp_t *duckLisp,
+                                   duckLisp_compileState_t *compileState,
+                                   dl_array_t *assembly,
+                                   duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_binaryArithmeticOperator(duckLisp,
+                                                   compileState,
+                                                   assembly,
+                                                   expression,
+                                                   duckLisp_emit_send);
+}
+
+dl_error_t duckLisp_generator_receive(duckLisp_t *duckLisp,
+                                      duckLisp_compileState_t *compileState,
+                                      dl_array_t *assembly,
+                                      duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_unaryArithmeticOperator(duckLisp,
+                                                  compileState,
+                                                  assembly,
+                                                  expression,
+                                                  duckLisp_emit_receive);
+}
+
+dl_error_t duckLisp_generator_tryReceive(duckLisp_t *duckLisp,
+                                         duckLisp_compileState_t *compileState,
+                                         dl_array_t *assembly,
+                                         duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_binaryArithmeticOperator(duckLisp,
+                                                   compileState,
+                                                   assembly,
+                                                   expression,
+                                                   duckLisp_emit_tryReceive);
+}
+
+dl_error_t duckLisp_generator_freeze(duckLisp_t *duckLisp,
+                                     duckLisp_compileState_t *compileState,
+                                     dl_array_t *assembly,
+                                     duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_unaryArithmeticOperator(duckLisp,
+                                                  compileState,
+                                                  assembly,
+                                                  expression,
+                                                  duckLisp_emit_freeze);
+}
+
+dl_error_t duckLisp_generator_parallelMap(duckLisp_t *duckLisp,
+                                          duckLisp_compileState_t *compileState,
+                                          dl_array_t *assembly,
+                                          duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_binaryArithmeticOperator(duckLisp,
+                                                   compileState,
+                                                   assembly,
+                                                   expression,
+                                                   duckLisp_emit_parallelMap);
+}
+
+dl_error_t duckLisp_generator_makeHashTable(duckLisp_t *duckLisp,
+                                            duckLisp_compileState_t *compileState,
+                                            dl_array_t *assembly,
+                                            duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_nullaryArithmeticOperator(duckLisp,
+	                                                    compileState,
+	                                                    assembly,
+	                                                    expression,
+	                                                    duckLisp_emit_makeHashTable);
+}
+
+dl_error_t duckLisp_generator_hashTableGet(duckLisp_t *duckLisp,
+                                           duckLisp_compileState_t *compileState,
+                                           dl_array_t *assembly,
+                                           duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_ternaryArithmeticOperator(duckLisp,
+	                                                    compileState,
+	                                                    assembly,
+	                                                    expression,
+	                                                    duckLisp_emit_hashTableGet);
+}
+
+dl_error_t duckLisp_generator_hashTableSet(duckLisp_t *duckLisp,
+                                           duckLisp_compileState_t *compileState,
+                                           dl_array_t *assembly,
+                                           duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_ternaryArithmeticOperator(duckLisp,
+	                                                    compileState,
+	                                                    assembly,
+	                                                    expression,
+	                                                    duckLisp_emit_hashTableSet);
+}
+
+dl_error_t duckLisp_generator_hashTableDelete(duckLisp_t *duckLisp,
+                                              duckLisp_compileState_t *compileState,
+                                              dl_array_t *assembly,
+                                              duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_binaryArithmeticOperator(duckLisp,
+                                                   compileState,
+                                                   assembly,
+                                                   expression,
+                                                   duckLisp_emit_hashTableDelete);
+}
+
+dl_error_t duckLisp_generator_hashTableNext(duckLisp_t *duckLisp,
+                                            duckLisp_compileState_t *compileState,
+                                            dl_array_t *assembly,
+                                            duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_binaryArithmeticOperator(duckLisp,
+                                                   compileState,
+                                                   assembly,
+                                                   expression,
+                                                   duckLisp_emit_hashTableNext);
+}
+
+dl_error_t duckLisp_generator_vectorPush(duckLisp_t *duckLisp,
+                                         duckLisp_compileState_t *compileState,
+                                         dl_array_t *assembly,
+                                         duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_binaryArithmeticOperator(duckLisp,
+                                                   compileState,
+                                                   assembly,
+                                                   expression,
+                                                   duckLisp_emit_vectorPush);
+}
+
+dl_error_t duckLisp_generator_vectorPop(duckLisp_t *duckLisp,
+                                        duckLisp_compileState_t *compileState,
+                                        dl_array_t *assembly,
+                                        duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_unaryArithmeticOperator(duckLisp,
+                                                  compileState,
+                                                  assembly,
+                                                  expression,
+                                                  duckLisp_emit_vectorPop);
+}
+
+dl_error_t duckLisp_generator_vectorTruncate(duckLisp_t *duckLisp,
+                                             duckLisp_compileState_t *compileState,
+                                             dl_array_t *assembly,
+                                             duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_binaryArithmeticOperator(duckLisp,
+                                                   compileState,
+                                                   assembly,
+                                                   expression,
+                                                   duckLisp_emit_vectorTruncate);
+}
+
+dl_error_t duckLisp_generator_makeStringBuilder(duckLisp_t *duckLisp,
+                                                duckLisp_compileState_t *compileState,
+                                                dl_array_t *assembly,
+                                                duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_nullaryArithmeticOperator(duckLisp,
+	                                                    compileState,
+	                                                    assembly,
+	                                                    expression,
+	                                                    duckLisp_emit_makeStringBuilder);
+}
+
+dl_error_t duckLisp_generator_stringBuilderAppend(duckLisp_t *duckLisp,
+                                                  duckLisp_compileState_t *compileState,
+                                                  dl_array_t *assembly,
+                                                  duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_binaryArithmeticOperator(duckLisp,
+                                                   compileState,
+                                                   assembly,
+                                                   expression,
+                                                   duckLisp_emit_stringBuilderAppend);
+}
+
+dl_error_t duckLisp_generator_stringSearch(duckLisp_t *duckLisp,
+                                           duckLisp_compileState_t *compileState,
+                                           dl_array_t *assembly,
+                                           duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_ternaryArithmeticOperator(duckLisp,
+	                                                    compileState,
+	                                                    assembly,
+	                                                    expression,
+	                                                    duckLisp_emit_stringSearch);
+}
+
+dl_error_t duckLisp_generator_stringCompare(duckLisp_t *duckLisp,
+                                            duckLisp_compileState_t *compileState,
+                                            dl_array_t *assembly,
+                                            duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_binaryArithmeticOperator(duckLisp,
+                                                   compileState,
+                                                   assembly,
+                                                   expression,
+                                                   duckLisp_emit_stringCompare);
+}
+
+dl_error_t duckLisp_generator_utf8Validp(duckLisp_t *duckLisp,
+                                         duckLisp_compileState_t *compileState,
+                                         dl_array_t *assembly,
+                                         duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_unaryArithmeticOperator(duckLisp,
+                                                  compileState,
+                                                  assembly,
+                                                  expression,
+                                                  duckLisp_emit_utf8Validp);
+}
+
+dl_error_t duckLisp_generator_utf8Length(duckLisp_t *duckLisp,
+                                         duckLisp_compileState_t *compileState,
+                                         dl_array_t *assembly,
+                                         duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_unaryArithmeticOperator(duckLisp,
+                                                  compileState,
+                                                  assembly,
+                                                  expression,
+                                                  duckLisp_emit_utf8Length);
+}
+
+dl_error_t duckLisp_generator_stringUpcase(duckLisp_t *duckLisp,
+                                           duckLisp_compileState_t *compileState,
+                                           dl_array_t *assembly,
+                                           duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_unaryArithmeticOperator(duckLisp,
+                                                  compileState,
+                                                  assembly,
+                                                  expression,
+                                                  duckLisp_emit_stringUpcase);
+}
+
+dl_error_t duckLisp_generator_stringDowncase(duckLisp_t *duckLisp,
+                                             duckLisp_compileState_t *compileState,
+                                             dl_array_t *assembly,
+                                             duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_unaryArithmeticOperator(duckLisp,
+                                                  compileState,
+                                                  assembly,
+                                                  expression,
+                                                  duckLisp_emit_stringDowncase);
+}
+
+dl_error_t duckLisp_generator_makeTypedArray(duckLisp_t *duckLisp,
+                                             duckLisp_compileState_t *compileState,
+                                             dl_array_t *assembly,
+                                             duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_binaryArithmeticOperator(duckLisp,
+                                                   compileState,
+                                                   assembly,
+                                                   expression,
+                                                   duckLisp_emit_makeTypedArray);
+}
+
+dl_error_t duckLisp_generator_typedArraySum(duckLisp_t *duckLisp,
+                                            duckLisp_compileState_t *compileState,
+                                            dl_array_t *assembly,
+                                            duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_unaryArithmeticOperator(duckLisp,
+                                                  compileState,
+                                                  assembly,
+                                                  expression,
+                                                  duckLisp_emit_typedArraySum);
+}
+
+dl_error_t duckLisp_generator_typedArrayDot(duckLisp_t *duckLisp,
+                                            duckLisp_compileState_t *compileState,
+                                            dl_array_t *assembly,
+                                            duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_binaryArithmeticOperator(duckLisp,
+                                                   compileState,
+                                                   assembly,
+                                                   expression,
+                                                   duckLisp_emit_typedArrayDot);
+}
+
+dl_error_t duckLisp_generator_typedArrayScale(duckLisp_t *duckLisp,
+                                              duckLisp_compileState_t *compileState,
+                                              dl_array_t *assembly,
+                                              duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_binaryArithmeticOperator(duckLisp,
+                                                   compileState,
+                                                   assembly,
+                                                   expression,
+                                                   duckLisp_emit_typedArrayScale);
+}
+
+dl_error_t duckLisp_generator_typedArrayAdd(duckLisp_t *duckLisp,
+                                            duckLisp_compileState_t *compileState,
+                                            dl_array_t *assembly,
+                                            duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_binaryArithmeticOperator(duckLisp,
+                                                   compileState,
+                                                   assembly,
+                                                   expression,
+                                                   duckLisp_emit_typedArrayAdd);
+}
+
+dl_error_t duckLisp_generator_typedArrayMul(duckLisp_t *duckLisp,
+                                            duckLisp_compileState_t *compileState,
+                                            dl_array_t *assembly,
+                                            duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_binaryArithmeticOperator(duckLisp,
+                                                   compileState,
+                                                   assembly,
+                                                   expression,
+                                                   duckLisp_emit_typedArrayMul);
+}
+
+dl_error_t duckLisp_generator_typedArrayMin(duckLisp_t *duckLisp,
+                                            duckLisp_compileState_t *compileState,
+                                            dl_array_t *assembly,
+                                            duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_unaryArithmeticOperator(duckLisp,
+                                                  compileState,
+                                                  assembly,
+                                                  expression,
+                                                  duckLisp_emit_typedArrayMin);
+}
+
+dl_error_t duckLisp_generator_typedArrayMax(duckLisp_t *duckLisp,
+                                            duckLisp_compileState_t *compileState,
+                                            dl_array_t *assembly,
+                                            duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_unaryArithmeticOperator(duckLisp,
+                                                  compileState,
+                                                  assembly,
+                                                  expression,
+                                                  duckLisp_emit_typedArrayMax);
+}
+
+dl_error_t duckLisp_generator_makeRecord(duckLisp_t *duckLisp,
+                                         duckLisp_compileState_t *compileState,
+                                         dl_array_t *assembly,
+                                         duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_binaryArithmeticOperator(duckLisp,
+                                                   compileState,
+                                                   assembly,
+                                                   expression,
+                                                   duckLisp_emit_makeRecord);
+}
+
+/* The slot must be known at compile time, so it is emitted as an immediate operand. */
+dl_error_t duckLisp_generator_recordSlot(duckLisp_t *duckLisp,
+                                         duckLisp_compileState_t *compileState,
+                                         dl_array_t *assembly,
+                                         duckLisp_ast_expression_t *expression) {
+	dl_error_t e = dl_error_ok;
+
+	dl_ptrdiff_t record_index;
+
+	e = duckLisp_checkArgsAndReportError(duckLisp, *expression, 3, dl_false);
+	if (e) goto cleanup;
+
+	if ((expression->compoundExpressions[2].type != duckLisp_ast_type_int)
+	    || (expression->compoundExpressions[2].value.integer.value < 0)
+	    || (expression->compoundExpressions[2].value.integer.value > 0x7FFFFFFF)) {
+		e = duckLisp_error_pushRuntime(duckLisp, DL_STR("record-slot: Slot must be a non-negative integer literal."));
+		if (e) goto cleanup;
+		e = dl_error_invalidValue;
+		goto cleanup;
+	}
+
+	e = duckLisp_compile_compoundExpression(duckLisp,
+	                                        compileState,
+	                                        assembly,
+	                                        expression->compoundExpressions[0].value.identifier.value,
+	                                        expression->compoundExpressions[0].value.identifier.value_length,
+	                                        &expression->compoundExpressions[1],
+	                                        &record_index,
+	                                        dl_null,
+	                                        dl_false);
+	if (e) goto cleanup;
+
+	e = duckLisp_emit_recordSlot(duckLisp,
+	                             compileState,
+	                             assembly,
+	                             record_index,
+	                             expression->compoundExpressions[2].value.integer.value);
+	if (e) goto cleanup;
+
+ cleanup:
+	return e;
+}
+
+dl_error_t duckLisp_generator_setRecordSlot(duckLisp_t *duckLisp,
+                                            duckLisp_compileState_t *compileState,
+                                            dl_array_t *assembly,
+                                            duckLisp_ast_expression_t *expression) {
+	dl_error_t e = dl_error_ok;
+
+	dl_ptrdiff_t record_index;
+	dl_ptrdiff_t value_index;
+
+	e = duckLisp_checkArgsAndReportError(duckLisp, *expression, 4, dl_false);
+	if (e) goto cleanup;
+
+	if ((expression->compoundExpressions[2].type != duckLisp_ast_type_int)
+	    || (expression->compoundExpressions[2].value.integer.value < 0)
+	    || (expression->compoundExpressions[2].value.integer.value > 0x7FFFFFFF)) {
+		e = duckLisp_error_pushRuntime(duckLisp, DL_STR("set-record-slot: Slot must be a non-negative integer literal."));
+		if (e) goto cleanup;
+		e = dl_error_invalidValue;
+		goto cleanup;
+	}
+
+	e = duckLisp_compile_compoundExpression(duckLisp,
+	                                        compileState,
+	                                        assembly,
+	                                        expression->compoundExpressions[0].value.identifier.value,
+	                                        expression->compoundExpressions[0].value.identifier.value_length,
+	                                        &expression->compoundExpressions[1],
+	                                        &record_index,
 	                                        dl_null,
 	                                        dl_false);
 	if (e) goto cleanup;
@@ -197,97 +804,307 @@ dl_error_t duckLisp_generator_ternaryArithmeticOperator(duckLisp_t *duckLisp,
 	                                        expression->compoundExpressions[0].value.identifier.value,
 	                                        expression->compoundExpressions[0].value.identifier.value_length,
 	                                        &expression->compoundExpressions[3],
-	                                        &third_index,
+	                                        &value_index,
 	                                        dl_null,
 	                                        dl_false);
 	if (e) goto cleanup;
 
-	e = emitter(duckLisp, compileState, assembly, first_index, second_index, third_index);
+	e = duckLisp_emit_setRecordSlot(duckLisp,
+	                                compileState,
+	                                assembly,
+	                                record_index,
+	                                expression->compoundExpressions[2].value.integer.value,
+	                                value_index);
 	if (e) goto cleanup;
 
  cleanup:
+	return e;
+}
 
-	eError = dl_array_quit(&eString);
-	if (eError) e = eError;
+dl_error_t duckLisp_generator_nth(duckLisp_t *duckLisp,
+                                  duckLisp_compileState_t *compileState,
+                                  dl_array_t *assembly,
+                                  duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_binaryArithmeticOperator(duckLisp,
+                                                   compileState,
+                                                   assembly,
+                                                   expression,
+                                                   duckLisp_emit_nth);
+}
 
-	return e;
+dl_error_t duckLisp_generator_nthcdr(duckLisp_t *duckLisp,
+                                     duckLisp_compileState_t *compileState,
+                                     dl_array_t *assembly,
+                                     duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_binaryArithmeticOperator(duckLisp,
+                                                   compileState,
+                                                   assembly,
+                                                   expression,
+                                                   duckLisp_emit_nthcdr);
 }
 
+dl_error_t duckLisp_generator_append(duckLisp_t *duckLisp,
+                                     duckLisp_compileState_t *compileState,
+                                     dl_array_t *assembly,
+                                     duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_binaryArithmeticOperator(duckLisp,
+                                                   compileState,
+                                                   assembly,
+                                                   expression,
+                                                   duckLisp_emit_append);
+}
 
-/* Generator for the `__declare` keyword that is recognized by the parenthesis inferrer. Expands to nil, no matter what
-   arguments are passed to it. */
-dl_error_t duckLisp_generator_declare(duckLisp_t *duckLisp,
+dl_error_t duckLisp_generator_reverse(duckLisp_t *duckLisp,
                                       duckLisp_compileState_t *compileState,
                                       dl_array_t *assembly,
                                       duckLisp_ast_expression_t *expression) {
-	(void) expression;
-	return duckLisp_emit_nil(duckLisp, compileState, assembly);
-}
-
-dl_error_t duckLisp_generator_makeString(duckLisp_t *duckLisp,
-                                         duckLisp_compileState_t *compileState,
-                                         dl_array_t *assembly,
-                                         duckLisp_ast_expression_t *expression) {
 	return duckLisp_generator_unaryArithmeticOperator(duckLisp,
-	                                                  compileState,
-	                                                  assembly,
-	                                                  expression,
-	                                                  duckLisp_emit_makeString);
+                                                  compileState,
+                                                  assembly,
+                                                  expression,
+                                                  duckLisp_emit_reverse);
 }
 
-dl_error_t duckLisp_generator_concatenate(duckLisp_t *duckLisp,
-                                          duckLisp_compileState_t *compileState,
-                                          dl_array_t *assembly,
-                                          duckLisp_ast_expression_t *expression) {
+dl_error_t duckLisp_generator_assoc(duckLisp_t *duckLisp,
+                                    duckLisp_compileState_t *compileState,
+                                    dl_array_t *assembly,
+                                    duckLisp_ast_expression_t *expression) {
 	return duckLisp_generator_binaryArithmeticOperator(duckLisp,
-	                                                   compileState,
-	                                                   assembly,
-	                                                   expression,
-	                                                   duckLisp_emit_concatenate);
-}
-
-dl_error_t duckLisp_generator_substring(duckLisp_t *duckLisp,
-                                        duckLisp_compileState_t *compileState,
-                                        dl_array_t *assembly,
-                                        duckLisp_ast_expression_t *expression) {
-	return duckLisp_generator_ternaryArithmeticOperator(duckLisp,
-	                                                    compileState,
-	                                                    assembly,
-	                                                    expression,
-	                                                    duckLisp_emit_substring);
+                                                   compileState,
+                                                   assembly,
+                                                   expression,
+                                                   duckLisp_emit_assoc);
 }
 
-dl_error_t duckLisp_generator_length(duckLisp_t *duckLisp,
+dl_error_t duckLisp_generator_member(duckLisp_t *duckLisp,
                                      duckLisp_compileState_t *compileState,
                                      dl_array_t *assembly,
                                      duckLisp_ast_expression_t *expression) {
-	return duckLisp_generator_unaryArithmeticOperator(duckLisp,
-	                                                  compileState,
-	                                                  assembly,
-	                                                  expression,
-	                                                  duckLisp_emit_length);
+	return duckLisp_generator_binaryArithmeticOperator(duckLisp,
+                                                   compileState,
+                                                   assembly,
+                                                   expression,
+                                                   duckLisp_emit_member);
 }
 
-dl_error_t duckLisp_generator_symbolString(duckLisp_t *duckLisp,
-                                           duckLisp_compileState_t *compileState,
-                                           dl_array_t *assembly,
-                                           duckLisp_ast_expression_t *expression) {
-	return duckLisp_generator_unaryArithmeticOperator(duckLisp,
-	                                                  compileState,
-	                                                  assembly,
-	                                                  expression,
-	                                                  duckLisp_emit_symbolString);
+/* `map` and `filter` are compiled to a loop instead of a single instruction so that the function is called by the
+   interpreter loop like any other call. It can then yield, wait in `receive`, and be preempted when the VM runs with a
+   budget, none of which is possible from inside a C call.
+
+   (length list)  ; Rejects circular lists.
+   (goto start)
+   (label loop)
+   (setq result (cons (funcall function (car list)) result))
+   (setq list (cdr list))
+   (label start)
+   (brnz list loop)
+   (reverse result)
+
+   `filter` conses the element instead of the result, and only if the result is true. */
+dl_error_t duckLisp_generator_mapList(duckLisp_t *duckLisp,
+                                      duckLisp_compileState_t *compileState,
+                                      dl_array_t *assembly,
+                                      duckLisp_ast_expression_t *expression,
+                                      const dl_bool_t filter) {
+	dl_error_t e = dl_error_ok;
+	dl_error_t eError = dl_error_ok;
+
+	dl_ptrdiff_t startStack_length = duckLisp_localsLength_get(compileState);
+	dl_ptrdiff_t index;
+	dl_ptrdiff_t function_index;
+	dl_ptrdiff_t list_index;
+	dl_ptrdiff_t result_index;
+	dl_ptrdiff_t element_index;
+
+	duckLisp_ast_identifier_t gensym_start = {0};
+	duckLisp_ast_identifier_t gensym_loop = {0};
+	duckLisp_ast_identifier_t gensym_keep = {0};
+	duckLisp_ast_identifier_t gensym_skip = {0};
+
+	e = duckLisp_checkArgsAndReportError(duckLisp, *expression, 3, dl_false);
+	if (e) goto cleanup;
+
+	/* Both arguments get their own slots since the list slot is overwritten as the list is walked. */
+	e = duckLisp_compile_compoundExpression(duckLisp,
+	                                        compileState,
+	                                        assembly,
+	                                        expression->compoundExpressions[0].value.identifier.value,
+	                                        expression->compoundExpressions[0].value.identifier.value_length,
+	                                        &expression->compoundExpressions[1],
+	                                        &index,
+	                                        dl_null,
+	                                        dl_false);
+	if (e) goto cleanup;
+	e = duckLisp_emit_pushIndex(duckLisp, compileState, assembly, index);
+	if (e) goto cleanup;
+	function_index = duckLisp_localsLength_get(compileState) - 1;
+
+	e = duckLisp_compile_compoundExpression(duckLisp,
+	                                        compileState,
+	                                        assembly,
+	                                        expression->compoundExpressions[0].value.identifier.value,
+	                                        expression->compoundExpressions[0].value.identifier.value_length,
+	                                        &expression->compoundExpressions[2],
+	                                        &index,
+	                                        dl_null,
+	                                        dl_false);
+	if (e) goto cleanup;
+	e = duckLisp_emit_pushIndex(duckLisp, compileState, assembly, index);
+	if (e) goto cleanup;
+	list_index = duckLisp_localsLength_get(compileState) - 1;
+
+	e = duckLisp_emit_length(duckLisp, compileState, assembly, list_index);
+	if (e) goto cleanup;
+	e = duckLisp_emit_pop(duckLisp, compileState, assembly, 1);
+	if (e) goto cleanup;
+
+	e = duckLisp_emit_nil(duckLisp, compileState, assembly);
+	if (e) goto cleanup;
+	result_index = duckLisp_localsLength_get(compileState) - 1;
+
+	e = duckLisp_gensym(duckLisp, &gensym_start);
+	if (e) goto cleanup;
+	e = duckLisp_gensym(duckLisp, &gensym_loop);
+	if (e) goto cleanup;
+	e = duckLisp_register_label(duckLisp,
+	                            compileState->currentCompileState,
+	                            gensym_start.value,
+	                            gensym_start.value_length);
+	if (e) goto cleanup;
+	e = duckLisp_register_label(duckLisp,
+	                            compileState->currentCompileState,
+	                            gensym_loop.value,
+	                            gensym_loop.value_length);
+	if (e) goto cleanup;
+	if (filter) {
+		e = duckLisp_gensym(duckLisp, &gensym_keep);
+		if (e) goto cleanup;
+		e = duckLisp_gensym(duckLisp, &gensym_skip);
+		if (e) goto cleanup;
+		e = duckLisp_register_label(duckLisp,
+		                            compileState->currentCompileState,
+		                            gensym_keep.value,
+		                            gensym_keep.value_length);
+		if (e) goto cleanup;
+		e = duckLisp_register_label(duckLisp,
+		                            compileState->currentCompileState,
+		                            gensym_skip.value,
+		                            gensym_skip.value_length);
+		if (e) goto cleanup;
+	}
+
+	e = duckLisp_emit_jump(duckLisp, compileState, assembly, gensym_start.value, gensym_start.value_length);
+	if (e) goto cleanup;
+	e = duckLisp_emit_label(duckLisp, compileState, assembly, gensym_loop.value, gensym_loop.value_length);
+	if (e) goto cleanup;
+
+	e = duckLisp_emit_car(duckLisp, compileState, assembly, list_index);
+	if (e) goto cleanup;
+	element_index = duckLisp_localsLength_get(compileState) - 1;
+	if (filter) {
+		/* Keep the element for the cons. */
+		e = duckLisp_emit_pushIndex(duckLisp, compileState, assembly, element_index);
+		if (e) goto cleanup;
+	}
+	e = duckLisp_emit_funcall(duckLisp, compileState, assembly, function_index, 1);
+	if (e) goto cleanup;
+	/* The argument is replaced by the return value. */
+	compileState->currentCompileState->locals_length = element_index + (filter ? 2 : 1);
+
+	if (filter) {
+		e = duckLisp_emit_brnz(duckLisp, compileState, assembly, gensym_keep.value, gensym_keep.value_length, 1);
+		if (e) goto cleanup;
+		e = duckLisp_emit_jump(duckLisp, compileState, assembly, gensym_skip.value, gensym_skip.value_length);
+		if (e) goto cleanup;
+		e = duckLisp_emit_label(duckLisp, compileState, assembly, gensym_keep.value, gensym_keep.value_length);
+		if (e) goto cleanup;
+	}
+	e = duckLisp_emit_cons(duckLisp,
+	                       compileState,
+	                       assembly,
+	                       duckLisp_localsLength_get(compileState) - 1,
+	                       result_index);
+	if (e) goto cleanup;
+	e = duckLisp_emit_move(duckLisp,
+	                       compileState,
+	                       assembly,
+	                       result_index,
+	                       duckLisp_localsLength_get(compileState) - 1);
+	if (e) goto cleanup;
+	e = duckLisp_emit_pop(duckLisp, compileState, assembly, filter ? 1 : 2);
+	if (e) goto cleanup;
+	if (filter) {
+		e = duckLisp_emit_label(duckLisp, compileState, assembly, gensym_skip.value, gensym_skip.value_length);
+		if (e) goto cleanup;
+		e = duckLisp_emit_pop(duckLisp, compileState, assembly, 1);
+		if (e) goto cleanup;
+	}
+
+	e = duckLisp_emit_cdr(duckLisp, compileState, assembly, list_index);
+	if (e) goto cleanup;
+	e = duckLisp_emit_move(duckLisp,
+	                       compileState,
+	                       assembly,
+	                       list_index,
+	                       duckLisp_localsLength_get(compileState) - 1);
+	if (e) goto cleanup;
+	e = duckLisp_emit_pop(duckLisp, compileState, assembly, 1);
+	if (e) goto cleanup;
+
+	e = duckLisp_emit_label(duckLisp, compileState, assembly, gensym_start.value, gensym_start.value_length);
+	if (e) goto cleanup;
+	e = duckLisp_emit_pushIndex(duckLisp, compileState, assembly, list_index);
+	if (e) goto cleanup;
+	e = duckLisp_emit_brnz(duckLisp, compileState, assembly, gensym_loop.value, gensym_loop.value_length, 1);
+	if (e) goto cleanup;
+
+	e = duckLisp_emit_reverse(duckLisp, compileState, assembly, result_index);
+	if (e) goto cleanup;
+	e = duckLisp_emit_move(duckLisp,
+	                       compileState,
+	                       assembly,
+	                       startStack_length,
+	                       duckLisp_localsLength_get(compileState) - 1);
+	if (e) goto cleanup;
+	e = duckLisp_emit_pop(duckLisp,
+	                      compileState,
+	                      assembly,
+	                      duckLisp_localsLength_get(compileState) - startStack_length - 1);
+	if (e) goto cleanup;
+
+ cleanup:
+	if (gensym_skip.value != dl_null) {
+		eError = dl_free(duckLisp->memoryAllocation, (void **) &gensym_skip.value);
+		if (eError) e = eError;
+	}
+	if (gensym_keep.value != dl_null) {
+		eError = dl_free(duckLisp->memoryAllocation, (void **) &gensym_keep.value);
+		if (eError) e = eError;
+	}
+	if (gensym_loop.value != dl_null) {
+		eError = dl_free(duckLisp->memoryAllocation, (void **) &gensym_loop.value);
+		if (eError) e = eError;
+	}
+	if (gensym_start.value != dl_null) {
+		eError = dl_free(duckLisp->memoryAllocation, (void **) &gensym_start.value);
+		if (eError) e = eError;
+	}
+
+	return e;
 }
 
-dl_error_t duckLisp_generator_symbolId(duckLisp_t *duckLisp,
-                                       duckLisp_compileState_t *compileState,
-                                       dl_array_t *assembly,
-                                       duckLisp_ast_expression_t *expression) {
-	return duckLisp_generator_unaryArithmeticOperator(duckLisp,
-	                                                  compileState,
-	                                                  assembly,
-	                                                  expression,
-	                                                  duckLisp_emit_symbolId);
+dl_error_t duckLisp_generator_map(duckLisp_t *duckLisp,
+                                  duckLisp_compileState_t *compileState,
+                                  dl_array_t *assembly,
+                                  duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_mapList(duckLisp, compileState, assembly, expression, dl_false);
+}
+
+dl_error_t duckLisp_generator_filter(duckLisp_t *duckLisp,
+                                     duckLisp_compileState_t *compileState,
+                                     dl_array_t *assembly,
+                                     duckLisp_ast_expression_t *expression) {
+	return duckLisp_generator_mapList(duckLisp, compileState, assembly, expression, dl_true);
 }
 
 dl_error_t duckLisp_generator_typeof(duckLisp_t *duckLisp,
@@ -753,6 +1570,9 @@ dl_error_t duckLisp_generator_quote(duckLisp_t *duckLisp,
 	dl_uint8_t *functionName = expression->compoundExpressions[0].value.identifier.value;
 	dl_size_t functionName_length = expression->compoundExpressions[0].value.identifier.value_length;
 	duckLisp_ast_identifier_t tempIdentifier;
+	duckLisp_ast_identifier_t gensym_end;
+	gensym_end.value = dl_null;
+	gensym_end.value_length = 0;
 
 	/*
 	  Recursively convert to a tree made of lists.
@@ -820,7 +1640,27 @@ dl_error_t duckLisp_generator_quote(duckLisp_t *duckLisp,
 		break;
 	case duckLisp_ast_type_expression:
 		if (tree->value.expression.compoundExpressions_length > 0) {
+			/* The list is built and frozen the first time this runs. Later runs push the frozen list and jump over
+			   the code that builds it. */
 			dl_ptrdiff_t last_temp_index;
+			dl_ptrdiff_t startStack_length;
+			dl_ptrdiff_t pops;
+			dl_ptrdiff_t slot = compileState->currentCompileState->quoted_number++;
+
+			e = duckLisp_gensym(duckLisp, &gensym_end);
+			if (e) goto cleanup;
+			e = duckLisp_register_label(duckLisp,
+			                            compileState->currentCompileState,
+			                            gensym_end.value,
+			                            gensym_end.value_length);
+			if (e) goto cleanup;
+
+			startStack_length = duckLisp_localsLength_get(compileState);
+			e = duckLisp_emit_pushQuoted(duckLisp, compileState, assembly, slot);
+			if (e) goto cleanup;
+			e = duckLisp_emit_brnz(duckLisp, compileState, assembly, gensym_end.value, gensym_end.value_length, 0);
+			if (e) goto cleanup;
+
 			e = duckLisp_emit_nil(duckLisp, compileState, assembly);
 			if (e) goto cleanup;
 			last_temp_index = duckLisp_localsLength_get(compileState) - 1;
@@ -839,6 +1679,23 @@ dl_error_t duckLisp_generator_quote(duckLisp_t *duckLisp,
 				if (e) goto cleanup;
 				last_temp_index = duckLisp_localsLength_get(compileState) - 1;
 			}
+
+			/* Replace the nil from `pushQuoted` with the list so that both paths leave one object. */
+			e = duckLisp_emit_move(duckLisp,
+			                       compileState,
+			                       assembly,
+			                       startStack_length,
+			                       duckLisp_localsLength_get(compileState) - 1);
+			if (e) goto cleanup;
+			pops = duckLisp_localsLength_get(compileState) - startStack_length - 1;
+			if (pops > 0) {
+				e = duckLisp_emit_pop(duckLisp, compileState, assembly, pops);
+				if (e) goto cleanup;
+			}
+			e = duckLisp_emit_setQuoted(duckLisp, compileState, assembly, startStack_length, slot);
+			if (e) goto cleanup;
+			e = duckLisp_emit_label(duckLisp, compileState, assembly, gensym_end.value, gensym_end.value_length);
+			if (e) goto cleanup;
 		}
 		else {
 			e = duckLisp_emit_nil(duckLisp, compileState, assembly);
@@ -857,6 +1714,11 @@ dl_error_t duckLisp_generator_quote(duckLisp_t *duckLisp,
 
  cleanup:
 
+	if (gensym_end.value != dl_null) {
+		eError = dl_free(duckLisp->memoryAllocation, (void **) &gensym_end.value);
+		if (eError) e = eError;
+	}
+
 	eError = dl_array_quit(&tempString);
 	if (eError) e = eError;
 
@@ -2019,77 +2881,91 @@ dl_error_t duckLisp_generator_multiply(duckLisp_t *duckLisp,
                                        duckLisp_compileState_t *compileState,
                                        dl_array_t *assembly,
                                        duckLisp_ast_expression_t *expression) {
-	return duckLisp_generator_binaryArithmeticOperator(duckLisp,
-	                                                   compileState,
-	                                                   assembly,
-	                                                   expression,
-	                                                   duckLisp_emit_multiply);
+	return duckLisp_generator_numericBinaryOperator(duckLisp,
+	                                               compileState,
+	                                               assembly,
+	                                               expression,
+	                                               duckLisp_instructionClass_mul,
+	                                               duckLisp_instructionClass_mulInteger,
+	                                               duckLisp_instructionClass_mulFloat);
 }
 
 dl_error_t duckLisp_generator_divide(duckLisp_t *duckLisp,
                                      duckLisp_compileState_t *compileState,
                                      dl_array_t *assembly,
                                      duckLisp_ast_expression_t *expression) {
-	return duckLisp_generator_binaryArithmeticOperator(duckLisp,
-	                                                   compileState,
-	                                                   assembly,
-	                                                   expression,
-	                                                   duckLisp_emit_divide);
+	return duckLisp_generator_numericBinaryOperator(duckLisp,
+	                                               compileState,
+	                                               assembly,
+	                                               expression,
+	                                               duckLisp_instructionClass_div,
+	                                               duckLisp_instructionClass_divInteger,
+	                                               duckLisp_instructionClass_divFloat);
 }
 
 dl_error_t duckLisp_generator_add(duckLisp_t *duckLisp,
                                   duckLisp_compileState_t *compileState,
                                   dl_array_t *assembly,
                                   duckLisp_ast_expression_t *expression) {
-	return duckLisp_generator_binaryArithmeticOperator(duckLisp,
-	                                                   compileState,
-	                                                   assembly,
-	                                                   expression,
-	                                                   duckLisp_emit_add);
+	return duckLisp_generator_numericBinaryOperator(duckLisp,
+	                                               compileState,
+	                                               assembly,
+	                                               expression,
+	                                               duckLisp_instructionClass_add,
+	                                               duckLisp_instructionClass_addInteger,
+	                                               duckLisp_instructionClass_addFloat);
 }
 
 dl_error_t duckLisp_generator_sub(duckLisp_t *duckLisp,
                                   duckLisp_compileState_t *compileState,
                                   dl_array_t *assembly,
                                   duckLisp_ast_expression_t *expression) {
-	return duckLisp_generator_binaryArithmeticOperator(duckLisp,
-	                                                   compileState,
-	                                                   assembly,
-	                                                   expression,
-	                                                   duckLisp_emit_sub);
+	return duckLisp_generator_numericBinaryOperator(duckLisp,
+	                                               compileState,
+	                                               assembly,
+	                                               expression,
+	                                               duckLisp_instructionClass_sub,
+	                                               duckLisp_instructionClass_subInteger,
+	                                               duckLisp_instructionClass_subFloat);
 }
 
 dl_error_t duckLisp_generator_equal(duckLisp_t *duckLisp,
                                     duckLisp_compileState_t *compileState,
                                     dl_array_t *assembly,
                                     duckLisp_ast_expression_t *expression) {
-	return duckLisp_generator_binaryArithmeticOperator(duckLisp,
-	                                                   compileState,
-	                                                   assembly,
-	                                                   expression,
-	                                                   duckLisp_emit_equal);
+	return duckLisp_generator_numericBinaryOperator(duckLisp,
+	                                               compileState,
+	                                               assembly,
+	                                               expression,
+	                                               duckLisp_instructionClass_equal,
+	                                               duckLisp_instructionClass_equalInteger,
+	                                               duckLisp_instructionClass_equalFloat);
 }
 
 dl_error_t duckLisp_generator_greater(duckLisp_t *duckLisp,
                                       duckLisp_compileState_t *compileState,
                                       dl_array_t *assembly,
                                       duckLisp_ast_expression_t *expression) {
-	return duckLisp_generator_binaryArithmeticOperator(duckLisp,
-	                                                   compileState,
-	                                                   assembly,
-	                                                   expression,
-	                                                   duckLisp_emit_greater);
+	return duckLisp_generator_numericBinaryOperator(duckLisp,
+	                                               compileState,
+	                                               assembly,
+	                                               expression,
+	                                               duckLisp_instructionClass_greater,
+	                                               duckLisp_instructionClass_greaterInteger,
+	                                               duckLisp_instructionClass_greaterFloat);
 }
 
 dl_error_t duckLisp_generator_less(duckLisp_t *duckLisp,
                                    duckLisp_compileState_t *compileState,
                                    dl_array_t *assembly,
                                    duckLisp_ast_expression_t *expression) {
-	return duckLisp_generator_binaryArithmeticOperator(duckLisp,
-	                                                   compileState,
-	                                                   assembly,
-	                                                   expression,
-	                                                   duckLisp_emit_less);
+	return duckLisp_generator_numericBinaryOperator(duckLisp,
+	                                               compileState,
+	                                               assembly,
+	                                               expression,
+	                                               duckLisp_instructionClass_less,
+	                                               duckLisp_instructionClass_lessInteger,
+	                                               duckLisp_instructionClass_lessFloat);
 }
 
 dl_error_t duckLisp_generator_while(duckLisp_t *duckLisp,
@@ -3526,7 +4402,12 @@ dl_error_t duckLisp_generator_callback(duckLisp_t *duckLisp,
 	}
 
 	/* Create the string variable. */
-	e = duckLisp_emit_ccall(duckLisp, compileState, assembly, callback_key);
+	/* -1 for the callback name. */
+	e = duckLisp_emit_ccall(duckLisp,
+	                        compileState,
+	                        assembly,
+	                        callback_key,
+	                        expression->compoundExpressions_length - 1);
 	if (e) goto cleanup;
 
 	compileState->currentCompileState->locals_length = outerStartStack_length + 1;
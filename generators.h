@@ -54,6 +54,14 @@ dl_error_t duckLisp_generator_binaryArithmeticOperator(duckLisp_t *duckLisp,
                                                                              dl_ptrdiff_t,
                                                                              dl_ptrdiff_t));
 
+dl_error_t duckLisp_generator_numericBinaryOperator(duckLisp_t *duckLisp,
+                                                   duckLisp_compileState_t *compileState,
+                                                   dl_array_t *assembly,
+                                                   duckLisp_ast_expression_t *expression,
+                                                   duckLisp_instructionClass_t genericClass,
+                                                   duckLisp_instructionClass_t integerClass,
+                                                   duckLisp_instructionClass_t floatClass);
+
 dl_error_t duckLisp_generator_ternaryArithmeticOperator(duckLisp_t *duckLisp,
                                                         duckLisp_compileState_t *compileState,
                                                         dl_array_t *assembly,
@@ -100,6 +108,232 @@ dl_error_t duckLisp_generator_symbolId(duckLisp_t *duckLisp,
                                        dl_array_t *assembly,
                                        duckLisp_ast_expression_t *expression);
 
+dl_error_t duckLisp_generator_makeCoroutine(duckLisp_t *duckLisp,
+                                            duckLisp_compileState_t *compileState,
+                                            dl_array_t *assembly,
+                                            duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_resume(duckLisp_t *duckLisp,
+                                     duckLisp_compileState_t *compileState,
+                                     dl_array_t *assembly,
+                                     duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_yield(duckLisp_t *duckLisp,
+                                    duckLisp_compileState_t *compileState,
+                                    dl_array_t *assembly,
+                                    duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_coroutineDonep(duckLisp_t *duckLisp,
+                                             duckLisp_compileState_t *compileState,
+                                             dl_array_t *assembly,
+                                             duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_send(duckLisp_t *duckLisp,
+                                   duckLisp_compileState_t *compileState,
+                                   dl_array_t *assembly,
+                                   duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_receive(duckLisp_t *duckLisp,
+                                      duckLisp_compileState_t *compileState,
+                                      dl_array_t *assembly,
+                                      duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_tryReceive(duckLisp_t *duckLisp,
+                                         duckLisp_compileState_t *compileState,
+                                         dl_array_t *assembly,
+                                         duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_freeze(duckLisp_t *duckLisp,
+                                     duckLisp_compileState_t *compileState,
+                                     dl_array_t *assembly,
+                                     duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_parallelMap(duckLisp_t *duckLisp,
+                                          duckLisp_compileState_t *compileState,
+                                          dl_array_t *assembly,
+                                          duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_makeHashTable(duckLisp_t *duckLisp,
+                                            duckLisp_compileState_t *compileState,
+                                            dl_array_t *assembly,
+                                            duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_hashTableGet(duckLisp_t *duckLisp,
+                                           duckLisp_compileState_t *compileState,
+                                           dl_array_t *assembly,
+                                           duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_hashTableSet(duckLisp_t *duckLisp,
+                                           duckLisp_compileState_t *compileState,
+                                           dl_array_t *assembly,
+                                           duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_hashTableDelete(duckLisp_t *duckLisp,
+                                              duckLisp_compileState_t *compileState,
+                                              dl_array_t *assembly,
+                                              duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_hashTableNext(duckLisp_t *duckLisp,
+                                            duckLisp_compileState_t *compileState,
+                                            dl_array_t *assembly,
+                                            duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_vectorPush(duckLisp_t *duckLisp,
+                                         duckLisp_compileState_t *compileState,
+                                         dl_array_t *assembly,
+                                         duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_vectorPop(duckLisp_t *duckLisp,
+                                        duckLisp_compileState_t *compileState,
+                                        dl_array_t *assembly,
+                                        duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_vectorTruncate(duckLisp_t *duckLisp,
+                                             duckLisp_compileState_t *compileState,
+                                             dl_array_t *assembly,
+                                             duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_makeStringBuilder(duckLisp_t *duckLisp,
+                                                duckLisp_compileState_t *compileState,
+                                                dl_array_t *assembly,
+                                                duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_stringBuilderAppend(duckLisp_t *duckLisp,
+                                                  duckLisp_compileState_t *compileState,
+                                                  dl_array_t *assembly,
+                                                  duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_stringSearch(duckLisp_t *duckLisp,
+                                           duckLisp_compileState_t *compileState,
+                                           dl_array_t *assembly,
+                                           duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_stringCompare(duckLisp_t *duckLisp,
+                                            duckLisp_compileState_t *compileState,
+                                            dl_array_t *assembly,
+                                            duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_utf8Validp(duckLisp_t *duckLisp,
+                                         duckLisp_compileState_t *compileState,
+                                         dl_array_t *assembly,
+                                         duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_utf8Length(duckLisp_t *duckLisp,
+                                         duckLisp_compileState_t *compileState,
+                                         dl_array_t *assembly,
+                                         duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_stringUpcase(duckLisp_t *duckLisp,
+                                           duckLisp_compileState_t *compileState,
+                                           dl_array_t *assembly,
+                                           duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_stringDowncase(duckLisp_t *duckLisp,
+                                             duckLisp_compileState_t *compileState,
+                                             dl_array_t *assembly,
+                                             duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_makeTypedArray(duckLisp_t *duckLisp,
+                                             duckLisp_compileState_t *compileState,
+                                             dl_array_t *assembly,
+                                             duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_typedArraySum(duckLisp_t *duckLisp,
+                                            duckLisp_compileState_t *compileState,
+                                            dl_array_t *assembly,
+                                            duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_typedArrayDot(duckLisp_t *duckLisp,
+                                            duckLisp_compileState_t *compileState,
+                                            dl_array_t *assembly,
+                                            duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_typedArrayScale(duckLisp_t *duckLisp,
+                                              duckLisp_compileState_t *compileState,
+                                              dl_array_t *assembly,
+                                              duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_typedArrayAdd(duckLisp_t *duckLisp,
+                                            duckLisp_compileState_t *compileState,
+                                            dl_array_t *assembly,
+                                            duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_typedArrayMul(duckLisp_t *duckLisp,
+                                            duckLisp_compileState_t *compileState,
+                                            dl_array_t *assembly,
+                                            duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_typedArrayMin(duckLisp_t *duckLisp,
+                                            duckLisp_compileState_t *compileState,
+                                            dl_array_t *assembly,
+                                            duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_typedArrayMax(duckLisp_t *duckLisp,
+                                            duckLisp_compileState_t *compileState,
+                                            dl_array_t *assembly,
+                                            duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_makeRecord(duckLisp_t *duckLisp,
+                                         duckLisp_compileState_t *compileState,
+                                         dl_array_t *assembly,
+                                         duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_recordSlot(duckLisp_t *duckLisp,
+                                         duckLisp_compileState_t *compileState,
+                                         dl_array_t *assembly,
+                                         duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_setRecordSlot(duckLisp_t *duckLisp,
+                                            duckLisp_compileState_t *compileState,
+                                            dl_array_t *assembly,
+                                            duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_nth(duckLisp_t *duckLisp,
+                                  duckLisp_compileState_t *compileState,
+                                  dl_array_t *assembly,
+                                  duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_nthcdr(duckLisp_t *duckLisp,
+                                     duckLisp_compileState_t *compileState,
+                                     dl_array_t *assembly,
+                                     duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_append(duckLisp_t *duckLisp,
+                                     duckLisp_compileState_t *compileState,
+                                     dl_array_t *assembly,
+                                     duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_reverse(duckLisp_t *duckLisp,
+                                      duckLisp_compileState_t *compileState,
+                                      dl_array_t *assembly,
+                                      duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_assoc(duckLisp_t *duckLisp,
+                                    duckLisp_compileState_t *compileState,
+                                    dl_array_t *assembly,
+                                    duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_member(duckLisp_t *duckLisp,
+                                     duckLisp_compileState_t *compileState,
+                                     dl_array_t *assembly,
+                                     duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_mapList(duckLisp_t *duckLisp,
+                                      duckLisp_compileState_t *compileState,
+                                      dl_array_t *assembly,
+                                      duckLisp_ast_expression_t *expression,
+                                      const dl_bool_t filter);
+
+dl_error_t duckLisp_generator_map(duckLisp_t *duckLisp,
+                                  duckLisp_compileState_t *compileState,
+                                  dl_array_t *assembly,
+                                  duckLisp_ast_expression_t *expression);
+
+dl_error_t duckLisp_generator_filter(duckLisp_t *duckLisp,
+                                     duckLisp_compileState_t *compileState,
+                                     dl_array_t *assembly,
+                                     duckLisp_ast_expression_t *expression);
+
 dl_error_t duckLisp_generator_typeof(duckLisp_t *duckLisp,
                                      duckLisp_compileState_t *compileState,
                                      dl_array_t *assembly,
@@ -0,0 +1,1045 @@
+/*
+MIT License
+
+Copyright (c) 2023 Joseph Herguth
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <stddef.h>
+#include <sys/mman.h>
+#include "jit.h"
+#include "duckLisp.h"
+
+/* Stack operands and pop counts are turned into 32-bit displacements, so larger ones are left to the interpreter. */
+#define DUCKJIT_MAX_OPERAND 0x100000
+
+/* Stack slots are copied 8 bytes at a time. */
+typedef char duckJit_objectSizeCheck[(sizeof(duckVM_object_t) % 8 == 0) ? 1 : -1];
+
+/* Passed to native code, which loads it into registers on entry and writes it back before it returns. The stack and
+   upvalue stack are pushed and popped together, so native code only tracks their tops. */
+typedef struct {
+	duckVM_object_t *base;
+	duckVM_object_t *top;
+	duckVM_object_t **upvalueTop;
+	/* Pushing at this address would overflow the stack or the upvalue stack. */
+	duckVM_object_t *limit;
+	/* Popping below this address would underflow the stack or the upvalue stack. */
+	duckVM_object_t *floor;
+	dl_size_t budget;
+	void *entry;
+	/* Set to the instruction the interpreter continues at. */
+	dl_uint8_t *ip;
+} duckJit_frame_t;
+
+typedef struct {
+	duckVM_native_t native;
+	/* Start of the bytecode the code was compiled from. */
+	dl_uint8_t *bytecode;
+	/* Offset into `code` of each entry in `native.entries`. */
+	dl_size_t *entryCode;
+	dl_uint8_t *code;
+	dl_size_t code_size;
+} duckJit_region_t;
+
+
+/* Assembler */
+
+/* Registers, numbered as in the encoding. */
+typedef enum {
+	duckJit_register_rax = 0,
+	duckJit_register_rcx = 1,
+	duckJit_register_rdx = 2,
+	duckJit_register_rbx = 3,
+	duckJit_register_rdi = 7,
+	duckJit_register_r12 = 12,
+	duckJit_register_r13 = 13,
+	duckJit_register_r14 = 14,
+	duckJit_register_r15 = 15,
+} duckJit_register_t;
+
+/* Register assignment while native code runs. All of them are callee-saved. */
+#define DUCKJIT_FRAME duckJit_register_rbx
+#define DUCKJIT_BASE duckJit_register_r12
+#define DUCKJIT_BUDGET duckJit_register_r13
+#define DUCKJIT_TOP duckJit_register_r14
+#define DUCKJIT_UPVALUE_TOP duckJit_register_r15
+
+typedef enum {
+	duckJit_condition_below = 0x2,
+	duckJit_condition_aboveOrEqual = 0x3,
+	duckJit_condition_equal = 0x4,
+	duckJit_condition_notEqual = 0x5,
+	duckJit_condition_less = 0xC,
+	duckJit_condition_greater = 0xF,
+} duckJit_condition_t;
+
+typedef struct {
+	dl_array_t code;  /* dl_uint8_t */
+	/* The first error. Nothing is emitted once it's set, so the templates don't have to check after each instruction. */
+	dl_error_t e;
+} duckJit_assembler_t;
+
+static void duckJit_emitByte(duckJit_assembler_t *assembler, dl_uint8_t byte) {
+	if (assembler->e) return;
+	assembler->e = dl_array_pushElement(&assembler->code, &byte);
+}
+
+static void duckJit_emit32(duckJit_assembler_t *assembler, const dl_uint32_t value) {
+	DL_DOTIMES(i, 4) {
+		/**/ duckJit_emitByte(assembler, (value >> (8 * i)) & 0xFF);
+	}
+}
+
+static void duckJit_emit64(duckJit_assembler_t *assembler, const dl_uint64_t value) {
+	DL_DOTIMES(i, 8) {
+		/**/ duckJit_emitByte(assembler, (value >> (8 * i)) & 0xFF);
+	}
+}
+
+/* Emit the REX prefix if the instruction needs one. */
+static void duckJit_emitRex(duckJit_assembler_t *assembler, const dl_bool_t wide, const int reg, const int rm) {
+	const dl_uint8_t rex = 0x40 | (wide ? 0x8 : 0) | ((reg & 8) ? 0x4 : 0) | ((rm & 8) ? 0x1 : 0);
+	if (rex != 0x40) duckJit_emitByte(assembler, rex);
+}
+
+/* Emit an instruction whose operands are `reg` and `[base + displacement]`. `prefix` is a mandatory prefix, or 0.
+   `opcode2` is the second opcode byte, or 0. */
+static void duckJit_emitMemory(duckJit_assembler_t *assembler,
+                               const dl_uint8_t prefix,
+                               const dl_bool_t wide,
+                               const dl_uint8_t opcode,
+                               const dl_uint8_t opcode2,
+                               const int reg,
+                               const duckJit_register_t base,
+                               const dl_ptrdiff_t displacement) {
+	if (prefix) duckJit_emitByte(assembler, prefix);
+	/**/ duckJit_emitRex(assembler, wide, reg, base);
+	/**/ duckJit_emitByte(assembler, opcode);
+	if (opcode2) duckJit_emitByte(assembler, opcode2);
+	/* Always use a 32-bit displacement. */
+	/**/ duckJit_emitByte(assembler, 0x80 | ((reg & 7) << 3) | (base & 7));
+	/* r12 can only be a base with a SIB byte. */
+	if ((base & 7) == 4) duckJit_emitByte(assembler, 0x24);
+	/**/ duckJit_emit32(assembler, (dl_uint32_t) displacement);
+}
+
+/* Emit an instruction whose operands are both registers. */
+static void duckJit_emitRegister(duckJit_assembler_t *assembler,
+                                 const dl_bool_t wide,
+                                 const dl_uint8_t opcode,
+                                 const int reg,
+                                 const duckJit_register_t rm) {
+	/**/ duckJit_emitRex(assembler, wide, reg, rm);
+	/**/ duckJit_emitByte(assembler, opcode);
+	/**/ duckJit_emitByte(assembler, 0xC0 | ((reg & 7) << 3) | (rm & 7));
+}
+
+static void duckJit_emitPush(duckJit_assembler_t *assembler, const duckJit_register_t reg) {
+	/**/ duckJit_emitRex(assembler, dl_false, 0, reg);
+	/**/ duckJit_emitByte(assembler, 0x50 + (reg & 7));
+}
+
+static void duckJit_emitPop(duckJit_assembler_t *assembler, const duckJit_register_t reg) {
+	/**/ duckJit_emitRex(assembler, dl_false, 0, reg);
+	/**/ duckJit_emitByte(assembler, 0x58 + (reg & 7));
+}
+
+/* mov reg, imm64 */
+static void duckJit_emitLoadImmediate(duckJit_assembler_t *assembler,
+                                      const duckJit_register_t reg,
+                                      const dl_uint64_t value) {
+	/**/ duckJit_emitRex(assembler, dl_true, 0, reg);
+	/**/ duckJit_emitByte(assembler, 0xB8 + (reg & 7));
+	/**/ duckJit_emit64(assembler, value);
+}
+
+/* Emit a jump with a 32-bit displacement that is filled in later by `duckJit_patch`. Returns the position of the
+   displacement. */
+static dl_size_t duckJit_emitJump(duckJit_assembler_t *assembler) {
+	/**/ duckJit_emitByte(assembler, 0xE9);
+	/**/ duckJit_emit32(assembler, 0);
+	return assembler->code.elements_length - 4;
+}
+
+static dl_size_t duckJit_emitBranch(duckJit_assembler_t *assembler, const duckJit_condition_t condition) {
+	/**/ duckJit_emitByte(assembler, 0x0F);
+	/**/ duckJit_emitByte(assembler, 0x80 | condition);
+	/**/ duckJit_emit32(assembler, 0);
+	return assembler->code.elements_length - 4;
+}
+
+static void duckJit_patch(duckJit_assembler_t *assembler, const dl_size_t position, const dl_size_t target) {
+	const dl_uint32_t displacement = (dl_uint32_t) (target - (position + 4));
+	if (assembler->e) return;
+	DL_DOTIMES(i, 4) {
+		DL_ARRAY_GETADDRESS(assembler->code, dl_uint8_t, position + i) = (displacement >> (8 * i)) & 0xFF;
+	}
+}
+
+static dl_size_t duckJit_here(const duckJit_assembler_t *assembler) {
+	return assembler->code.elements_length;
+}
+
+
+/* Templates */
+
+/* Address of the operand `index` slots down from the top of the stack, relative to the top. */
+static dl_ptrdiff_t duckJit_slot(const dl_size_t index) {
+	return -(dl_ptrdiff_t) (index * sizeof(duckVM_object_t));
+}
+
+/* Branch to `stub` unless the stack holds at least `count` objects. */
+static void duckJit_emitCheckDepth(duckJit_assembler_t *assembler, const dl_size_t count, dl_array_t *stubs) {
+	dl_size_t position;
+	/* mov rax, top; sub rax, base; cmp rax, count * size; jb stub */
+	/**/ duckJit_emitRegister(assembler, dl_true, 0x89, DUCKJIT_TOP, duckJit_register_rax);
+	/**/ duckJit_emitRegister(assembler, dl_true, 0x29, DUCKJIT_BASE, duckJit_register_rax);
+	/**/ duckJit_emitRegister(assembler, dl_true, 0x81, 7, duckJit_register_rax);
+	/**/ duckJit_emit32(assembler, (dl_uint32_t) (count * sizeof(duckVM_object_t)));
+	position = duckJit_emitBranch(assembler, duckJit_condition_below);
+	if (!assembler->e) assembler->e = dl_array_pushElement(stubs, &position);
+}
+
+/* Branch to `stub` unless `count` objects can be popped. */
+static void duckJit_emitCheckPop(duckJit_assembler_t *assembler, const dl_size_t count, dl_array_t *stubs) {
+	dl_size_t position;
+	/* mov rax, top; sub rax, [frame.floor]; cmp rax, count * size; jb stub */
+	/**/ duckJit_emitRegister(assembler, dl_true, 0x89, DUCKJIT_TOP, duckJit_register_rax);
+	/**/ duckJit_emitMemory(assembler,
+	                        0,
+	                        dl_true,
+	                        0x2B,
+	                        0,
+	                        duckJit_register_rax,
+	                        DUCKJIT_FRAME,
+	                        offsetof(duckJit_frame_t, floor));
+	/**/ duckJit_emitRegister(assembler, dl_true, 0x81, 7, duckJit_register_rax);
+	/**/ duckJit_emit32(assembler, (dl_uint32_t) (count * sizeof(duckVM_object_t)));
+	position = duckJit_emitBranch(assembler, duckJit_condition_below);
+	if (!assembler->e) assembler->e = dl_array_pushElement(stubs, &position);
+}
+
+/* Branch to `stub` if the stack is full. */
+static void duckJit_emitCheckPush(duckJit_assembler_t *assembler, dl_array_t *stubs) {
+	dl_size_t position;
+	/* cmp top, [frame.limit]; jae stub */
+	/**/ duckJit_emitMemory(assembler, 0, dl_true, 0x3B, 0, DUCKJIT_TOP, DUCKJIT_FRAME, offsetof(duckJit_frame_t, limit));
+	position = duckJit_emitBranch(assembler, duckJit_condition_aboveOrEqual);
+	if (!assembler->e) assembler->e = dl_array_pushElement(stubs, &position);
+}
+
+/* Branch to `stub` unless the operand has the type. */
+static void duckJit_emitCheckType(duckJit_assembler_t *assembler,
+                                  const dl_size_t index,
+                                  const duckVM_object_type_t type,
+                                  dl_array_t *stubs) {
+	dl_size_t position;
+	/* cmp dword [top - index * size + type], type; jne stub */
+	/**/ duckJit_emitMemory(assembler,
+	                        0,
+	                        dl_false,
+	                        0x81,
+	                        0,
+	                        7,
+	                        DUCKJIT_TOP,
+	                        duckJit_slot(index) + offsetof(duckVM_object_t, type));
+	/**/ duckJit_emit32(assembler, type);
+	position = duckJit_emitBranch(assembler, duckJit_condition_notEqual);
+	if (!assembler->e) assembler->e = dl_array_pushElement(stubs, &position);
+}
+
+/* Count the instruction against the budget. Everything before this may branch to the stub, which returns to the
+   interpreter in front of the instruction. Nothing after it may. */
+static void duckJit_emitCommit(duckJit_assembler_t *assembler) {
+	/* dec budget */
+	/**/ duckJit_emitRegister(assembler, dl_true, 0xFF, 1, DUCKJIT_BUDGET);
+}
+
+static void duckJit_emitCopy(duckJit_assembler_t *assembler, const dl_ptrdiff_t from, const dl_ptrdiff_t to) {
+	dl_size_t offset = 0;
+	while (offset + 16 <= sizeof(duckVM_object_t)) {
+		/* movdqu xmm0, [top + from]; movdqu [top + to], xmm0 */
+		/**/ duckJit_emitMemory(assembler, 0xF3, dl_false, 0x0F, 0x6F, 0, DUCKJIT_TOP, from + offset);
+		/**/ duckJit_emitMemory(assembler, 0xF3, dl_false, 0x0F, 0x7F, 0, DUCKJIT_TOP, to + offset);
+		offset += 16;
+	}
+	if (offset < sizeof(duckVM_object_t)) {
+		/**/ duckJit_emitMemory(assembler, 0, dl_true, 0x8B, 0, duckJit_register_rax, DUCKJIT_TOP, from + offset);
+		/**/ duckJit_emitMemory(assembler, 0, dl_true, 0x89, 0, duckJit_register_rax, DUCKJIT_TOP, to + offset);
+	}
+}
+
+/* Finish a push of the object written just above the top of the stack. */
+static void duckJit_emitPushed(duckJit_assembler_t *assembler) {
+	/* mov qword [upvalueTop], 0; add upvalueTop, 8; add top, size */
+	/**/ duckJit_emitMemory(assembler, 0, dl_true, 0xC7, 0, 0, DUCKJIT_UPVALUE_TOP, 0);
+	/**/ duckJit_emit32(assembler, 0);
+	/**/ duckJit_emitRegister(assembler, dl_true, 0x81, 0, DUCKJIT_UPVALUE_TOP);
+	/**/ duckJit_emit32(assembler, sizeof(duckVM_object_t *));
+	/**/ duckJit_emitRegister(assembler, dl_true, 0x81, 0, DUCKJIT_TOP);
+	/**/ duckJit_emit32(assembler, sizeof(duckVM_object_t));
+}
+
+/* Pop `count` objects. Doesn't change the flags. */
+static void duckJit_emitPopped(duckJit_assembler_t *assembler, const dl_size_t count) {
+	/* lea top, [top - count * size]; lea upvalueTop, [upvalueTop - count * 8] */
+	/**/ duckJit_emitMemory(assembler, 0, dl_true, 0x8D, 0, DUCKJIT_TOP, DUCKJIT_TOP, duckJit_slot(count));
+	/**/ duckJit_emitMemory(assembler,
+	                        0,
+	                        dl_true,
+	                        0x8D,
+	                        0,
+	                        DUCKJIT_UPVALUE_TOP,
+	                        DUCKJIT_UPVALUE_TOP,
+	                        -(dl_ptrdiff_t) (count * sizeof(duckVM_object_t *)));
+}
+
+
+/* Instructions */
+
+typedef enum {
+	/* Not translated. Returns to the interpreter. */
+	duckJit_kind_exit,
+	duckJit_kind_nop,
+	duckJit_kind_push,
+	duckJit_kind_pushIndex,
+	duckJit_kind_move,
+	duckJit_kind_pop,
+	duckJit_kind_add,
+	duckJit_kind_sub,
+	duckJit_kind_mul,
+	duckJit_kind_less,
+	duckJit_kind_greater,
+	duckJit_kind_jump,
+	duckJit_kind_brnz,
+} duckJit_kind_t;
+
+typedef struct {
+	duckJit_kind_t kind;
+	dl_size_t offset;
+	dl_size_t length;
+	/* Stack operands, the pop count, or the value and type of a pushed constant. */
+	dl_size_t operand1;
+	dl_size_t operand2;
+	dl_size_t target;
+	/* Set if the interpreter can enter native code here. */
+	dl_bool_t entry;
+	/* Position of the instruction's machine code and its stub. */
+	dl_size_t code;
+	dl_size_t stub;
+} duckJit_instruction_t;
+
+static dl_size_t duckJit_read(const dl_uint8_t *bytecode, const dl_size_t offset, const dl_size_t width) {
+	dl_size_t value = 0;
+	DL_DOTIMES(i, width) {
+		value = (value << 8) | bytecode[offset + i];
+	}
+	return value;
+}
+
+static dl_size_t duckJit_signExtend(dl_size_t value, const dl_size_t width) {
+	const dl_size_t sign = (dl_size_t) 1 << (8 * width - 1);
+	return (value & sign) ? (value | ~((sign << 1) - 1)) : value;
+}
+
+/* Decode the instruction at `offset`. Instructions that aren't translated, that run off the end of the bytecode, or
+   whose operands are out of range decode as exits. */
+static duckJit_instruction_t duckJit_decode(const dl_uint8_t *bytecode,
+                                            const dl_size_t bytecode_length,
+                                            const dl_size_t offset) {
+	duckJit_instruction_t instruction = {0};
+	const dl_size_t opcode = bytecode[offset];
+	dl_size_t width = 0;
+	dl_size_t operands = 0;
+
+	instruction.kind = duckJit_kind_exit;
+	instruction.offset = offset;
+	instruction.length = 1;
+
+	switch (opcode) {
+	case duckLisp_instruction_nop:
+		instruction.kind = duckJit_kind_nop;
+		break;
+	case duckLisp_instruction_pushBooleanFalse:
+	case duckLisp_instruction_pushBooleanTrue:
+		instruction.kind = duckJit_kind_push;
+		instruction.operand1 = opcode == duckLisp_instruction_pushBooleanTrue;
+		instruction.operand2 = duckVM_object_type_bool;
+		break;
+	case duckLisp_instruction_nil:
+		instruction.kind = duckJit_kind_push;
+		instruction.operand1 = 0;
+		instruction.operand2 = duckVM_object_type_list;
+		break;
+	case duckLisp_instruction_pushInteger8:
+	case duckLisp_instruction_pushInteger16:
+	case duckLisp_instruction_pushInteger32:
+		width = (dl_size_t) 1 << (opcode - duckLisp_instruction_pushInteger8);
+		if (offset + 1 + width > bytecode_length) return instruction;
+		instruction.kind = duckJit_kind_push;
+		instruction.operand1 = duckJit_signExtend(duckJit_read(bytecode, offset + 1, width), width);
+		instruction.operand2 = duckVM_object_type_integer;
+		instruction.length = 1 + width;
+		break;
+	case duckLisp_instruction_pushIndex8:
+	case duckLisp_instruction_pushIndex16:
+	case duckLisp_instruction_pushIndex32:
+		instruction.kind = duckJit_kind_pushIndex;
+		width = (dl_size_t) 1 << (opcode - duckLisp_instruction_pushIndex8);
+		operands = 1;
+		break;
+	case duckLisp_instruction_move8:
+	case duckLisp_instruction_move16:
+	case duckLisp_instruction_move32:
+		instruction.kind = duckJit_kind_move;
+		width = (dl_size_t) 1 << (opcode - duckLisp_instruction_move8);
+		operands = 2;
+		break;
+	case duckLisp_instruction_pop8:
+	case duckLisp_instruction_pop16:
+	case duckLisp_instruction_pop32:
+		width = (dl_size_t) 1 << (opcode - duckLisp_instruction_pop8);
+		if (offset + 1 + width > bytecode_length) return instruction;
+		instruction.operand1 = duckJit_read(bytecode, offset + 1, width);
+		if (instruction.operand1 > DUCKJIT_MAX_OPERAND) return instruction;
+		instruction.kind = duckJit_kind_pop;
+		instruction.length = 1 + width;
+		break;
+	case duckLisp_instruction_add8:
+	case duckLisp_instruction_add16:
+	case duckLisp_instruction_add32:
+		instruction.kind = duckJit_kind_add;
+		width = (dl_size_t) 1 << (opcode - duckLisp_instruction_add8);
+		operands = 2;
+		break;
+	case duckLisp_instruction_sub8:
+	case duckLisp_instruction_sub16:
+	case duckLisp_instruction_sub32:
+		instruction.kind = duckJit_kind_sub;
+		width = (dl_size_t) 1 << (opcode - duckLisp_instruction_sub8);
+		operands = 2;
+		break;
+	case duckLisp_instruction_mul8:
+	case duckLisp_instruction_mul16:
+	case duckLisp_instruction_mul32:
+		instruction.kind = duckJit_kind_mul;
+		width = (dl_size_t) 1 << (opcode - duckLisp_instruction_mul8);
+		operands = 2;
+		break;
+	case duckLisp_instruction_less8:
+	case duckLisp_instruction_less16:
+	case duckLisp_instruction_less32:
+		instruction.kind = duckJit_kind_less;
+		width = (dl_size_t) 1 << (opcode - duckLisp_instruction_less8);
+		operands = 2;
+		break;
+	case duckLisp_instruction_greater8:
+	case duckLisp_instruction_greater16:
+	case duckLisp_instruction_greater32:
+		instruction.kind = duckJit_kind_greater;
+		width = (dl_size_t) 1 << (opcode - duckLisp_instruction_greater8);
+		operands = 2;
+		break;
+	/* Quickened instructions check the same types as the templates do. */
+	case duckLisp_instruction_addInteger8:
+		instruction.kind = duckJit_kind_add;
+		width = 1;
+		operands = 2;
+		break;
+	case duckLisp_instruction_subInteger8:
+		instruction.kind = duckJit_kind_sub;
+		width = 1;
+		operands = 2;
+		break;
+	case duckLisp_instruction_mulInteger8:
+		instruction.kind = duckJit_kind_mul;
+		width = 1;
+		operands = 2;
+		break;
+	case duckLisp_instruction_lessInteger8:
+		instruction.kind = duckJit_kind_less;
+		width = 1;
+		operands = 2;
+		break;
+	case duckLisp_instruction_greaterInteger8:
+		instruction.kind = duckJit_kind_greater;
+		width = 1;
+		operands = 2;
+		break;
+	case duckLisp_instruction_jump8:
+	case duckLisp_instruction_jump16:
+	case duckLisp_instruction_jump32:
+	case duckLisp_instruction_brnz8:
+	case duckLisp_instruction_brnz16:
+	case duckLisp_instruction_brnz32: {
+		const dl_bool_t brnz = opcode >= duckLisp_instruction_brnz8;
+		dl_size_t next;
+		width = (dl_size_t) 1 << (opcode - (brnz ? duckLisp_instruction_brnz8 : duckLisp_instruction_jump8));
+		/* Branches are relative to the end of the offset. `brnz` has a pop count after it. */
+		next = offset + 1 + width;
+		if (next + brnz > bytecode_length) return instruction;
+		instruction.target = next + duckJit_signExtend(duckJit_read(bytecode, offset + 1, width), width);
+		if (instruction.target >= bytecode_length) return instruction;
+		if (brnz) {
+			instruction.operand1 = bytecode[next];
+		}
+		instruction.kind = brnz ? duckJit_kind_brnz : duckJit_kind_jump;
+		instruction.length = 1 + width + brnz;
+		break;
+	}
+	default:
+		return instruction;
+	}
+
+	if (operands > 0) {
+		if (offset + 1 + operands * width > bytecode_length) {
+			instruction.kind = duckJit_kind_exit;
+			return instruction;
+		}
+		instruction.operand1 = duckJit_read(bytecode, offset + 1, width);
+		if (operands > 1) instruction.operand2 = duckJit_read(bytecode, offset + 1 + width, width);
+		/* Operands count down from the top of the stack starting at 1. */
+		if ((instruction.operand1 < 1)
+		    || (instruction.operand1 > DUCKJIT_MAX_OPERAND)
+		    || ((operands > 1) && ((instruction.operand2 < 1) || (instruction.operand2 > DUCKJIT_MAX_OPERAND)))) {
+			instruction.kind = duckJit_kind_exit;
+			return instruction;
+		}
+		instruction.length = 1 + operands * width;
+	}
+	/* The last instruction can't fall off the end of the bytecode. */
+	if ((instruction.kind != duckJit_kind_jump) && (offset + instruction.length >= bytecode_length)) {
+		instruction.kind = duckJit_kind_exit;
+		instruction.length = 1;
+	}
+	return instruction;
+}
+
+/* Emit the instruction's machine code. Branches to its stub are added to `stubs`, and jumps to other instructions are
+   added to `jumps` as the position followed by the target offset. */
+static void duckJit_emitInstruction(duckJit_assembler_t *assembler,
+                                    const duckJit_instruction_t *instruction,
+                                    const dl_uint8_t *bytecode,
+                                    const dl_size_t epilogue,
+                                    dl_array_t *stubs,
+                                    dl_array_t *jumps) {
+	const dl_size_t a = instruction->operand1;
+	const dl_size_t b = instruction->operand2;
+	dl_size_t position;
+
+	if (instruction->kind == duckJit_kind_exit) {
+		/**/ duckJit_emitLoadImmediate(assembler, duckJit_register_rax, (dl_uint64_t) (bytecode + instruction->offset));
+		/**/ duckJit_patch(assembler, duckJit_emitJump(assembler), epilogue);
+		return;
+	}
+
+	/* test budget, budget; jz stub */
+	/**/ duckJit_emitRegister(assembler, dl_true, 0x85, DUCKJIT_BUDGET, DUCKJIT_BUDGET);
+	position = duckJit_emitBranch(assembler, duckJit_condition_equal);
+	if (!assembler->e) assembler->e = dl_array_pushElement(stubs, &position);
+
+	switch (instruction->kind) {
+	case duckJit_kind_nop:
+		/**/ duckJit_emitCommit(assembler);
+		break;
+
+	case duckJit_kind_push:
+		/**/ duckJit_emitCheckPush(assembler, stubs);
+		/**/ duckJit_emitCommit(assembler);
+		/* mov rax, value; mov [top + value], rax; mov dword [top + type], type */
+		/**/ duckJit_emitLoadImmediate(assembler, duckJit_register_rax, a);
+		/**/ duckJit_emitMemory(assembler,
+		                        0,
+		                        dl_true,
+		                        0x89,
+		                        0,
+		                        duckJit_register_rax,
+		                        DUCKJIT_TOP,
+		                        offsetof(duckVM_object_t, value));
+		/**/ duckJit_emitMemory(assembler, 0, dl_false, 0xC7, 0, 0, DUCKJIT_TOP, offsetof(duckVM_object_t, type));
+		/**/ duckJit_emit32(assembler, (dl_uint32_t) b);
+		/**/ duckJit_emitPushed(assembler);
+		break;
+
+	case duckJit_kind_pushIndex:
+		/**/ duckJit_emitCheckDepth(assembler, a, stubs);
+		/**/ duckJit_emitCheckPush(assembler, stubs);
+		/**/ duckJit_emitCommit(assembler);
+		/**/ duckJit_emitCopy(assembler, duckJit_slot(a), 0);
+		/**/ duckJit_emitPushed(assembler);
+		break;
+
+	case duckJit_kind_move:
+		/**/ duckJit_emitCheckDepth(assembler, (a > b) ? a : b, stubs);
+		/**/ duckJit_emitCommit(assembler);
+		/**/ duckJit_emitCopy(assembler, duckJit_slot(a), duckJit_slot(b));
+		break;
+
+	case duckJit_kind_pop:
+		/**/ duckJit_emitCheckPop(assembler, a, stubs);
+		/**/ duckJit_emitCommit(assembler);
+		/**/ duckJit_emitPopped(assembler, a);
+		break;
+
+	case duckJit_kind_add:
+	case duckJit_kind_sub:
+	case duckJit_kind_mul:
+	case duckJit_kind_less:
+	case duckJit_kind_greater: {
+		const dl_ptrdiff_t value = offsetof(duckVM_object_t, value);
+		/**/ duckJit_emitCheckDepth(assembler, (a > b) ? a : b, stubs);
+		/**/ duckJit_emitCheckPush(assembler, stubs);
+		/**/ duckJit_emitCheckType(assembler, a, duckVM_object_type_integer, stubs);
+		/**/ duckJit_emitCheckType(assembler, b, duckVM_object_type_integer, stubs);
+		/**/ duckJit_emitCommit(assembler);
+		/* Like the interpreter, the result starts as a copy of the first operand. */
+		/**/ duckJit_emitCopy(assembler, duckJit_slot(a), 0);
+		if (instruction->kind == duckJit_kind_add) {
+			/* mov rax, [b]; add [top], rax */
+			/**/ duckJit_emitMemory(assembler, 0, dl_true, 0x8B, 0, duckJit_register_rax, DUCKJIT_TOP, duckJit_slot(b) + value);
+			/**/ duckJit_emitMemory(assembler, 0, dl_true, 0x01, 0, duckJit_register_rax, DUCKJIT_TOP, value);
+		}
+		else if (instruction->kind == duckJit_kind_sub) {
+			/* mov rax, [b]; sub [top], rax */
+			/**/ duckJit_emitMemory(assembler, 0, dl_true, 0x8B, 0, duckJit_register_rax, DUCKJIT_TOP, duckJit_slot(b) + value);
+			/**/ duckJit_emitMemory(assembler, 0, dl_true, 0x29, 0, duckJit_register_rax, DUCKJIT_TOP, value);
+		}
+		else if (instruction->kind == duckJit_kind_mul) {
+			/* mov rax, [top]; imul rax, [b]; mov [top], rax */
+			/**/ duckJit_emitMemory(assembler, 0, dl_true, 0x8B, 0, duckJit_register_rax, DUCKJIT_TOP, value);
+			/**/ duckJit_emitMemory(assembler,
+			                        0,
+			                        dl_true,
+			                        0x0F,
+			                        0xAF,
+			                        duckJit_register_rax,
+			                        DUCKJIT_TOP,
+			                        duckJit_slot(b) + value);
+			/**/ duckJit_emitMemory(assembler, 0, dl_true, 0x89, 0, duckJit_register_rax, DUCKJIT_TOP, value);
+		}
+		else {
+			/* mov rax, [top]; cmp rax, [b]; setl/setg al; mov [top], al; mov dword [top + type], bool */
+			/**/ duckJit_emitMemory(assembler, 0, dl_true, 0x8B, 0, duckJit_register_rax, DUCKJIT_TOP, value);
+			/**/ duckJit_emitMemory(assembler, 0, dl_true, 0x3B, 0, duckJit_register_rax, DUCKJIT_TOP, duckJit_slot(b) + value);
+			/**/ duckJit_emitByte(assembler, 0x0F);
+			/**/ duckJit_emitByte(assembler,
+			                      0x90 | ((instruction->kind == duckJit_kind_less)
+			                              ? duckJit_condition_less
+			                              : duckJit_condition_greater));
+			/**/ duckJit_emitByte(assembler, 0xC0);
+			/**/ duckJit_emitMemory(assembler, 0, dl_false, 0x88, 0, duckJit_register_rax, DUCKJIT_TOP, value);
+			/**/ duckJit_emitMemory(assembler, 0, dl_false, 0xC7, 0, 0, DUCKJIT_TOP, offsetof(duckVM_object_t, type));
+			/**/ duckJit_emit32(assembler, duckVM_object_type_bool);
+		}
+		/**/ duckJit_emitPushed(assembler);
+		break;
+	}
+
+	case duckJit_kind_jump:
+		/**/ duckJit_emitCommit(assembler);
+		position = duckJit_emitJump(assembler);
+		if (!assembler->e) assembler->e = dl_array_pushElement(jumps, &position);
+		if (!assembler->e) assembler->e = dl_array_pushElement(jumps, (void *) &instruction->target);
+		break;
+
+	case duckJit_kind_brnz: {
+		const dl_ptrdiff_t top = duckJit_slot(1);
+		dl_size_t isBoolean;
+		dl_size_t isInteger;
+		dl_size_t isList;
+		dl_size_t loaded;
+		/**/ duckJit_emitCheckDepth(assembler, 1, stubs);
+		/**/ duckJit_emitCheckPop(assembler, a, stubs);
+		/* Only booleans, integers, and lists are tested here. The interpreter handles every other type. */
+		/* mov edx, [top + type] */
+		/**/ duckJit_emitMemory(assembler,
+		                        0,
+		                        dl_false,
+		                        0x8B,
+		                        0,
+		                        duckJit_register_rdx,
+		                        DUCKJIT_TOP,
+		                        top + offsetof(duckVM_object_t, type));
+		/* cmp edx, bool; je isBoolean; cmp edx, integer; je isInteger; cmp edx, list; jne stub */
+		/**/ duckJit_emitRegister(assembler, dl_false, 0x81, 7, duckJit_register_rdx);
+		/**/ duckJit_emit32(assembler, duckVM_object_type_bool);
+		isBoolean = duckJit_emitBranch(assembler, duckJit_condition_equal);
+		/**/ duckJit_emitRegister(assembler, dl_false, 0x81, 7, duckJit_register_rdx);
+		/**/ duckJit_emit32(assembler, duckVM_object_type_integer);
+		isInteger = duckJit_emitBranch(assembler, duckJit_condition_equal);
+		/**/ duckJit_emitRegister(assembler, dl_false, 0x81, 7, duckJit_register_rdx);
+		/**/ duckJit_emit32(assembler, duckVM_object_type_list);
+		position = duckJit_emitBranch(assembler, duckJit_condition_notEqual);
+		if (!assembler->e) assembler->e = dl_array_pushElement(stubs, &position);
+		/* Integers and lists are true if they aren't zero or null. mov rcx, [top + value]; jmp loaded */
+		isList = duckJit_here(assembler);
+		/**/ duckJit_patch(assembler, isInteger, isList);
+		/**/ duckJit_emitMemory(assembler,
+		                        0,
+		                        dl_true,
+		                        0x8B,
+		                        0,
+		                        duckJit_register_rcx,
+		                        DUCKJIT_TOP,
+		                        top + offsetof(duckVM_object_t, value));
+		loaded = duckJit_emitJump(assembler);
+		/* movzx ecx, byte [top + value] */
+		/**/ duckJit_patch(assembler, isBoolean, duckJit_here(assembler));
+		/**/ duckJit_emitMemory(assembler,
+		                        0,
+		                        dl_false,
+		                        0x0F,
+		                        0xB6,
+		                        duckJit_register_rcx,
+		                        DUCKJIT_TOP,
+		                        top + offsetof(duckVM_object_t, value));
+		/**/ duckJit_patch(assembler, loaded, duckJit_here(assembler));
+		/**/ duckJit_emitCommit(assembler);
+		/**/ duckJit_emitPopped(assembler, a);
+		/* test rcx, rcx; jnz target */
+		/**/ duckJit_emitRegister(assembler, dl_true, 0x85, duckJit_register_rcx, duckJit_register_rcx);
+		position = duckJit_emitBranch(assembler, duckJit_condition_notEqual);
+		if (!assembler->e) assembler->e = dl_array_pushElement(jumps, &position);
+		if (!assembler->e) assembler->e = dl_array_pushElement(jumps, (void *) &instruction->target);
+		break;
+	}
+
+	default:
+		break;
+	}
+}
+
+
+/* Compiling and running */
+
+static dl_error_t duckJit_compile(void *data,
+                                  duckVM_t *duckVM,
+                                  duckVM_object_t *bytecodeObject,
+                                  dl_uint8_t *ip,
+                                  duckVM_native_t **native) {
+	dl_error_t e = dl_error_ok;
+	dl_error_t eError = dl_error_ok;
+	(void) data;
+
+	dl_memoryAllocation_t *memoryAllocation = duckVM->memoryAllocation;
+	dl_uint8_t *bytecode = bytecodeObject->value.bytecode.bytecode;
+	const dl_size_t bytecode_length = bytecodeObject->value.bytecode.bytecode_length;
+	const dl_size_t start = ip - bytecode;
+	/* Index into `instructions` of the instruction at each offset, or -1. */
+	dl_ptrdiff_t *indices = dl_null;
+	dl_array_t instructions;  /* duckJit_instruction_t */
+	dl_array_t pending;  /* dl_size_t */
+	dl_array_t stubs;  /* dl_size_t */
+	dl_array_t jumps;  /* dl_size_t */
+	duckJit_assembler_t assembler;
+	duckJit_region_t *region = dl_null;
+	void *code = MAP_FAILED;
+	dl_size_t code_size = 0;
+	dl_size_t epilogue = 0;
+	dl_size_t entries_length = 0;
+	dl_ptrdiff_t fallthrough = -1;
+	/**/ dl_array_init(&instructions, memoryAllocation, sizeof(duckJit_instruction_t), dl_array_strategy_double);
+	/**/ dl_array_init(&pending, memoryAllocation, sizeof(dl_size_t), dl_array_strategy_double);
+	/**/ dl_array_init(&stubs, memoryAllocation, sizeof(dl_size_t), dl_array_strategy_double);
+	/**/ dl_array_init(&jumps, memoryAllocation, sizeof(dl_size_t), dl_array_strategy_double);
+	/**/ dl_array_init(&assembler.code, memoryAllocation, sizeof(dl_uint8_t), dl_array_strategy_double);
+	assembler.e = dl_error_ok;
+
+	*native = dl_null;
+
+	/* Find every instruction reachable from the start without passing through an exit. */
+	e = DL_MALLOC(memoryAllocation, &indices, bytecode_length, dl_ptrdiff_t);
+	if (e) goto cleanup;
+	DL_DOTIMES(i, bytecode_length) {
+		indices[i] = -1;
+	}
+	e = dl_array_pushElement(&pending, (void *) &start);
+	if (e) goto cleanup;
+	while (pending.elements_length > 0) {
+		dl_size_t offset;
+		duckJit_instruction_t instruction;
+		e = dl_array_popElement(&pending, &offset);
+		if (e) goto cleanup;
+		if (indices[offset] >= 0) continue;
+		instruction = duckJit_decode(bytecode, bytecode_length, offset);
+		indices[offset] = instructions.elements_length;
+		e = dl_array_pushElement(&instructions, &instruction);
+		if (e) goto cleanup;
+		if ((instruction.kind != duckJit_kind_exit) && (instruction.kind != duckJit_kind_jump)) {
+			const dl_size_t next = offset + instruction.length;
+			e = dl_array_pushElement(&pending, (void *) &next);
+			if (e) goto cleanup;
+		}
+		if ((instruction.kind == duckJit_kind_jump) || (instruction.kind == duckJit_kind_brnz)) {
+			e = dl_array_pushElement(&pending, &instruction.target);
+			if (e) goto cleanup;
+		}
+	}
+	/* Nothing to gain if the interpreter would be sent straight back. */
+	if (DL_ARRAY_GETADDRESS(instructions, duckJit_instruction_t, 0).kind == duckJit_kind_exit) goto cleanup;
+
+	/* The start and the targets of branches are entries, since those are where the interpreter tries to enter. */
+	DL_ARRAY_GETADDRESS(instructions, duckJit_instruction_t, 0).entry = dl_true;
+	DL_DOTIMES(i, instructions.elements_length) {
+		const duckJit_instruction_t *instruction = &DL_ARRAY_GETADDRESS(instructions, duckJit_instruction_t, i);
+		if ((instruction->kind == duckJit_kind_jump) || (instruction->kind == duckJit_kind_brnz)) {
+			duckJit_instruction_t *target = &DL_ARRAY_GETADDRESS(instructions,
+			                                                     duckJit_instruction_t,
+			                                                     indices[instruction->target]);
+			if (target->kind != duckJit_kind_exit) target->entry = dl_true;
+		}
+	}
+
+	/* Prologue. Called as `void (duckJit_frame_t *frame)`. */
+	/**/ duckJit_emitPush(&assembler, duckJit_register_rbx);
+	/**/ duckJit_emitPush(&assembler, duckJit_register_r12);
+	/**/ duckJit_emitPush(&assembler, duckJit_register_r13);
+	/**/ duckJit_emitPush(&assembler, duckJit_register_r14);
+	/**/ duckJit_emitPush(&assembler, duckJit_register_r15);
+	/**/ duckJit_emitRegister(&assembler, dl_true, 0x89, duckJit_register_rdi, DUCKJIT_FRAME);
+	/**/ duckJit_emitMemory(&assembler, 0, dl_true, 0x8B, 0, DUCKJIT_BASE, DUCKJIT_FRAME, offsetof(duckJit_frame_t, base));
+	/**/ duckJit_emitMemory(&assembler,
+	                        0,
+	                        dl_true,
+	                        0x8B,
+	                        0,
+	                        DUCKJIT_BUDGET,
+	                        DUCKJIT_FRAME,
+	                        offsetof(duckJit_frame_t, budget));
+	/**/ duckJit_emitMemory(&assembler, 0, dl_true, 0x8B, 0, DUCKJIT_TOP, DUCKJIT_FRAME, offsetof(duckJit_frame_t, top));
+	/**/ duckJit_emitMemory(&assembler,
+	                        0,
+	                        dl_true,
+	                        0x8B,
+	                        0,
+	                        DUCKJIT_UPVALUE_TOP,
+	                        DUCKJIT_FRAME,
+	                        offsetof(duckJit_frame_t, upvalueTop));
+	/* jmp [frame.entry] */
+	/**/ duckJit_emitMemory(&assembler, 0, dl_false, 0xFF, 0, 4, DUCKJIT_FRAME, offsetof(duckJit_frame_t, entry));
+
+	/* Epilogue. Expects the IP to continue at in rax. */
+	epilogue = duckJit_here(&assembler);
+	/**/ duckJit_emitMemory(&assembler,
+	                        0,
+	                        dl_true,
+	                        0x89,
+	                        0,
+	                        duckJit_register_rax,
+	                        DUCKJIT_FRAME,
+	                        offsetof(duckJit_frame_t, ip));
+	/**/ duckJit_emitMemory(&assembler,
+	                        0,
+	                        dl_true,
+	                        0x89,
+	                        0,
+	                        DUCKJIT_BUDGET,
+	                        DUCKJIT_FRAME,
+	                        offsetof(duckJit_frame_t, budget));
+	/**/ duckJit_emitMemory(&assembler, 0, dl_true, 0x89, 0, DUCKJIT_TOP, DUCKJIT_FRAME, offsetof(duckJit_frame_t, top));
+	/**/ duckJit_emitMemory(&assembler,
+	                        0,
+	                        dl_true,
+	                        0x89,
+	                        0,
+	                        DUCKJIT_UPVALUE_TOP,
+	                        DUCKJIT_FRAME,
+	                        offsetof(duckJit_frame_t, upvalueTop));
+	/**/ duckJit_emitPop(&assembler, duckJit_register_r15);
+	/**/ duckJit_emitPop(&assembler, duckJit_register_r14);
+	/**/ duckJit_emitPop(&assembler, duckJit_register_r13);
+	/**/ duckJit_emitPop(&assembler, duckJit_register_r12);
+	/**/ duckJit_emitPop(&assembler, duckJit_register_rbx);
+	/**/ duckJit_emitByte(&assembler, 0xC3);
+
+	/* Instructions, in bytecode order so that most fall through to the next one. Each is followed by its stub. */
+	DL_DOTIMES(offset, bytecode_length) {
+		duckJit_instruction_t *instruction;
+		dl_size_t stubs_length;
+		if (indices[offset] < 0) continue;
+		instruction = &DL_ARRAY_GETADDRESS(instructions, duckJit_instruction_t, indices[offset]);
+		if ((fallthrough >= 0) && (fallthrough != offset)) {
+			const dl_size_t target = fallthrough;
+			const dl_size_t position = duckJit_emitJump(&assembler);
+			if (!assembler.e) assembler.e = dl_array_pushElement(&jumps, (void *) &position);
+			if (!assembler.e) assembler.e = dl_array_pushElement(&jumps, (void *) &target);
+		}
+		instruction->code = duckJit_here(&assembler);
+		stubs.elements_length = 0;
+		/**/ duckJit_emitInstruction(&assembler, instruction, bytecode, epilogue, &stubs, &jumps);
+		fallthrough = (((instruction->kind == duckJit_kind_exit) || (instruction->kind == duckJit_kind_jump))
+		               ? -1
+		               : (dl_ptrdiff_t) (offset + instruction->length));
+		if (stubs.elements_length == 0) continue;
+		stubs_length = stubs.elements_length;
+		if (fallthrough >= 0) {
+			const dl_size_t target = fallthrough;
+			const dl_size_t position = duckJit_emitJump(&assembler);
+			if (!assembler.e) assembler.e = dl_array_pushElement(&jumps, (void *) &position);
+			if (!assembler.e) assembler.e = dl_array_pushElement(&jumps, (void *) &target);
+			fallthrough = -1;
+		}
+		/* mov rax, ip; jmp epilogue */
+		instruction->stub = duckJit_here(&assembler);
+		DL_DOTIMES(i, stubs_length) {
+			/**/ duckJit_patch(&assembler, DL_ARRAY_GETADDRESS(stubs, dl_size_t, i), instruction->stub);
+		}
+		/**/ duckJit_emitLoadImmediate(&assembler, duckJit_register_rax, (dl_uint64_t) (bytecode + offset));
+		/**/ duckJit_patch(&assembler, duckJit_emitJump(&assembler), epilogue);
+	}
+	e = assembler.e;
+	if (e) goto cleanup;
+	for (dl_size_t i = 0; i < jumps.elements_length; i += 2) {
+		const dl_size_t position = DL_ARRAY_GETADDRESS(jumps, dl_size_t, i);
+		const dl_size_t target = DL_ARRAY_GETADDRESS(jumps, dl_size_t, i + 1);
+		/**/ duckJit_patch(&assembler,
+		                   position,
+		                   DL_ARRAY_GETADDRESS(instructions, duckJit_instruction_t, indices[target]).code);
+	}
+
+	/* Map the code writable, then make it executable. It's never both. */
+	code_size = assembler.code.elements_length;
+	code = mmap(NULL, code_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (code == MAP_FAILED) {
+		e = dl_error_outOfMemory;
+		goto cleanup;
+	}
+	/**/ dl_memcopy_noOverlap(code, assembler.code.elements, code_size);
+	if (mprotect(code, code_size, PROT_READ | PROT_EXEC)) {
+		e = dl_error_invalidValue;
+		goto cleanup;
+	}
+
+	e = DL_MALLOC(memoryAllocation, &region, 1, duckJit_region_t);
+	if (e) goto cleanup;
+	region->native.next = dl_null;
+	region->native.entries = dl_null;
+	region->entryCode = dl_null;
+	region->bytecode = bytecode;
+	region->code = code;
+	region->code_size = code_size;
+	code = MAP_FAILED;
+	DL_DOTIMES(i, instructions.elements_length) {
+		if (DL_ARRAY_GETADDRESS(instructions, duckJit_instruction_t, i).entry) entries_length++;
+	}
+	e = DL_MALLOC(memoryAllocation, &region->native.entries, entries_length, dl_size_t);
+	if (e) goto cleanup;
+	e = DL_MALLOC(memoryAllocation, &region->entryCode, entries_length, dl_size_t);
+	if (e) goto cleanup;
+	region->native.entries_length = 0;
+	DL_DOTIMES(offset, bytecode_length) {
+		const duckJit_instruction_t *instruction;
+		if (indices[offset] < 0) continue;
+		instruction = &DL_ARRAY_GETADDRESS(instructions, duckJit_instruction_t, indices[offset]);
+		if (!instruction->entry) continue;
+		region->native.entries[region->native.entries_length] = offset;
+		region->entryCode[region->native.entries_length] = instruction->code;
+		region->native.entries_length++;
+	}
+	*native = &region->native;
+	region = dl_null;
+
+ cleanup:
+	if (region != dl_null) {
+		/**/ munmap(region->code, region->code_size);
+		if (region->native.entries != dl_null) {
+			eError = DL_FREE(memoryAllocation, &region->native.entries);
+			if (eError) e = eError;
+		}
+		eError = DL_FREE(memoryAllocation, &region);
+		if (eError) e = eError;
+	}
+	if (code != MAP_FAILED) munmap(code, code_size);
+	if (indices != dl_null) {
+		eError = DL_FREE(memoryAllocation, &indices);
+		if (eError) e = eError;
+	}
+	eError = dl_array_quit(&assembler.code);
+	if (eError) e = eError;
+	eError = dl_array_quit(&jumps);
+	if (eError) e = eError;
+	eError = dl_array_quit(&stubs);
+	if (eError) e = eError;
+	eError = dl_array_quit(&pending);
+	if (eError) e = eError;
+	eError = dl_array_quit(&instructions);
+	if (eError) e = eError;
+	return e;
+}
+
+static void duckJit_run(void *data, duckVM_t *duckVM, duckVM_native_t *native, dl_uint8_t **ip, dl_size_t *budget) {
+	duckJit_region_t *region = (duckJit_region_t *) native;
+	dl_array_t *stack = &duckVM->stack;
+	dl_array_t *upvalueStack = &duckVM->upvalue_stack;
+	const dl_size_t offset = *ip - region->bytecode;
+	const dl_size_t stackRoom = stack->elements_memorySize / sizeof(duckVM_object_t) - stack->elements_length;
+	const dl_size_t upvalueRoom = (upvalueStack->elements_memorySize / sizeof(duckVM_object_t *)
+	                               - upvalueStack->elements_length);
+	duckJit_frame_t frame;
+	void (*function)(duckJit_frame_t *frame);
+	void *address = region->code;
+	dl_size_t low = 0;
+	dl_size_t high = native->entries_length;
+	(void) data;
+
+	while (low < high) {
+		const dl_size_t middle = low + (high - low) / 2;
+		if (native->entries[middle] < offset) low = middle + 1;
+		else high = middle;
+	}
+
+	frame.base = stack->elements;
+	frame.top = frame.base + stack->elements_length;
+	frame.upvalueTop = (duckVM_object_t **) upvalueStack->elements + upvalueStack->elements_length;
+	frame.limit = frame.top + ((stackRoom < upvalueRoom) ? stackRoom : upvalueRoom);
+	frame.floor = frame.top - ((stack->elements_length < upvalueStack->elements_length)
+	                           ? stack->elements_length
+	                           : upvalueStack->elements_length);
+	frame.budget = *budget;
+	frame.entry = region->code + region->entryCode[low];
+	frame.ip = *ip;
+
+	/* ISO C doesn't allow casting an object pointer to a function pointer. */
+	/**/ dl_memcopy_noOverlap(&function, &address, sizeof(function));
+	/**/ function(&frame);
+
+	upvalueStack->elements_length = frame.upvalueTop - (duckVM_object_t **) upvalueStack->elements;
+	stack->elements_length = frame.top - frame.base;
+	*budget = frame.budget;
+	*ip = frame.ip;
+}
+
+static void duckJit_free(void *data, duckVM_t *duckVM, duckVM_native_t *native) {
+	duckJit_region_t *region = (duckJit_region_t *) native;
+	(void) data;
+	/**/ munmap(region->code, region->code_size);
+	(void) DL_FREE(duckVM->memoryAllocation, &region->native.entries);
+	(void) DL_FREE(duckVM->memoryAllocation, &region->entryCode);
+	(void) DL_FREE(duckVM->memoryAllocation, &region);
+}
+
+void duckJit_init(duckJit_t *jit, const dl_size_t threshold) {
+	jit->jit.compile = duckJit_compile;
+	jit->jit.run = duckJit_run;
+	jit->jit.free = duckJit_free;
+	jit->jit.data = jit;
+	jit->jit.threshold = threshold;
+}
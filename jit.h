@@ -0,0 +1,48 @@
+/*
+MIT License
+
+Copyright (c) 2023 Joseph Herguth
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* Compiles hot bytecode to x86-64 machine code. Unlike the rest of the library this depends on the CPU, the System V
+   calling convention, and `mmap`, so it is only built with `USE_JIT`.
+
+   Each instruction is translated to a fixed template of machine code that works on the VM's stack in place. Pushing
+   constants, copying and popping stack slots, integer `+`, `-`, `*`, `<`, and `>`, and jumps are translated. Every
+   other instruction, an operand of another type, a stack that would have to grow, and running out of budget all return
+   to the interpreter in front of the instruction, so the interpreter repeats the checks and handles it. Native code
+   never allocates or calls into the VM, so the garbage collector, C callbacks, and `duckVM_call` only ever see the
+   VM's usual state. */
+
+#ifndef JIT_H
+#define JIT_H
+
+#include "duckVM.h"
+
+/* Stateless, so one JIT can be linked into any number of VMs on any number of threads. */
+typedef struct {
+	duckVM_jit_t jit;
+} duckJit_t;
+
+/* Closures and loops are compiled once they have been entered `threshold` times. */
+void duckJit_init(duckJit_t *jit, const dl_size_t threshold);
+
+#endif /* JIT_H */
@@ -0,0 +1,537 @@
+/*
+MIT License
+
+Copyright (c) 2023 Joseph Herguth
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "scheduler.h"
+
+/* Deques */
+
+/* Deques have room for `maxTasks` tasks, which is every task that can be pending, so pushes can't fail. C99 has no
+   atomics, so each deque is guarded by its own mutex instead of being lock-free. Workers still only contend when one of
+   them is stealing. */
+
+static dl_error_t duckScheduler_deque_init(duckScheduler_deque_t *deque,
+                                           dl_memoryAllocation_t *memoryAllocation,
+                                           const dl_size_t capacity) {
+	dl_error_t e = dl_error_ok;
+	deque->top = 0;
+	deque->length = 0;
+	e = DL_MALLOC(memoryAllocation, &deque->tasks, capacity, duckScheduler_task_t *);
+	if (e) return e;
+	if (pthread_mutex_init(&deque->mutex, NULL)) {
+		(void) DL_FREE(memoryAllocation, &deque->tasks);
+		return dl_error_invalidValue;
+	}
+	return e;
+}
+
+static void duckScheduler_deque_quit(duckScheduler_deque_t *deque, dl_memoryAllocation_t *memoryAllocation) {
+	(void) pthread_mutex_destroy(&deque->mutex);
+	(void) DL_FREE(memoryAllocation, &deque->tasks);
+}
+
+static void duckScheduler_deque_pushBottom(duckScheduler_deque_t *deque,
+                                           const dl_size_t capacity,
+                                           duckScheduler_task_t *task) {
+	(void) pthread_mutex_lock(&deque->mutex);
+	deque->tasks[(deque->top + deque->length) % capacity] = task;
+	deque->length++;
+	(void) pthread_mutex_unlock(&deque->mutex);
+}
+
+static void duckScheduler_deque_pushTop(duckScheduler_deque_t *deque,
+                                        const dl_size_t capacity,
+                                        duckScheduler_task_t *task) {
+	(void) pthread_mutex_lock(&deque->mutex);
+	deque->top = (deque->top + capacity - 1) % capacity;
+	deque->tasks[deque->top] = task;
+	deque->length++;
+	(void) pthread_mutex_unlock(&deque->mutex);
+}
+
+static duckScheduler_task_t *duckScheduler_deque_popBottom(duckScheduler_deque_t *deque, const dl_size_t capacity) {
+	duckScheduler_task_t *task = dl_null;
+	(void) pthread_mutex_lock(&deque->mutex);
+	if (deque->length > 0) {
+		deque->length--;
+		task = deque->tasks[(deque->top + deque->length) % capacity];
+	}
+	(void) pthread_mutex_unlock(&deque->mutex);
+	return task;
+}
+
+static duckScheduler_task_t *duckScheduler_deque_popTop(duckScheduler_deque_t *deque, const dl_size_t capacity) {
+	duckScheduler_task_t *task = dl_null;
+	(void) pthread_mutex_lock(&deque->mutex);
+	if (deque->length > 0) {
+		task = deque->tasks[deque->top];
+		deque->top = (deque->top + 1) % capacity;
+		deque->length--;
+	}
+	(void) pthread_mutex_unlock(&deque->mutex);
+	return task;
+}
+
+
+/* Workers */
+
+/* Take the newest task from the worker's own deque, or steal the oldest task from another worker. */
+static duckScheduler_task_t *duckScheduler_findTask(duckScheduler_t *scheduler, duckScheduler_worker_t *worker) {
+	duckScheduler_task_t *task = duckScheduler_deque_popBottom(&worker->deque, scheduler->maxTasks);
+	for (dl_size_t i = 1; (task == dl_null) && (i < scheduler->workers_length); i++) {
+		duckScheduler_worker_t *victim = &scheduler->workers[(worker->index + i) % scheduler->workers_length];
+		task = duckScheduler_deque_popTop(&victim->deque, scheduler->maxTasks);
+	}
+	if (task != dl_null) {
+		(void) pthread_mutex_lock(&scheduler->mutex);
+		--scheduler->queued;
+		(void) pthread_mutex_unlock(&scheduler->mutex);
+	}
+	return task;
+}
+
+static void duckScheduler_complete(duckScheduler_t *scheduler, duckScheduler_task_t *task, dl_error_t e) {
+	(void) pthread_mutex_lock(&scheduler->mutex);
+	DL_DOTIMES(i, scheduler->busyVMs_length) {
+		if (scheduler->busyVMs[i] == task->duckVM) {
+			scheduler->busyVMs[i] = scheduler->busyVMs[--scheduler->busyVMs_length];
+			break;
+		}
+	}
+	(void) pthread_mutex_unlock(&scheduler->mutex);
+
+	/* The VM is free again, so the callback may submit another task for it. */
+	if (task->callback != dl_null) task->callback(task, e);
+
+	(void) pthread_mutex_lock(&scheduler->mutex);
+	if (--scheduler->pending == 0) (void) pthread_cond_broadcast(&scheduler->idle);
+	(void) pthread_mutex_unlock(&scheduler->mutex);
+}
+
+static void *duckScheduler_worker(void *argument) {
+	duckScheduler_worker_t *worker = argument;
+	duckScheduler_t *scheduler = worker->scheduler;
+
+	while (dl_true) {
+		dl_error_t e = dl_error_ok;
+		duckVM_halt_mode_t halt = duckVM_halt_mode_halt;
+		duckScheduler_task_t *task = duckScheduler_findTask(scheduler, worker);
+
+		if (task == dl_null) {
+			dl_bool_t stop = dl_false;
+			(void) pthread_mutex_lock(&scheduler->mutex);
+			while ((scheduler->queued == 0) && !scheduler->stopping) {
+				(void) pthread_cond_wait(&scheduler->workAvailable, &scheduler->mutex);
+			}
+			stop = (scheduler->queued == 0) && scheduler->stopping;
+			(void) pthread_mutex_unlock(&scheduler->mutex);
+			if (stop) break;
+			continue;
+		}
+
+		if (task->started) {
+			e = duckVM_resume(task->duckVM, scheduler->budget, &halt);
+		}
+		else {
+			task->started = dl_true;
+			if (task->program != dl_null) {
+				e = duckVM_executeProgram(task->duckVM, task->program, scheduler->budget, &halt);
+			}
+			else {
+				e = duckVM_executeBudgeted(task->duckVM,
+				                           task->bytecode,
+				                           task->bytecode_length,
+				                           scheduler->budget,
+				                           &halt);
+			}
+		}
+
+		if (!e && (halt == duckVM_halt_mode_suspend)) {
+			/* Out of budget. Let everything else in this deque run first. */
+			(void) pthread_mutex_lock(&scheduler->mutex);
+			scheduler->queued++;
+			(void) pthread_mutex_unlock(&scheduler->mutex);
+			duckScheduler_deque_pushTop(&worker->deque, scheduler->maxTasks, task);
+			(void) pthread_cond_signal(&scheduler->workAvailable);
+			continue;
+		}
+
+		duckScheduler_complete(scheduler, task, e);
+	}
+
+	return NULL;
+}
+
+
+/* Scheduler */
+
+dl_error_t duckScheduler_init(duckScheduler_t *scheduler,
+                              dl_memoryAllocation_t *memoryAllocation,
+                              const dl_size_t workers_length,
+                              const dl_size_t maxTasks,
+                              const dl_size_t budget) {
+	dl_error_t e = dl_error_ok;
+
+	dl_size_t dequesInitialized = 0;
+	dl_size_t threadsStarted = 0;
+	dl_bool_t mutexInitialized = dl_false;
+	dl_bool_t workAvailableInitialized = dl_false;
+	dl_bool_t idleInitialized = dl_false;
+
+	scheduler->memoryAllocation = memoryAllocation;
+	scheduler->workers = dl_null;
+	scheduler->workers_length = workers_length;
+	scheduler->maxTasks = maxTasks;
+	scheduler->budget = budget;
+	scheduler->queued = 0;
+	scheduler->pending = 0;
+	scheduler->busyVMs = dl_null;
+	scheduler->busyVMs_length = 0;
+	scheduler->nextWorker = 0;
+	scheduler->stopping = dl_false;
+
+	if ((workers_length == 0) || (maxTasks == 0) || (budget == 0)) {
+		e = dl_error_invalidValue;
+		goto cleanup;
+	}
+
+	if (pthread_mutex_init(&scheduler->mutex, NULL)) {
+		e = dl_error_invalidValue;
+		goto cleanup;
+	}
+	mutexInitialized = dl_true;
+	if (pthread_cond_init(&scheduler->workAvailable, NULL)) {
+		e = dl_error_invalidValue;
+		goto cleanup;
+	}
+	workAvailableInitialized = dl_true;
+	if (pthread_cond_init(&scheduler->idle, NULL)) {
+		e = dl_error_invalidValue;
+		goto cleanup;
+	}
+	idleInitialized = dl_true;
+
+	e = DL_MALLOC(memoryAllocation, &scheduler->busyVMs, maxTasks, duckVM_t *);
+	if (e) goto cleanup;
+	e = DL_MALLOC(memoryAllocation, &scheduler->workers, workers_length, duckScheduler_worker_t);
+	if (e) goto cleanup;
+
+	for (; dequesInitialized < workers_length; dequesInitialized++) {
+		duckScheduler_worker_t *worker = &scheduler->workers[dequesInitialized];
+		worker->scheduler = scheduler;
+		worker->index = dequesInitialized;
+		e = duckScheduler_deque_init(&worker->deque, memoryAllocation, maxTasks);
+		if (e) goto cleanup;
+	}
+
+	/* Workers are started last so that they never see a partially initialized scheduler. */
+	for (; threadsStarted < workers_length; threadsStarted++) {
+		duckScheduler_worker_t *worker = &scheduler->workers[threadsStarted];
+		if (pthread_create(&worker->thread, NULL, duckScheduler_worker, worker)) {
+			e = dl_error_invalidValue;
+			goto cleanup;
+		}
+	}
+
+ cleanup:
+	if (e) {
+		if (threadsStarted > 0) {
+			(void) pthread_mutex_lock(&scheduler->mutex);
+			scheduler->stopping = dl_true;
+			(void) pthread_cond_broadcast(&scheduler->workAvailable);
+			(void) pthread_mutex_unlock(&scheduler->mutex);
+			DL_DOTIMES(i, threadsStarted) {
+				(void) pthread_join(scheduler->workers[i].thread, NULL);
+			}
+		}
+		DL_DOTIMES(i, dequesInitialized) {
+			duckScheduler_deque_quit(&scheduler->workers[i].deque, memoryAllocation);
+		}
+		if (scheduler->workers != dl_null) (void) DL_FREE(memoryAllocation, &scheduler->workers);
+		if (scheduler->busyVMs != dl_null) (void) DL_FREE(memoryAllocation, &scheduler->busyVMs);
+		if (idleInitialized) (void) pthread_cond_destroy(&scheduler->idle);
+		if (workAvailableInitialized) (void) pthread_cond_destroy(&scheduler->workAvailable);
+		if (mutexInitialized) (void) pthread_mutex_destroy(&scheduler->mutex);
+	}
+	return e;
+}
+
+void duckScheduler_quit(duckScheduler_t *scheduler) {
+	duckScheduler_wait(scheduler);
+
+	(void) pthread_mutex_lock(&scheduler->mutex);
+	scheduler->stopping = dl_true;
+	(void) pthread_cond_broadcast(&scheduler->workAvailable);
+	(void) pthread_mutex_unlock(&scheduler->mutex);
+
+	DL_DOTIMES(i, scheduler->workers_length) {
+		(void) pthread_join(scheduler->workers[i].thread, NULL);
+	}
+	DL_DOTIMES(i, scheduler->workers_length) {
+		duckScheduler_deque_quit(&scheduler->workers[i].deque, scheduler->memoryAllocation);
+	}
+	(void) DL_FREE(scheduler->memoryAllocation, &scheduler->workers);
+	(void) DL_FREE(scheduler->memoryAllocation, &scheduler->busyVMs);
+	(void) pthread_cond_destroy(&scheduler->idle);
+	(void) pthread_cond_destroy(&scheduler->workAvailable);
+	(void) pthread_mutex_destroy(&scheduler->mutex);
+	scheduler->workers_length = 0;
+}
+
+dl_error_t duckScheduler_submit(duckScheduler_t *scheduler, duckScheduler_task_t *task) {
+	dl_error_t e = dl_error_ok;
+	duckScheduler_worker_t *worker = dl_null;
+
+	(void) pthread_mutex_lock(&scheduler->mutex);
+	DL_DOTIMES(i, scheduler->busyVMs_length) {
+		if (scheduler->busyVMs[i] == task->duckVM) {
+			e = dl_error_invalidValue;
+			break;
+		}
+	}
+	if (!e && (scheduler->busyVMs_length >= scheduler->maxTasks)) e = dl_error_bufferOverflow;
+	if (!e) {
+		scheduler->busyVMs[scheduler->busyVMs_length++] = task->duckVM;
+		scheduler->pending++;
+		scheduler->queued++;
+		worker = &scheduler->workers[scheduler->nextWorker];
+		scheduler->nextWorker = (scheduler->nextWorker + 1) % scheduler->workers_length;
+	}
+	(void) pthread_mutex_unlock(&scheduler->mutex);
+	if (e) return e;
+
+	task->started = dl_false;
+	duckScheduler_deque_pushBottom(&worker->deque, scheduler->maxTasks, task);
+	(void) pthread_cond_signal(&scheduler->workAvailable);
+	return e;
+}
+
+void duckScheduler_wait(duckScheduler_t *scheduler) {
+	(void) pthread_mutex_lock(&scheduler->mutex);
+	while (scheduler->pending > 0) {
+		(void) pthread_cond_wait(&scheduler->idle, &scheduler->mutex);
+	}
+	(void) pthread_mutex_unlock(&scheduler->mutex);
+}
+
+static void duckScheduler_mailbox_lock(void *lockData) {
+	(void) pthread_mutex_lock(lockData);
+}
+
+static void duckScheduler_mailbox_unlock(void *lockData) {
+	(void) pthread_mutex_unlock(lockData);
+}
+
+dl_error_t duckScheduler_mailbox_init(duckVM_mailbox_t *mailbox, dl_memoryAllocation_t *memoryAllocation) {
+	dl_error_t e = dl_error_ok;
+	pthread_mutex_t *mutex = dl_null;
+
+	/**/ duckVM_mailbox_init(mailbox, memoryAllocation);
+	e = DL_MALLOC(memoryAllocation, &mutex, 1, pthread_mutex_t);
+	if (e) return e;
+	if (pthread_mutex_init(mutex, dl_null)) {
+		(void) DL_FREE(memoryAllocation, &mutex);
+		return dl_error_invalidValue;
+	}
+	mailbox->lock = duckScheduler_mailbox_lock;
+	mailbox->unlock = duckScheduler_mailbox_unlock;
+	mailbox->lockData = mutex;
+	return e;
+}
+
+dl_error_t duckScheduler_mailbox_quit(duckVM_mailbox_t *mailbox) {
+	dl_error_t e = dl_error_ok;
+	pthread_mutex_t *mutex = mailbox->lockData;
+	e = duckVM_mailbox_quit(mailbox);
+	if (mutex != dl_null) {
+		(void) pthread_mutex_destroy(mutex);
+		dl_error_t eError = DL_FREE(mailbox->memoryAllocation, &mutex);
+		if (eError) e = eError;
+	}
+	mailbox->lock = dl_null;
+	mailbox->unlock = dl_null;
+	mailbox->lockData = dl_null;
+	return e;
+}
+
+/* Map pools */
+
+static void *duckScheduler_mapWorker(void *argument) {
+	duckScheduler_mapWorker_t *worker = argument;
+	duckScheduler_mapPool_t *pool = worker->pool;
+
+	while (dl_true) {
+		duckVM_mapChunk_t *chunk = dl_null;
+
+		(void) pthread_mutex_lock(&pool->mutex);
+		while (!pool->stopping && (worker->chunk == dl_null)) {
+			(void) pthread_cond_wait(&pool->workAvailable, &pool->mutex);
+		}
+		chunk = worker->chunk;
+		(void) pthread_mutex_unlock(&pool->mutex);
+		if (chunk == dl_null) break;
+
+		/* The error is stored in the chunk. */
+		(void) duckVM_mapChunk(&worker->duckVM, &pool->mapPool, chunk);
+
+		(void) pthread_mutex_lock(&pool->mutex);
+		worker->chunk = dl_null;
+		if (--pool->remaining == 0) (void) pthread_cond_signal(&pool->done);
+		(void) pthread_mutex_unlock(&pool->mutex);
+	}
+
+	return NULL;
+}
+
+/* Hand one chunk to each worker and wait for all of them. */
+static dl_error_t duckScheduler_mapPool_run(void *data, duckVM_mapChunk_t *chunks, dl_size_t chunks_length) {
+	duckScheduler_mapPool_t *pool = data;
+
+	if (chunks_length > pool->workers_length) return dl_error_invalidValue;
+
+	(void) pthread_mutex_lock(&pool->callMutex);
+	(void) pthread_mutex_lock(&pool->mutex);
+	DL_DOTIMES(i, chunks_length) {
+		pool->workers[i].chunk = &chunks[i];
+	}
+	pool->remaining = chunks_length;
+	(void) pthread_cond_broadcast(&pool->workAvailable);
+	while (pool->remaining > 0) {
+		(void) pthread_cond_wait(&pool->done, &pool->mutex);
+	}
+	(void) pthread_mutex_unlock(&pool->mutex);
+	(void) pthread_mutex_unlock(&pool->callMutex);
+
+	return dl_error_ok;
+}
+
+dl_error_t duckScheduler_mapPool_init(duckScheduler_mapPool_t *pool,
+                                      dl_memoryAllocation_t *memoryAllocation,
+                                      const dl_size_t workers_length,
+                                      const dl_size_t maxObjects) {
+	dl_error_t e = dl_error_ok;
+
+	dl_size_t vmsInitialized = 0;
+	dl_size_t threadsStarted = 0;
+	dl_bool_t callMutexInitialized = dl_false;
+	dl_bool_t mutexInitialized = dl_false;
+	dl_bool_t workAvailableInitialized = dl_false;
+	dl_bool_t doneInitialized = dl_false;
+
+	pool->memoryAllocation = memoryAllocation;
+	pool->workers = dl_null;
+	pool->workers_length = workers_length;
+	pool->remaining = 0;
+	pool->stopping = dl_false;
+	pool->mapPool.run = duckScheduler_mapPool_run;
+	pool->mapPool.data = pool;
+	pool->mapPool.workers = workers_length;
+	pool->mapPool.memoryAllocation = memoryAllocation;
+
+	if (workers_length == 0) {
+		e = dl_error_invalidValue;
+		goto cleanup;
+	}
+
+	if (pthread_mutex_init(&pool->callMutex, NULL)) {
+		e = dl_error_invalidValue;
+		goto cleanup;
+	}
+	callMutexInitialized = dl_true;
+	if (pthread_mutex_init(&pool->mutex, NULL)) {
+		e = dl_error_invalidValue;
+		goto cleanup;
+	}
+	mutexInitialized = dl_true;
+	if (pthread_cond_init(&pool->workAvailable, NULL)) {
+		e = dl_error_invalidValue;
+		goto cleanup;
+	}
+	workAvailableInitialized = dl_true;
+	if (pthread_cond_init(&pool->done, NULL)) {
+		e = dl_error_invalidValue;
+		goto cleanup;
+	}
+	doneInitialized = dl_true;
+
+	e = DL_MALLOC(memoryAllocation, &pool->workers, workers_length, duckScheduler_mapWorker_t);
+	if (e) goto cleanup;
+
+	for (; vmsInitialized < workers_length; vmsInitialized++) {
+		duckScheduler_mapWorker_t *worker = &pool->workers[vmsInitialized];
+		worker->pool = pool;
+		worker->chunk = dl_null;
+		e = duckVM_init(&worker->duckVM, memoryAllocation, maxObjects);
+		if (e) goto cleanup;
+	}
+
+	for (; threadsStarted < workers_length; threadsStarted++) {
+		duckScheduler_mapWorker_t *worker = &pool->workers[threadsStarted];
+		if (pthread_create(&worker->thread, NULL, duckScheduler_mapWorker, worker)) {
+			e = dl_error_invalidValue;
+			goto cleanup;
+		}
+	}
+
+ cleanup:
+	if (e) {
+		if (threadsStarted > 0) {
+			(void) pthread_mutex_lock(&pool->mutex);
+			pool->stopping = dl_true;
+			(void) pthread_cond_broadcast(&pool->workAvailable);
+			(void) pthread_mutex_unlock(&pool->mutex);
+			DL_DOTIMES(i, threadsStarted) {
+				(void) pthread_join(pool->workers[i].thread, NULL);
+			}
+		}
+		DL_DOTIMES(i, vmsInitialized) {
+			duckVM_quit(&pool->workers[i].duckVM);
+		}
+		if (pool->workers != dl_null) (void) DL_FREE(memoryAllocation, &pool->workers);
+		if (doneInitialized) (void) pthread_cond_destroy(&pool->done);
+		if (workAvailableInitialized) (void) pthread_cond_destroy(&pool->workAvailable);
+		if (mutexInitialized) (void) pthread_mutex_destroy(&pool->mutex);
+		if (callMutexInitialized) (void) pthread_mutex_destroy(&pool->callMutex);
+	}
+	return e;
+}
+
+void duckScheduler_mapPool_quit(duckScheduler_mapPool_t *pool) {
+	(void) pthread_mutex_lock(&pool->mutex);
+	pool->stopping = dl_true;
+	(void) pthread_cond_broadcast(&pool->workAvailable);
+	(void) pthread_mutex_unlock(&pool->mutex);
+
+	DL_DOTIMES(i, pool->workers_length) {
+		(void) pthread_join(pool->workers[i].thread, NULL);
+	}
+	DL_DOTIMES(i, pool->workers_length) {
+		duckVM_quit(&pool->workers[i].duckVM);
+	}
+	(void) DL_FREE(pool->memoryAllocation, &pool->workers);
+	(void) pthread_cond_destroy(&pool->done);
+	(void) pthread_cond_destroy(&pool->workAvailable);
+	(void) pthread_mutex_destroy(&pool->mutex);
+	(void) pthread_mutex_destroy(&pool->callMutex);
+	pool->workers_length = 0;
+}
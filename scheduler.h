@@ -0,0 +1,162 @@
+/*
+MIT License
+
+Copyright (c) 2023 Joseph Herguth
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* Runs many independent VMs on a pool of worker threads. Unlike the rest of the library this requires POSIX threads,
+   so it is only built with `USE_SCHEDULER`.
+
+   Each worker owns a queue of tasks. It takes the newest task from its own queue and steals the oldest task from
+   another worker's queue when its own is empty. A task runs for a fixed instruction budget at a time, then goes to the
+   back of the worker's queue so that long-running scripts can't starve short ones. A task that is waiting for a message
+   is requeued the same way, so it retries its `receive` each time it comes back around.
+
+   Map pools are separate from the scheduler. They keep their own worker VMs and threads, since the VM that calls
+   `parallel-map` blocks its thread until every chunk is done. */
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <pthread.h>
+#include "duckVM.h"
+
+struct duckScheduler_s;
+
+typedef struct duckScheduler_task_s {
+	duckVM_t *duckVM;
+	/* If set, the program is run instead of `bytecode`. Any number of tasks may share one program. */
+	duckVM_program_t *program;
+	dl_uint8_t *bytecode;
+	dl_size_t bytecode_length;
+	/* Called on a worker thread once the program halts or fails. `e` is the error returned by the VM. The task and the
+	   VM belong to the caller again when this is called. May be `dl_null`. */
+	void (*callback)(struct duckScheduler_task_s *task, dl_error_t e);
+	void *userData;
+	/* Private. Set by the scheduler. */
+	dl_bool_t started;
+} duckScheduler_task_t;
+
+/* Double-ended queue of tasks. The owning worker works at the bottom and thieves take from the top. */
+typedef struct {
+	duckScheduler_task_t **tasks;
+	dl_size_t top;
+	dl_size_t length;
+	pthread_mutex_t mutex;
+} duckScheduler_deque_t;
+
+typedef struct {
+	struct duckScheduler_s *scheduler;
+	dl_size_t index;
+	pthread_t thread;
+	duckScheduler_deque_t deque;
+} duckScheduler_worker_t;
+
+typedef struct duckScheduler_s {
+	dl_memoryAllocation_t *memoryAllocation;
+	duckScheduler_worker_t *workers;
+	dl_size_t workers_length;
+	/* Maximum number of tasks that may be submitted and not yet completed. */
+	dl_size_t maxTasks;
+	/* Instructions a task may run before it has to give up its worker. */
+	dl_size_t budget;
+
+	/* Everything below is protected by `mutex`. */
+	pthread_mutex_t mutex;
+	/* Signaled when a task is queued or the scheduler is shutting down. */
+	pthread_cond_t workAvailable;
+	/* Signaled when the last pending task completes. */
+	pthread_cond_t idle;
+	/* Tasks waiting in a deque. */
+	dl_size_t queued;
+	/* Tasks submitted whose callbacks haven't returned. */
+	dl_size_t pending;
+	/* VMs with a submitted task that hasn't completed. A VM can only appear once, so it never runs on two threads at
+	   the same time. */
+	duckVM_t **busyVMs;
+	dl_size_t busyVMs_length;
+	dl_size_t nextWorker;
+	dl_bool_t stopping;
+} duckScheduler_t;
+
+struct duckScheduler_mapPool_s;
+
+/* A VM that runs `parallel-map` chunks on its own thread. */
+typedef struct {
+	struct duckScheduler_mapPool_s *pool;
+	pthread_t thread;
+	/* Workers start with no globals. C functions the mapped functions need can be linked into this VM after
+	   `duckScheduler_mapPool_init`. */
+	duckVM_t duckVM;
+	/* The chunk to run next, or `dl_null`. Protected by the pool's `mutex`. */
+	duckVM_mapChunk_t *chunk;
+} duckScheduler_mapWorker_t;
+
+/* A fixed set of worker VMs that any number of VMs can share for `parallel-map` by linking `mapPool` with
+   `duckVM_linkMapPool`. One `parallel-map` runs on the pool at a time. Don't link the pool into its own workers, since a
+   nested `parallel-map` would wait on itself. */
+typedef struct duckScheduler_mapPool_s {
+	duckVM_mapPool_t mapPool;
+	dl_memoryAllocation_t *memoryAllocation;
+	duckScheduler_mapWorker_t *workers;
+	dl_size_t workers_length;
+	/* Held for the whole of a `parallel-map`. */
+	pthread_mutex_t callMutex;
+
+	/* Everything below is protected by `mutex`. */
+	pthread_mutex_t mutex;
+	/* Signaled when chunks are handed out or the pool is shutting down. */
+	pthread_cond_t workAvailable;
+	/* Signaled when the last chunk of a call is done. */
+	pthread_cond_t done;
+	/* Chunks of the current call that haven't finished. */
+	dl_size_t remaining;
+	dl_bool_t stopping;
+} duckScheduler_mapPool_t;
+
+/* Start `workers_length` worker threads. */
+dl_error_t duckScheduler_init(duckScheduler_t *scheduler,
+                              dl_memoryAllocation_t *memoryAllocation,
+                              const dl_size_t workers_length,
+                              const dl_size_t maxTasks,
+                              const dl_size_t budget);
+/* Wait for all submitted tasks to complete, then stop the workers and free the scheduler. */
+void duckScheduler_quit(duckScheduler_t *scheduler);
+/* Queue `task` to execute its bytecode in its VM. The VM and the bytecode must not be touched until the task's callback
+   has been called. Fails with `dl_error_invalidValue` if the VM already has a pending task and with
+   `dl_error_bufferOverflow` if `maxTasks` tasks are pending. */
+dl_error_t duckScheduler_submit(duckScheduler_t *scheduler, duckScheduler_task_t *task);
+/* Block until every submitted task has completed. */
+void duckScheduler_wait(duckScheduler_t *scheduler);
+/* Initialize a mailbox that VMs on different workers can share. `memoryAllocation` must be thread-safe. */
+dl_error_t duckScheduler_mailbox_init(duckVM_mailbox_t *mailbox, dl_memoryAllocation_t *memoryAllocation);
+/* Free the mailbox's messages and its lock. No task linked to it may be running. */
+dl_error_t duckScheduler_mailbox_quit(duckVM_mailbox_t *mailbox);
+/* Start `workers_length` worker VMs, each with a heap of `maxObjects` objects and a thread of its own.
+   `memoryAllocation` is used by every worker and for the chunks, so it must be thread-safe. */
+dl_error_t duckScheduler_mapPool_init(duckScheduler_mapPool_t *pool,
+                                      dl_memoryAllocation_t *memoryAllocation,
+                                      const dl_size_t workers_length,
+                                      const dl_size_t maxObjects);
+/* Stop the workers and free their VMs. No VM may be using the pool. */
+void duckScheduler_mapPool_quit(duckScheduler_mapPool_t *pool);
+
+#endif /* SCHEDULER_H */
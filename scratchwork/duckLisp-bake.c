@@ -0,0 +1,1137 @@
+/*
+MIT License
+
+Copyright (c) 2023 Joseph Herguth
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* Compile a script ahead of time and translate it to C. The generated file is linked into the program that ships the
+   script, which then runs it without ever starting the compiler:
+
+   duckVM_linkJit(&duckVM, &NAME_jit);
+   e = duckVM_execute(&duckVM, NAME_bytecode, NAME_bytecode_length);
+
+   Each closure becomes one C function with straight-line code per instruction. Jumps become `goto`s, stack operands
+   become fixed offsets from the top of the stack, and globals are looked up once and then read by index. The functions
+   are handed to the VM through its JIT interface, so the VM calls them where it would have entered the closure or
+   looped. Instructions that aren't translated, and translated instructions whose operands have unexpected types,
+   return to the interpreter, which then continues from that instruction. The bytecode is still embedded so that the
+   interpreter has something to continue with.
+
+   Usage: duckLisp-bake [-i] <name> <input file> <output file> [callback[:type] ...]
+
+   `-i` enables parenthesis inference. Every C callback the script calls must be listed so that the compiler can
+   resolve it. The type is the parenthesis inference type of the callback, and is ignored if inference is disabled. */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "../duckLisp.h"
+#include "../duckVM.h"
+#include "DuckLib/array.h"
+#include "DuckLib/core.h"
+#include "DuckLib/memory.h"
+
+
+/* Callbacks are only linked so that the compiler knows their names. They can't be run at compile time. */
+static dl_error_t duckLispBake_callback_unavailable(duckVM_t *duckVM) {
+	dl_error_t e = dl_error_invalidValue;
+	dl_error_t eError = duckVM_error_pushRuntime(duckVM,
+	                                             DL_STR("duckLisp-bake: C callbacks can't be called at compile time."));
+	if (eError) e = eError;
+	return e;
+}
+
+static void duckLispBake_printErrors(dl_array_t errors) {
+	DL_DOTIMES(i, errors.elements_length) {
+		putc(DL_ARRAY_GETADDRESS(errors, char, i), stderr);
+	}
+	putc('\n', stderr);
+}
+
+static dl_error_t duckLispBake_readFile(dl_array_t *text, const char *fileName) {
+	dl_error_t e = dl_error_ok;
+
+	FILE *file = fopen(fileName, "rb");
+	if (file == NULL) {
+		perror("duckLisp-bake: Could not open input file");
+		e = dl_error_invalidValue;
+		goto cleanup;
+	}
+
+	while (1) {
+		int c = fgetc(file);
+		if (c == EOF) break;
+		char character = (char) c;
+		e = dl_array_pushElement(text, &character);
+		if (e) goto cleanup;
+	}
+	if (ferror(file)) {
+		perror("duckLisp-bake: Could not read input file");
+		e = dl_error_invalidValue;
+		goto cleanup;
+	}
+
+ cleanup:
+	if (file != NULL) (void) fclose(file);
+	return e;
+}
+
+/* Write a symbol name as a C string literal. Anything that isn't plain printable ASCII is escaped. */
+static void duckLispBake_writeString(FILE *file, const dl_uint8_t *string, const dl_size_t string_length) {
+	putc('"', file);
+	DL_DOTIMES(i, string_length) {
+		dl_uint8_t c = string[i];
+		if ((c == '"') || (c == '\\') || (c == '?')) {
+			fprintf(file, "\\%c", c);
+		}
+		else if ((c < 0x20) || (c >= 0x7F)) {
+			/* Octal escapes are at most three digits, so they can't swallow the next character. */
+			fprintf(file, "\\%03o", c);
+		}
+		else {
+			putc(c, file);
+		}
+	}
+	putc('"', file);
+}
+
+/* Translation */
+
+typedef enum {
+	/* Not translated. The interpreter runs it. */
+	duckLispBake_kind_interpret,
+	duckLispBake_kind_nop,
+	duckLispBake_kind_pushInteger,
+	duckLispBake_kind_pushBoolean,
+	duckLispBake_kind_nil,
+	duckLispBake_kind_pushIndex,
+	duckLispBake_kind_pushGlobal,
+	duckLispBake_kind_move,
+	duckLispBake_kind_pop,
+	duckLispBake_kind_add,
+	duckLispBake_kind_sub,
+	duckLispBake_kind_mul,
+	duckLispBake_kind_less,
+	duckLispBake_kind_greater,
+	duckLispBake_kind_jump,
+	duckLispBake_kind_brnz,
+} duckLispBake_kind_t;
+
+typedef struct {
+	duckLispBake_kind_t kind;
+	dl_size_t length;
+	/* Stack operands, the pop count, a constant, or a global's key. */
+	dl_ptrdiff_t operand1;
+	dl_ptrdiff_t operand2;
+	/* Branch target, or the first instruction of the closure this instruction creates. */
+	dl_ptrdiff_t target;
+	/* Set for instructions that can be followed by the next one. */
+	dl_bool_t fallsThrough;
+	/* Set for branches that the VM enters native code at. */
+	dl_bool_t backward;
+	/* Cache slot of the global, for `pushGlobal`. */
+	dl_size_t global;
+	/* The closure that owns this instruction, or -1. */
+	dl_ptrdiff_t closure;
+	/* Set if the generated code needs a label here. */
+	dl_bool_t label;
+	dl_bool_t entry;
+	/* Set if native code can reach this instruction. */
+	dl_bool_t reached;
+} duckLispBake_instruction_t;
+
+typedef struct {
+	/* Indexed by offset. Only offsets that start an instruction are used. */
+	duckLispBake_instruction_t *instructions;
+	dl_bool_t *starts;
+	dl_size_t bytecode_length;
+	/* Offsets of the first instruction of each closure, in increasing order. The script itself is the first one. */
+	dl_array_t closures;  /* dl_size_t */
+	dl_size_t globals_length;
+	/* Set if any global is read by native code. */
+	dl_bool_t globals_used;
+	dl_size_t entries_length;
+} duckLispBake_translation_t;
+
+static dl_size_t duckLispBake_read(const dl_uint8_t *bytecode, const dl_size_t offset, const dl_size_t width) {
+	dl_size_t value = 0;
+	DL_DOTIMES(i, width) {
+		value = (value << 8) | bytecode[offset + i];
+	}
+	return value;
+}
+
+static dl_ptrdiff_t duckLispBake_signExtend(const dl_size_t value, const dl_size_t width) {
+	const dl_size_t sign = (dl_size_t) 1 << (8 * width - 1);
+	return (dl_ptrdiff_t) ((value & sign) ? (value | ~((sign << 1) - 1)) : value);
+}
+
+/* Decode what the translator needs to know about the instruction at `offset`. The length has already been set. */
+static void duckLispBake_decode(duckLispBake_instruction_t *instruction,
+                                const dl_uint8_t *bytecode,
+                                const dl_size_t offset) {
+	const dl_size_t opcode = bytecode[offset];
+	dl_size_t width = 1;
+	dl_size_t operands = 0;
+
+	instruction->kind = duckLispBake_kind_interpret;
+	instruction->fallsThrough = dl_true;
+
+	switch (opcode) {
+	case duckLisp_instruction_nop:
+		instruction->kind = duckLispBake_kind_nop;
+		break;
+	case duckLisp_instruction_pushBooleanFalse:
+	case duckLisp_instruction_pushBooleanTrue:
+		instruction->kind = duckLispBake_kind_pushBoolean;
+		instruction->operand1 = opcode == duckLisp_instruction_pushBooleanTrue;
+		break;
+	case duckLisp_instruction_nil:
+		instruction->kind = duckLispBake_kind_nil;
+		break;
+	case duckLisp_instruction_pushInteger8:
+	case duckLisp_instruction_pushInteger16:
+	case duckLisp_instruction_pushInteger32:
+		width = (dl_size_t) 1 << (opcode - duckLisp_instruction_pushInteger8);
+		instruction->kind = duckLispBake_kind_pushInteger;
+		instruction->operand1 = duckLispBake_signExtend(duckLispBake_read(bytecode, offset + 1, width), width);
+		break;
+	case duckLisp_instruction_pushIndex8:
+	case duckLisp_instruction_pushIndex16:
+	case duckLisp_instruction_pushIndex32:
+		instruction->kind = duckLispBake_kind_pushIndex;
+		width = (dl_size_t) 1 << (opcode - duckLisp_instruction_pushIndex8);
+		operands = 1;
+		break;
+	case duckLisp_instruction_pushGlobal8:
+	case duckLisp_instruction_pushGlobal16:
+	case duckLisp_instruction_pushGlobal32:
+		width = (dl_size_t) 1 << (opcode - duckLisp_instruction_pushGlobal8);
+		instruction->kind = duckLispBake_kind_pushGlobal;
+		instruction->operand1 = duckLispBake_read(bytecode, offset + 1, width);
+		break;
+	case duckLisp_instruction_move8:
+	case duckLisp_instruction_move16:
+	case duckLisp_instruction_move32:
+		instruction->kind = duckLispBake_kind_move;
+		width = (dl_size_t) 1 << (opcode - duckLisp_instruction_move8);
+		operands = 2;
+		break;
+	case duckLisp_instruction_pop8:
+	case duckLisp_instruction_pop16:
+	case duckLisp_instruction_pop32:
+		width = (dl_size_t) 1 << (opcode - duckLisp_instruction_pop8);
+		instruction->kind = duckLispBake_kind_pop;
+		instruction->operand1 = duckLispBake_read(bytecode, offset + 1, width);
+		break;
+	case duckLisp_instruction_add8:
+	case duckLisp_instruction_add16:
+	case duckLisp_instruction_add32:
+		instruction->kind = duckLispBake_kind_add;
+		width = (dl_size_t) 1 << (opcode - duckLisp_instruction_add8);
+		operands = 2;
+		break;
+	case duckLisp_instruction_sub8:
+	case duckLisp_instruction_sub16:
+	case duckLisp_instruction_sub32:
+		instruction->kind = duckLispBake_kind_sub;
+		width = (dl_size_t) 1 << (opcode - duckLisp_instruction_sub8);
+		operands = 2;
+		break;
+	case duckLisp_instruction_mul8:
+	case duckLisp_instruction_mul16:
+	case duckLisp_instruction_mul32:
+		instruction->kind = duckLispBake_kind_mul;
+		width = (dl_size_t) 1 << (opcode - duckLisp_instruction_mul8);
+		operands = 2;
+		break;
+	case duckLisp_instruction_less8:
+	case duckLisp_instruction_less16:
+	case duckLisp_instruction_less32:
+		instruction->kind = duckLispBake_kind_less;
+		width = (dl_size_t) 1 << (opcode - duckLisp_instruction_less8);
+		operands = 2;
+		break;
+	case duckLisp_instruction_greater8:
+	case duckLisp_instruction_greater16:
+	case duckLisp_instruction_greater32:
+		instruction->kind = duckLispBake_kind_greater;
+		width = (dl_size_t) 1 << (opcode - duckLisp_instruction_greater8);
+		operands = 2;
+		break;
+	case duckLisp_instruction_jump8:
+	case duckLisp_instruction_jump16:
+	case duckLisp_instruction_jump32:
+	case duckLisp_instruction_brnz8:
+	case duckLisp_instruction_brnz16:
+	case duckLisp_instruction_brnz32: {
+		const dl_bool_t brnz = opcode >= duckLisp_instruction_brnz8;
+		width = (dl_size_t) 1 << (opcode - (brnz ? duckLisp_instruction_brnz8 : duckLisp_instruction_jump8));
+		const dl_ptrdiff_t displacement = duckLispBake_signExtend(duckLispBake_read(bytecode, offset + 1, width), width);
+		/* Branches are relative to the end of the displacement, not the end of the instruction. */
+		instruction->target = offset + 1 + width + displacement;
+		instruction->backward = displacement < 0;
+		if (brnz) {
+			instruction->kind = duckLispBake_kind_brnz;
+			instruction->operand1 = bytecode[offset + 1 + width];
+		}
+		else {
+			instruction->kind = duckLispBake_kind_jump;
+			instruction->fallsThrough = dl_false;
+		}
+		break;
+	}
+	case duckLisp_instruction_pushClosure8:
+	case duckLisp_instruction_pushClosure16:
+	case duckLisp_instruction_pushClosure32:
+	case duckLisp_instruction_pushVaClosure8:
+	case duckLisp_instruction_pushVaClosure16:
+	case duckLisp_instruction_pushVaClosure32:
+		width = (dl_size_t) 1 << ((opcode - duckLisp_instruction_pushClosure8) % 3);
+		instruction->target = (offset + 1 + width
+		                       + duckLispBake_signExtend(duckLispBake_read(bytecode, offset + 1, width), width));
+		break;
+	case duckLisp_instruction_return0:
+	case duckLisp_instruction_return8:
+	case duckLisp_instruction_return16:
+	case duckLisp_instruction_return32:
+	case duckLisp_instruction_halt:
+		instruction->fallsThrough = dl_false;
+		break;
+	default:
+		break;
+	}
+
+	if (operands > 0) {
+		instruction->operand1 = duckLispBake_read(bytecode, offset + 1, width);
+		if (operands > 1) instruction->operand2 = duckLispBake_read(bytecode, offset + 1 + width, width);
+		/* Operands count down from the top of the stack starting at 1. The interpreter reports anything else. */
+		if ((instruction->operand1 < 1) || ((operands > 1) && (instruction->operand2 < 1))) {
+			instruction->kind = duckLispBake_kind_interpret;
+		}
+	}
+}
+
+/* Find every closure, the instructions that belong to each, and the instructions the VM can enter native code at.
+   Instructions belong to the first closure that reaches them, following control flow the way the interpreter would. */
+static dl_error_t duckLispBake_translation_init(duckLispBake_translation_t *translation,
+                                                dl_memoryAllocation_t *memoryAllocation,
+                                                const dl_uint8_t *bytecode,
+                                                const dl_size_t bytecode_length) {
+	dl_error_t e = dl_error_ok;
+	dl_error_t eError = dl_error_ok;
+
+	dl_array_t pending;  /* dl_size_t */
+	/**/ dl_array_init(&pending, memoryAllocation, sizeof(dl_size_t), dl_array_strategy_double);
+	/**/ dl_array_init(&translation->closures, memoryAllocation, sizeof(dl_size_t), dl_array_strategy_double);
+	translation->instructions = dl_null;
+	translation->starts = dl_null;
+	translation->bytecode_length = bytecode_length;
+	translation->globals_length = 0;
+	translation->globals_used = dl_false;
+	translation->entries_length = 0;
+
+	e = DL_MALLOC(memoryAllocation, &translation->instructions, bytecode_length, duckLispBake_instruction_t);
+	if (e) goto cleanup;
+	e = DL_MALLOC(memoryAllocation, &translation->starts, bytecode_length, dl_bool_t);
+	if (e) goto cleanup;
+	DL_DOTIMES(i, bytecode_length) {
+		translation->starts[i] = dl_false;
+	}
+
+	/* Decode every instruction. */
+	{
+		dl_size_t offset = 0;
+		dl_size_t closure = 0;
+		e = dl_array_pushElement(&translation->closures, &closure);
+		if (e) goto cleanup;
+		while (offset < bytecode_length) {
+			duckLispBake_instruction_t *instruction = &translation->instructions[offset];
+			instruction->operand1 = 0;
+			instruction->operand2 = 0;
+			instruction->target = -1;
+			instruction->backward = dl_false;
+			instruction->global = 0;
+			instruction->closure = -1;
+			instruction->label = dl_false;
+			instruction->entry = dl_false;
+			instruction->reached = dl_false;
+			e = duckLisp_instructionLength(bytecode, bytecode_length, offset, &instruction->length);
+			if (e) {
+				fprintf(stderr, "duckLisp-bake: Could not decode the instruction at offset %lu.\n", (unsigned long) offset);
+				goto cleanup;
+			}
+			/**/ duckLispBake_decode(instruction, bytecode, offset);
+			translation->starts[offset] = dl_true;
+			if (instruction->kind == duckLispBake_kind_pushGlobal) {
+				instruction->global = translation->globals_length++;
+			}
+			offset += instruction->length;
+		}
+	}
+
+	/* Closures. Branches and closures that point outside the bytecode are left to the interpreter to report. */
+	DL_DOTIMES(offset, bytecode_length) {
+		duckLispBake_instruction_t *instruction = &translation->instructions[offset];
+		if (!translation->starts[offset] || (instruction->target < 0)) continue;
+		if (((dl_size_t) instruction->target >= bytecode_length) || !translation->starts[instruction->target]) {
+			instruction->kind = duckLispBake_kind_interpret;
+			instruction->target = -1;
+			continue;
+		}
+		if ((instruction->kind == duckLispBake_kind_interpret) && (instruction->target != 0)) {
+			dl_size_t closure = instruction->target;
+			e = dl_array_pushElement(&translation->closures, &closure);
+			if (e) goto cleanup;
+		}
+	}
+	/* Closures are translated in bytecode order. Duplicates are skipped below. */
+	for (dl_size_t i = 1; i < translation->closures.elements_length; i++) {
+		for (dl_size_t j = i; (j > 0) && (DL_ARRAY_GETADDRESS(translation->closures, dl_size_t, j - 1)
+		                                  > DL_ARRAY_GETADDRESS(translation->closures, dl_size_t, j)); --j) {
+			const dl_size_t temp = DL_ARRAY_GETADDRESS(translation->closures, dl_size_t, j);
+			DL_ARRAY_GETADDRESS(translation->closures, dl_size_t, j) = DL_ARRAY_GETADDRESS(translation->closures,
+			                                                                                dl_size_t,
+			                                                                                j - 1);
+			DL_ARRAY_GETADDRESS(translation->closures, dl_size_t, j - 1) = temp;
+		}
+	}
+
+	/* Claim instructions for each closure. */
+	DL_DOTIMES(i, translation->closures.elements_length) {
+		dl_size_t closure = DL_ARRAY_GETADDRESS(translation->closures, dl_size_t, i);
+		if (translation->instructions[closure].closure >= 0) continue;
+		e = dl_array_pushElement(&pending, &closure);
+		if (e) goto cleanup;
+		while (pending.elements_length > 0) {
+			dl_size_t offset;
+			duckLispBake_instruction_t *instruction;
+			e = dl_array_popElement(&pending, &offset);
+			if (e) goto cleanup;
+			instruction = &translation->instructions[offset];
+			if (instruction->closure >= 0) continue;
+			instruction->closure = closure;
+			if (instruction->fallsThrough && (offset + instruction->length < bytecode_length)) {
+				dl_size_t next = offset + instruction->length;
+				e = dl_array_pushElement(&pending, &next);
+				if (e) goto cleanup;
+			}
+			if ((instruction->target >= 0)
+			    && ((instruction->kind == duckLispBake_kind_jump) || (instruction->kind == duckLispBake_kind_brnz))) {
+				dl_size_t target = instruction->target;
+				e = dl_array_pushElement(&pending, &target);
+				if (e) goto cleanup;
+			}
+		}
+		/* The VM enters native code at the start of a closure. */
+		if (translation->instructions[closure].kind != duckLispBake_kind_interpret) {
+			translation->instructions[closure].entry = dl_true;
+		}
+	}
+
+	/* The VM also enters native code where backward branches land. Branches into other closures are left to the
+	   interpreter, since they can't be `goto`s. */
+	DL_DOTIMES(offset, bytecode_length) {
+		duckLispBake_instruction_t *instruction = &translation->instructions[offset];
+		duckLispBake_instruction_t *target;
+		if (!translation->starts[offset] || (instruction->closure < 0)) continue;
+		if ((instruction->kind != duckLispBake_kind_jump) && (instruction->kind != duckLispBake_kind_brnz)) continue;
+		target = &translation->instructions[instruction->target];
+		if (target->closure != instruction->closure) {
+			instruction->kind = duckLispBake_kind_interpret;
+			continue;
+		}
+		if (instruction->backward && (target->kind != duckLispBake_kind_interpret)) target->entry = dl_true;
+	}
+
+	/* Only code reachable from an entry without passing through the interpreter is written out. */
+	DL_DOTIMES(offset, bytecode_length) {
+		if (!translation->starts[offset] || !translation->instructions[offset].entry) continue;
+		translation->instructions[offset].label = dl_true;
+		translation->entries_length++;
+		e = dl_array_pushElement(&pending, &offset);
+		if (e) goto cleanup;
+	}
+	while (pending.elements_length > 0) {
+		dl_size_t offset;
+		duckLispBake_instruction_t *instruction;
+		e = dl_array_popElement(&pending, &offset);
+		if (e) goto cleanup;
+		instruction = &translation->instructions[offset];
+		if (instruction->reached) continue;
+		instruction->reached = dl_true;
+		if (instruction->kind == duckLispBake_kind_interpret) continue;
+		if (instruction->kind == duckLispBake_kind_pushGlobal) translation->globals_used = dl_true;
+		if (instruction->fallsThrough
+		    && (offset + instruction->length < bytecode_length)
+		    && (translation->instructions[offset + instruction->length].closure == instruction->closure)) {
+			dl_size_t next = offset + instruction->length;
+			e = dl_array_pushElement(&pending, &next);
+			if (e) goto cleanup;
+		}
+		if ((instruction->kind == duckLispBake_kind_jump) || (instruction->kind == duckLispBake_kind_brnz)) {
+			dl_size_t target = instruction->target;
+			translation->instructions[target].label = dl_true;
+			e = dl_array_pushElement(&pending, &target);
+			if (e) goto cleanup;
+		}
+	}
+
+ cleanup:
+	eError = dl_array_quit(&pending);
+	if (eError) e = eError;
+	return e;
+}
+
+static dl_error_t duckLispBake_translation_quit(duckLispBake_translation_t *translation,
+                                                dl_memoryAllocation_t *memoryAllocation) {
+	dl_error_t e = dl_error_ok;
+	dl_error_t eError = dl_error_ok;
+	if (translation->instructions != dl_null) {
+		eError = DL_FREE(memoryAllocation, &translation->instructions);
+		if (eError) e = eError;
+	}
+	if (translation->starts != dl_null) {
+		eError = DL_FREE(memoryAllocation, &translation->starts);
+		if (eError) e = eError;
+	}
+	eError = dl_array_quit(&translation->closures);
+	if (eError) e = eError;
+	return e;
+}
+
+/* Return to the interpreter in front of the instruction if `condition` holds. */
+static void duckLispBake_writeExit(FILE *file, const char *condition, const dl_size_t offset) {
+	fprintf(file, "\tif (%s) {\n", condition);
+	fprintf(file, "\t\tnext = %lu;\n", (unsigned long) offset);
+	fprintf(file, "\t\tgoto leave;\n");
+	fprintf(file, "\t}\n");
+}
+
+static void duckLispBake_writePush(FILE *file) {
+	fprintf(file, "\t*upvalueTop++ = dl_null;\n");
+	fprintf(file, "\ttop++;\n");
+}
+
+/* Write the C code for an instruction. Instructions that aren't translated return to the interpreter. */
+static void duckLispBake_writeInstruction(FILE *file,
+                                          const char *name,
+                                          const duckLispBake_instruction_t *instruction,
+                                          const dl_size_t offset) {
+	char condition[512];
+	const dl_ptrdiff_t a = instruction->operand1;
+	const dl_ptrdiff_t b = instruction->operand2;
+	const dl_ptrdiff_t depth = (a > b) ? a : b;
+
+	switch (instruction->kind) {
+	case duckLispBake_kind_interpret:
+		fprintf(file, "\tnext = %lu;\n", (unsigned long) offset);
+		fprintf(file, "\tgoto leave;\n");
+		break;
+
+	case duckLispBake_kind_nop:
+		duckLispBake_writeExit(file, "left == 0", offset);
+		fprintf(file, "\t--left;\n");
+		break;
+
+	case duckLispBake_kind_pushInteger:
+	case duckLispBake_kind_pushBoolean:
+	case duckLispBake_kind_nil:
+		duckLispBake_writeExit(file, "(left == 0) || (top >= limit)", offset);
+		fprintf(file, "\t--left;\n");
+		if (instruction->kind == duckLispBake_kind_pushInteger) {
+			fprintf(file, "\ttop->type = duckVM_object_type_integer;\n");
+			fprintf(file, "\ttop->value.integer = %ld;\n", (long) a);
+		}
+		else if (instruction->kind == duckLispBake_kind_pushBoolean) {
+			fprintf(file, "\ttop->type = duckVM_object_type_bool;\n");
+			fprintf(file, "\ttop->value.boolean = %s;\n", a ? "dl_true" : "dl_false");
+		}
+		else {
+			fprintf(file, "\ttop->type = duckVM_object_type_list;\n");
+			fprintf(file, "\ttop->value.list = dl_null;\n");
+		}
+		/**/ duckLispBake_writePush(file);
+		break;
+
+	case duckLispBake_kind_pushIndex:
+		(void) snprintf(condition, sizeof(condition), "(left == 0) || (top - base < %ld) || (top >= limit)", (long) a);
+		duckLispBake_writeExit(file, condition, offset);
+		fprintf(file, "\t--left;\n");
+		fprintf(file, "\t*top = top[-%ld];\n", (long) a);
+		/**/ duckLispBake_writePush(file);
+		break;
+
+	case duckLispBake_kind_pushGlobal:
+		/* Globals are looked up by key once per VM. After that they're read by index. */
+		(void) snprintf(condition,
+		                sizeof(condition),
+		                "(left == 0) || (top >= limit) || !%s_global(duckVM, &native->globals[%lu], %ld)",
+		                name,
+		                (unsigned long) instruction->global,
+		                (long) a);
+		duckLispBake_writeExit(file, condition, offset);
+		fprintf(file, "\t--left;\n");
+		fprintf(file,
+		        "\t*top = *DL_ARRAY_GETADDRESS(duckVM->globals, duckVM_object_t *, native->globals[%lu]);\n",
+		        (unsigned long) instruction->global);
+		/**/ duckLispBake_writePush(file);
+		break;
+
+	case duckLispBake_kind_move:
+		(void) snprintf(condition, sizeof(condition), "(left == 0) || (top - base < %ld)", (long) depth);
+		duckLispBake_writeExit(file, condition, offset);
+		fprintf(file, "\t--left;\n");
+		fprintf(file, "\ttop[-%ld] = top[-%ld];\n", (long) b, (long) a);
+		break;
+
+	case duckLispBake_kind_pop:
+		(void) snprintf(condition, sizeof(condition), "(left == 0) || (top - bottom < %ld)", (long) a);
+		duckLispBake_writeExit(file, condition, offset);
+		fprintf(file, "\t--left;\n");
+		fprintf(file, "\ttop -= %ld;\n", (long) a);
+		fprintf(file, "\tupvalueTop -= %ld;\n", (long) a);
+		break;
+
+	case duckLispBake_kind_add:
+	case duckLispBake_kind_sub:
+	case duckLispBake_kind_mul:
+	case duckLispBake_kind_less:
+	case duckLispBake_kind_greater: {
+		const char *operator = ((instruction->kind == duckLispBake_kind_add)
+		                        ? "+"
+		                        : (instruction->kind == duckLispBake_kind_sub)
+		                        ? "-"
+		                        : (instruction->kind == duckLispBake_kind_mul)
+		                        ? "*"
+		                        : (instruction->kind == duckLispBake_kind_less)
+		                        ? "<"
+		                        : ">");
+		const dl_bool_t comparison = ((instruction->kind == duckLispBake_kind_less)
+		                              || (instruction->kind == duckLispBake_kind_greater));
+		(void) snprintf(condition, sizeof(condition), "(left == 0) || (top - base < %ld) || (top >= limit)", (long) depth);
+		duckLispBake_writeExit(file, condition, offset);
+		/* Like the interpreter, the result starts as a copy of the first operand. Other type combinations are left to
+		   the interpreter. */
+		fprintf(file,
+		        "\tif ((top[-%ld].type == duckVM_object_type_integer) && (top[-%ld].type == duckVM_object_type_integer)) {\n",
+		        (long) a,
+		        (long) b);
+		fprintf(file, "\t\t*top = top[-%ld];\n", (long) a);
+		if (comparison) {
+			fprintf(file,
+			        "\t\ttop->value.boolean = top[-%ld].value.integer %s top[-%ld].value.integer;\n",
+			        (long) a,
+			        operator,
+			        (long) b);
+			fprintf(file, "\t\ttop->type = duckVM_object_type_bool;\n");
+		}
+		else {
+			/* Unsigned, so that overflow wraps. */
+			fprintf(file,
+			        "\t\ttop->value.integer = (dl_ptrdiff_t) ((dl_size_t) top[-%ld].value.integer %s (dl_size_t) top[-%ld].value.integer);\n",
+			        (long) a,
+			        operator,
+			        (long) b);
+		}
+		fprintf(file, "\t}\n");
+		fprintf(file,
+		        "\telse if ((top[-%ld].type == duckVM_object_type_float) && (top[-%ld].type == duckVM_object_type_float)) {\n",
+		        (long) a,
+		        (long) b);
+		fprintf(file, "\t\t*top = top[-%ld];\n", (long) a);
+		if (comparison) {
+			fprintf(file,
+			        "\t\ttop->value.boolean = top[-%ld].value.floatingPoint %s top[-%ld].value.floatingPoint;\n",
+			        (long) a,
+			        operator,
+			        (long) b);
+			fprintf(file, "\t\ttop->type = duckVM_object_type_bool;\n");
+		}
+		else {
+			fprintf(file,
+			        "\t\ttop->value.floatingPoint = top[-%ld].value.floatingPoint %s top[-%ld].value.floatingPoint;\n",
+			        (long) a,
+			        operator,
+			        (long) b);
+		}
+		fprintf(file, "\t}\n");
+		fprintf(file, "\telse {\n");
+		fprintf(file, "\t\tnext = %lu;\n", (unsigned long) offset);
+		fprintf(file, "\t\tgoto leave;\n");
+		fprintf(file, "\t}\n");
+		fprintf(file, "\t--left;\n");
+		/**/ duckLispBake_writePush(file);
+		break;
+	}
+
+	case duckLispBake_kind_jump:
+		duckLispBake_writeExit(file, "left == 0", offset);
+		fprintf(file, "\t--left;\n");
+		fprintf(file, "\tgoto l%ld;\n", (long) instruction->target);
+		break;
+
+	case duckLispBake_kind_brnz:
+		(void) snprintf(condition, sizeof(condition), "(left == 0) || (top - base < 1) || (top - bottom < %ld)", (long) a);
+		duckLispBake_writeExit(file, condition, offset);
+		/* Truthiness of the types that loops usually test. The interpreter handles the rest. */
+		fprintf(file, "\tswitch (top[-1].type) {\n");
+		fprintf(file, "\tcase duckVM_object_type_bool:\n");
+		fprintf(file, "\t\ttruthy = top[-1].value.boolean;\n");
+		fprintf(file, "\t\tbreak;\n");
+		fprintf(file, "\tcase duckVM_object_type_integer:\n");
+		fprintf(file, "\t\ttruthy = top[-1].value.integer != 0;\n");
+		fprintf(file, "\t\tbreak;\n");
+		fprintf(file, "\tcase duckVM_object_type_float:\n");
+		fprintf(file, "\t\ttruthy = top[-1].value.floatingPoint != 0.0;\n");
+		fprintf(file, "\t\tbreak;\n");
+		fprintf(file, "\tcase duckVM_object_type_list:\n");
+		fprintf(file, "\t\ttruthy = top[-1].value.list != dl_null;\n");
+		fprintf(file, "\t\tbreak;\n");
+		fprintf(file, "\tdefault:\n");
+		fprintf(file, "\t\tnext = %lu;\n", (unsigned long) offset);
+		fprintf(file, "\t\tgoto leave;\n");
+		fprintf(file, "\t}\n");
+		fprintf(file, "\t--left;\n");
+		fprintf(file, "\ttop -= %ld;\n", (long) a);
+		fprintf(file, "\tupvalueTop -= %ld;\n", (long) a);
+		fprintf(file, "\tif (truthy) goto l%ld;\n", (long) instruction->target);
+		break;
+	}
+}
+
+static dl_bool_t duckLispBake_hasEntries(const duckLispBake_translation_t *translation, const dl_size_t closure) {
+	DL_DOTIMES(offset, translation->bytecode_length) {
+		const duckLispBake_instruction_t *instruction = &translation->instructions[offset];
+		if (translation->starts[offset] && instruction->entry && (instruction->closure == (dl_ptrdiff_t) closure)) {
+			return dl_true;
+		}
+	}
+	return dl_false;
+}
+
+/* Write one function per closure. Each starts at whichever of its entries the VM asked for, and returns the offset the
+   interpreter continues at through `*ip`. */
+static void duckLispBake_writeClosure(FILE *file,
+                                      const char *name,
+                                      const duckLispBake_translation_t *translation,
+                                      const dl_size_t closure) {
+	const dl_size_t bytecode_length = translation->bytecode_length;
+	dl_ptrdiff_t fallthrough = -1;
+
+	fprintf(file,
+	        "static void %s_closure%lu(duckVM_t *duckVM, %s_native_t *native, dl_uint8_t **ip, dl_size_t *budget) {\n",
+	        name,
+	        (unsigned long) closure,
+	        name);
+	fprintf(file, "\tdl_array_t *stack = &duckVM->stack;\n");
+	fprintf(file, "\tdl_array_t *upvalueStack = &duckVM->upvalue_stack;\n");
+	fprintf(file, "\tduckVM_object_t *base = (duckVM_object_t *) stack->elements;\n");
+	fprintf(file, "\tduckVM_object_t *top = base + stack->elements_length;\n");
+	fprintf(file, "\tduckVM_object_t **upvalueTop = (duckVM_object_t **) upvalueStack->elements + upvalueStack->elements_length;\n");
+	fprintf(file, "\t/* The stacks are pushed and popped together. Pushes stop short of growing either one. */\n");
+	fprintf(file, "\tconst dl_size_t stackRoom = stack->elements_memorySize / sizeof(duckVM_object_t) - stack->elements_length;\n");
+	fprintf(file, "\tconst dl_size_t upvalueRoom = (upvalueStack->elements_memorySize / sizeof(duckVM_object_t *)\n");
+	fprintf(file, "\t                               - upvalueStack->elements_length);\n");
+	fprintf(file, "\tduckVM_object_t *const limit = top + ((stackRoom < upvalueRoom) ? stackRoom : upvalueRoom);\n");
+	fprintf(file, "\tduckVM_object_t *const bottom = top - ((stack->elements_length < upvalueStack->elements_length)\n");
+	fprintf(file, "\t                                       ? stack->elements_length\n");
+	fprintf(file, "\t                                       : upvalueStack->elements_length);\n");
+	fprintf(file, "\tdl_size_t left = *budget;\n");
+	fprintf(file, "\tdl_size_t next = *ip - native->bytecode;\n");
+	fprintf(file, "\tdl_bool_t truthy = dl_false;\n");
+	fprintf(file, "\t/* Not every closure uses all of these. */\n");
+	fprintf(file, "\t(void) base;\n");
+	fprintf(file, "\t(void) limit;\n");
+	fprintf(file, "\t(void) bottom;\n");
+	fprintf(file, "\t(void) truthy;\n");
+	fprintf(file, "\n");
+	fprintf(file, "\tswitch (next) {\n");
+	DL_DOTIMES(offset, bytecode_length) {
+		const duckLispBake_instruction_t *instruction = &translation->instructions[offset];
+		if (!translation->starts[offset] || !instruction->entry) continue;
+		if (instruction->closure != (dl_ptrdiff_t) closure) continue;
+		fprintf(file, "\tcase %lu:\n", (unsigned long) offset);
+		fprintf(file, "\t\tgoto l%lu;\n", (unsigned long) offset);
+	}
+	fprintf(file, "\tdefault:\n");
+	fprintf(file, "\t\tgoto leave;\n");
+	fprintf(file, "\t}\n");
+
+	DL_DOTIMES(offset, bytecode_length) {
+		const duckLispBake_instruction_t *instruction = &translation->instructions[offset];
+		if (!translation->starts[offset] || (instruction->closure != (dl_ptrdiff_t) closure)) continue;
+		/* The next instruction belongs to another closure, so the interpreter runs it. */
+		if ((fallthrough >= 0) && (fallthrough != (dl_ptrdiff_t) offset)) {
+			fprintf(file, "\tnext = %lu;\n", (unsigned long) fallthrough);
+			fprintf(file, "\tgoto leave;\n");
+			fallthrough = -1;
+		}
+		/* Instructions that are only reached from untranslated code are left out. */
+		if (!instruction->reached) continue;
+		fprintf(file, "\n");
+		if (instruction->label) fprintf(file, " l%lu:\n", (unsigned long) offset);
+		/**/ duckLispBake_writeInstruction(file, name, instruction, offset);
+		fallthrough = (((instruction->kind == duckLispBake_kind_interpret) || !instruction->fallsThrough)
+		               ? -1
+		               : (dl_ptrdiff_t) (offset + instruction->length));
+	}
+	if (fallthrough >= 0) {
+		fprintf(file, "\tnext = %lu;\n", (unsigned long) fallthrough);
+	}
+
+	fprintf(file, "\n");
+	fprintf(file, " leave:\n");
+	fprintf(file, "\tstack->elements_length = top - base;\n");
+	fprintf(file, "\tupvalueStack->elements_length = upvalueTop - (duckVM_object_t **) upvalueStack->elements;\n");
+	fprintf(file, "\t*budget = left;\n");
+	fprintf(file, "\t*ip = native->bytecode + next;\n");
+	fprintf(file, "}\n");
+	fprintf(file, "\n");
+}
+
+/* Write the JIT that hands the baked bytecode's closures to their translations. */
+static void duckLispBake_writeTranslation(FILE *file,
+                                          const char *name,
+                                          const duckLispBake_translation_t *translation) {
+	const dl_size_t bytecode_length = translation->bytecode_length;
+	dl_size_t written = 0;
+
+	fprintf(file, "\n");
+	fprintf(file, "/* Translation */\n");
+	fprintf(file, "\n");
+	fprintf(file, "typedef struct {\n");
+	fprintf(file, "\tduckVM_native_t native;\n");
+	fprintf(file, "\tdl_uint8_t *bytecode;\n");
+	fprintf(file, "\t/* Index into the VM's globals of each global read by the translation, or -1 until it is first read. */\n");
+	fprintf(file, "\tdl_ptrdiff_t globals[%lu];\n", (unsigned long) (translation->globals_length + 1));
+	fprintf(file, "} %s_native_t;\n", name);
+	fprintf(file, "\n");
+	fprintf(file, "/* Offsets that the VM can enter the translation at. */\n");
+	fprintf(file, "static dl_size_t %s_entries[] = {", name);
+	DL_DOTIMES(offset, bytecode_length) {
+		if (!translation->starts[offset] || !translation->instructions[offset].entry) continue;
+		if (written % 8 == 0) fprintf(file, "\n\t");
+		else putc(' ', file);
+		fprintf(file, "%lu,", (unsigned long) offset);
+		written++;
+	}
+	if (written == 0) fprintf(file, "\n\t0,");
+	fprintf(file, "\n};\n");
+	fprintf(file, "\n");
+	if (translation->globals_used) {
+		fprintf(file, "/* Globals are never removed from the VM, so an index stays valid once found. */\n");
+		fprintf(file, "static dl_bool_t %s_global(duckVM_t *duckVM, dl_ptrdiff_t *index, const dl_ptrdiff_t key) {\n", name);
+		fprintf(file, "\tif (*index >= 0) return dl_true;\n");
+		fprintf(file, "\tDL_DOTIMES(i, duckVM->globals_map.elements_length) {\n");
+		fprintf(file, "\t\tif (DL_ARRAY_GETADDRESS(duckVM->globals_map, dl_ptrdiff_t, i) == key) {\n");
+		fprintf(file, "\t\t\t*index = i;\n");
+		fprintf(file, "\t\t\treturn dl_true;\n");
+		fprintf(file, "\t\t}\n");
+		fprintf(file, "\t}\n");
+		fprintf(file, "\treturn dl_false;\n");
+		fprintf(file, "}\n");
+		fprintf(file, "\n");
+	}
+
+	DL_DOTIMES(i, translation->closures.elements_length) {
+		const dl_size_t closure = DL_ARRAY_GETADDRESS(translation->closures, dl_size_t, i);
+		if ((i > 0) && (closure == DL_ARRAY_GETADDRESS(translation->closures, dl_size_t, i - 1))) continue;
+		if (!duckLispBake_hasEntries(translation, closure)) continue;
+		/**/ duckLispBake_writeClosure(file, name, translation, closure);
+	}
+
+	fprintf(file,
+	        "static dl_error_t %s_compile(void *data,\n"
+	        "                             duckVM_t *duckVM,\n"
+	        "                             duckVM_object_t *bytecode,\n"
+	        "                             dl_uint8_t *ip,\n"
+	        "                             duckVM_native_t **native) {\n",
+	        name);
+	fprintf(file, "\tdl_error_t e = dl_error_ok;\n");
+	fprintf(file, "\t%s_native_t *translation = dl_null;\n", name);
+	fprintf(file, "\tdl_uint8_t *instructions = bytecode->value.bytecode.bytecode;\n");
+	fprintf(file, "\t(void) data;\n");
+	fprintf(file, "\n");
+	fprintf(file, "\t*native = dl_null;\n");
+	fprintf(file, "\t/* Only the baked bytecode was translated. The VM asks for its first instruction before running it, which is the\n");
+	fprintf(file, "\t   only time its copy is sure to match. Later it may have been rewritten. */\n");
+	fprintf(file, "\tif ((ip != instructions) || (bytecode->value.bytecode.bytecode_length != %s_bytecode_length)) return e;\n", name);
+	fprintf(file, "\tDL_DOTIMES(i, %s_bytecode_length) {\n", name);
+	fprintf(file, "\t\tif (instructions[i] != %s_bytecode[i]) return e;\n", name);
+	fprintf(file, "\t}\n");
+	fprintf(file, "\te = DL_MALLOC(duckVM->memoryAllocation, &translation, 1, %s_native_t);\n", name);
+	fprintf(file, "\tif (e) return e;\n");
+	fprintf(file, "\ttranslation->native.next = dl_null;\n");
+	fprintf(file, "\ttranslation->native.entries = %s_entries;\n", name);
+	fprintf(file, "\ttranslation->native.entries_length = %lu;\n", (unsigned long) translation->entries_length);
+	fprintf(file, "\ttranslation->bytecode = instructions;\n");
+	fprintf(file, "\tDL_DOTIMES(i, %lu) {\n", (unsigned long) (translation->globals_length + 1));
+	fprintf(file, "\t\ttranslation->globals[i] = -1;\n");
+	fprintf(file, "\t}\n");
+	fprintf(file, "\t*native = &translation->native;\n");
+	fprintf(file, "\treturn e;\n");
+	fprintf(file, "}\n");
+	fprintf(file, "\n");
+
+	fprintf(file,
+	        "static void %s_run(void *data, duckVM_t *duckVM, duckVM_native_t *native, dl_uint8_t **ip, dl_size_t *budget) {\n",
+	        name);
+	fprintf(file, "\t%s_native_t *translation = (%s_native_t *) native;\n", name, name);
+	fprintf(file, "\t(void) data;\n");
+	if (translation->entries_length == 0) {
+		fprintf(file, "\t(void) duckVM;\n");
+		fprintf(file, "\t(void) budget;\n");
+	}
+	fprintf(file, "\tswitch (*ip - translation->bytecode) {\n");
+	DL_DOTIMES(i, translation->closures.elements_length) {
+		const dl_size_t closure = DL_ARRAY_GETADDRESS(translation->closures, dl_size_t, i);
+		dl_bool_t any = dl_false;
+		if ((i > 0) && (closure == DL_ARRAY_GETADDRESS(translation->closures, dl_size_t, i - 1))) continue;
+		DL_DOTIMES(offset, bytecode_length) {
+			const duckLispBake_instruction_t *instruction = &translation->instructions[offset];
+			if (!translation->starts[offset] || !instruction->entry) continue;
+			if (instruction->closure != (dl_ptrdiff_t) closure) continue;
+			fprintf(file, "\tcase %lu:\n", (unsigned long) offset);
+			any = dl_true;
+		}
+		if (any) {
+			fprintf(file, "\t\t%s_closure%lu(duckVM, translation, ip, budget);\n", name, (unsigned long) closure);
+			fprintf(file, "\t\tbreak;\n");
+		}
+	}
+	fprintf(file, "\tdefault:\n");
+	fprintf(file, "\t\tbreak;\n");
+	fprintf(file, "\t}\n");
+	fprintf(file, "}\n");
+	fprintf(file, "\n");
+
+	fprintf(file, "static void %s_free(void *data, duckVM_t *duckVM, duckVM_native_t *native) {\n", name);
+	fprintf(file, "\t%s_native_t *translation = (%s_native_t *) native;\n", name, name);
+	fprintf(file, "\t(void) data;\n");
+	fprintf(file, "\t(void) DL_FREE(duckVM->memoryAllocation, &translation);\n");
+	fprintf(file, "}\n");
+	fprintf(file, "\n");
+
+	fprintf(file, "duckVM_jit_t %s_jit = {%s_compile, %s_run, %s_free, dl_null, 1};\n", name, name, name, name);
+}
+
+static dl_error_t duckLispBake_writeFile(dl_memoryAllocation_t *memoryAllocation,
+                                         const char *fileName,
+                                         const char *name,
+                                         const char *inputFileName,
+                                         const dl_uint8_t *bytecode,
+                                         const dl_size_t bytecode_length,
+                                         const dl_array_t *symbols) {
+	dl_error_t e = dl_error_ok;
+	dl_error_t eError = dl_error_ok;
+
+	duckLispBake_translation_t translation;
+	dl_bool_t translation_initialized = dl_false;
+	FILE *file = NULL;
+
+	e = duckLispBake_translation_init(&translation, memoryAllocation, bytecode, bytecode_length);
+	translation_initialized = dl_true;
+	if (e) goto cleanup;
+
+	file = fopen(fileName, "w");
+	if (file == NULL) {
+		perror("duckLisp-bake: Could not open output file");
+		e = dl_error_invalidValue;
+		goto cleanup;
+	}
+
+	fprintf(file, "/* Generated by duckLisp-bake from \"%s\". Do not edit.\n", inputFileName);
+	fprintf(file, "\n");
+	fprintf(file, "   extern dl_uint8_t %s_bytecode[];\n", name);
+	fprintf(file, "   extern const dl_size_t %s_bytecode_length;\n", name);
+	fprintf(file, "   extern const char *const %s_symbols[];\n", name);
+	fprintf(file, "   extern const dl_size_t %s_symbols_length;\n", name);
+	fprintf(file, "   extern duckVM_jit_t %s_jit; */\n", name);
+	fprintf(file, "\n");
+	fprintf(file, "#include \"DuckLib/array.h\"\n");
+	fprintf(file, "#include \"DuckLib/core.h\"\n");
+	fprintf(file, "#include \"DuckLib/memory.h\"\n");
+	fprintf(file, "#include \"duckVM.h\"\n");
+	fprintf(file, "\n");
+	fprintf(file, "dl_uint8_t %s_bytecode[] = {", name);
+	DL_DOTIMES(i, bytecode_length) {
+		if (i % 16 == 0) fprintf(file, "\n\t");
+		else putc(' ', file);
+		fprintf(file, "0x%02X,", bytecode[i]);
+	}
+	fprintf(file, "\n};\n");
+	fprintf(file, "const dl_size_t %s_bytecode_length = sizeof(%s_bytecode);\n", name, name);
+	fprintf(file, "\n");
+	fprintf(file,
+	        "/* Symbol names indexed by symbol ID, followed by `dl_null`. Globals and C callbacks are keyed by these IDs. */\n");
+	fprintf(file, "const char *const %s_symbols[] = {\n", name);
+	DL_DOTIMES(i, symbols->elements_length) {
+		duckLisp_ast_identifier_t symbol = DL_ARRAY_GETADDRESS(*symbols, duckLisp_ast_identifier_t, i);
+		putc('\t', file);
+		duckLispBake_writeString(file, symbol.value, symbol.value_length);
+		fprintf(file, ",\n");
+	}
+	fprintf(file, "\tdl_null\n};\n");
+	fprintf(file, "const dl_size_t %s_symbols_length = %lu;\n", name, (unsigned long) symbols->elements_length);
+	/**/ duckLispBake_writeTranslation(file, name, &translation);
+
+	if (ferror(file)) {
+		perror("duckLisp-bake: Could not write output file");
+		e = dl_error_invalidValue;
+		goto cleanup;
+	}
+
+ cleanup:
+	if ((file != NULL) && fclose(file)) {
+		perror("duckLisp-bake: Could not close output file");
+		e = dl_error_invalidValue;
+	}
+	if (translation_initialized) {
+		eError = duckLispBake_translation_quit(&translation, memoryAllocation);
+		if (eError) e = eError;
+	}
+	return e;
+}
+
+int main(int argc, char *argv[]) {
+	dl_error_t e = dl_error_ok;
+
+	const size_t duckLispMemory_size = 64 * 1024 * 1024;
+	const size_t duckVMMaxObjects = 100000;
+
+	void *memory = NULL;
+	dl_memoryAllocation_t ma;
+	duckLisp_t duckLisp = {0};
+	dl_bool_t duckLisp_initialized = dl_false;
+	dl_array_t text;
+	dl_bool_t text_initialized = dl_false;
+	unsigned char *bytecode = NULL;
+	dl_size_t bytecode_length = 0;
+	dl_bool_t inference = dl_false;
+
+	int arg = 1;
+	if ((arg < argc) && !strcmp(argv[arg], "-i")) {
+		inference = dl_true;
+		arg++;
+	}
+	if (argc - arg < 3) {
+		fprintf(stderr, "Usage: %s [-i] <name> <input file> <output file> [callback[:type] ...]\n", argv[0]);
+		e = dl_error_invalidValue;
+		goto cleanup;
+	}
+	const char *name = argv[arg++];
+	const char *inputFileName = argv[arg++];
+	const char *outputFileName = argv[arg++];
+#ifndef USE_PARENTHESIS_INFERENCE
+	if (inference) {
+		fprintf(stderr, "duckLisp-bake: Built without parenthesis inference. Ignoring \"-i\".\n");
+	}
+#endif /* USE_PARENTHESIS_INFERENCE */
+
+	memory = malloc(duckLispMemory_size);
+	if (memory == NULL) {
+		e = dl_error_outOfMemory;
+		perror("duckLisp-bake: malloc failed");
+		goto cleanup;
+	}
+
+	e = dl_memory_init(&ma, memory, duckLispMemory_size, dl_memoryFit_best);
+	if (e) {
+		fprintf(stderr, "duckLisp-bake: Memory allocation initialization failed.\n");
+		goto cleanup;
+	}
+
+	e = duckLisp_init(&duckLisp,
+	                  &ma,
+	                  duckVMMaxObjects
+#ifdef USE_PARENTHESIS_INFERENCE
+	                  ,
+	                  duckVMMaxObjects
+#endif /* USE_PARENTHESIS_INFERENCE */
+	                  );
+	if (e) {
+		fprintf(stderr, "duckLisp-bake: Compiler initialization failed.\n");
+		goto cleanup;
+	}
+	duckLisp_initialized = dl_true;
+
+	for (; arg < argc; arg++) {
+		char *callback = argv[arg];
+		char *type = strchr(callback, ':');
+		size_t callback_length = (type == NULL) ? strlen(callback) : (size_t) (type - callback);
+		if (type != NULL) type++;
+#ifndef USE_PARENTHESIS_INFERENCE
+		(void) type;
+#endif /* USE_PARENTHESIS_INFERENCE */
+		e = duckLisp_linkCFunction(&duckLisp,
+		                           duckLispBake_callback_unavailable,
+		                           (dl_uint8_t *) callback,
+		                           callback_length
+#ifdef USE_PARENTHESIS_INFERENCE
+		                           ,
+		                           (dl_uint8_t *) type,
+		                           (type == NULL) ? 0 : strlen(type)
+#endif /* USE_PARENTHESIS_INFERENCE */
+		                           );
+		if (e) {
+			fprintf(stderr, "duckLisp-bake: Could not link callback \"%s\". (%s)\n", callback, (const char *) dl_errorString[e]);
+			goto cleanup;
+		}
+	}
+
+	/**/ dl_array_init(&text, &ma, sizeof(char), dl_array_strategy_double);
+	text_initialized = dl_true;
+	e = duckLispBake_readFile(&text, inputFileName);
+	if (e) goto cleanup;
+
+	e = duckLisp_loadString(&duckLisp,
+#ifdef USE_PARENTHESIS_INFERENCE
+	                        inference,
+#endif /* USE_PARENTHESIS_INFERENCE */
+	                        &bytecode,
+	                        &bytecode_length,
+	                        text.elements,
+	                        text.elements_length,
+	                        (const dl_uint8_t *) inputFileName,
+	                        strlen(inputFileName));
+	if (e) {
+		fprintf(stderr, "duckLisp-bake: Compilation failed.\n");
+		duckLispBake_printErrors(duckLisp.errors);
+		goto cleanup;
+	}
+
+	e = duckLispBake_writeFile(&ma,
+	                           outputFileName,
+	                           name,
+	                           inputFileName,
+	                           bytecode,
+	                           bytecode_length,
+	                           &duckLisp.symbols_array);
+	if (e) goto cleanup;
+
+ cleanup:
+	if (bytecode != NULL) (void) DL_FREE(&ma, &bytecode);
+	if (text_initialized) (void) dl_array_quit(&text);
+	if (duckLisp_initialized) (void) duckLisp_quit(&duckLisp);
+	free(memory);
+	return e;
+}
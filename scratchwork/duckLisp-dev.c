@@ -32,6 +32,9 @@ SOFTWARE.
 #include "../DuckLib/sort.h"
 #include "../parser.h"
 #include "DuckLib/string.h"
+#ifdef USE_JIT
+#include "../jit.h"
+#endif /* USE_JIT */
 
 
 #define COLOR_NORMAL    "\x1B[0m"
@@ -1321,6 +1324,9 @@ int main(int argc, char *argv[]) {
 	dl_size_t tempDlSize;
 
 	duckVM_t duckVM;
+#ifdef USE_JIT
+	duckJit_t jit;
+#endif /* USE_JIT */
 
 	// All user-defined generators go here.
 	struct {
@@ -1496,6 +1502,11 @@ int main(int argc, char *argv[]) {
 	}
 	d.duckVM_init = dl_true;
 
+#ifdef USE_JIT
+	/**/ duckJit_init(&jit, 100);
+	/**/ duckVM_linkJit(&duckVM, &jit.jit);
+#endif /* USE_JIT */
+
 	for (dl_ptrdiff_t i = 0; callbacks[i].name != dl_null; i++) {
 		e = duckVM_linkCFunction(&duckVM,
 		                         duckLisp_symbol_nameToValue(&duckLisp, callbacks[i].name, callbacks[i].name_length),
@@ -36,6 +36,9 @@ SOFTWARE.
 #include "DuckLib/array.h"
 #include "DuckLib/core.h"
 #include "DuckLib/memory.h"
+#ifdef USE_JIT
+#include "../jit.h"
+#endif /* USE_JIT */
 
 
 #define COLOR_NORMAL    "\x1B[0m"
@@ -415,6 +418,129 @@ void printErrors(dl_array_t errors) {
 	printf(COLOR_NORMAL);
 }
 
+/* A map pool that runs each chunk in turn on the calling thread. It covers the chunking and copying done by
+   `parallel-map` without needing threads. */
+#define TEST_MAP_POOL_WORKERS 3
+typedef struct {
+	duckVM_mapPool_t mapPool;
+	duckVM_t workers[TEST_MAP_POOL_WORKERS];
+} testMapPool_t;
+
+dl_error_t testMapPool_run(void *data, duckVM_mapChunk_t *chunks, dl_size_t chunks_length) {
+	testMapPool_t *pool = data;
+	if (chunks_length > TEST_MAP_POOL_WORKERS) return dl_error_invalidValue;
+	DL_DOTIMES(i, chunks_length) {
+		/* The error is stored in the chunk. */
+		(void) duckVM_mapChunk(&pool->workers[i], &pool->mapPool, &chunks[i]);
+	}
+	return dl_error_ok;
+}
+
+/* Run the bytecode in a fresh VM and check that it returns true. A budget of `DUCKVM_BUDGET_UNLIMITED` runs it with
+   `duckVM_execute`. Any other budget runs it in slices of that many instructions. If `withMapPool` is set, the
+   bytecode is run as a shared program with a map pool linked, since only closures from shared programs can be sent to
+   the pool's workers. If `jit` isn't null, it is linked into the VM. */
+dl_error_t runBytecode(dl_memoryAllocation_t *ma,
+                       const size_t maxObjects,
+                       unsigned char *bytecode,
+                       const dl_size_t bytecode_length,
+                       const dl_size_t budget,
+                       const dl_bool_t withMapPool,
+                       duckVM_jit_t *jit) {
+	dl_error_t e = dl_error_ok;
+	dl_error_t eError = dl_error_ok;
+
+	duckVM_t duckVM = {0};
+	duckVM_mailbox_t mailbox = {0};
+	duckVM_object_type_t objectType;
+	duckVM_halt_mode_t halt = duckVM_halt_mode_halt;
+	duckVM_program_t *program = dl_null;
+	testMapPool_t mapPool;
+	dl_size_t workersInitialized = 0;
+
+	/**/ duckVM_mailbox_init(&mailbox, ma);
+
+	e = duckVM_init(&duckVM, ma, maxObjects);
+	if (e) {
+		puts(COLOR_YELLOW "VM initialization failed" COLOR_NORMAL);
+		goto cleanup;
+	}
+
+	if (jit != dl_null) duckVM_linkJit(&duckVM, jit);
+
+	/* Channel 0 loops back to the test itself. */
+	e = duckVM_linkChannel(&duckVM, 0, &mailbox);
+	if (e) goto cleanup;
+
+	if (withMapPool) {
+		mapPool.mapPool.run = testMapPool_run;
+		mapPool.mapPool.data = &mapPool;
+		mapPool.mapPool.workers = TEST_MAP_POOL_WORKERS;
+		mapPool.mapPool.memoryAllocation = ma;
+		for (; workersInitialized < TEST_MAP_POOL_WORKERS; workersInitialized++) {
+			e = duckVM_init(&mapPool.workers[workersInitialized], ma, maxObjects);
+			if (e) {
+				puts(COLOR_YELLOW "Worker VM initialization failed" COLOR_NORMAL);
+				goto cleanup;
+			}
+		}
+		/**/ duckVM_linkMapPool(&duckVM, &mapPool.mapPool);
+
+		e = duckVM_program_init(&program, ma, bytecode, bytecode_length);
+		if (e) goto cleanup;
+		e = duckVM_executeProgram(&duckVM, program, budget, &halt);
+	}
+	else if (budget == DUCKVM_BUDGET_UNLIMITED) {
+		e = duckVM_execute(&duckVM, bytecode, bytecode_length);
+	}
+	else {
+		e = duckVM_executeBudgeted(&duckVM, bytecode, bytecode_length, budget, &halt);
+	}
+	while (!e && (halt == duckVM_halt_mode_suspend)) {
+		e = duckVM_resume(&duckVM, budget, &halt);
+	}
+	if (e) {
+		if (jit != dl_null) printf(COLOR_YELLOW "Execution failed with the JIT and a budget of %lu" COLOR_NORMAL "\n",
+		                           (unsigned long) budget);
+		else if (withMapPool) puts(COLOR_YELLOW "Execution failed with a map pool" COLOR_NORMAL);
+		else if (budget == DUCKVM_BUDGET_UNLIMITED) puts(COLOR_YELLOW "Execution failed" COLOR_NORMAL);
+		else printf(COLOR_YELLOW "Execution failed with a budget of %lu" COLOR_NORMAL "\n", (unsigned long) budget);
+
+		printErrors(duckVM.errors);
+
+		goto cleanup;
+	}
+
+	e = duckVM_typeOf(&duckVM, &objectType);
+	if (e) goto cleanup;
+	if (objectType == duckVM_object_type_bool) {
+		dl_bool_t returnedBoolean;
+		e = duckVM_copyBoolean(&duckVM, &returnedBoolean);
+		if (e) goto cleanup;
+		if (!returnedBoolean) {
+			e = dl_error_invalidValue;
+			puts(COLOR_YELLOW "Test returned \"fail\"" COLOR_NORMAL);
+		}
+	}
+	else {
+		e = dl_error_invalidValue;
+		printf(COLOR_YELLOW "Test didn't return a boolean. type: %i\n" COLOR_NORMAL, objectType);
+	}
+	/* Pop return value. */
+	eError = duckVM_pop(&duckVM);
+	if (eError) e = eError;
+
+ cleanup:
+	(void) duckVM_quit(&duckVM);
+	DL_DOTIMES(i, workersInitialized) {
+		(void) duckVM_quit(&mapPool.workers[i]);
+	}
+	if (program != dl_null) (void) duckVM_program_release(program);
+	(void) duckVM_mailbox_quit(&mailbox);
+
+	return e;
+}
+
 dl_error_t runTest(const unsigned char *fileBaseName, dl_uint8_t *text, size_t text_length) {
 	dl_error_t e = dl_error_ok;
 
@@ -426,9 +552,6 @@ dl_error_t runTest(const unsigned char *fileBaseName, dl_uint8_t *text, size_t t
 	duckLisp_t duckLisp = {0};
 	unsigned char *bytecode = NULL;
 	dl_size_t bytecode_length;
-	duckVM_t duckVM = {0};
-	duckVM_object_type_t objectType;
-
 	memory = malloc(duckLispMemory_size);
 	if (memory == NULL) {
 		e = dl_error_outOfMemory;
@@ -473,42 +596,28 @@ dl_error_t runTest(const unsigned char *fileBaseName, dl_uint8_t *text, size_t t
 		goto cleanup;
 	}
 
-	e = duckVM_init(&duckVM, &ma, duckVMMaxObjects);
-	if (e) {
-		puts(COLOR_YELLOW "VM initialization failed" COLOR_NORMAL);
-		goto cleanup;
-	}
-
-	e = duckVM_execute(&duckVM, bytecode, bytecode_length);
-	if (e) {
-		puts(COLOR_YELLOW "Execution failed" COLOR_NORMAL);
-
-		printErrors(duckVM.errors);
-
-		goto cleanup;
-	}
-
-	e = duckVM_typeOf(&duckVM, &objectType);
+	/* Run once to completion, once in short slices so that every test also exercises suspending and resuming the VM,
+	   and once more as a shared program with a map pool. */
+	e = runBytecode(&ma, duckVMMaxObjects, bytecode, bytecode_length, DUCKVM_BUDGET_UNLIMITED, dl_false, dl_null);
 	if (e) goto cleanup;
-	if (objectType == duckVM_object_type_bool) {
-		dl_bool_t returnedBoolean;
-		e = duckVM_copyBoolean(&duckVM, &returnedBoolean);
+	e = runBytecode(&ma, duckVMMaxObjects, bytecode, bytecode_length, 7, dl_false, dl_null);
+	if (e) goto cleanup;
+	e = runBytecode(&ma, duckVMMaxObjects, bytecode, bytecode_length, 7, dl_true, dl_null);
+	if (e) goto cleanup;
+#ifdef USE_JIT
+	/* Compile everything the first time it's entered, and run it both to completion and in slices so that native code
+	   also runs out of budget. */
+	{
+		duckJit_t jit;
+		/**/ duckJit_init(&jit, 1);
+		e = runBytecode(&ma, duckVMMaxObjects, bytecode, bytecode_length, DUCKVM_BUDGET_UNLIMITED, dl_false, &jit.jit);
+		if (e) goto cleanup;
+		e = runBytecode(&ma, duckVMMaxObjects, bytecode, bytecode_length, 7, dl_false, &jit.jit);
 		if (e) goto cleanup;
-		if (returnedBoolean) {
-			printf(COLOR_GREEN "PASS" COLOR_NORMAL " %s\n" , fileBaseName);
-		}
-		else {
-			e = dl_error_invalidValue;
-			puts(COLOR_YELLOW "Test returned \"fail\"" COLOR_NORMAL);
-		}
-	}
-	else {
-		e = dl_error_invalidValue;
-		printf(COLOR_YELLOW "Test didn't return a boolean. type: %i\n" COLOR_NORMAL, objectType);
 	}
-	/* Pop return value. */
-	e = duckVM_pop(&duckVM);
-	if (e) goto cleanup;
+#endif /* USE_JIT */
+
+	printf(COLOR_GREEN "PASS" COLOR_NORMAL " %s\n" , fileBaseName);
 
  cleanup:
 
@@ -521,7 +630,6 @@ dl_error_t runTest(const unsigned char *fileBaseName, dl_uint8_t *text, size_t t
 		printf(COLOR_RED "FAIL" COLOR_NORMAL " %s\n", fileBaseName);
 	}
 
-	(void) duckVM_quit(&duckVM);
 	(void) duckLisp_quit(&duckLisp);
 	(void) dl_memory_quit(&ma);
 	(void) free(memory);
@@ -0,0 +1,270 @@
+/*
+MIT License
+
+Copyright (c) 2023 Joseph Herguth
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+/* Run one script in many VMs at once through the scheduler.
+
+   Usage: scheduler-dev <input file> [VMs] [threads] [budget]
+
+   The script is compiled once into a shared program that every VM runs without copying. Each VM gets its own heap. Channel 0 is a mailbox shared by every VM. `parallel-map` runs on a pool with one worker per thread. Prints the result of the first VM and how many VMs returned an integer. */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "../duckLisp.h"
+#include "../duckVM.h"
+#include "../scheduler.h"
+#include "DuckLib/core.h"
+#include "DuckLib/memory.h"
+
+typedef struct {
+	void *memory;
+	dl_memoryAllocation_t ma;
+	duckVM_t duckVM;
+	dl_bool_t duckVM_initialized;
+	duckScheduler_task_t task;
+	dl_error_t e;
+	dl_bool_t integer;
+	dl_ptrdiff_t result;
+} schedulerDev_job_t;
+
+static void schedulerDev_printErrors(dl_array_t errors) {
+	DL_DOTIMES(i, errors.elements_length) {
+		putc(DL_ARRAY_GETADDRESS(errors, char, i), stderr);
+	}
+	putc('\n', stderr);
+}
+
+/* Runs on a worker thread. Only touches its own job. */
+static void schedulerDev_callback(duckScheduler_task_t *task, dl_error_t e) {
+	schedulerDev_job_t *job = task->userData;
+	duckVM_object_type_t type;
+	job->e = e;
+	if (e) return;
+	if (duckVM_typeOf(&job->duckVM, &type)) return;
+	if (type != duckVM_object_type_integer) return;
+	if (duckVM_copySignedInteger(&job->duckVM, &job->result)) return;
+	job->integer = dl_true;
+}
+
+static dl_error_t schedulerDev_readFile(dl_array_t *text, const char *fileName) {
+	dl_error_t e = dl_error_ok;
+
+	FILE *file = fopen(fileName, "rb");
+	if (file == NULL) {
+		perror("scheduler-dev: Could not open input file");
+		e = dl_error_invalidValue;
+		goto cleanup;
+	}
+
+	while (1) {
+		int c = fgetc(file);
+		if (c == EOF) break;
+		char character = (char) c;
+		e = dl_array_pushElement(text, &character);
+		if (e) goto cleanup;
+	}
+
+ cleanup:
+	if (file != NULL) (void) fclose(file);
+	return e;
+}
+
+int main(int argc, char *argv[]) {
+	dl_error_t e = dl_error_ok;
+
+	const size_t duckLispMemory_size = 64 * 1024 * 1024;
+	const size_t jobMemory_size = 4 * 1024 * 1024;
+	const size_t duckVMMaxObjects = 10000;
+
+	void *memory = NULL;
+	dl_memoryAllocation_t ma;
+	duckLisp_t duckLisp = {0};
+	dl_bool_t duckLisp_initialized = dl_false;
+	dl_array_t text;
+	dl_bool_t text_initialized = dl_false;
+	unsigned char *bytecode = NULL;
+	dl_size_t bytecode_length = 0;
+	duckVM_program_t *program = dl_null;
+	duckScheduler_t scheduler;
+	dl_bool_t scheduler_initialized = dl_false;
+	duckVM_mailbox_t mailbox;
+	dl_bool_t mailbox_initialized = dl_false;
+	duckScheduler_mapPool_t mapPool;
+	dl_bool_t mapPool_initialized = dl_false;
+	schedulerDev_job_t *jobs = NULL;
+	size_t jobs_length = 100;
+	size_t threads = 4;
+	size_t budget = 10000;
+
+	if (argc < 2) {
+		fprintf(stderr, "Usage: %s <input file> [VMs] [threads] [budget]\n", argv[0]);
+		e = dl_error_invalidValue;
+		goto cleanup;
+	}
+	if (argc > 2) jobs_length = strtoul(argv[2], NULL, 10);
+	if (argc > 3) threads = strtoul(argv[3], NULL, 10);
+	if (argc > 4) budget = strtoul(argv[4], NULL, 10);
+
+	memory = malloc(duckLispMemory_size);
+	if (memory == NULL) {
+		e = dl_error_outOfMemory;
+		perror("scheduler-dev: malloc failed");
+		goto cleanup;
+	}
+	e = dl_memory_init(&ma, memory, duckLispMemory_size, dl_memoryFit_best);
+	if (e) goto cleanup;
+
+	e = duckLisp_init(&duckLisp,
+	                  &ma,
+	                  duckVMMaxObjects
+#ifdef USE_PARENTHESIS_INFERENCE
+	                  ,
+	                  0
+#endif /* USE_PARENTHESIS_INFERENCE */
+	                  );
+	if (e) goto cleanup;
+	duckLisp_initialized = dl_true;
+
+	/**/ dl_array_init(&text, &ma, sizeof(char), dl_array_strategy_double);
+	text_initialized = dl_true;
+	e = schedulerDev_readFile(&text, argv[1]);
+	if (e) goto cleanup;
+
+	e = duckLisp_loadString(&duckLisp,
+#ifdef USE_PARENTHESIS_INFERENCE
+	                        dl_false,
+#endif /* USE_PARENTHESIS_INFERENCE */
+	                        &bytecode,
+	                        &bytecode_length,
+	                        text.elements,
+	                        text.elements_length,
+	                        (const dl_uint8_t *) argv[1],
+	                        strlen(argv[1]));
+	if (e) {
+		fprintf(stderr, "scheduler-dev: Compilation failed.\n");
+		schedulerDev_printErrors(duckLisp.errors);
+		goto cleanup;
+	}
+
+	e = duckVM_program_init(&program, &ma, bytecode, bytecode_length);
+	if (e) {
+		fprintf(stderr, "scheduler-dev: Program initialization failed.\n");
+		goto cleanup;
+	}
+
+	jobs = calloc(jobs_length, sizeof(schedulerDev_job_t));
+	if (jobs == NULL) {
+		e = dl_error_outOfMemory;
+		perror("scheduler-dev: calloc failed");
+		goto cleanup;
+	}
+
+	e = duckScheduler_init(&scheduler, &ma, threads, jobs_length, budget);
+	if (e) {
+		fprintf(stderr, "scheduler-dev: Scheduler initialization failed.\n");
+		goto cleanup;
+	}
+	scheduler_initialized = dl_true;
+
+	/* Messages are allocated by whichever thread sends them, so this needs the default `malloc`-based allocator. */
+	e = duckScheduler_mailbox_init(&mailbox, &ma);
+	if (e) goto cleanup;
+	mailbox_initialized = dl_true;
+
+	/* Chunks are allocated on the workers' threads too. */
+	e = duckScheduler_mapPool_init(&mapPool, &ma, threads, duckVMMaxObjects);
+	if (e) {
+		fprintf(stderr, "scheduler-dev: Map pool initialization failed.\n");
+		goto cleanup;
+	}
+	mapPool_initialized = dl_true;
+
+	/* Every VM has its own allocator. DuckLib's allocator is not thread-safe. */
+	DL_DOTIMES(i, jobs_length) {
+		schedulerDev_job_t *job = &jobs[i];
+		job->memory = malloc(jobMemory_size);
+		if (job->memory == NULL) {
+			e = dl_error_outOfMemory;
+			perror("scheduler-dev: malloc failed");
+			goto cleanup;
+		}
+		e = dl_memory_init(&job->ma, job->memory, jobMemory_size, dl_memoryFit_best);
+		if (e) goto cleanup;
+		e = duckVM_init(&job->duckVM, &job->ma, duckVMMaxObjects);
+		if (e) goto cleanup;
+		job->duckVM_initialized = dl_true;
+		e = duckVM_linkChannel(&job->duckVM, 0, &mailbox);
+		if (e) goto cleanup;
+		/**/ duckVM_linkMapPool(&job->duckVM, &mapPool.mapPool);
+		job->task.duckVM = &job->duckVM;
+		job->task.program = program;
+		job->task.callback = schedulerDev_callback;
+		job->task.userData = job;
+		e = duckScheduler_submit(&scheduler, &job->task);
+		if (e) goto cleanup;
+	}
+
+	duckScheduler_wait(&scheduler);
+
+	{
+		size_t integers = 0;
+		dl_bool_t failed = dl_false;
+		DL_DOTIMES(i, jobs_length) {
+			schedulerDev_job_t *job = &jobs[i];
+			if (job->e) {
+				/* Every VM runs the same program, so one error message is enough. */
+				if (!failed) {
+					fprintf(stderr, "VM %li failed.\n", (long) i);
+					schedulerDev_printErrors(job->duckVM.errors);
+				}
+				failed = dl_true;
+			}
+			else if (job->integer) {
+				if (i == 0) printf("VM 0 returned %li.\n", (long) job->result);
+				integers++;
+			}
+		}
+		printf("%lu of %lu VMs returned integers.\n", (unsigned long) integers, (unsigned long) jobs_length);
+	}
+
+ cleanup:
+	if (scheduler_initialized) duckScheduler_quit(&scheduler);
+	if (jobs != NULL) {
+		DL_DOTIMES(i, jobs_length) {
+			if (jobs[i].duckVM_initialized) duckVM_quit(&jobs[i].duckVM);
+			free(jobs[i].memory);
+		}
+		free(jobs);
+	}
+	if (mapPool_initialized) duckScheduler_mapPool_quit(&mapPool);
+	if (mailbox_initialized) (void) duckScheduler_mailbox_quit(&mailbox);
+	/* Every VM has released its reference by now. */
+	if (program != dl_null) (void) duckVM_program_release(program);
+	if (bytecode != NULL) (void) DL_FREE(&ma, &bytecode);
+	if (text_initialized) (void) dl_array_quit(&text);
+	if (duckLisp_initialized) (void) duckLisp_quit(&duckLisp);
+	free(memory);
+	return e;
+}